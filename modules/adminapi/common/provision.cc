@@ -468,6 +468,11 @@ std::vector<mysqlshdk::mysql::Invalid_config> check_instance_config(
     const mysqlshdk::config::Config &config, Cluster_type cluster_type) {
   auto invalid_cfgs_vec = std::vector<mysqlshdk::mysql::Invalid_config>();
 
+  // server_id and log_bin are validated first, fetch them at once, variables
+  // required for GR are fetched by check_server_variables_compatibility()
+  const auto clear_prefetched = mysqlshdk::mysql::prefetch_server_variables(
+      config, {"server_id", "log_bin"});
+
   // validate server_id
   mysqlshdk::mysql::check_server_id_compatibility(instance, config,
                                                   &invalid_cfgs_vec);
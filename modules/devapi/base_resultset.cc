@@ -92,11 +92,11 @@ std::unique_ptr<mysqlsh::Row> ShellBaseResult::fetch_one_row() const {
   std::unique_ptr<mysqlsh::Row> ret_val;
 
   auto result = get_result();
-  auto columns = get_column_names();
-  if (result && columns) {
+  update_column_cache();
+  if (result && m_row_layout) {
     const mysqlshdk::db::IRow *row = result->fetch_one();
     if (row) {
-      ret_val = std::make_unique<mysqlsh::Row>(columns, *row);
+      ret_val = std::make_unique<mysqlsh::Row>(m_row_layout, *row);
     }
   }
 
@@ -118,6 +118,7 @@ std::shared_ptr<std::vector<std::string>> ShellBaseResult::get_column_names()
 void ShellBaseResult::reset_column_cache() const {
   m_columns.reset();
   m_column_names.reset();
+  m_row_layout.reset();
 }
 
 void ShellBaseResult::update_column_cache() const {
@@ -138,9 +139,43 @@ void ShellBaseResult::update_column_cache() const {
 
       m_column_names->push_back(column_meta.get_column_label());
     }
+
+    m_row_layout = std::make_shared<Row_layout>(m_column_names);
   }
 }
 
+Row_layout::Row_layout(std::shared_ptr<std::vector<std::string>> names)
+    : m_names(std::move(names)) {
+  assert(m_names);
+
+  // used to check if a field name clashes with members of the Row object
+  const Row row;
+
+  for (size_t i = 0, c = m_names->size(); i < c; ++i) {
+    const auto &name = m_names->at(i);
+
+    // only the first field with the given name can be accessed by name
+    if (!m_field_indexes.emplace(name, i).second) continue;
+
+    // Values would be available as properties if they are valid identifier
+    // and not base members like length and getField
+    if (shcore::is_valid_identifier(name) && !row.has_member(name)) {
+      m_property_indexes.emplace(name, i);
+      m_properties.emplace_back(name);
+    }
+  }
+}
+
+size_t Row_layout::field_index(const std::string &name) const {
+  const auto it = m_field_indexes.find(name);
+  return m_field_indexes.end() == it ? npos : it->second;
+}
+
+size_t Row_layout::property_index(const std::string &name) const {
+  const auto it = m_property_indexes.find(name);
+  return m_property_indexes.end() == it ? npos : it->second;
+}
+
 Column::Column(const mysqlshdk::db::Column &meta, shcore::Value type)
     : _c(meta), _type(type) {
   add_property("schemaName", "getSchemaName");
@@ -256,44 +291,56 @@ In the case a field does not met these conditions, it must be retrieved through
 the Row.<<<getField>>>(@<field_name@>) function.
 )*");
 Row::Row() {
-  add_property("length", "getLength");
-  expose("getField", &Row::get_field, "fieldName");
+  register_members();
   names.reset(new std::vector<std::string>());
 }
 
-Row::Row(std::shared_ptr<std::vector<std::string>> names_,
+Row::Row(std::shared_ptr<const Row_layout> layout,
          const mysqlshdk::db::IRow &row)
-    : names(names_) {
-  assert(names);
+    : names(layout->names()),
+      m_layout(std::move(layout)),
+      m_row(std::make_unique<mysqlshdk::db::Row_copy>(row)),
+      m_values(row.num_fields()),
+      m_undecoded(m_values.size()) {
+  assert(row.num_fields() == names->size());
+
+  // Fields which are valid identifiers are available as properties, i.e.
+  // row.property, these are resolved using the layout. Properties for Row
+  // Fields are exposed exactly as the field name in both JavaScript and
+  // Python. Values of the fields are converted when they are accessed.
+}
 
-  add_property("length", "getLength");
-  expose("getField", &Row::get_field, "fieldName");
+void Row::register_members() const {
+  if (m_members_registered) return;
 
-  assert(row.num_fields() == names_->size());
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
-    const std::string &key = names_->at(i);
-    // Values would be available as properties if they are valid identifier
-    // and not base members like length and getField
-    // O on this case the values would be available as
-    // row.property
-    // Properties for Row Fields are exposed exactly as the field name in both
-    // JavaScript and Python, hence the property is registered as
-    // <jsname> | <pyname> to avoid the naming enforcement logic to mess with
-    // the property name.
-    // i.e. without this a property like NAME would be turned into n_a_m_e for
-    // Python
-    if (shcore::is_valid_identifier(key) && !has_member(key))
-      add_property(key + "|" + key);
+  m_members_registered = true;
+
+  // members are registered on demand by the const accessors
+  const auto self = const_cast<Row *>(this);
+  self->add_property("length", "getLength");
+  self->expose("getField", &Row::get_field, "fieldName");
+}
+
+const shcore::Value &Row::value(size_t index) const {
+  auto &v = m_values[index];
+
+  if (m_row && shcore::Undefined == v.type) {
+    v = get_row_value(*m_row, static_cast<uint32_t>(index));
+
+    // copy of the fetched row is no longer needed once all fields are decoded
+    if (0 == --m_undecoded) {
+      m_row.reset();
+    }
   }
 
-  value_array = get_row_values(row);
+  return v;
 }
 
 shcore::Dictionary_t Row::as_object() {
   auto ret_val = shcore::make_dict();
 
   for (size_t index = 0; index < names->size(); index++) {
-    ret_val->emplace(names->at(index), value_array.at(index));
+    ret_val->emplace(names->at(index), value(index));
   }
 
   return ret_val;
@@ -303,15 +350,14 @@ std::string &Row::append_descr(std::string &s_out, int indent,
                                int UNUSED(quote_strings)) const {
   std::string nl = (indent >= 0) ? "\n" : "";
   s_out += "[";
-  for (size_t index = 0; index < value_array.size(); index++) {
+  for (size_t index = 0; index < m_values.size(); index++) {
     if (index > 0) s_out += ", ";
 
     s_out += nl;
 
     if (indent >= 0) s_out.append((indent + 1) * 4, ' ');
 
-    value_array[index].append_descr(s_out, indent < 0 ? indent : indent + 1,
-                                    '"');
+    value(index).append_descr(s_out, indent < 0 ? indent : indent + 1, '"');
   }
 
   s_out += nl;
@@ -325,8 +371,8 @@ std::string &Row::append_descr(std::string &s_out, int indent,
 void Row::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
-  for (size_t index = 0; index < value_array.size(); index++)
-    dumper.append_value(names->at(index), value_array[index]);
+  for (size_t index = 0; index < m_values.size(); index++)
+    dumper.append_value(names->at(index), value(index));
 
   dumper.end_object();
 }
@@ -354,9 +400,8 @@ Object Row::getField(String name) {}
 object Row::get_field(str name) {}
 #endif
 shcore::Value Row::get_field(const std::string &name) const {
-  auto iter = std::find(names->begin(), names->end(), name);
-  if (iter != names->end())
-    return value_array[iter - names->begin()];
+  if (const auto index = field_index(name); Row_layout::npos != index)
+    return value(index);
   else
     throw shcore::Exception::argument_error("Field " + name +
                                             " does not exist");
@@ -376,30 +421,125 @@ int Row::get_length() {}
 #endif
 shcore::Value Row::get_member(const std::string &prop) const {
   if (prop == "length") {
-    return shcore::Value((int)value_array.size());
+    return shcore::Value((int)m_values.size());
   } else {
-    auto it = std::find(names->begin(), names->end(), prop);
-    if (it != names->end()) return value_array[it - names->begin()];
+    if (const auto index = field_index(prop); Row_layout::npos != index)
+      return value(index);
   }
 
+  register_members();
+
   return shcore::Cpp_object_bridge::get_member(prop);
 }
 
+std::vector<std::string> Row::get_members() const {
+  register_members();
+
+  auto members = Cpp_object_bridge::get_members();
+
+  if (m_layout) {
+    // properties are listed before functions, length is the only property
+    // registered in the object
+    const auto &properties = m_layout->properties();
+    members.insert(members.begin() + 1, properties.begin(), properties.end());
+  }
+
+  return members;
+}
+
+namespace {
+
+bool is_row_member(const std::string &name, shcore::NamingStyle style) {
+  return name == "length" ||
+         name == shcore::get_member_name("getLength", style) ||
+         name == shcore::get_member_name("getField", style);
+}
+
+bool is_row_method(const std::string &name, shcore::NamingStyle style) {
+  return name != "length" && is_row_member(name, style);
+}
+
+}  // namespace
+
+bool Row::has_member(const std::string &prop) const {
+  if (!m_members_registered &&
+      is_row_member(prop, shcore::NamingStyle::LowerCamelCase))
+    return true;
+
+  return Cpp_object_bridge::has_member(prop) ||
+         (m_layout && Row_layout::npos != m_layout->property_index(prop));
+}
+
+bool Row::has_method(const std::string &name) const {
+  if (!m_members_registered &&
+      is_row_method(name, shcore::NamingStyle::LowerCamelCase))
+    return true;
+
+  return Cpp_object_bridge::has_method(name);
+}
+
+shcore::Value Row::get_member_advanced(const std::string &prop) const {
+  if (m_layout && !has_method_advanced(prop)) {
+    if (const auto index = m_layout->property_index(prop);
+        Row_layout::npos != index)
+      return value(index);
+  }
+
+  register_members();
+
+  return Cpp_object_bridge::get_member_advanced(prop);
+}
+
+bool Row::has_member_advanced(const std::string &prop) const {
+  if (!m_members_registered &&
+      is_row_member(prop, shcore::current_naming_style()))
+    return true;
+
+  return Cpp_object_bridge::has_member_advanced(prop) ||
+         (m_layout && Row_layout::npos != m_layout->property_index(prop));
+}
+
+bool Row::has_method_advanced(const std::string &name) const {
+  if (!m_members_registered &&
+      is_row_method(name, shcore::current_naming_style()))
+    return true;
+
+  return Cpp_object_bridge::has_method_advanced(name);
+}
+
+shcore::Value Row::call_advanced(const std::string &name,
+                                 const shcore::Argument_list &args,
+                                 const shcore::Dictionary_t &kwargs) {
+  register_members();
+
+  return Cpp_object_bridge::call_advanced(name, args, kwargs);
+}
+
+size_t Row::field_index(const std::string &name) const {
+  if (m_layout) return m_layout->field_index(name);
+
+  const auto it = std::find(names->begin(), names->end(), name);
+  return names->end() == it ? Row_layout::npos : it - names->begin();
+}
+
 #if DOXYGEN_CPP
 /**
  * Returns the value of a field on the Row based on the field position.
  */
 #endif
 shcore::Value Row::get_member(size_t index) const {
-  if (index < value_array.size())
-    return value_array[index];
+  if (index < m_values.size())
+    return value(index);
   else
     return shcore::Value();
 }
 
 void Row::add_item(const std::string &key, shcore::Value value) {
+  // names are shared by all the rows which use the same layout
+  assert(!m_layout);
+
   // All the values are available through index
-  value_array.push_back(value);
+  m_values.push_back(value);
   names->push_back(key);
 
   // Values would be available as properties if they are valid identifier
@@ -30,9 +30,11 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "db/column.h"
 #include "db/row.h"
+#include "db/row_copy.h"
 #include "modules/mod_common.h"
 #include "mysqlshdk/libs/db/result.h"
 #include "scripting/types.h"
@@ -40,6 +42,55 @@
 
 namespace mysqlsh {
 class Row;
+
+/**
+ * Describes the fields of the rows of a result. It is shared by all the rows
+ * fetched from the same result, so that the name lookups and the decision
+ * which fields are exposed as properties are done once per result, rather
+ * than once per row.
+ */
+class Row_layout final {
+ public:
+  static constexpr size_t npos = std::string::npos;
+
+  explicit Row_layout(std::shared_ptr<std::vector<std::string>> names);
+
+  Row_layout(const Row_layout &) = delete;
+  Row_layout(Row_layout &&) = delete;
+
+  Row_layout &operator=(const Row_layout &) = delete;
+  Row_layout &operator=(Row_layout &&) = delete;
+
+  ~Row_layout() = default;
+
+  const std::shared_ptr<std::vector<std::string>> &names() const {
+    return m_names;
+  }
+
+  /**
+   * Index of the first field with the given name, npos if there's no such
+   * field.
+   */
+  size_t field_index(const std::string &name) const;
+
+  /**
+   * Index of the field exposed as a property with the given name, npos if
+   * there's no such property.
+   */
+  size_t property_index(const std::string &name) const;
+
+  /**
+   * Names of the fields which are exposed as properties, in field order.
+   */
+  const std::vector<std::string> &properties() const { return m_properties; }
+
+ private:
+  std::shared_ptr<std::vector<std::string>> m_names;
+  std::unordered_map<std::string, size_t> m_field_indexes;
+  std::unordered_map<std::string, size_t> m_property_indexes;
+  std::vector<std::string> m_properties;
+};
+
 // This is the Shell Common Base Class for all the resultset classes
 class ShellBaseResult : public shcore::Cpp_object_bridge {
  public:
@@ -76,6 +127,7 @@ class ShellBaseResult : public shcore::Cpp_object_bridge {
 
   mutable shcore::Value::Array_type_ref m_columns;
   mutable std::shared_ptr<std::vector<std::string>> m_column_names;
+  mutable std::shared_ptr<const Row_layout> m_row_layout;
 };
 
 /**
@@ -300,13 +352,12 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
 #endif
 
   Row();
-  Row(std::shared_ptr<std::vector<std::string>> names,
+  Row(std::shared_ptr<const Row_layout> layout,
       const mysqlshdk::db::IRow &row);
 
   virtual std::string class_name() const { return "Row"; }
 
   std::shared_ptr<std::vector<std::string>> names;
-  std::vector<shcore::Value> value_array;
 
   virtual std::string &append_descr(std::string &s_out, int indent = -1,
                                     int quote_strings = 0) const;
@@ -320,12 +371,55 @@ class SHCORE_PUBLIC Row : public shcore::Cpp_object_bridge {
   virtual shcore::Value get_member(const std::string &prop) const;
   shcore::Value get_member(size_t index) const;
 
-  size_t get_length() { return value_array.size(); }
+  std::vector<std::string> get_members() const override;
+  bool has_member(const std::string &prop) const override;
+  bool has_method(const std::string &name) const override;
+  shcore::Value get_member_advanced(const std::string &prop) const override;
+  bool has_member_advanced(const std::string &prop) const override;
+  bool has_method_advanced(const std::string &name) const override;
+  shcore::Value call_advanced(const std::string &name,
+                              const shcore::Argument_list &args,
+                              const shcore::Dictionary_t &kwargs = {}) override;
+
+  size_t get_length() const { return m_values.size(); }
   virtual bool is_indexed() const { return true; }
 
   void add_item(const std::string &key, shcore::Value value);
 
   shcore::Dictionary_t as_object();
+
+ private:
+  size_t field_index(const std::string &name) const;
+
+  /**
+   * Returns value of the given field, converting it from the copy of the
+   * fetched row when it's accessed for the first time.
+   */
+  const shcore::Value &value(size_t index) const;
+
+  /**
+   * Registers the members of this object. Rows fetched from a result do this
+   * when one of their members is accessed for the first time, rows which are
+   * only iterated or converted do not have to pay for it.
+   */
+  void register_members() const;
+
+  // fields of rows fetched from a result are not registered as properties of
+  // each row, they are resolved using the layout shared by all these rows
+  std::shared_ptr<const Row_layout> m_layout;
+
+  // copy of the row fetched from a result, the fetched row is valid only
+  // until the next row is fetched; released once all fields are decoded
+  mutable std::unique_ptr<mysqlshdk::db::Row_copy> m_row;
+
+  // values of the fields, fields of the rows fetched from a result which
+  // were not yet accessed hold an undefined value
+  mutable std::vector<shcore::Value> m_values;
+
+  // number of fields which were not yet decoded
+  mutable size_t m_undecoded = 0;
+
+  mutable bool m_members_registered = false;
 };
 }  // namespace mysqlsh
 
@@ -23,6 +23,7 @@
 
 #include "crud_definition.h"
 #include <mysqld_error.h>
+#include <cinttypes>
 #include <memory>
 #include <string>
 #include <vector>
@@ -109,11 +110,18 @@ std::shared_ptr<mysqlshdk::db::mysqlx::Result> Crud_definition::safe_exec(
   });
 
   std::shared_ptr<mysqlshdk::db::IResult> result;
+  const auto key =
+      allow_prepared_statements() ? prepared_statement_key() : std::string{};
 
   // Prepared statements are used when the statement is executed a
   // more than once after the last statement update and if the operation
   // allows prepared statements
-  if (use_prepared()) {
+  m_use_prepared = allow_prepared_statements() && m_execution_count;
+
+  if (!key.empty()) {
+    // statement is shared with other operations using the same session
+    result = execute_cached(key, func);
+  } else if (use_prepared()) {
     try {
       // If the statement has not been prepared, then it gets prepared
       if (!m_prep_stmt.has_stmt_id()) {
@@ -170,6 +178,94 @@ std::shared_ptr<mysqlshdk::db::mysqlx::Result> Crud_definition::safe_exec(
   return std::static_pointer_cast<mysqlshdk::db::mysqlx::Result>(result);
 }
 
+std::shared_ptr<mysqlshdk::db::IResult> Crud_definition::execute_cached(
+    const std::string &key,
+    const std::function<std::shared_ptr<mysqlshdk::db::IResult>()> &func) {
+  const auto s = session();
+  const auto cache = s->crud_statement_cache();
+  const auto statement = cache->execute(key);
+
+  // statement is prepared when it's executed for the second time, regardless
+  // of which operation executed it first
+  m_use_prepared = statement.executions > 0;
+
+  if (!use_prepared()) {
+    return func();
+  }
+
+  // prepared statement is owned by the cache
+  shcore::Scoped_callback clear_stmt([this]() { m_prep_stmt.Clear(); });
+
+  const auto prepare = [&]() {
+    m_prep_stmt.set_stmt_id(s->session()->next_prep_stmt_id());
+    set_prepared_stmt();
+    s->session()->prepare_stmt(m_prep_stmt);
+    cache->set_prepared(key, m_prep_stmt.stmt_id());
+  };
+
+  try {
+    if (statement.id) {
+      m_prep_stmt.set_stmt_id(statement.id);
+      update_limits();
+    } else {
+      prepare();
+    }
+
+    Mysqlx::Prepare::Execute execute;
+    execute.set_stmt_id(m_prep_stmt.stmt_id());
+    insert_bound_values(execute.mutable_args());
+
+    try {
+      return s->session()->execute_prep_stmt(execute);
+    } catch (const mysqlshdk::db::Error &error) {
+      if (!statement.id || ER_X_BAD_STATEMENT_ID != error.code()) {
+        throw;
+      }
+
+      // statement prepared earlier is no longer known to the server, it's
+      // prepared again and executed once more, nothing was executed so far
+      log_info("Prepared statement %" PRIu32 " is not available: %s",
+               statement.id, error.format().c_str());
+
+      cache->forget(key);
+      cache->execute(key);
+      prepare();
+
+      execute.set_stmt_id(m_prep_stmt.stmt_id());
+      return s->session()->execute_prep_stmt(execute);
+    }
+  } catch (const mysqlshdk::db::Error &error) {
+    if (ER_UNKNOWN_COM_ERROR == error.code()) {
+      s->disable_prepared_statements();
+      m_use_prepared = false;
+      return func();
+    } else {
+      // state of the prepared statement is unknown, it's removed from the
+      // cache, so that it's prepared again when this statement is executed
+      cache->forget(key);
+      throw;
+    }
+  }
+}
+
+Mysqlx::Expr::Expr *Crud_definition::parse_criteria(
+    const std::string &criteria, bool document_mode) {
+  const auto s = session();
+
+  // positions of the placeholders are stored in the expression, cached
+  // expression can only be used if this is the first one which has them
+  if (s && _placeholders.empty()) {
+    return s->crud_statement_cache()
+        ->parse_criteria(criteria, document_mode, &_placeholders)
+        .release();
+  }
+
+  return document_mode
+             ? ::mysqlx::parser::parse_collection_filter(criteria,
+                                                         &_placeholders)
+             : ::mysqlx::parser::parse_table_filter(criteria, &_placeholders);
+}
+
 std::shared_ptr<Session> Crud_definition::session() {
   if (_owner) {
     return std::static_pointer_cast<Session>(_owner->session());
@@ -334,6 +430,7 @@ void Crud_definition::bind_value(const std::string &name, shcore::Value value) {
 
 void Crud_definition::reset_prepared_statement() {
   m_execution_count = 0;
+  m_use_prepared = false;
 
   // If the statement was prepared previously, it should be deallocated
   if (m_prep_stmt.has_stmt_id()) {
@@ -346,6 +443,14 @@ void Crud_definition::reset_prepared_statement() {
   }
 }
 
+REGISTER_HELP(
+    EXECUTE_ASYNC_BRIEF,
+    "Sends the operation to the server without waiting for its result.");
+REGISTER_HELP(EXECUTE_ASYNC_DETAIL,
+              "The result is received when it is requested, this allows to "
+              "execute several operations without waiting for the results of "
+              "the previous ones. See PendingResult for details.");
+
 REGISTER_HELP(
     LIMIT_EXECUTION_MODE,
     "This function can be called every time the statement is executed.");
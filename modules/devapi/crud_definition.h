@@ -36,6 +36,7 @@
 #include "db/mysqlx/mysqlx_parser.h"
 #include "db/mysqlx/mysqlxclient_clean.h"
 #include "modules/devapi/dynamic_object.h"
+#include "modules/devapi/mod_mysqlx_pending_result.h"
 #include "modules/devapi/mod_mysqlx_session.h"
 #include "mysqlshdk/libs/utils/nullable.h"
 #include "scripting/common.h"
@@ -73,6 +74,26 @@ class Crud_definition : public Dynamic_object {
   std::shared_ptr<mysqlshdk::db::mysqlx::Result> safe_exec(
       std::function<std::shared_ptr<mysqlshdk::db::IResult>()> func);
 
+  /**
+   * Sends the statement through the pipeline of the session, without waiting
+   * for its result.
+   */
+  template <class T>
+  std::shared_ptr<PendingResult> execute_pipelined(T *message) {
+    // pipelined statements are not prepared
+    m_use_prepared = false;
+    update_limits();
+    insert_bound_values(message->mutable_args());
+
+    const auto s = session();
+
+    return std::make_shared<PendingResult>(
+        s->session()->execute_async(*message, s->pipeline_depth()),
+        [](const std::shared_ptr<mysqlshdk::db::mysqlx::Result> &result) {
+          return shcore::Value::wrap(std::make_shared<Result>(result));
+        });
+  }
+
   std::shared_ptr<Session> session();
   std::shared_ptr<DatabaseObject> _owner;
 
@@ -82,6 +103,7 @@ class Crud_definition : public Dynamic_object {
  protected:
   Mysqlx::Prepare::Prepare m_prep_stmt;
   uint64_t m_execution_count;
+  bool m_use_prepared = false;
   mysqlshdk::utils::nullable<uint64_t> m_limit;
   mysqlshdk::utils::nullable<uint64_t> m_offset;
   std::vector<std::string> _placeholders;
@@ -108,10 +130,47 @@ class Crud_definition : public Dynamic_object {
   virtual bool allow_prepared_statements();
   virtual void update_limits(){};
   void reset_prepared_statement();
-  bool use_prepared() {
-    return allow_prepared_statements() && m_execution_count;
+  bool use_prepared() { return m_use_prepared; }
+
+  /**
+   * Provides the normalized shape of the statement executed by this operation,
+   * used to share the prepared statements between the operations created using
+   * the same session. If empty, statement is prepared only for this operation.
+   */
+  virtual std::string prepared_statement_key() { return {}; }
+
+  template <class T>
+  std::string statement_key(const T &message) const {
+    // values of limit and offset are always bound, only the fact that they are
+    // used changes the statement
+    T normalized = message;
+    normalized.clear_args();
+    normalized.clear_limit();
+    normalized.clear_limit_expr();
+
+    std::string key = normalized.GetTypeName();
+    key += m_limit.is_null() ? '-' : 'L';
+    key += m_offset.is_null() ? '-' : 'O';
+
+    for (const auto &placeholder : _placeholders) {
+      if (placeholder != K_LIMIT_BIND_TAG && placeholder != K_OFFSET_BIND_TAG) {
+        key += placeholder;
+        key += ',';
+      }
+    }
+
+    normalized.AppendToString(&key);
+
+    return key;
   }
 
+  /**
+   * Parses the criteria of this operation, placeholders are added to the list
+   * of placeholders.
+   */
+  Mysqlx::Expr::Expr *parse_criteria(const std::string &criteria,
+                                     bool document_mode);
+
   virtual shcore::Value this_object() { return shcore::Value(); }
   shcore::Value limit(const shcore::Argument_list &args,
                       Dynamic_object::Allowed_function_mask limit_func_id,
@@ -162,6 +221,9 @@ class Crud_definition : public Dynamic_object {
 
  private:
   void validate_placeholders();
+  std::shared_ptr<mysqlshdk::db::IResult> execute_cached(
+      const std::string &key,
+      const std::function<std::shared_ptr<mysqlshdk::db::IResult>()> &func);
 };
 }  // namespace mysqlx
 }  // namespace mysqlsh
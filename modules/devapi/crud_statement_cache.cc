@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/devapi/crud_statement_cache.h"
+
+#include <cassert>
+#include <cinttypes>
+
+#include "mysqlshdk/libs/db/mysqlx/mysqlx_parser.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+namespace {
+
+std::string hit_rate(uint64_t hits, uint64_t misses) {
+  const auto total = hits + misses;
+  return total ? shcore::str_format("%.2f%%", 100.0 * hits / total) : "n/a";
+}
+
+}  // namespace
+
+template <typename T>
+T *Crud_statement_cache::Lru<T>::find(const std::string &key) {
+  const auto it = m_index.find(key);
+
+  if (m_index.end() == it) return nullptr;
+
+  // mark as the most recently used
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+  return &it->second->second;
+}
+
+template <typename T>
+std::unique_ptr<T> Crud_statement_cache::Lru<T>::insert(const std::string &key,
+                                                        T value,
+                                                        T **inserted) {
+  assert(m_index.end() == m_index.find(key));
+
+  m_entries.emplace_front(key, std::move(value));
+  m_index.emplace(key, m_entries.begin());
+
+  *inserted = &m_entries.front().second;
+
+  std::unique_ptr<T> evicted;
+
+  if (m_entries.size() > m_max_size) {
+    auto &lru = m_entries.back();
+    evicted = std::make_unique<T>(std::move(lru.second));
+    m_index.erase(lru.first);
+    m_entries.pop_back();
+  }
+
+  return evicted;
+}
+
+template <typename T>
+std::unique_ptr<T> Crud_statement_cache::Lru<T>::erase(const std::string &key) {
+  const auto it = m_index.find(key);
+
+  if (m_index.end() == it) return {};
+
+  auto erased = std::make_unique<T>(std::move(it->second->second));
+  m_entries.erase(it->second);
+  m_index.erase(it);
+
+  return erased;
+}
+
+Crud_statement_cache::Crud_statement_cache(Deallocate_callback deallocate,
+                                           size_t max_statements,
+                                           size_t max_expressions)
+    : m_deallocate(std::move(deallocate)),
+      m_statements(max_statements),
+      m_expressions(max_expressions) {
+  assert(m_deallocate);
+}
+
+std::unique_ptr<Mysqlx::Expr::Expr> Crud_statement_cache::parse_criteria(
+    const std::string &criteria, bool document_mode,
+    std::vector<std::string> *placeholders) {
+  assert(placeholders && placeholders->empty());
+
+  const auto key = (document_mode ? "D" : "T") + criteria;
+
+  if (const auto cached = m_expressions.find(key)) {
+    ++m_statistics.expression_hits;
+
+    *placeholders = cached->placeholders;
+    return std::make_unique<Mysqlx::Expr::Expr>(*cached->expr);
+  }
+
+  ++m_statistics.expression_misses;
+
+  Expression parsed;
+  parsed.expr.reset(
+      document_mode
+          ? ::mysqlx::parser::parse_collection_filter(criteria,
+                                                      &parsed.placeholders)
+          : ::mysqlx::parser::parse_table_filter(criteria,
+                                                 &parsed.placeholders));
+
+  *placeholders = parsed.placeholders;
+  auto result = std::make_unique<Mysqlx::Expr::Expr>(*parsed.expr);
+
+  Expression *inserted = nullptr;
+  m_expressions.insert(key, std::move(parsed), &inserted);
+
+  return result;
+}
+
+Crud_statement_cache::Statement Crud_statement_cache::execute(
+    const std::string &key) {
+  if (const auto cached = m_statements.find(key)) {
+    ++m_statistics.statement_hits;
+
+    const auto previous = *cached;
+    ++cached->executions;
+    return previous;
+  }
+
+  ++m_statistics.statement_misses;
+
+  Statement statement;
+  statement.executions = 1;
+
+  Statement *inserted = nullptr;
+  const auto evicted = m_statements.insert(key, statement, &inserted);
+
+  if (evicted && evicted->id) {
+    ++m_statistics.statements_evicted;
+    m_deallocate(evicted->id);
+  }
+
+  return {};
+}
+
+void Crud_statement_cache::set_prepared(const std::string &key, uint32_t id) {
+  const auto cached = m_statements.find(key);
+
+  if (cached) {
+    assert(!cached->id);
+    cached->id = id;
+    ++m_statistics.statements_prepared;
+  } else {
+    // statement was evicted in the meantime
+    m_deallocate(id);
+  }
+}
+
+void Crud_statement_cache::forget(const std::string &key) {
+  const auto erased = m_statements.erase(key);
+
+  if (erased && erased->id) {
+    ++m_statistics.statements_evicted;
+    m_deallocate(erased->id);
+  }
+}
+
+void Crud_statement_cache::clear() {
+  if (m_statistics.statement_hits + m_statistics.statement_misses +
+      m_statistics.expression_hits + m_statistics.expression_misses) {
+    log_debug("CRUD statement cache: %s", statistics_summary().c_str());
+  }
+
+  m_statements.clear();
+  m_expressions.clear();
+  m_statistics = {};
+}
+
+std::string Crud_statement_cache::statistics_summary() const {
+  return shcore::str_format(
+      "expressions: %" PRIu64 " hits, %" PRIu64
+      " misses (hit rate: %s), statements: %" PRIu64 " hits, %" PRIu64
+      " misses (hit rate: %s), %" PRIu64 " prepared, %" PRIu64 " evicted",
+      m_statistics.expression_hits, m_statistics.expression_misses,
+      hit_rate(m_statistics.expression_hits, m_statistics.expression_misses)
+          .c_str(),
+      m_statistics.statement_hits, m_statistics.statement_misses,
+      hit_rate(m_statistics.statement_hits, m_statistics.statement_misses)
+          .c_str(),
+      m_statistics.statements_prepared, m_statistics.statements_evicted);
+}
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
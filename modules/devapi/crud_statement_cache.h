@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_DEVAPI_CRUD_STATEMENT_CACHE_H_
+#define MODULES_DEVAPI_CRUD_STATEMENT_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "db/mysqlx/mysqlxclient_clean.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+/**
+ * Cache of the CRUD statements executed using a session, shared by all the
+ * CRUD operation objects created using that session.
+ *
+ * Holds:
+ *  - expressions parsed from the criteria strings, so that an operation object
+ *    created for the same criteria does not need to parse it again,
+ *  - IDs of the server-side prepared statements, keyed by the normalized shape
+ *    of the CRUD message, so that different operation objects which execute
+ *    the same statement use the same prepared statement.
+ *
+ * Both caches are bounded, least recently used entries are evicted. Prepared
+ * statements are owned by the cache, they are deallocated when evicted. Each
+ * prepared statement counts against the max_prepared_stmt_count limit of the
+ * server, which is shared by all the connections, hence the small default.
+ */
+class Crud_statement_cache final {
+ public:
+  static constexpr size_t k_default_max_statements = 16;
+  static constexpr size_t k_default_max_expressions = 1024;
+
+  struct Statistics {
+    uint64_t expression_hits = 0;
+    uint64_t expression_misses = 0;
+    uint64_t statement_hits = 0;
+    uint64_t statement_misses = 0;
+    uint64_t statements_prepared = 0;
+    uint64_t statements_evicted = 0;
+  };
+
+  struct Statement {
+    // number of times this statement was executed before
+    uint64_t executions = 0;
+    // ID of the prepared statement, 0 if statement was not prepared yet
+    uint32_t id = 0;
+  };
+
+  using Deallocate_callback = std::function<void(uint32_t)>;
+
+  explicit Crud_statement_cache(
+      Deallocate_callback deallocate,
+      size_t max_statements = k_default_max_statements,
+      size_t max_expressions = k_default_max_expressions);
+
+  Crud_statement_cache(const Crud_statement_cache &) = delete;
+  Crud_statement_cache(Crud_statement_cache &&) = delete;
+
+  Crud_statement_cache &operator=(const Crud_statement_cache &) = delete;
+  Crud_statement_cache &operator=(Crud_statement_cache &&) = delete;
+
+  ~Crud_statement_cache() = default;
+
+  /**
+   * Parses the given criteria, reusing previously parsed expression if
+   * possible. Placeholders found in the expression are appended to the given
+   * list, which has to be empty.
+   *
+   * @param criteria Criteria to be parsed.
+   * @param document_mode Whether this is a collection or a table criteria.
+   * @param placeholders Receives the placeholders used in the criteria.
+   *
+   * @returns Parsed expression.
+   */
+  std::unique_ptr<Mysqlx::Expr::Expr> parse_criteria(
+      const std::string &criteria, bool document_mode,
+      std::vector<std::string> *placeholders);
+
+  /**
+   * Registers execution of a statement with the given shape.
+   *
+   * @param key Normalized shape of the statement.
+   *
+   * @returns State of the statement before this execution.
+   */
+  Statement execute(const std::string &key);
+
+  /**
+   * Stores ID of the prepared statement with the given shape. Cache takes the
+   * ownership of the prepared statement.
+   */
+  void set_prepared(const std::string &key, uint32_t id);
+
+  /**
+   * Removes the statement with the given shape, deallocating the prepared
+   * statement, if there is one. Meant to be used when execution of the
+   * prepared statement fails, so that it's prepared again.
+   */
+  void forget(const std::string &key);
+
+  /**
+   * Forgets all the cached information. Prepared statements are not
+   * deallocated, this is meant to be used when connection is closed.
+   */
+  void clear();
+
+  const Statistics &statistics() const { return m_statistics; }
+
+  /**
+   * Provides a human-readable summary of the statistics.
+   */
+  std::string statistics_summary() const;
+
+ private:
+  template <typename T>
+  class Lru {
+   public:
+    explicit Lru(size_t max_size) : m_max_size(max_size) {}
+
+    T *find(const std::string &key);
+
+    // returns the evicted entry, if any
+    std::unique_ptr<T> insert(const std::string &key, T value, T **inserted);
+
+    // returns the removed entry, if any
+    std::unique_ptr<T> erase(const std::string &key);
+
+    void clear() {
+      m_entries.clear();
+      m_index.clear();
+    }
+
+   private:
+    using Entries = std::list<std::pair<std::string, T>>;
+
+    size_t m_max_size;
+    Entries m_entries;
+    std::unordered_map<std::string, typename Entries::iterator> m_index;
+  };
+
+  struct Expression {
+    std::unique_ptr<Mysqlx::Expr::Expr> expr;
+    std::vector<std::string> placeholders;
+  };
+
+  Deallocate_callback m_deallocate;
+  Lru<Statement> m_statements;
+  Lru<Expression> m_expressions;
+  Statistics m_statistics;
+};
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
+
+#endif  // MODULES_DEVAPI_CRUD_STATEMENT_CACHE_H_
@@ -54,6 +54,8 @@ CollectionAdd::CollectionAdd(std::shared_ptr<Collection> owner)
 
   // Exposes the methods available for chaining
   add_method("add", std::bind(&CollectionAdd::add, this, _1), "data");
+  add_method("executeAsync",
+             std::bind(&CollectionAdd::execute_async, this, _1));
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::add, F::execute, K_DISABLE_NONE, K_ALLOW_REUSE);
@@ -339,5 +341,49 @@ shcore::Value CollectionAdd::execute(bool upsert) {
                 : shcore::Value::Null();
 }
 
+// Documentation of executeAsync function
+REGISTER_HELP_FUNCTION(executeAsync, CollectionAdd);
+REGISTER_HELP(COLLECTIONADD_EXECUTEASYNC_BRIEF, "${EXECUTE_ASYNC_BRIEF}");
+REGISTER_HELP(COLLECTIONADD_EXECUTEASYNC_RETURNS,
+              "@returns A PendingResult object which can be used to retrieve "
+              "the Result of the operation.");
+REGISTER_HELP(COLLECTIONADD_EXECUTEASYNC_DETAIL, "${EXECUTE_ASYNC_DETAIL}");
+
+/**
+ * $(COLLECTIONADD_EXECUTEASYNC_BRIEF)
+ *
+ * $(COLLECTIONADD_EXECUTEASYNC_RETURNS)
+ *
+ * $(COLLECTIONADD_EXECUTEASYNC_DETAIL)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked whenever execute() can be invoked.
+ */
+#if DOXYGEN_JS
+PendingResult CollectionAdd::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult CollectionAdd::execute_async() {}
+#endif
+shcore::Value CollectionAdd::execute_async(const shcore::Argument_list &args) {
+  args.ensure_count(0, get_function_name("executeAsync").c_str());
+
+  std::shared_ptr<PendingResult> result;
+  try {
+    if (!message_.row().empty()) {
+      result = execute_pipelined(&message_);
+    } else {
+      result = std::make_shared<PendingResult>(
+          nullptr,
+          [](const std::shared_ptr<mysqlshdk::db::mysqlx::Result> &) {
+            return shcore::Value::wrap(std::make_shared<Result>(nullptr));
+          });
+    }
+  }
+  CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("executeAsync"));
+
+  return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(result));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
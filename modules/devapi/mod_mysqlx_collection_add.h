@@ -57,16 +57,19 @@ class CollectionAdd : public Collection_crud_definition,
 
   shcore::Value add(const shcore::Argument_list &args);
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
   shcore::Value execute(bool upsert);
 
 #if DOXYGEN_JS
   CollectionAdd add(DocDefinition document[, DocDefinition document, ...]);
   CollectionAdd add(List documents);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   CollectionAdd add(DocDefinition document[, DocDefinition document, ...]);
   CollectionAdd add(list documents);
   Result execute();
+  PendingResult execute_async();
 #endif
 
  private:
@@ -87,7 +90,7 @@ class CollectionAdd : public Collection_crud_definition,
     if ("add" == s) {
       return F::add;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
@@ -218,8 +218,7 @@ shcore::Value CollectionFind::find(const shcore::Argument_list &args) {
 }
 
 CollectionFind &CollectionFind::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_criteria(filter, true));
 
   return *this;
 }
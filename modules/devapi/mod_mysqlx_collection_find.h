@@ -110,6 +110,9 @@ class CollectionFind : public Collection_crud_definition,
   void set_lock_contention(const shcore::Argument_list &args);
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   shcore::Value this_object() override;
 
   struct F {
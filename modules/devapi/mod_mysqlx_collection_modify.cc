@@ -76,6 +76,8 @@ CollectionModify::CollectionModify(std::shared_ptr<Collection> owner)
              "data");
   add_method("bind", std::bind(&CollectionModify::bind_, this, _1, bind_id),
              "data");
+  add_method("executeAsync",
+             std::bind(&CollectionModify::execute_async, this, _1));
 
   // Registers the dynamic function behavior
   Allowed_function_mask operations = F::set | F::unset | F::merge | F::patch |
@@ -242,8 +244,7 @@ std::shared_ptr<CollectionModify> CollectionModify::modify(
 }
 
 CollectionModify &CollectionModify::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_criteria(filter, true));
 
   return *this;
 }
@@ -1679,5 +1680,43 @@ shcore::Value CollectionModify::execute() {
 }
 #endif
 
+// Documentation of executeAsync function
+REGISTER_HELP_FUNCTION(executeAsync, CollectionModify);
+REGISTER_HELP(COLLECTIONMODIFY_EXECUTEASYNC_BRIEF, "${EXECUTE_ASYNC_BRIEF}");
+REGISTER_HELP(COLLECTIONMODIFY_EXECUTEASYNC_RETURNS,
+              "@returns A PendingResult object which can be used to retrieve "
+              "the Result of the operation.");
+REGISTER_HELP(COLLECTIONMODIFY_EXECUTEASYNC_DETAIL, "${EXECUTE_ASYNC_DETAIL}");
+
+/**
+ * $(COLLECTIONMODIFY_EXECUTEASYNC_BRIEF)
+ *
+ * $(COLLECTIONMODIFY_EXECUTEASYNC_RETURNS)
+ *
+ * $(COLLECTIONMODIFY_EXECUTEASYNC_DETAIL)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked whenever execute() can be invoked.
+ */
+#if DOXYGEN_JS
+PendingResult CollectionModify::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult CollectionModify::execute_async() {}
+#endif
+shcore::Value CollectionModify::execute_async(
+    const shcore::Argument_list &args) {
+  args.ensure_count(0, get_function_name("executeAsync").c_str());
+
+  std::shared_ptr<PendingResult> result;
+  try {
+    result = execute_pipelined(&message_);
+    update_functions(F::execute);
+  }
+  CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("executeAsync"));
+
+  return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(result));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
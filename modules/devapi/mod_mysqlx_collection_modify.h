@@ -68,6 +68,7 @@ class CollectionModify : public Collection_crud_definition,
   CollectionModify limit(Integer numberOfRows);
   CollectionModify bind(String name, Value value);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   CollectionModify modify(str searchCondition);
   CollectionModify set(str attribute, Value value);
@@ -83,6 +84,7 @@ class CollectionModify : public Collection_crud_definition,
   CollectionModify limit(int numberOfRows);
   CollectionModify bind(str name, Value value);
   Result execute();
+  PendingResult execute_async();
 #endif
   std::string class_name() const override { return "CollectionModify"; }
   static std::shared_ptr<shcore::Object_bridge> create(
@@ -102,8 +104,12 @@ class CollectionModify : public Collection_crud_definition,
   std::shared_ptr<CollectionModify> array_delete(const std::string &doc_path);
   shcore::Value sort(const shcore::Argument_list &args);
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   shcore::Value this_object() override;
 #if !defined DOXYGEN_JS && !defined DOXYGEN_PY
   shcore::Value execute();
@@ -168,7 +174,7 @@ class CollectionModify : public Collection_crud_definition,
     if ("bind" == s) {
       return F::bind;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
@@ -62,6 +62,8 @@ CollectionRemove::CollectionRemove(std::shared_ptr<Collection> owner)
              "data");
   add_method("bind", std::bind(&CollectionRemove::bind_, this, _1, bind_id),
              "data");
+  add_method("executeAsync",
+             std::bind(&CollectionRemove::execute_async, this, _1));
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::remove,
@@ -198,8 +200,7 @@ shcore::Value CollectionRemove::remove(const shcore::Argument_list &args) {
 }
 
 CollectionRemove &CollectionRemove::set_filter(const std::string &filter) {
-  message_.set_allocated_criteria(
-      ::mysqlx::parser::parse_collection_filter(filter, &_placeholders));
+  message_.set_allocated_criteria(parse_criteria(filter, true));
 
   return *this;
 }
@@ -525,5 +526,43 @@ shcore::Value CollectionRemove::execute() {
 }
 #endif
 
+// Documentation of executeAsync function
+REGISTER_HELP_FUNCTION(executeAsync, CollectionRemove);
+REGISTER_HELP(COLLECTIONREMOVE_EXECUTEASYNC_BRIEF, "${EXECUTE_ASYNC_BRIEF}");
+REGISTER_HELP(COLLECTIONREMOVE_EXECUTEASYNC_RETURNS,
+              "@returns A PendingResult object which can be used to retrieve "
+              "the Result of the operation.");
+REGISTER_HELP(COLLECTIONREMOVE_EXECUTEASYNC_DETAIL, "${EXECUTE_ASYNC_DETAIL}");
+
+/**
+ * $(COLLECTIONREMOVE_EXECUTEASYNC_BRIEF)
+ *
+ * $(COLLECTIONREMOVE_EXECUTEASYNC_RETURNS)
+ *
+ * $(COLLECTIONREMOVE_EXECUTEASYNC_DETAIL)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked whenever execute() can be invoked.
+ */
+#if DOXYGEN_JS
+PendingResult CollectionRemove::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult CollectionRemove::execute_async() {}
+#endif
+shcore::Value CollectionRemove::execute_async(
+    const shcore::Argument_list &args) {
+  args.ensure_count(0, get_function_name("executeAsync").c_str());
+
+  std::shared_ptr<PendingResult> result;
+  try {
+    result = execute_pipelined(&message_);
+    update_functions(F::execute);
+  }
+  CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("executeAsync"));
+
+  return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(result));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
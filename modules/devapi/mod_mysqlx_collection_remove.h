@@ -59,6 +59,7 @@ class CollectionRemove : public Collection_crud_definition,
   CollectionRemove limit(Integer numberOfRows);
   CollectionRemove bind(String name, Value value);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   CollectionRemove remove(str searchCondition);
   CollectionRemove sort(list sortCriteria);
@@ -66,6 +67,7 @@ class CollectionRemove : public Collection_crud_definition,
   CollectionRemove limit(int numberOfRows);
   CollectionRemove bind(str name, Value value);
   Result execute();
+  PendingResult execute_async();
 #endif
   std::string class_name() const override { return "CollectionRemove"; }
 
@@ -74,8 +76,12 @@ class CollectionRemove : public Collection_crud_definition,
   shcore::Value sort(const shcore::Argument_list &args);
 
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   shcore::Value this_object() override;
 #if !defined DOXYGEN_JS && !defined DOXYGEN_PY
   shcore::Value execute();
@@ -107,7 +113,7 @@ class CollectionRemove : public Collection_crud_definition,
     if ("bind" == s) {
       return F::bind;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
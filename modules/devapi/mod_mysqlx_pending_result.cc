@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/devapi/mod_mysqlx_pending_result.h"
+
+#include <utility>
+
+#include "modules/mysqlxtest_utils.h"
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/include/shellcore/utils_help.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+// Documentation of PendingResult class
+REGISTER_HELP_CLASS(PendingResult, mysqlx);
+REGISTER_HELP_CLASS_TEXT(PENDINGRESULT, R"*(
+Handle to the result of an operation executed using <<<executeAsync>>>().
+
+Operations executed using <<<executeAsync>>>() are sent to the server without
+waiting for their results, which are received in the order the operations were
+executed. Results are received when they are requested using
+<<<getResult>>>(), when the maximum number of operations awaiting their
+results, as specified by the devapi.pipelineDepth shell option, is reached, or
+when any other operation is executed using the same session.
+
+If an operation fails, all the operations executed after it using
+<<<executeAsync>>>() which are still awaiting their results fail as well.
+)*");
+PendingResult::PendingResult(
+    std::shared_ptr<mysqlshdk::db::mysqlx::Pipelined_result> result,
+    Result_wrapper wrapper)
+    : m_pending(std::move(result)), m_wrapper(std::move(wrapper)) {
+  expose("isReady", &PendingResult::is_ready);
+  expose("getResult", &PendingResult::get_result);
+}
+
+// Documentation of isReady function
+REGISTER_HELP_FUNCTION(isReady, PendingResult);
+REGISTER_HELP_FUNCTION_TEXT(PENDINGRESULT_ISREADY, R"*(
+Checks whether the result of the operation was already received.
+
+@returns A boolean value indicating whether the result is available.
+)*");
+/**
+ * $(PENDINGRESULT_ISREADY_BRIEF)
+ *
+ * $(PENDINGRESULT_ISREADY)
+ */
+#if DOXYGEN_JS
+Bool PendingResult::isReady() {}
+#elif DOXYGEN_PY
+bool PendingResult::is_ready() {}
+#endif
+bool PendingResult::is_ready() const {
+  return !m_pending || m_pending->ready();
+}
+
+// Documentation of getResult function
+REGISTER_HELP_FUNCTION(getResult, PendingResult);
+REGISTER_HELP_FUNCTION_TEXT(PENDINGRESULT_GETRESULT, R"*(
+Waits for the result of the operation.
+
+@returns The result of the operation.
+
+The results of all the operations executed before this one are received
+first.
+
+An error is thrown if this operation has failed, or if any of the operations
+executed using <<<executeAsync>>>() before this one has failed.
+)*");
+/**
+ * $(PENDINGRESULT_GETRESULT_BRIEF)
+ *
+ * $(PENDINGRESULT_GETRESULT)
+ */
+#if DOXYGEN_JS
+Result PendingResult::getResult() {}
+#elif DOXYGEN_PY
+Result PendingResult::get_result() {}
+#endif
+shcore::Value PendingResult::get_result() {
+  if (!m_result) {
+    std::shared_ptr<mysqlshdk::db::mysqlx::Result> result;
+
+    if (m_pending) {
+      try {
+        result = std::static_pointer_cast<mysqlshdk::db::mysqlx::Result>(
+            m_pending->get());
+      }
+      CATCH_AND_TRANSLATE();
+    }
+
+    m_result = m_wrapper(result);
+  }
+
+  return m_result;
+}
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
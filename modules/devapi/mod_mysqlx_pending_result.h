@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_DEVAPI_MOD_MYSQLX_PENDING_RESULT_H_
+#define MODULES_DEVAPI_MOD_MYSQLX_PENDING_RESULT_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/scripting/types_cpp.h"
+#include "mysqlshdk/libs/db/mysqlx/result.h"
+#include "mysqlshdk/libs/db/mysqlx/session.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+/**
+ * \ingroup XDevAPI
+ * $(PENDINGRESULT_BRIEF)
+ *
+ * $(PENDINGRESULT)
+ */
+class SHCORE_PUBLIC PendingResult : public shcore::Cpp_object_bridge {
+ public:
+#if DOXYGEN_JS
+  Bool isReady();
+  Result getResult();
+#elif DOXYGEN_PY
+  bool is_ready();
+  Result get_result();
+#endif
+
+  using Result_wrapper = std::function<shcore::Value(
+      const std::shared_ptr<mysqlshdk::db::mysqlx::Result> &)>;
+
+  /**
+   * Creates the handle of the result.
+   *
+   * @param result Result of the pipelined statement, if null, statement was
+   *        not sent to the server and an empty result is returned.
+   * @param wrapper Creates the result object exposed to the user.
+   */
+  PendingResult(
+      std::shared_ptr<mysqlshdk::db::mysqlx::Pipelined_result> result,
+      Result_wrapper wrapper);
+
+  std::string class_name() const override { return "PendingResult"; }
+
+  bool is_ready() const;
+  shcore::Value get_result();
+
+ private:
+  std::shared_ptr<mysqlshdk::db::mysqlx::Pipelined_result> m_pending;
+  Result_wrapper m_wrapper;
+  shcore::Value m_result;
+};
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
+
+#endif  // MODULES_DEVAPI_MOD_MYSQLX_PENDING_RESULT_H_
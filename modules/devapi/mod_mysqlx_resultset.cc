@@ -525,7 +525,14 @@ shcore::Array_t DocResult::fetch_all() const {
 void DocResult::append_json(shcore::JSON_dumper &dumper) const {
   dumper.start_object();
 
-  dumper.append_value("documents", shcore::Value(fetch_all()));
+  // documents are appended as they are fetched, there's no need to hold all
+  // of them in memory
+  dumper.append_string("documents");
+  dumper.start_array();
+  while (const auto record = fetch_one()) {
+    dumper.append_value(shcore::Value(record));
+  }
+  dumper.end_array();
 
   BaseResult::append_json(dumper);
 
@@ -740,7 +747,14 @@ void RowResult::append_json(shcore::JSON_dumper &dumper) const {
 
   BaseResult::append_json(dumper);
 
-  dumper.append_value("rows", shcore::Value(fetch_all()));
+  // rows are appended as they are fetched, there's no need to hold all of
+  // them in memory
+  dumper.append_string("rows");
+  dumper.start_array();
+  while (const auto record = fetch_one()) {
+    dumper.append_value(shcore::Value(record));
+  }
+  dumper.end_array();
 
   if (create_object) dumper.end_object();
 }
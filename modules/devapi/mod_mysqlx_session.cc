@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cinttypes>
 #include <memory>
 #include <set>
 #include <string>
@@ -200,6 +201,9 @@ void Session::connect(const mysqlshdk::db::Connection_options &data) {
   try {
     _connection_options = data;
 
+    // statements prepared by a previous connection are gone
+    m_crud_statement_cache.clear();
+
     _session->connect(_connection_options);
 
     _connection_id = _session->get_connection_id();
@@ -265,9 +269,27 @@ void Session::close() {
     log_warning("Error occurred closing session: %s", e.what());
   }
 
+  // prepared statements are released by the server when the connection is
+  // closed, no need to deallocate them
+  m_crud_statement_cache.clear();
+
   _session = mysqlshdk::db::mysqlx::Session::create();
 }
 
+size_t Session::pipeline_depth() const {
+  return current_shell_options()->get().devapi_pipeline_depth;
+}
+
+void Session::deallocate_prepared_statement(uint32_t id) {
+  try {
+    if (_session->is_open()) _session->deallocate_prep_stmt(id);
+  } catch (const std::exception &e) {
+    log_warning("Error occurred deallocating prepared statement %" PRIu32
+                ": %s",
+                id, e.what());
+  }
+}
+
 // Documentation of createSchema function
 REGISTER_HELP_FUNCTION(createSchema, Session);
 REGISTER_HELP_FUNCTION_TEXT(SESSION_CREATESCHEMA, R"*(
@@ -30,6 +30,7 @@
 #include <vector>
 #include "db/mysqlx/mysqlxclient_clean.h"
 #include "db/mysqlx/session.h"
+#include "modules/devapi/crud_statement_cache.h"
 #include "modules/devapi/mod_mysqlx_resultset.h"
 #include "modules/mod_common.h"
 #include "scripting/types.h"
@@ -224,6 +225,19 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   void disable_prepared_statements() { m_allow_prepared_statements = false; }
   bool allow_prepared_statements() { return m_allow_prepared_statements; }
 
+  /**
+   * Cache of the statements executed by the CRUD operations created using this
+   * session.
+   */
+  Crud_statement_cache *crud_statement_cache() {
+    return &m_crud_statement_cache;
+  }
+
+  /**
+   * Maximum number of pipelined statements which can await their results.
+   */
+  size_t pipeline_depth() const;
+
   void _enable_notices(const std::vector<std::string> &notices);
   shcore::Dictionary_t _fetch_notice();
 
@@ -261,8 +275,11 @@ class SHCORE_PUBLIC Session : public ShellBaseSession,
   bool m_allow_prepared_statements = true;
   std::list<shcore::Dictionary_t> m_notices;
   bool m_notices_enabled = false;
+  Crud_statement_cache m_crud_statement_cache{
+      [this](uint32_t id) { deallocate_prepared_statement(id); }};
 
   void reset_session();
+  void deallocate_prepared_statement(uint32_t id);
 };
 
 }  // namespace mysqlx
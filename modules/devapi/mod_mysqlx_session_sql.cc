@@ -32,6 +32,7 @@
 #include "mysqlxtest_utils.h"
 #include "scripting/common.h"
 #include "shellcore/utils_help.h"
+#include "utils/utils_general.h"
 
 using namespace std::placeholders;
 using namespace shcore;
@@ -53,6 +54,7 @@ SqlExecute::SqlExecute(std::shared_ptr<Session> owner)
   expose("sql", &SqlExecute::sql, "statement");
   expose("bind", &SqlExecute::bind, "value");
   expose("execute", &SqlExecute::execute);
+  expose("executeAsync", &SqlExecute::execute_async);
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::sql, F::bind | F::execute);
@@ -241,5 +243,62 @@ std::shared_ptr<SqlResult> SqlExecute::execute_sql(
   return result;
 }
 
+REGISTER_HELP_FUNCTION(executeAsync, SqlExecute);
+REGISTER_HELP_FUNCTION_TEXT(SQLEXECUTE_EXECUTEASYNC, R"*(
+Sends the operation to the server without waiting for its result.
+
+@returns A PendingResult object which can be used to retrieve the SqlResult of
+the operation.
+
+The result is received when it is requested, this allows to execute several
+operations without waiting for the results of the previous ones. See
+PendingResult for details.
+
+This function can be invoked after:
+@li sql(String statement)
+@li bind(Value data)
+)*");
+/**
+ * $(SQLEXECUTE_EXECUTEASYNC_BRIEF)
+ *
+ * $(SQLEXECUTE_EXECUTEASYNC)
+ */
+#if DOXYGEN_JS
+PendingResult SqlExecute::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult SqlExecute::execute_async() {}
+#endif
+
+std::shared_ptr<PendingResult> SqlExecute::execute_async() {
+  const auto session = _session.lock();
+
+  if (!session) {
+    throw shcore::Exception::logic_error(
+        "Unable to execute sql, no Session available");
+  }
+
+  // parameters are consumed by the execution, regardless of its outcome
+  shcore::Scoped_callback clear_parameters([this]() { _parameters->clear(); });
+
+  ::Mysqlx::Sql::StmtExecute stmt;
+  stmt.set_namespace_("sql");
+  stmt.set_stmt(_sql);
+
+  std::shared_ptr<mysqlshdk::db::mysqlx::Pipelined_result> result;
+
+  try {
+    insert_bound_values(_parameters, stmt.mutable_args());
+    result =
+        session->session()->execute_async(stmt, session->pipeline_depth());
+  }
+  CATCH_AND_TRANSLATE();
+
+  return std::make_shared<PendingResult>(
+      std::move(result),
+      [](const std::shared_ptr<mysqlshdk::db::mysqlx::Result> &r) {
+        return shcore::Value::wrap(std::make_shared<SqlResult>(r));
+      });
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
@@ -31,6 +31,7 @@
 #include <string>
 #include "db/mysqlx/mysqlxclient_clean.h"
 #include "modules/devapi/dynamic_object.h"
+#include "modules/devapi/mod_mysqlx_pending_result.h"
 #include "modules/devapi/mod_mysqlx_resultset.h"
 
 namespace mysqlsh {
@@ -50,10 +51,12 @@ class SqlExecute : public Dynamic_object,
   SqlExecute sql(String statement);
   SqlExecute bind(Value data);
   SqlResult execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   SqlExecute sql(str statement);
   SqlExecute bind(Value data);
   SqlResult execute();
+  PendingResult execute_async();
 #endif
   explicit SqlExecute(std::shared_ptr<Session> owner);
   std::string class_name() const override { return "SqlExecute"; }
@@ -64,6 +67,7 @@ class SqlExecute : public Dynamic_object,
     _parameters->push_back(value);
   }
   std::shared_ptr<SqlResult> execute();
+  std::shared_ptr<PendingResult> execute_async();
 
  private:
   std::weak_ptr<Session> _session;
@@ -89,7 +93,7 @@ class SqlExecute : public Dynamic_object,
     if ("bind" == s) {
       return F::bind;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
@@ -54,6 +54,7 @@ class TableDelete : public Table_crud_definition,
   shcore::Value where(const shcore::Argument_list &args);
   shcore::Value order_by(const shcore::Argument_list &args);
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
 #if DOXYGEN_JS
   TableDelete delete ();
   TableDelete where(String expression);
@@ -62,6 +63,7 @@ class TableDelete : public Table_crud_definition,
   TableDelete limit(Integer numberOfRows);
   TableDelete bind(String name, Value value);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   TableDelete delete ();
   TableDelete where(str expression);
@@ -70,12 +72,16 @@ class TableDelete : public Table_crud_definition,
   TableDelete limit(int numberOfRows);
   TableDelete bind(str name, Value value);
   Result execute();
+  PendingResult execute_async();
 #endif
  private:
   Mysqlx::Crud::Delete message_;
 
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   shcore::Value this_object() override;
 
   struct F {
@@ -103,7 +109,7 @@ class TableDelete : public Table_crud_definition,
     if ("bind" == s) {
       return F::bind;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
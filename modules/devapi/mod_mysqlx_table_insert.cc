@@ -60,6 +60,7 @@ TableInsert::TableInsert(std::shared_ptr<Table> owner)
   // The values function should not be enabled if values were already given
   add_method("insert", std::bind(&TableInsert::insert, this, _1), "data");
   add_method("values", std::bind(&TableInsert::values, this, _1), "data");
+  add_method("executeAsync", std::bind(&TableInsert::execute_async, this, _1));
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::insert, F::values,
@@ -414,5 +415,49 @@ shcore::Value TableInsert::execute(const shcore::Argument_list &args) {
                 : shcore::Value::Null();
 }
 
+// Documentation of executeAsync function
+REGISTER_HELP_FUNCTION(executeAsync, TableInsert);
+REGISTER_HELP(TABLEINSERT_EXECUTEASYNC_BRIEF, "${EXECUTE_ASYNC_BRIEF}");
+REGISTER_HELP(TABLEINSERT_EXECUTEASYNC_RETURNS,
+              "@returns A PendingResult object which can be used to retrieve "
+              "the Result of the operation.");
+REGISTER_HELP(TABLEINSERT_EXECUTEASYNC_DETAIL, "${EXECUTE_ASYNC_DETAIL}");
+
+/**
+ * $(TABLEINSERT_EXECUTEASYNC_BRIEF)
+ *
+ * $(TABLEINSERT_EXECUTEASYNC_RETURNS)
+ *
+ * $(TABLEINSERT_EXECUTEASYNC_DETAIL)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked whenever execute() can be invoked.
+ */
+#if DOXYGEN_JS
+PendingResult TableInsert::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult TableInsert::execute_async() {}
+#endif
+shcore::Value TableInsert::execute_async(const shcore::Argument_list &args) {
+  args.ensure_count(0, get_function_name("executeAsync").c_str());
+
+  std::shared_ptr<PendingResult> result;
+  try {
+    if (!message_.row().empty()) {
+      result = execute_pipelined(&message_);
+    } else {
+      result = std::make_shared<PendingResult>(
+          nullptr,
+          [](const std::shared_ptr<mysqlshdk::db::mysqlx::Result> &) {
+            return shcore::Value::wrap(std::make_shared<Result>(nullptr));
+          });
+    }
+  }
+  CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("executeAsync"));
+
+  return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(result));
+}
+
 }  // namespace mysqlx
 }  // namespace mysqlsh
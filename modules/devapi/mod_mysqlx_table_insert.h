@@ -49,6 +49,7 @@ class TableInsert : public Table_crud_definition,
   TableInsert insert(JSON columns);
   TableInsert values(Value value[, Value value, ...]);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   TableInsert insert();
   TableInsert insert(list columns);
@@ -56,6 +57,7 @@ class TableInsert : public Table_crud_definition,
   TableInsert insert(JSON columns);
   TableInsert values(Value value[, Value value, ...]);
   Result execute();
+  PendingResult execute_async();
 #endif
   explicit TableInsert(std::shared_ptr<Table> owner);
   std::string class_name() const override { return "TableInsert"; }
@@ -63,6 +65,7 @@ class TableInsert : public Table_crud_definition,
   shcore::Value values(const shcore::Argument_list &args);
 
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
 
  private:
   Mysqlx::Crud::Insert message_;
@@ -85,7 +88,7 @@ class TableInsert : public Table_crud_definition,
     if ("values" == s) {
       return F::values;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("insertFields" == s) {
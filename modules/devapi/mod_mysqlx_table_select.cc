@@ -319,8 +319,8 @@ shcore::Value TableSelect::where(const shcore::Argument_list &args) {
   args.ensure_count(1, get_function_name("where").c_str());
 
   try {
-    message_.set_allocated_criteria(::mysqlx::parser::parse_table_filter(
-        args.string_at(0), &_placeholders));
+    message_.set_allocated_criteria(
+        parse_criteria(args.string_at(0), false));
 
     update_functions(F::where);
     reset_prepared_statement();
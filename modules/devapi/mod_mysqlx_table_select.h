@@ -98,6 +98,9 @@ class TableSelect : public Table_crud_definition,
   Mysqlx::Crud::Find message_;
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   void set_lock_contention(const shcore::Argument_list &args);
 
   shcore::Value this_object() override;
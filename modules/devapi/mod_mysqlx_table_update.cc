@@ -58,6 +58,7 @@ TableUpdate::TableUpdate(std::shared_ptr<Table> owner)
   add_method("limit", std::bind(&TableUpdate::limit, this, _1, limit_id, false),
              "data");
   add_method("bind", std::bind(&TableUpdate::bind_, this, _1, bind_id), "data");
+  add_method("executeAsync", std::bind(&TableUpdate::execute_async, this, _1));
 
   // Registers the dynamic function behavior
   register_dynamic_function(F::update, F::set);
@@ -331,8 +332,8 @@ shcore::Value TableUpdate::where(const shcore::Argument_list &args) {
   args.ensure_count(1, get_function_name("where").c_str());
 
   try {
-    message_.set_allocated_criteria(::mysqlx::parser::parse_table_filter(
-        args.string_at(0), &_placeholders));
+    message_.set_allocated_criteria(
+        parse_criteria(args.string_at(0), false));
 
     // Updates the exposed functions
     update_functions(F::where);
@@ -646,3 +647,40 @@ void TableUpdate::set_prepared_stmt() {
   update_limits();
   *m_prep_stmt.mutable_stmt()->mutable_update() = message_;
 }
+
+// Documentation of executeAsync function
+REGISTER_HELP_FUNCTION(executeAsync, TableUpdate);
+REGISTER_HELP(TABLEUPDATE_EXECUTEASYNC_BRIEF, "${EXECUTE_ASYNC_BRIEF}");
+REGISTER_HELP(TABLEUPDATE_EXECUTEASYNC_RETURNS,
+              "@returns A PendingResult object which can be used to retrieve "
+              "the Result of the operation.");
+REGISTER_HELP(TABLEUPDATE_EXECUTEASYNC_DETAIL, "${EXECUTE_ASYNC_DETAIL}");
+
+/**
+ * $(TABLEUPDATE_EXECUTEASYNC_BRIEF)
+ *
+ * $(TABLEUPDATE_EXECUTEASYNC_RETURNS)
+ *
+ * $(TABLEUPDATE_EXECUTEASYNC_DETAIL)
+ *
+ * #### Method Chaining
+ *
+ * This function can be invoked whenever execute() can be invoked.
+ */
+#if DOXYGEN_JS
+PendingResult TableUpdate::executeAsync() {}
+#elif DOXYGEN_PY
+PendingResult TableUpdate::execute_async() {}
+#endif
+shcore::Value TableUpdate::execute_async(const shcore::Argument_list &args) {
+  args.ensure_count(0, get_function_name("executeAsync").c_str());
+
+  std::shared_ptr<PendingResult> result;
+  try {
+    result = execute_pipelined(&message_);
+    update_functions(F::execute);
+  }
+  CATCH_AND_TRANSLATE_CRUD_EXCEPTION(get_function_name("executeAsync"));
+
+  return shcore::Value(std::static_pointer_cast<shcore::Object_bridge>(result));
+}
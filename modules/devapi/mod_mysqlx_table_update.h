@@ -59,6 +59,7 @@ class TableUpdate : public Table_crud_definition,
   TableUpdate limit(Integer numberOfRows);
   TableUpdate bind(String name, Value value);
   Result execute();
+  PendingResult executeAsync();
 #elif DOXYGEN_PY
   TableUpdate update();
   TableUpdate set(str attribute, Value value);
@@ -68,6 +69,7 @@ class TableUpdate : public Table_crud_definition,
   TableUpdate limit(int numberOfRows);
   TableUpdate bind(str name, Value value);
   Result execute();
+  PendingResult execute_async();
 #endif
   explicit TableUpdate(std::shared_ptr<Table> owner);
   std::string class_name() const override { return "TableUpdate"; }
@@ -78,12 +80,16 @@ class TableUpdate : public Table_crud_definition,
   shcore::Value where(const shcore::Argument_list &args);
   shcore::Value order_by(const shcore::Argument_list &args);
   shcore::Value execute(const shcore::Argument_list &args) override;
+  shcore::Value execute_async(const shcore::Argument_list &args);
 
  private:
   Mysqlx::Crud::Update message_;
 
   void set_prepared_stmt() override;
   void update_limits() override { set_limits_on_message(&message_); }
+  std::string prepared_statement_key() override {
+    return statement_key(message_);
+  }
   shcore::Value this_object() override;
 
   struct F {
@@ -116,7 +122,7 @@ class TableUpdate : public Table_crud_definition,
     if ("bind" == s) {
       return F::bind;
     }
-    if ("execute" == s) {
+    if ("execute" == s || "executeAsync" == s) {
       return F::execute;
     }
     if ("help" == s) {
@@ -642,7 +642,14 @@ void ClassicResult::append_json(shcore::JSON_dumper &dumper) const {
   dumper.append_value("executionTime", get_member("executionTime"));
 
   dumper.append_value("info", get_member("info"));
-  dumper.append_value("rows", shcore::Value(fetch_all()));
+  // rows are appended as they are fetched, there's no need to hold all of
+  // them in memory
+  dumper.append_string("rows");
+  dumper.start_array();
+  while (const auto record = fetch_one()) {
+    dumper.append_value(shcore::Value(record));
+  }
+  dumper.end_array();
 
   if (mysqlsh::current_shell_options()->get().show_warnings) {
     dumper.append_value("warningCount", get_member("warningsCount"));
@@ -50,6 +50,10 @@ execution of an SQL script in batch mode shall continue if errors occur
 @li connectTimeout: float, default connection timeout used by Shell sessions,
 in seconds
 
+@li credentialStore.cacheTtl: integer, number of seconds for which the
+passwords fetched from or stored by the credential helper are cached in memory,
+0 disables the cache
+
 @li credentialStore.excludeFilters: array of URLs for which
 automatic password storage is disabled, supports glob characters '*' and '?'
 
@@ -58,6 +62,10 @@ use to fetch/store passwords; a special value "default" is
 supported to use platform default helper; a special value
 "@<disabled>" is supported to disable the credential store
 
+@li credentialStore.persistentHelper: bool, starts the credential helper once
+and uses it to execute all operations, instead of starting it for each
+operation
+
 @li credentialStore.savePasswords: controls automatic password
 storage, allowed values: "always", "prompt" or "never"
 
@@ -88,6 +96,9 @@ allowed values: "js", "py", "sql" or "none"
 @li devapi.dbObjectHandles: true to enable schema collection
 and table name aliases in the db object, for DevAPI operations.
 
+@li devapi.pipelineDepth: maximum number of DevAPI operations executed
+using executeAsync() which can await their results.
+
 @li history.autoSave: true to save command history when exiting the shell
 
 @li history.maxSize: number of entries to keep in command history
@@ -158,7 +169,12 @@ Default is 0.
 @li ssh.configFile string path default empty, custom path for SSH configuration.
 If not defined the standard SSH paths will be used (~/.ssh/config).
 
-@li ssh.bufferSize integer default 10240 bytes, used for tunnel data transfer
+@li ssh.bufferSize integer default 65536 bytes, used for tunnel data transfer
+
+@li ssh.tunnelThreads integer default 1, maximum number of threads, each using
+a separate SSH connection, which transfer data of a single SSH tunnel. Values
+greater than 1 open additional SSH connections to the server. The number of
+threads is also limited by the number of CPU cores.
 
 The resultFormat option supports the following values to modify the
 format of printed query results:
@@ -621,75 +621,81 @@ Connection_options get_classic_connection_options(
   return co;
 }
 
-std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
+shcore::Value get_row_value(const mysqlshdk::db::IRow &row, uint32_t i) {
   using mysqlshdk::db::Type;
   using shcore::Date;
   using shcore::Value;
-  std::vector<Value> value_array;
 
-  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
-    Value v;
+  Value v;
 
-    if (row.is_null(i)) {
-      v = Value::Null();
-    } else {
-      switch (row.get_type(i)) {
-        case Type::Null:
-          v = Value::Null();
-          break;
-
-        case Type::String:
-          v = Value(row.get_string(i));
-          break;
-
-        case Type::Integer:
-          v = Value(row.get_int(i));
-          break;
-
-        case Type::UInteger:
-          v = Value(row.get_uint(i));
-          break;
-
-        case Type::Float:
-          v = Value(row.get_float(i));
-          break;
-
-        case Type::Double:
-          v = Value(row.get_double(i));
-          break;
-
-        case Type::Decimal:
-          v = Value(row.get_as_string(i));
-          break;
-
-        case Type::Date:
-        case Type::DateTime:
-          v = Value::wrap(
-              std::make_shared<Date>(Date::unrepr(row.get_string(i))));
-          break;
-
-        case Type::Time:
-          v = Value::wrap(
-              std::make_shared<Date>(Date::unrepr(row.get_string(i))));
-          break;
-
-        case Type::Bit:
-          v = Value(std::get<0>(row.get_bit(i)));
-          break;
-
-        case Type::Bytes:
-          v = Value(row.get_string(i), true);
-          break;
-        case Type::Geometry:
-        case Type::Json:
-        case Type::Enum:
-        case Type::Set:
-          v = Value(row.get_string(i));
-          break;
-      }
+  if (row.is_null(i)) {
+    v = Value::Null();
+  } else {
+    switch (row.get_type(i)) {
+      case Type::Null:
+        v = Value::Null();
+        break;
+
+      case Type::String:
+        v = Value(row.get_string(i));
+        break;
+
+      case Type::Integer:
+        v = Value(row.get_int(i));
+        break;
+
+      case Type::UInteger:
+        v = Value(row.get_uint(i));
+        break;
+
+      case Type::Float:
+        v = Value(row.get_float(i));
+        break;
+
+      case Type::Double:
+        v = Value(row.get_double(i));
+        break;
+
+      case Type::Decimal:
+        v = Value(row.get_as_string(i));
+        break;
+
+      case Type::Date:
+      case Type::DateTime:
+        v = Value::wrap(
+            std::make_shared<Date>(Date::unrepr(row.get_string(i))));
+        break;
+
+      case Type::Time:
+        v = Value::wrap(
+            std::make_shared<Date>(Date::unrepr(row.get_string(i))));
+        break;
+
+      case Type::Bit:
+        v = Value(std::get<0>(row.get_bit(i)));
+        break;
+
+      case Type::Bytes:
+        v = Value(row.get_string(i), true);
+        break;
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set:
+        v = Value(row.get_string(i));
+        break;
     }
+  }
 
-    value_array.emplace_back(std::move(v));
+  return v;
+}
+
+std::vector<shcore::Value> get_row_values(const mysqlshdk::db::IRow &row) {
+  std::vector<shcore::Value> value_array;
+  value_array.reserve(row.num_fields());
+
+  for (uint32_t i = 0, c = row.num_fields(); i < c; i++) {
+    value_array.emplace_back(get_row_value(row, i));
   }
 
   return value_array;
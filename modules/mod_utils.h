@@ -171,6 +171,16 @@ establish_mysql_session(const Connection_options &options,
 Connection_options SHCORE_PUBLIC get_classic_connection_options(
     const std::shared_ptr<mysqlshdk::db::ISession> &session);
 
+/**
+ * Converts SQL value of the given field of a row into shcore::Value.
+ *
+ * @param row Row which holds the value.
+ * @param index Index of the field to be converted.
+ *
+ * @return Converted value.
+ */
+shcore::Value get_row_value(const mysqlshdk::db::IRow &row, uint32_t index);
+
 /**
  * Converts SQL values from a row into shcore::Values.
  *
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/compare/compare_operation.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/console.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/mysql/instance.h"
+#include "mysqlshdk/libs/storage/backend/in_memory/virtual_config.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "modules/mod_utils.h"
+
+namespace mysqlsh {
+namespace compare {
+
+namespace {
+
+using mysqlshdk::db::Row_difference;
+
+std::string where(const std::string &condition) {
+  return condition.empty() ? "" : " WHERE " + condition;
+}
+
+std::string columns(const dump::Table_chunk &chunk) {
+  return shcore::str_join(chunk.info->columns, ",",
+                          [](const auto &c) { return c->quoted_name; });
+}
+
+std::string from(const dump::Table_chunk &chunk) {
+  return " FROM " + chunk.quoted_name + chunk.partitions + where(chunk.where);
+}
+
+std::string order_by(
+    const std::vector<dump::Instance_cache::Column *> &columns) {
+  using mysqlshdk::db::Type;
+
+  // order needs to match the one used by mysqlshdk::db::compare_field(): NULL
+  // is greater than any other value, values which are compared as strings are
+  // compared byte by byte, regardless of the collation of a column
+  return shcore::str_join(columns, ",", [](const auto &c) {
+    std::string result;
+
+    if (c->nullable) {
+      result += "ISNULL(" + c->quoted_name + "),";
+    }
+
+    switch (c->type) {
+      case Type::Date:
+      case Type::DateTime:
+      case Type::Time:
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set:
+      case Type::String:
+      case Type::Bytes:
+        result += "CAST(" + c->quoted_name + " AS BINARY)";
+        break;
+
+      default:
+        result += c->quoted_name;
+        break;
+    }
+
+    return result;
+  });
+}
+
+std::string checksum_query(const dump::Table_chunk &chunk) {
+  std::string nulls;
+
+  for (const auto &column : chunk.info->columns) {
+    if (column->nullable) {
+      nulls += "ISNULL(" + column->quoted_name + "),";
+    }
+  }
+
+  if (!nulls.empty()) {
+    // CONCAT_WS() skips NULL values, they are marked separately
+    nulls.pop_back();
+    nulls = "CONCAT(" + nulls + "),";
+  }
+
+  // binary separator makes the whole string binary, this avoids errors caused
+  // by columns which use different character sets; hash of a row is the first
+  // 64 bits of its MD5, BIT_XOR() and SUM() of hashes do not depend on the
+  // order of rows
+  const auto hash = "CAST(CONV(LEFT(MD5(CONCAT_WS(0x00," + nulls +
+                    columns(chunk) + ")),16),16,10) AS UNSIGNED)";
+
+  return "SELECT COUNT(*),COALESCE(BIT_XOR(h),0),COALESCE(SUM(h),0) FROM "
+         "(SELECT " +
+         hash + " AS h" + from(chunk) + ") AS t";
+}
+
+std::string describe(const dump::Table_chunk &chunk) {
+  return "Table " + chunk.quoted_name + " (" + chunk.id + ")";
+}
+
+std::string describe_key(const dump::Table_chunk &chunk,
+                         const std::vector<uint32_t> &key_fields,
+                         const mysqlshdk::db::IRow &row) {
+  return shcore::str_join(key_fields, ", ", [&chunk, &row](uint32_t idx) {
+    const auto value = row.is_null(idx)
+                           ? std::string{"NULL"}
+                           : shcore::quote_sql_string(row.get_as_string(idx));
+    return chunk.info->columns[idx]->quoted_name + "=" + value;
+  });
+}
+
+}  // namespace
+
+Data_comparer::Data_comparer(
+    const std::shared_ptr<mysqlshdk::db::ISession> &target,
+    const dump::Dump_options &options, uint64_t max_row_differences)
+    : m_options(options), m_max_row_differences(max_row_differences) {
+  for (std::size_t i = 0; i < m_options.threads(); ++i) {
+    auto session = establish_session(target->get_connection_options(), false);
+
+    initialize_session(session);
+
+    m_sessions.push(std::move(session));
+  }
+}
+
+void Data_comparer::initialize_session(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
+  // needs to match the settings of the dumper's sessions
+  session->execute("SET SQL_MODE = '';");
+  session->executef("SET NAMES ?;", m_options.character_set());
+
+  if (m_options.use_timezone_utc()) {
+    session->execute("SET TIME_ZONE = '+00:00';");
+  }
+}
+
+dump::Dump_write_result Data_comparer::process(
+    const dump::Table_chunk &chunk,
+    const std::shared_ptr<mysqlshdk::db::ISession> &source) {
+  auto target = m_sessions.pop();
+  shcore::on_leave_scope release_session(
+      [this, &target]() { m_sessions.push(std::move(target)); });
+
+  // if this throws, transaction is going to be implicitly committed when
+  // the session is used again
+  target->execute("START TRANSACTION WITH CONSISTENT SNAPSHOT");
+
+  const auto source_checksum = checksum(chunk, source);
+  const auto target_checksum = checksum(chunk, target);
+
+  ++m_chunks;
+  m_source_rows += source_checksum.rows;
+  m_target_rows += target_checksum.rows;
+
+  if (source_checksum != target_checksum) {
+    ++m_different_chunks;
+
+    current_console()->print_warning(shcore::str_format(
+        "%s: checksums differ, rows on source: %" PRIu64
+        ", rows on target: %" PRIu64,
+        describe(chunk).c_str(), source_checksum.rows, target_checksum.rows));
+
+    if (m_max_row_differences > 0) {
+      compare_rows(chunk, source, target);
+    }
+  }
+
+  target->execute("COMMIT");
+
+  dump::Dump_write_result result;
+  result.write_rows(source_checksum.rows);
+  result.write_data(source_checksum.rows * chunk.info->average_row_length);
+  return result;
+}
+
+void Data_comparer::summary() const {
+  const auto console = current_console();
+
+  console->print_status("Chunks compared: " + std::to_string(m_chunks));
+  console->print_status("Rows on source: " + std::to_string(m_source_rows));
+  console->print_status("Rows on target: " + std::to_string(m_target_rows));
+  console->print_status("Chunks with differences: " +
+                        std::to_string(m_different_chunks));
+
+  if (m_max_row_differences > 0) {
+    console->print_status("Rows with differences reported: " +
+                          std::to_string(m_total_reported_rows));
+  }
+}
+
+Data_comparer::Checksum Data_comparer::checksum(
+    const dump::Table_chunk &chunk,
+    const std::shared_ptr<mysqlshdk::db::ISession> &session) const {
+  const auto query = checksum_query(chunk);
+
+  try {
+    const auto row = session->query(query)->fetch_one_or_throw();
+    Checksum result;
+
+    result.rows = row->get_uint(0);
+    result.bit_xor = row->get_as_string(1);
+    result.sum = row->get_as_string(2);
+
+    return result;
+  } catch (const mysqlshdk::db::Error &e) {
+    log_error(
+        "Failed to compute checksum of %s (%s) using query: %s, error: %s",
+        chunk.quoted_name.c_str(), chunk.id.c_str(), query.c_str(),
+        e.format().c_str());
+    throw;
+  }
+}
+
+void Data_comparer::compare_rows(
+    const dump::Table_chunk &chunk,
+    const std::shared_ptr<mysqlshdk::db::ISession> &source,
+    const std::shared_ptr<mysqlshdk::db::ISession> &target) {
+  const auto &columns = chunk.info->columns;
+  std::vector<uint32_t> key_fields;
+
+  if (chunk.info->index.valid()) {
+    for (const auto &c : chunk.info->index.columns()) {
+      key_fields.emplace_back(
+          std::find(columns.begin(), columns.end(), c) - columns.begin());
+    }
+  } else {
+    // whole row is the key
+    for (uint32_t i = 0; i < columns.size(); ++i) {
+      key_fields.emplace_back(i);
+    }
+  }
+
+  // both results need to be sorted using the same key
+  const auto query =
+      "SELECT " + compare::columns(chunk) + from(chunk) + " ORDER BY " +
+      order_by(chunk.info->index.valid() ? chunk.info->index.columns()
+                                         : columns);
+
+  const auto source_result = source->query(query);
+  const auto target_result = target->query(query);
+
+  report_definitions(chunk, source_result->get_metadata(),
+                     target_result->get_metadata());
+
+  mysqlshdk::db::find_different_rows_with_key_indexes(
+      source_result.get(), target_result.get(), key_fields,
+      [&chunk, &key_fields, this](const mysqlshdk::db::IRow *s,
+                                  const mysqlshdk::db::IRow *t,
+                                  Row_difference difference) {
+        return report_row(chunk, key_fields, s, t, difference);
+      });
+}
+
+void Data_comparer::report_definitions(
+    const dump::Table_chunk &chunk,
+    const std::vector<mysqlshdk::db::Column> &source,
+    const std::vector<mysqlshdk::db::Column> &target) {
+  std::vector<std::string> fields;
+
+  for (std::size_t i = 0; i < source.size() && i < target.size(); ++i) {
+    if (!(source[i] == target[i])) {
+      fields.emplace_back(chunk.info->columns[i]->quoted_name);
+    }
+  }
+
+  if (fields.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (!m_reported_definitions.emplace(chunk.quoted_name).second) {
+      return;
+    }
+  }
+
+  current_console()->print_warning(
+      "Table " + chunk.quoted_name +
+      ": definitions of columns differ (i.e. type, length or collation): " +
+      shcore::str_join(fields, ", ") +
+      ", their values are compared byte by byte");
+}
+
+bool Data_comparer::report_row(const dump::Table_chunk &chunk,
+                               const std::vector<uint32_t> &key_fields,
+                               const mysqlshdk::db::IRow *source,
+                               const mysqlshdk::db::IRow *target,
+                               Row_difference difference) {
+  {
+    std::lock_guard lock{m_mutex};
+    auto &reported = m_reported_rows[chunk.quoted_name];
+
+    if (reported >= m_max_row_differences) {
+      // stop comparing this chunk
+      return false;
+    }
+
+    ++reported;
+    ++m_total_reported_rows;
+  }
+
+  std::string message = describe(chunk) + ": ";
+
+  switch (difference) {
+    case Row_difference::Identical:
+      return true;
+
+    case Row_difference::Fields_differ: {
+      std::vector<std::string> fields;
+
+      mysqlshdk::db::find_different_row_fields(
+          *source, *target, [&chunk, &fields](int idx) {
+            fields.emplace_back(chunk.info->columns[idx]->quoted_name);
+            return true;
+          });
+
+      message += "row " + describe_key(chunk, key_fields, *source) +
+                 " differs, columns: " + shcore::str_join(fields, ", ");
+      break;
+    }
+
+    case Row_difference::Row_missing:
+      message += "row " + describe_key(chunk, key_fields, *source) +
+                 " is missing on target";
+      break;
+
+    case Row_difference::Row_added:
+      message += "row " + describe_key(chunk, key_fields, *target) +
+                 " exists only on target";
+      break;
+  }
+
+  current_console()->print_info(message);
+
+  return true;
+}
+
+std::shared_ptr<mysqlshdk::db::ISession> prepare(
+    const mysqlshdk::db::Connection_options &connection_options,
+    dump::Ddl_dumper_options *options) {
+  std::shared_ptr<mysqlshdk::db::ISession> target;
+
+  try {
+    target = establish_session(connection_options,
+                               current_shell_options()->get().wizards);
+  } catch (const mysqlshdk::db::Error &e) {
+    throw std::invalid_argument("Could not connect to the target instance: " +
+                                e.format());
+  }
+
+  // only the metadata is written, small pages are enough
+  const auto storage =
+      std::make_shared<mysqlshdk::storage::in_memory::Virtual_config>(
+          1024 * 1024);  // 1MB
+  const auto output = mysqlshdk::storage::make_directory("memory", storage);
+  output->create();
+
+  options->set_storage_config(storage);
+  options->set_output_url(output->full_path().real());
+  options->validate();
+
+  const auto host_info = [](const auto &session) {
+    const auto instance = mysqlshdk::mysql::Instance(session);
+    return instance.get_canonical_address();
+  };
+
+  const auto src = host_info(options->session());
+  const auto tgt = host_info(target);
+
+  if (src == tgt) {
+    throw std::invalid_argument(
+        "The target instance is the same as the source instance");
+  }
+
+  current_console()->print_info("Comparing data, source: " + src +
+                                ", target: " + tgt);
+
+  return target;
+}
+
+}  // namespace compare
+}  // namespace mysqlsh
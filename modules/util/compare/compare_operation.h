@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_OPERATION_H_
+#define MODULES_UTIL_COMPARE_COMPARE_OPERATION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/interrupt_handler.h"
+#include "mysqlshdk/libs/db/connection_options.h"
+#include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/db/utils/diff.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+#include "modules/util/dump/ddl_dumper_options.h"
+#include "modules/util/dump/dump_writer.h"
+#include "modules/util/dump/dumper.h"
+
+namespace mysqlsh {
+namespace compare {
+
+/**
+ * Compares data of table chunks between the source and the target instance.
+ *
+ * Each chunk is first compared using a checksum computed by both servers, if
+ * checksums differ, rows of the chunk are fetched from both servers and
+ * differences are reported.
+ */
+class Data_comparer final : public dump::Table_chunk_processor {
+ public:
+  Data_comparer() = delete;
+
+  /**
+   * Creates the comparer.
+   *
+   * @param target Session to the target instance.
+   * @param options Options of the dumper, used to initialize the sessions.
+   * @param max_row_differences Maximum number of different rows reported for
+   *        each table, 0 disables comparison of rows.
+   */
+  Data_comparer(const std::shared_ptr<mysqlshdk::db::ISession> &target,
+                const dump::Dump_options &options,
+                uint64_t max_row_differences);
+
+  Data_comparer(const Data_comparer &) = delete;
+  Data_comparer(Data_comparer &&) = delete;
+
+  Data_comparer &operator=(const Data_comparer &) = delete;
+  Data_comparer &operator=(Data_comparer &&) = delete;
+
+  ~Data_comparer() override = default;
+
+  /**
+   * Compares the given chunk, reports the differences.
+   *
+   * @param chunk Chunk to be compared.
+   * @param source Session to the source instance.
+   *
+   * @returns Number of compared rows.
+   */
+  dump::Dump_write_result process(
+      const dump::Table_chunk &chunk,
+      const std::shared_ptr<mysqlshdk::db::ISession> &source) override;
+
+  void summary() const;
+
+  bool has_differences() const { return 0 != m_different_chunks; }
+
+ private:
+  struct Checksum {
+    uint64_t rows = 0;
+    std::string bit_xor;
+    std::string sum;
+
+    bool operator==(const Checksum &other) const {
+      return rows == other.rows && bit_xor == other.bit_xor && sum == other.sum;
+    }
+
+    bool operator!=(const Checksum &other) const { return !(*this == other); }
+  };
+
+  void initialize_session(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session) const;
+
+  Checksum checksum(
+      const dump::Table_chunk &chunk,
+      const std::shared_ptr<mysqlshdk::db::ISession> &session) const;
+
+  void compare_rows(const dump::Table_chunk &chunk,
+                    const std::shared_ptr<mysqlshdk::db::ISession> &source,
+                    const std::shared_ptr<mysqlshdk::db::ISession> &target);
+
+  void report_definitions(const dump::Table_chunk &chunk,
+                          const std::vector<mysqlshdk::db::Column> &source,
+                          const std::vector<mysqlshdk::db::Column> &target);
+
+  bool report_row(const dump::Table_chunk &chunk,
+                  const std::vector<uint32_t> &key_fields,
+                  const mysqlshdk::db::IRow *source,
+                  const mysqlshdk::db::IRow *target,
+                  mysqlshdk::db::Row_difference difference);
+
+  const dump::Dump_options &m_options;
+  const uint64_t m_max_row_differences;
+
+  shcore::Synchronized_queue<std::shared_ptr<mysqlshdk::db::ISession>>
+      m_sessions;
+
+  std::atomic<uint64_t> m_chunks = 0;
+  std::atomic<uint64_t> m_different_chunks = 0;
+  std::atomic<uint64_t> m_source_rows = 0;
+  std::atomic<uint64_t> m_target_rows = 0;
+
+  std::mutex m_mutex;
+  // table -> number of reported rows
+  std::unordered_map<std::string, uint64_t> m_reported_rows;
+  uint64_t m_total_reported_rows = 0;
+  // tables with different definitions of columns which were reported
+  std::unordered_set<std::string> m_reported_definitions;
+};
+
+/**
+ * Dumper which compares the chunks of table data instead of writing them.
+ */
+template <class Dumper>
+class Comparing_dumper final : public Dumper {
+ public:
+  Comparing_dumper() = delete;
+
+  template <class Options>
+  Comparing_dumper(const Options &options, Data_comparer *comparer)
+      : Dumper(options), m_comparer(comparer) {}
+
+  Comparing_dumper(const Comparing_dumper &) = delete;
+  Comparing_dumper(Comparing_dumper &&) = delete;
+
+  Comparing_dumper &operator=(const Comparing_dumper &) = delete;
+  Comparing_dumper &operator=(Comparing_dumper &&) = delete;
+
+  ~Comparing_dumper() override = default;
+
+ private:
+  void summary() const override { m_comparer->summary(); }
+
+  dump::Table_chunk_processor *table_chunk_processor() const override {
+    return m_comparer;
+  }
+
+  Data_comparer *m_comparer;
+};
+
+/**
+ * Connects to the target instance and prepares the dumper options.
+ *
+ * @returns Session to the target instance.
+ */
+std::shared_ptr<mysqlshdk::db::ISession> prepare(
+    const mysqlshdk::db::Connection_options &connection_options,
+    dump::Ddl_dumper_options *options);
+
+template <class Dumper, class Options>
+void compare(const mysqlshdk::db::Connection_options &connection_options,
+             Options *compare_options) {
+  const auto target =
+      prepare(connection_options, compare_options->dump_options());
+
+  Data_comparer comparer{target, *compare_options->dump_options(),
+                         compare_options->max_row_differences()};
+  Comparing_dumper<Dumper> dumper{*compare_options->dump_options(),
+                                  &comparer};
+
+  shcore::Interrupt_handler intr_handler([&dumper]() -> bool {
+    dumper.interrupt();
+    return false;
+  });
+
+  dumper.run();
+
+  if (comparer.has_differences()) {
+    throw std::runtime_error(
+        "Data of the source and the target instance differs.");
+  }
+}
+
+}  // namespace compare
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_OPERATION_H_
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_OPTIONS_H_
+#define MODULES_UTIL_COMPARE_COMPARE_OPTIONS_H_
+
+#include <cstdint>
+#include <type_traits>
+
+#include "mysqlshdk/include/scripting/type_info/custom.h"
+#include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+#include "modules/util/dump/ddl_dumper_options.h"
+
+namespace mysqlsh {
+namespace compare {
+
+template <class T, std::enable_if_t<
+                       std::is_base_of_v<dump::Ddl_dumper_options, T>, int> = 0>
+class Compare_options {
+ public:
+  Compare_options(const Compare_options &) = default;
+  Compare_options(Compare_options &&) = default;
+
+  Compare_options &operator=(const Compare_options &) = default;
+  Compare_options &operator=(Compare_options &&) = default;
+
+  virtual ~Compare_options() = default;
+
+  static const shcore::Option_pack_def<Compare_options> &options() {
+    static const auto opts =
+        shcore::Option_pack_def<Compare_options>()
+            .template ignore<dump::Dump_manifest_options>()
+            .template ignore<mysqlshdk::aws::S3_bucket_options>()
+            .template ignore<mysqlshdk::azure::Blob_storage_options>()
+            .template ignore<import_table::Dialect>()
+            .ignore({"compatibility", "compression", "dataOnly", "ddlOnly",
+                     "dryRun", "excludeTriggers", "includeTriggers", "ocimds",
+                     "targetVersion", "triggers"})
+            .include(&Compare_options::m_dump_options)
+            .optional("maxRowDifferences",
+                      &Compare_options::m_max_row_differences);
+
+    return opts;
+  }
+
+  T *dump_options() { return &m_dump_options; }
+
+  /**
+   * Maximum number of different rows reported for each table, 0 means that
+   * only the checksums of chunks are compared.
+   */
+  uint64_t max_row_differences() const { return m_max_row_differences; }
+
+ protected:
+  Compare_options() {
+    // DDL is not compared
+    m_dump_options.set_data_only(true);
+    // data is not written, metadata is kept in memory
+    m_dump_options.set_compression(mysqlshdk::storage::Compression::NONE);
+    m_dump_options.disable_index_files();
+    m_dump_options.dont_rename_data_files();
+  }
+
+  void on_log_options(const char *msg) const {
+    log_info("Compare options: %s", msg);
+  }
+
+ private:
+  T m_dump_options;
+  uint64_t m_max_row_differences = 10;
+};
+
+}  // namespace compare
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_OPTIONS_H_
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/compare/compare_schemas_options.h"
+
+namespace mysqlsh {
+namespace compare {
+
+const shcore::Option_pack_def<Compare_schemas_options>
+    &Compare_schemas_options::options() {
+  static const auto opts =
+      shcore::Option_pack_def<Compare_schemas_options>()
+          .include<Compare_options<dump::Dump_schemas_options>>()
+          .ignore({"events", "excludeEvents", "excludeRoutines",
+                   "excludeSchemas", "excludeUsers", "includeEvents",
+                   "includeRoutines", "includeSchemas", "includeUsers",
+                   "routines"})
+          .on_log(&Compare_schemas_options::on_log_options);
+
+  return opts;
+}
+
+}  // namespace compare
+}  // namespace mysqlsh
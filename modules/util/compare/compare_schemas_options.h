@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_COMPARE_COMPARE_SCHEMAS_OPTIONS_H_
+#define MODULES_UTIL_COMPARE_COMPARE_SCHEMAS_OPTIONS_H_
+
+#include "modules/util/dump/dump_schemas_options.h"
+
+#include "modules/util/compare/compare_options.h"
+
+namespace mysqlsh {
+namespace compare {
+
+class Compare_schemas_options
+    : public Compare_options<dump::Dump_schemas_options> {
+ public:
+  Compare_schemas_options() = default;
+
+  Compare_schemas_options(const Compare_schemas_options &) = default;
+  Compare_schemas_options(Compare_schemas_options &&) = default;
+
+  Compare_schemas_options &operator=(const Compare_schemas_options &) = default;
+  Compare_schemas_options &operator=(Compare_schemas_options &&) = default;
+
+  ~Compare_schemas_options() override = default;
+
+  static const shcore::Option_pack_def<Compare_schemas_options> &options();
+};
+
+}  // namespace compare
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_COMPARE_COMPARE_SCHEMAS_OPTIONS_H_
@@ -37,6 +37,8 @@
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_config.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/textui/textui.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
@@ -186,11 +188,37 @@ class Console_with_prefix final : public IConsole {
   std::shared_ptr<IConsole> m_console;
 };
 
+void report_memory_usage(const mysqlshdk::storage::in_memory::Virtual_fs &fs) {
+  using mysqlshdk::utils::format_bytes;
+  using mysqlshdk::utils::format_seconds;
+
+  const auto stats = fs.memory_stats();
+  const auto blocked = std::chrono::duration<double>(stats.blocked_time);
+  const auto spilled = fs.spilled_bytes();
+
+  log_info(
+      "Copy memory usage: peak %s, limit %s, spilled to disk %s, waited for "
+      "memory %s",
+      format_bytes(stats.peak_resident).c_str(),
+      fs.memory_limit() ? format_bytes(fs.memory_limit()).c_str() : "none",
+      format_bytes(spilled).c_str(), format_seconds(blocked.count()).c_str());
+
+  if (fs.memory_limit()) {
+    current_console()->print_info(shcore::str_format(
+        "Peak memory usage: %s (limit: %s), %s written to the spill directory, "
+        "%s spent waiting for memory.",
+        format_bytes(stats.peak_resident).c_str(),
+        format_bytes(fs.memory_limit()).c_str(), format_bytes(spilled).c_str(),
+        format_seconds(blocked.count()).c_str()));
+  }
+}
+
 }  // namespace
 
 std::pair<std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>,
           std::unique_ptr<mysqlshdk::storage::IDirectory>>
-setup_virtual_storage() {
+setup_virtual_storage(std::size_t max_memory, const std::string &spill_dir,
+                      std::chrono::milliseconds wait_timeout) {
   auto config = std::make_shared<mysqlshdk::storage::in_memory::Virtual_config>(
       32 * 1024 * 1024);  // 32MB
   config->fs()->set_uses_synchronized_io([](std::string_view name) {
@@ -198,6 +226,11 @@ setup_virtual_storage() {
     // compressed and use the .tsv extension
     return shcore::str_iendswith(name, ".tsv");
   });
+  config->fs()->set_memory_limit(max_memory);
+  config->fs()->set_spill_directory(spill_dir);
+  // the loader may wait for a file which cannot be written until some other
+  // file is read, fail instead of waiting forever if memory is not released
+  config->fs()->set_memory_stall_timeout(wait_timeout);
 
   auto dir = directory(config);
   dir->create();
@@ -336,6 +369,8 @@ void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
     std::rethrow_exception(current_exception);
   }
 
+  report_memory_usage(*storage->fs());
+
   // show metadata at the end, making sure it doesn't disappear in the noise
   loader->show_metadata(true);
 }
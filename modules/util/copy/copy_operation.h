@@ -24,6 +24,7 @@
 #ifndef MODULES_UTIL_COPY_COPY_OPERATION_H_
 #define MODULES_UTIL_COPY_COPY_OPERATION_H_
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
@@ -44,9 +45,21 @@
 namespace mysqlsh {
 namespace copy {
 
+/**
+ * Creates the in-memory storage used to pass the data from the dumper to the
+ * loader.
+ *
+ * @param max_memory Memory limit, 0 means no limit.
+ * @param spill_dir Local directory used to hold the data which does not fit in
+ *                  memory, if empty, dumper waits until memory is released.
+ * @param wait_timeout Dumper fails if no memory is released for this long, 0
+ *                     means it waits indefinitely.
+ */
 std::pair<std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>,
           std::unique_ptr<mysqlshdk::storage::IDirectory>>
-setup_virtual_storage();
+setup_virtual_storage(
+    std::size_t max_memory = 0, const std::string &spill_dir = {},
+    std::chrono::milliseconds wait_timeout = std::chrono::milliseconds{0});
 
 void copy(dump::Ddl_dumper *dumper, Dump_loader *loader,
           const std::shared_ptr<mysqlshdk::storage::in_memory::Virtual_config>
@@ -65,7 +78,9 @@ void copy(const mysqlshdk::db::Connection_options &connection_options,
                                 e.format());
   }
 
-  auto [storage, output] = setup_virtual_storage();
+  auto [storage, output] = setup_virtual_storage(copy_options->max_memory(),
+                                                 copy_options->spill_dir(),
+                                                 copy_options->wait_timeout());
 
   copy_options->dump_options()->set_storage_config(storage);
   copy_options->dump_options()->set_output_url(output->full_path().real());
@@ -24,11 +24,17 @@
 #ifndef MODULES_UTIL_COPY_COPY_OPTIONS_H_
 #define MODULES_UTIL_COPY_COPY_OPTIONS_H_
 
+#include <chrono>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "modules/util/dump/ddl_dumper_options.h"
 #include "modules/util/load/load_dump_options.h"
@@ -55,12 +61,16 @@ class Copy_options {
             .template ignore<mysqlshdk::aws::S3_bucket_options>()
             .template ignore<mysqlshdk::azure::Blob_storage_options>()
             .template ignore<import_table::Dialect>()
-            .ignore({"backgroundThreads", "characterSet", "compression",
-                     "createInvisiblePKs", "loadData", "loadDdl", "loadUsers",
+            .ignore({"adaptiveThreads", "backgroundThreads", "characterSet",
+                     "compression", "createInvisiblePKs", "incrementalBase",
+                     "loadData", "loadDdl", "loadUsers", "metadataCache",
                      "ocimds", "progressFile", "resetProgress", "showMetadata",
                      "targetVersion", "waitDumpTimeout"})
             .include(&Copy_options::m_dump_options)
             .include(&Copy_options::m_load_options)
+            .optional("maxMetadataMemory", &Copy_options::set_max_memory)
+            .optional("metadataSpillDir", &Copy_options::set_spill_dir)
+            .optional("metadataWaitTimeout", &Copy_options::set_wait_timeout)
             .on_done(&Copy_options::on_unpacked_options);
 
     return opts;
@@ -69,6 +79,23 @@ class Copy_options {
   T *dump_options() { return &m_dump_options; }
   Load_dump_options *load_options() { return &m_load_options; }
 
+  /**
+   * Maximum memory used to hold the metadata and DDL files in transit, 0 means
+   * no limit. Table data is streamed directly and does not use this memory.
+   */
+  std::size_t max_memory() const { return m_max_memory; }
+
+  /**
+   * Directory which holds the metadata and DDL files which do not fit in the
+   * memory limit.
+   */
+  const std::string &spill_dir() const { return m_spill_dir; }
+
+  /**
+   * How long writing waits for memory to be released, 0 means no limit.
+   */
+  std::chrono::milliseconds wait_timeout() const { return m_wait_timeout; }
+
  protected:
   Copy_options() {
     on_unpacked_options();
@@ -97,7 +124,42 @@ class Copy_options {
   }
 
  private:
+  void set_max_memory(const std::string &value) {
+    if (!value.empty()) {
+      m_max_memory = mysqlshdk::utils::expand_to_bytes(value);
+    }
+  }
+
+  void set_spill_dir(const std::string &value) {
+    if (!value.empty() && !shcore::is_folder(value)) {
+      throw std::invalid_argument(
+          "The option 'metadataSpillDir' must be set to an existing "
+          "directory, got: " +
+          value);
+    }
+
+    m_spill_dir = value;
+  }
+
+  void set_wait_timeout(const double &timeout_seconds) {
+    if (timeout_seconds < 0.0) {
+      throw std::invalid_argument(
+          "The option 'metadataWaitTimeout' cannot be set to a negative "
+          "value.");
+    }
+
+    // we're using double here, so that tests can set it to millisecond values
+    m_wait_timeout = std::chrono::milliseconds(
+        static_cast<std::chrono::milliseconds::rep>(timeout_seconds * 1000));
+  }
+
   void on_unpacked_options() {
+    if (!m_spill_dir.empty() && !m_max_memory) {
+      throw std::invalid_argument(
+          "The option 'metadataSpillDir' cannot be used if the "
+          "'maxMetadataMemory' option is not set.");
+    }
+
     // dumper in the dry run mode writes all the files, because loader needs
     // these files to simulate the load
     if (m_load_options.dry_run()) {
@@ -112,10 +174,19 @@ class Copy_options {
     m_load_options.set_load_data(m_dump_options.dump_data());
     m_load_options.set_load_ddl(m_dump_options.dump_ddl());
     m_load_options.set_load_users(m_dump_options.dump_users());
+
+    // data is passed directly to LOAD DATA, binary columns can be written as
+    // is if escaped characters are never a part of a multi-byte character
+    m_dump_options.set_encode_binary_columns(!shcore::str_caseeq(
+        m_dump_options.character_set(), "utf8mb4", "utf8mb3", "utf8", "latin1",
+        "ascii", "binary"));
   }
 
   T m_dump_options;
   Load_dump_options m_load_options;
+  std::size_t m_max_memory = 0;
+  std::string m_spill_dir;
+  std::chrono::milliseconds m_wait_timeout{std::chrono::minutes{5}};
 };
 
 }  // namespace copy
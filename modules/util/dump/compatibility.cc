@@ -23,6 +23,7 @@
 
 #include "modules/util/dump/compatibility.h"
 
+#include <algorithm>
 #include <regex>
 #include <unordered_map>
 #include <utility>
@@ -93,13 +94,6 @@ using Offset = std::pair<std::size_t, std::size_t>;
 using Offsets = std::vector<Offset>;
 using SQL_iterator = mysqlshdk::utils::SQL_iterator;
 
-struct Comment_offset {
-  Offset offset;
-  bool inside_hint;
-};
-
-using Coffsets = std::vector<Comment_offset>;
-
 std::string replace_at_offsets(const std::string &s, const Offsets &offsets,
                                const std::string &target) {
   if (offsets.empty()) return s;
@@ -113,35 +107,6 @@ std::string replace_at_offsets(const std::string &s, const Offsets &offsets,
   return out;
 }
 
-std::string comment_out_offsets(const std::string &s, const Coffsets &offsets) {
-  if (offsets.empty()) return s;
-
-  std::size_t pos = 0;
-  std::string out;
-  for (const auto &o : offsets) {
-    out += s.substr(pos, o.offset.first - pos);
-    if (o.inside_hint) {
-      auto ol = shcore::str_rstrip(shcore::str_replace(
-          s.substr(o.offset.first, o.offset.second - o.offset.first), "\n",
-          " "));
-      out += "-- " + ol + "\n";
-    } else {
-      out += "/* " +
-             s.substr(o.offset.first, o.offset.second - o.offset.first) + "*/ ";
-    }
-    pos = o.offset.second;
-  }
-  out += s.substr(pos);
-  return out;
-}
-
-std::size_t eat_string_val(const std::string &s, std::size_t i) {
-  while (std::isspace(s[i]) || s[i] == '=') ++i;
-  if (s[i] == '\'') return mysqlshdk::utils::span_quoted_string_sq(s, i);
-  if (s[i] == '"') return mysqlshdk::utils::span_quoted_string_dq(s, i);
-  return std::string::npos;
-}
-
 void skip_columns_definition(SQL_iterator *it) {
   if (!shcore::str_caseeq(it->next_token(), "CREATE") ||
       !shcore::str_caseeq(it->next_token(), "TABLE"))
@@ -155,46 +120,120 @@ void skip_columns_definition(SQL_iterator *it) {
         "Malformed create table statement - columns definition not found");
 }
 
+/**
+ * Returns index of the first token after the columns definition.
+ */
+std::size_t skip_columns_definition(const Ddl_tokens &tokens) {
+  if (!shcore::str_caseeq(tokens.text(0), "CREATE") ||
+      !shcore::str_caseeq(tokens.text(1), "TABLE"))
+    throw std::runtime_error("Malformed create table statement");
+
+  auto idx = tokens.find("(", 2);
+  idx = tokens.find(")", idx + 1);
+
+  if (idx >= tokens.size() || tokens[idx].end >= tokens.ddl().length())
+    throw std::runtime_error(
+        "Malformed create table statement - columns definition not found");
+
+  return idx + 1;
+}
+
+/**
+ * Comments out options which have a string value.
+ *
+ * @param tokens Tokens of the statement.
+ * @param edits Receives the edits, can be null.
+ * @param is_option Called with index of a token, should return true if
+ *        this is the option to be commented out. Index should be moved to
+ *        the last token which was consumed.
+ *
+ * @returns true if an option was found.
+ */
 bool comment_out_option_with_string(
-    const std::string &s, std::string *rewritten,
-    std::function<bool(std::string_view *token, SQL_iterator *it)>
-        skip_condition) {
-  Coffsets offsets;
-  SQL_iterator it(s, 12);
-  std::size_t prev_pos = 0, end = 0;
-  auto token = it.next_token();
+    const Ddl_tokens &tokens, Ddl_edits *edits,
+    const std::function<bool(std::size_t *idx)> &is_option) {
+  const auto ddl = tokens.ddl();
+  const auto is_comma = [&ddl](std::size_t pos) {
+    return pos < ddl.length() && ',' == ddl[pos];
+  };
+  const auto begin_of = [&tokens, &ddl](std::size_t idx) {
+    return idx < tokens.size() ? tokens[idx].begin : ddl.length();
+  };
+
+  struct Comment {
+    std::size_t begin;
+    std::size_t end;
+    bool inside_hint;
+  };
+
+  std::vector<Comment> comments;
+  std::size_t prev_pos = 0;
   bool prev_added = false;
-  while (!token.empty()) {
-    auto start = it.position() - token.size();
-    bool hint = it.inside_hint();
-    if (skip_condition(&token, &it) ||
-        (end = eat_string_val(s, it.position())) == std::string_view::npos) {
-      prev_pos = it.position() - token.size();
+
+  // skip CREATE TABLE
+  auto idx = tokens.first_at(12);
+
+  while (idx < tokens.size()) {
+    auto start = tokens[idx].begin;
+    const auto hint = tokens[idx].inside_hint;
+    const auto matched = is_option(&idx);
+    auto value = idx + 1;
+
+    if (matched) {
+      while ("=" == tokens.text(value)) ++value;
+    }
+
+    if (!matched || value >= tokens.size() ||
+        !shcore::str_beginswith(tokens[value].text, "'", "\"")) {
+      prev_pos = begin_of(idx);
       prev_added = false;
-      token = it.next_token();
+      ++idx;
       continue;
     }
-    it.set_position(end);
-    token = it.next_token();
 
-    if (token == ",") {
-      end = it.position();
-      token = it.next_token();
-    } else if (s[prev_pos] == ',') {
+    auto end = tokens[value].end;
+    idx = value + 1;
+
+    if ("," == tokens.text(idx)) {
+      end = tokens[idx].end;
+      ++idx;
+    } else if (is_comma(prev_pos)) {
       start = prev_pos;
     }
 
     if (prev_added) {
-      offsets.back().offset.second = end;
-      offsets.back().inside_hint = offsets.back().inside_hint || hint;
+      comments.back().end = end;
+      comments.back().inside_hint = comments.back().inside_hint || hint;
     } else {
-      offsets.emplace_back(Comment_offset{{start, end}, hint});
+      comments.emplace_back(Comment{start, end, hint});
     }
+
     prev_added = true;
   }
 
-  if (rewritten) *rewritten = comment_out_offsets(s, offsets);
-  return !offsets.empty();
+  if (edits) {
+    for (const auto &c : comments) {
+      edits->comment_out(c.begin, c.end, c.inside_hint);
+    }
+  }
+
+  return !comments.empty();
+}
+
+/**
+ * Runs the given check on a CREATE TABLE statement.
+ */
+bool rewrite_create_table(
+    const std::string &create_table, std::string *rewritten,
+    const std::function<bool(const Ddl_tokens &, Ddl_edits *)> &check) {
+  const Ddl_tokens tokens{create_table};
+  Ddl_edits edits;
+
+  const auto result = check(tokens, rewritten ? &edits : nullptr);
+
+  if (rewritten) *rewritten = edits.apply(create_table);
+
+  return result;
 }
 
 inline bool is_quote(char c) { return '\'' == c || '"' == c || '`' == c; }
@@ -499,39 +538,41 @@ std::string_view is_grant_on_object_from_mysql_schema(
 
 bool check_create_table_for_data_index_dir_option(
     const std::string &create_table, std::string *rewritten) {
-  /*
-        First, comment out DATA|INDEX DIRECTORY = '...', but note:
-         - Optional preceding and trailing commas.
-         - Optional assignment operator.
-         - Path enclosed in single quotes.
-         - Use of ungreedy patterns to get correct grouping.
-     */
-  //  std::regex directory_option(
-  //      "\\s*,?\\s*(DATA|INDEX)\\s+DIRECTORY\\s*?=?\\s*?[\"'][^\"']+?[\"']\\s*,"
-  //      "?"
-  //      "\\s*",
-  //      std::regex::icase | std::regex::nosubs);
-  //  auto q = std::regex_replace(create_table, directory_option, " /*$&*/ ");
-  //  bool res = q != create_table;
-  //  if (rewritten) *rewritten = q;
-  //  return res;
+  return rewrite_create_table(
+      create_table, rewritten, [](const Ddl_tokens &tokens, Ddl_edits *edits) {
+        return check_create_table_for_data_index_dir_option(tokens, edits);
+      });
+}
 
+bool check_create_table_for_data_index_dir_option(const Ddl_tokens &tokens,
+                                                  Ddl_edits *edits) {
+  // Comment out DATA|INDEX DIRECTORY = '...', including the optional
+  // preceding or trailing comma.
   return comment_out_option_with_string(
-      create_table, rewritten, [](std::string_view *token, SQL_iterator *it) {
-        if (!shcore::str_caseeq(*token, "DATA", "INDEX")) return true;
-        *token = it->next_token();
-        return !shcore::str_caseeq(*token, "DIRECTORY");
+      tokens, edits, [&tokens](std::size_t *idx) {
+        if (!shcore::str_caseeq(tokens.text(*idx), "DATA", "INDEX")) {
+          return false;
+        }
+
+        return shcore::str_caseeq(tokens.text(++*idx), "DIRECTORY");
       });
 }
 
 bool check_create_table_for_encryption_option(const std::string &create_table,
                                               std::string *rewritten) {
-  // Comment out ENCRYPTION option.
+  return rewrite_create_table(
+      create_table, rewritten, [](const Ddl_tokens &tokens, Ddl_edits *edits) {
+        return check_create_table_for_encryption_option(tokens, edits);
+      });
+}
 
+bool check_create_table_for_encryption_option(const Ddl_tokens &tokens,
+                                              Ddl_edits *edits) {
+  // Comment out ENCRYPTION option.
   return comment_out_option_with_string(
-      create_table, rewritten, [](std::string_view *token, SQL_iterator *it) {
-        if (shcore::str_caseeq(*token, "DEFAULT")) *token = it->next_token();
-        return !shcore::str_caseeq(*token, "ENCRYPTION");
+      tokens, edits, [&tokens](std::size_t *idx) {
+        if (shcore::str_caseeq(tokens.text(*idx), "DEFAULT")) ++*idx;
+        return shcore::str_caseeq(tokens.text(*idx), "ENCRYPTION");
       });
 }
 
@@ -539,122 +580,155 @@ std::string check_create_table_for_engine_option(
     const std::string &create_table, std::string *rewritten,
     const std::string &target) {
   std::string res;
-  Offsets offsets;
-  SQL_iterator it(create_table);
-  skip_columns_definition(&it);
-  std::string token;
-  while (!(token = it.next_token()).empty()) {
-    if (!shcore::str_caseeq(token, "ENGINE")) continue;
-    auto name = it.next_token();
-    if (name == "=") name = it.next_token();
-    if (shcore::str_caseeq(name, target)) continue;
-    offsets.emplace_back(it.position() - name.length(), it.position());
-    res = name;
+
+  rewrite_create_table(create_table, rewritten,
+                       [&res, &target](const Ddl_tokens &tokens,
+                                       Ddl_edits *edits) {
+                         res = check_create_table_for_engine_option(
+                             tokens, edits, target);
+                         return !res.empty();
+                       });
+
+  return res;
+}
+
+std::string check_create_table_for_engine_option(const Ddl_tokens &tokens,
+                                                 Ddl_edits *edits,
+                                                 const std::string &target) {
+  std::string res;
+
+  for (auto idx = skip_columns_definition(tokens); idx < tokens.size();
+       ++idx) {
+    if (!shcore::str_caseeq(tokens[idx].text, "ENGINE")) continue;
+
+    if ("=" == tokens.text(++idx)) ++idx;
+    if (idx >= tokens.size()) break;
+
+    const auto &name = tokens[idx];
+    if (shcore::str_caseeq(name.text, target)) continue;
+
+    if (edits) edits->replace(name.begin, name.end, target);
+    res = name.text;
   }
 
-  if (rewritten) *rewritten = replace_at_offsets(create_table, offsets, target);
   return res;
 }
 
 bool check_create_table_for_tablespace_option(
     const std::string &create_table, std::string *rewritten,
     const std::vector<std::string> &whitelist) {
-  Offsets offsets;
-  SQL_iterator it(create_table, 0, false);
-  skip_columns_definition(&it);
+  return rewrite_create_table(
+      create_table, rewritten,
+      [&whitelist](const Ddl_tokens &tokens, Ddl_edits *edits) {
+        return check_create_table_for_tablespace_option(tokens, edits,
+                                                        whitelist);
+      });
+}
+
+bool check_create_table_for_tablespace_option(
+    const Ddl_tokens &tokens, Ddl_edits *edits,
+    const std::vector<std::string> &whitelist) {
+  const auto ddl = tokens.ddl();
+  const auto is_comma = [&ddl](std::size_t pos) {
+    return pos < ddl.length() && ',' == ddl[pos];
+  };
+
+  bool found = false;
   std::size_t prev_pos = 0;
-  std::string token;
-  while (!(token = it.next_token()).empty()) {
-    if (!shcore::str_caseeq(token, "TABLESPACE")) {
-      prev_pos = it.position() - token.size();
+
+  for (auto idx = skip_columns_definition(tokens); idx < tokens.size();
+       ++idx) {
+    if (!shcore::str_caseeq(tokens[idx].text, "TABLESPACE")) {
+      prev_pos = tokens[idx].begin;
       continue;
     }
-    auto start = it.position() - token.size();
-    auto name = it.next_token();
-    if (name == "=") name = it.next_token();
+
+    auto start = tokens[idx].begin;
+
+    if ("=" == tokens.text(++idx)) ++idx;
 
     // Leave whitelisted tablespaces
-    size_t iw = 0;
-    std::string_view n = name;
+    auto n = tokens.text(idx);
 
-    if (n[0] == '`') {
+    if (!n.empty() && n[0] == '`') {
       n.remove_prefix(1);
     }
 
-    for (; iw < whitelist.size(); ++iw) {
-      if (shcore::str_ibeginswith(n, whitelist[iw])) {
-        break;
-      }
-    }
-    if (iw < whitelist.size()) continue;
+    if (std::any_of(
+            whitelist.begin(), whitelist.end(),
+            [n](const auto &w) { return shcore::str_ibeginswith(n, w); }))
+      continue;
+
+    found = true;
 
     // Find if option encompassed by comment hint '/*!50100 '
-    if (it.inside_hint() && create_table.compare(start - 9, 3, "/*!") == 0) {
+    if (idx < tokens.size() && tokens[idx].inside_hint && start >= 9 &&
+        ddl.compare(start - 9, 3, "/*!") == 0) {
       start -= 9;
-      auto end = mysqlshdk::utils::span_cstyle_sql_comment(create_table, start);
-      offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start,
-                           end);
-      it.set_position(end);
+      const auto end = mysqlshdk::utils::span_cstyle_sql_comment(ddl, start);
+
+      if (edits) edits->remove(is_comma(prev_pos) ? prev_pos : start, end);
+
+      // continue after the comment
+      idx = tokens.first_at(end) - 1;
       continue;
     }
 
-    auto end = it.position();
-    if (shcore::str_caseeq("STORAGE", it.next_token())) {
+    auto end = idx < tokens.size() ? tokens[idx].end : ddl.length();
+
+    if (shcore::str_caseeq("STORAGE", tokens.text(++idx))) {
       // either DISK or MEMORY
-      it.next_token();
-      end = it.position();
+      ++idx;
+      end = idx < tokens.size() ? tokens[idx].end : ddl.length();
     }
-    offsets.emplace_back(create_table[prev_pos] == ',' ? prev_pos : start, end);
-  }
 
-  if (rewritten) *rewritten = replace_at_offsets(create_table, offsets, "");
+    if (edits) edits->remove(is_comma(prev_pos) ? prev_pos : start, end);
+  }
 
-  return !offsets.empty();
+  return found;
 }
 
 bool check_create_table_for_fixed_row_format(const std::string &create_table,
                                              std::string *rewritten) {
-  Offsets offsets;
-  SQL_iterator it(create_table);
-
-  skip_columns_definition(&it);
-
-  while (it.valid()) {
-    auto token = it.next_token();
+  const auto result = rewrite_create_table(
+      create_table, rewritten, [](const Ddl_tokens &tokens, Ddl_edits *edits) {
+        return check_create_table_for_fixed_row_format(tokens, edits);
+      });
 
-    if (shcore::str_caseeq(token, "ROW_FORMAT")) {
-      Offset offset;
+  // if new statement ends with comma, strip it as well
+  if (rewritten) *rewritten = shcore::str_strip(*rewritten, " \r\n\t,");
 
-      offset.first = it.position() - token.length();
+  return result;
+}
 
-      token = it.next_token();
+bool check_create_table_for_fixed_row_format(const Ddl_tokens &tokens,
+                                             Ddl_edits *edits) {
+  for (auto idx = skip_columns_definition(tokens); idx < tokens.size();
+       ++idx) {
+    if (!shcore::str_caseeq(tokens[idx].text, "ROW_FORMAT")) continue;
 
-      if (shcore::str_caseeq(token, "=")) {
-        token = it.next_token();
-      }
+    const auto begin = tokens[idx].begin;
 
-      if (shcore::str_caseeq(token, "FIXED")) {
-        offset.second = it.position();
+    if ("=" == tokens.text(++idx)) ++idx;
 
-        // consume comma, if it's there
-        if (shcore::str_caseeq(it.next_token(), ",")) {
-          offset.second = it.position();
-        }
+    if (shcore::str_caseeq(tokens.text(idx), "FIXED")) {
+      auto end = tokens[idx].end;
 
-        offsets.emplace_back(std::move(offset));
+      // consume comma, if it's there
+      if ("," == tokens.text(++idx)) {
+        end = tokens[idx].end;
       }
 
-      // no need to parse the rest
-      break;
+      if (edits) edits->remove(begin, end);
+
+      return true;
     }
-  }
 
-  // if new statement ends with comma, strip it as well
-  if (rewritten)
-    *rewritten = shcore::str_strip(
-        replace_at_offsets(create_table, offsets, ""), " \r\n\t,");
+    // no need to parse the rest
+    break;
+  }
 
-  return !offsets.empty();
+  return false;
 }
 
 std::vector<std::string> check_statement_for_charset_option(
@@ -32,6 +32,7 @@
 #include <utility>
 #include <vector>
 
+#include "modules/util/dump/ddl_rewriter.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 namespace mysqlsh {
@@ -104,6 +105,27 @@ bool check_create_table_for_tablespace_option(
 bool check_create_table_for_fixed_row_format(const std::string &create_table,
                                              std::string *rewritten = nullptr);
 
+// Variants of the CREATE TABLE checks which operate on a tokenized statement
+// and record the changes in edits (if not null), these can be combined using
+// the Ddl_rewriter, so that statement is tokenized and rewritten just once.
+
+bool check_create_table_for_data_index_dir_option(const Ddl_tokens &tokens,
+                                                  Ddl_edits *edits);
+
+bool check_create_table_for_encryption_option(const Ddl_tokens &tokens,
+                                              Ddl_edits *edits);
+
+std::string check_create_table_for_engine_option(
+    const Ddl_tokens &tokens, Ddl_edits *edits,
+    const std::string &target = "InnoDB");
+
+bool check_create_table_for_tablespace_option(
+    const Ddl_tokens &tokens, Ddl_edits *edits,
+    const std::vector<std::string> &whitelist = {"innodb_"});
+
+bool check_create_table_for_fixed_row_format(const Ddl_tokens &tokens,
+                                             Ddl_edits *edits);
+
 std::vector<std::string> check_statement_for_charset_option(
     const std::string &statement, std::string *rewritten = nullptr,
     const std::vector<std::string> &whitelist = {"utf8mb4"});
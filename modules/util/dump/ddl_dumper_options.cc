@@ -69,6 +69,7 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
           .optional("threads", &Ddl_dumper_options::set_threads)
+          .optional("metadataCache", &Ddl_dumper_options::m_metadata_cache)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
           .optional("ddlOnly", &Ddl_dumper_options::m_ddl_only)
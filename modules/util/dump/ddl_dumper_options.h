@@ -84,7 +84,10 @@ class Ddl_dumper_options : public Dump_options {
     return m_dump_manifest_options.par_manifest();
   }
 
+  std::string metadata_cache() const override { return m_metadata_cache; }
+
   void enable_mds_compatibility_checks();
+  void set_data_only(bool data_only) { m_data_only = data_only; }
   using Dump_options::set_target_version;
   void set_output_url(const std::string &url) override;
 
@@ -128,6 +131,7 @@ class Ddl_dumper_options : public Dump_options {
   bool m_data_only = false;
   bool m_consistent_dump = true;
   bool m_skip_consistency_checks = false;
+  std::string m_metadata_cache;
 };
 
 }  // namespace dump
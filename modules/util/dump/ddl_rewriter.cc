@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/dump/ddl_rewriter.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "mysqlshdk/libs/utils/utils_lexing.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+namespace compatibility {
+
+Ddl_tokens::Ddl_tokens(std::string_view ddl) : m_ddl(ddl) {
+  mysqlshdk::utils::SQL_iterator it(m_ddl, 0, false);
+
+  while (true) {
+    const auto [text, offset] = it.next_token_and_offset();
+
+    if (text.empty()) {
+      break;
+    }
+
+    m_tokens.emplace_back(
+        Ddl_token{text, offset, it.position(), it.inside_hint()});
+  }
+}
+
+std::size_t Ddl_tokens::first_at(std::size_t offset) const {
+  return std::lower_bound(m_tokens.begin(), m_tokens.end(), offset,
+                          [](const Ddl_token &token, std::size_t o) {
+                            return token.begin < o;
+                          }) -
+         m_tokens.begin();
+}
+
+std::size_t Ddl_tokens::find(std::string_view text, std::size_t from) const {
+  for (auto size = m_tokens.size(); from < size; ++from) {
+    if (shcore::str_caseeq(m_tokens[from].text, text)) {
+      break;
+    }
+  }
+
+  return std::min(from, m_tokens.size());
+}
+
+void Ddl_edits::replace(std::size_t begin, std::size_t end, std::string text) {
+  m_edits.emplace_back(Edit{begin, end, Type::REPLACE, std::move(text)});
+}
+
+void Ddl_edits::remove(std::size_t begin, std::size_t end) {
+  replace(begin, end, {});
+}
+
+void Ddl_edits::comment_out(std::size_t begin, std::size_t end,
+                            bool inside_hint) {
+  m_edits.emplace_back(
+      Edit{begin, end, inside_hint ? Type::HINT_COMMENT : Type::COMMENT, {}});
+}
+
+std::string Ddl_edits::apply(std::string_view ddl) const {
+  if (m_skip) {
+    return {};
+  }
+
+  std::vector<const Edit *> edits;
+  edits.reserve(m_edits.size());
+
+  for (const auto &edit : m_edits) {
+    edits.emplace_back(&edit);
+  }
+
+  std::stable_sort(edits.begin(), edits.end(),
+                   [](const Edit *l, const Edit *r) {
+                     return l->begin < r->begin;
+                   });
+
+  std::string out;
+  // comments add a few characters
+  out.reserve(ddl.length() + 8 * edits.size());
+
+  std::size_t pos = 0;
+
+  for (const auto edit : edits) {
+    auto begin = edit->begin;
+
+    if (begin < pos) {
+      if (Type::REPLACE == edit->type && !edit->text.empty()) {
+        // cannot partially replace a span
+        continue;
+      }
+
+      begin = pos;
+
+      while (begin < edit->end &&
+             std::isspace(static_cast<unsigned char>(ddl[begin]))) {
+        ++begin;
+      }
+
+      if (begin >= edit->end) {
+        continue;
+      }
+    }
+
+    out.append(ddl, pos, begin - pos);
+
+    const auto span = ddl.substr(begin, edit->end - begin);
+
+    switch (edit->type) {
+      case Type::REPLACE:
+        out.append(edit->text);
+        break;
+
+      case Type::COMMENT:
+        out.append("/* ");
+        out.append(span);
+        out.append("*/ ");
+        break;
+
+      case Type::HINT_COMMENT:
+        // cannot nest comments, use a single line comment instead
+        out.append("-- ");
+        out.append(shcore::str_rstrip(
+            shcore::str_replace(std::string{span}, "\n", " ")));
+        out.append(1, '\n');
+        break;
+    }
+
+    pos = edit->end;
+  }
+
+  out.append(ddl, pos);
+
+  return out;
+}
+
+bool Ddl_rewriter::rewrite(std::string_view ddl, std::string *out) const {
+  const Ddl_tokens tokens{ddl};
+  Ddl_edits edits;
+
+  for (const auto &rewrite : m_rewrites) {
+    rewrite(tokens, &edits);
+  }
+
+  if (edits.empty()) {
+    *out = ddl;
+    return false;
+  }
+
+  *out = edits.apply(ddl);
+  return true;
+}
+
+}  // namespace compatibility
+}  // namespace mysqlsh
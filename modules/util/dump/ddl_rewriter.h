@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_DDL_REWRITER_H_
+#define MODULES_UTIL_DUMP_DDL_REWRITER_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace mysqlsh {
+namespace compatibility {
+
+struct Ddl_token {
+  std::string_view text;
+  // offset of the first character of the token
+  std::size_t begin;
+  // offset past the token
+  std::size_t end;
+  // whether token is inside of a /*! */ or /*+ */ comment
+  bool inside_hint;
+};
+
+/**
+ * Result of a single tokenizing pass over a DDL statement. Comments are
+ * skipped, quoted strings and quoted identifiers are single tokens.
+ */
+class Ddl_tokens final {
+ public:
+  explicit Ddl_tokens(std::string_view ddl);
+
+  Ddl_tokens(const Ddl_tokens &) = delete;
+  Ddl_tokens(Ddl_tokens &&) = default;
+
+  Ddl_tokens &operator=(const Ddl_tokens &) = delete;
+  Ddl_tokens &operator=(Ddl_tokens &&) = default;
+
+  ~Ddl_tokens() = default;
+
+  inline std::string_view ddl() const noexcept { return m_ddl; }
+
+  inline std::size_t size() const noexcept { return m_tokens.size(); }
+
+  inline bool empty() const noexcept { return m_tokens.empty(); }
+
+  inline const Ddl_token &operator[](std::size_t idx) const {
+    return m_tokens[idx];
+  }
+
+  inline auto begin() const noexcept { return m_tokens.begin(); }
+
+  inline auto end() const noexcept { return m_tokens.end(); }
+
+  /**
+   * Text of the token at the given index, empty string if index is out of
+   * range.
+   */
+  inline std::string_view text(std::size_t idx) const noexcept {
+    return idx < m_tokens.size() ? m_tokens[idx].text : std::string_view{};
+  }
+
+  /**
+   * Index of the first token which starts at or after the given offset.
+   */
+  std::size_t first_at(std::size_t offset) const;
+
+  /**
+   * Index of the first token which case-insensitively matches the given
+   * text, starting from the token at the given index. Returns size() if
+   * not found.
+   */
+  std::size_t find(std::string_view text, std::size_t from = 0) const;
+
+ private:
+  std::string_view m_ddl;
+  std::vector<Ddl_token> m_tokens;
+};
+
+/**
+ * Edits of a DDL statement, expressed as spans of the original statement.
+ */
+class Ddl_edits final {
+ public:
+  Ddl_edits() = default;
+
+  Ddl_edits(const Ddl_edits &) = delete;
+  Ddl_edits(Ddl_edits &&) = default;
+
+  Ddl_edits &operator=(const Ddl_edits &) = delete;
+  Ddl_edits &operator=(Ddl_edits &&) = default;
+
+  ~Ddl_edits() = default;
+
+  /**
+   * Replaces the [begin, end) span with the given text.
+   */
+  void replace(std::size_t begin, std::size_t end, std::string text);
+
+  /**
+   * Removes the [begin, end) span.
+   */
+  void remove(std::size_t begin, std::size_t end);
+
+  /**
+   * Comments out the [begin, end) span. If span is inside of a conditional
+   * comment or an optimizer hint, a single line comment is used instead.
+   */
+  void comment_out(std::size_t begin, std::size_t end, bool inside_hint);
+
+  /**
+   * Marks the whole statement to be skipped, rewritten statement is empty.
+   */
+  inline void skip() noexcept { m_skip = true; }
+
+  inline bool skipped() const noexcept { return m_skip; }
+
+  inline bool empty() const noexcept { return !m_skip && m_edits.empty(); }
+
+  /**
+   * Builds the rewritten statement in a single buffer.
+   *
+   * Edits are applied in order of their offsets. If an edit overlaps with a
+   * previous one, removals and comments are clipped to start at the first
+   * non-whitespace character after the previous edit, replacements are
+   * ignored.
+   */
+  std::string apply(std::string_view ddl) const;
+
+ private:
+  enum class Type { REPLACE, COMMENT, HINT_COMMENT };
+
+  struct Edit {
+    std::size_t begin;
+    std::size_t end;
+    Type type;
+    std::string text;
+  };
+
+  std::vector<Edit> m_edits;
+  bool m_skip = false;
+};
+
+/**
+ * Chain of rewriters applied to a DDL statement. Statement is tokenized once,
+ * each rewriter (in order of registration) inspects the tokens and records
+ * its edits, then the output is built in a single pass.
+ *
+ * Since all rewriters operate on the original statement, they should not
+ * modify the same spans.
+ */
+class Ddl_rewriter final {
+ public:
+  using Rewrite = std::function<void(const Ddl_tokens &, Ddl_edits *)>;
+
+  Ddl_rewriter() = default;
+
+  Ddl_rewriter(const Ddl_rewriter &) = default;
+  Ddl_rewriter(Ddl_rewriter &&) = default;
+
+  Ddl_rewriter &operator=(const Ddl_rewriter &) = default;
+  Ddl_rewriter &operator=(Ddl_rewriter &&) = default;
+
+  ~Ddl_rewriter() = default;
+
+  inline void add(Rewrite rewrite) {
+    m_rewrites.emplace_back(std::move(rewrite));
+  }
+
+  inline bool empty() const noexcept { return m_rewrites.empty(); }
+
+  /**
+   * Rewrites the given statement.
+   *
+   * @param ddl Statement to be rewritten.
+   * @param out Rewritten statement, a copy of the input if it was not
+   *            modified.
+   *
+   * @returns true if statement was modified.
+   */
+  bool rewrite(std::string_view ddl, std::string *out) const;
+
+ private:
+  std::vector<Rewrite> m_rewrites;
+};
+
+}  // namespace compatibility
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_DDL_REWRITER_H_
@@ -33,6 +33,7 @@
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #include "modules/util/dump/dump_writer.h"
+#include "modules/util/dump/escape_scanner.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -242,10 +243,20 @@ class Dialect_dump_writer : public Dump_writer {
     // FIELDS ESCAPED BY character is specified, escape the string
     buffer()->will_write(2 * length);
     const auto end = data + length;
+    auto p = data;
 
-    for (auto p = data; p != end; ++p) {
-      const auto c = *p;
-      char to_write = 0;
+    while (p != end) {
+      // copy characters which do not need to be escaped in bulk
+      const auto next = s_escape_scanner.find(p, end);
+      buffer()->append(p, next - p);
+
+      if (next == end) {
+        break;
+      }
+
+      const auto c = *next;
+      char to_write = c;
+      p = next + 1;
 
       // note: this doesn't produce output consistent with SELECT .. INTO
       // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
@@ -278,38 +289,16 @@ class Dialect_dump_writer : public Dump_writer {
           break;
 
         default:
-          if (c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
-              c == T::lines_terminated_by[0] || should_escape(c)) {
-            to_write = c;
-          }
+          // FIELDS ESCAPED BY, FIELDS TERMINATED BY, LINES TERMINATED BY or
+          // FIELDS ENCLOSED BY character, written as is
           break;
       }
 
-      if (0 != to_write) {
-        buffer()->append(T::fields_escaped_by[0]);
-        buffer()->append(to_write);
-      } else {
-        buffer()->append(c);
-      }
+      buffer()->append(T::fields_escaped_by[0]);
+      buffer()->append(to_write);
     }
   }
 
-  inline bool should_escape(char c) {
-    return should_escape<s_fields_enclosed_by_length>(c);
-  }
-
-  template <int N, std::enable_if_t<0 == N, int> = 0>
-  inline bool should_escape(char) {
-    // FIELDS ENCLOSED BY character is not specified, nothing to do
-    return false;
-  }
-
-  template <int N, std::enable_if_t<1 == N, int> = 0>
-  inline bool should_escape(char c) {
-    // FIELDS ENCLOSED BY character is specified, escape it
-    return c == T::fields_enclosed_by[0];
-  }
-
   inline void quote_field(uint32_t idx) {
     quote_field<s_fields_enclosed_by_length>(idx);
   }
@@ -373,6 +362,12 @@ class Dialect_dump_writer : public Dump_writer {
   static constexpr size_t s_fields_enclosed_by_length =
       shcore::array_size(T::fields_enclosed_by) - 1;
 
+  // if FIELDS ENCLOSED BY is not specified, its first character is '\0',
+  // which is escaped anyway
+  static constexpr Escape_scanner s_escape_scanner{
+      T::fields_escaped_by[0], T::fields_terminated_by[0],
+      T::lines_terminated_by[0], T::fields_enclosed_by[0]};
+
   uint32_t m_num_fields;
 
   // not using vectors of bool here, as they are not very efficient on access
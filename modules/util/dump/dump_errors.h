@@ -182,7 +182,11 @@
   "Dump contains one or more invalid views. Fix them manually, or use the " \
   "'excludeTables' option to exclude them."
 
-#define SHERR_DUMP_LAST 52039
+#define SHERR_DUMP_INVALID_INCREMENTAL_BASE 52040
+#define SHERR_DUMP_INVALID_INCREMENTAL_BASE_MSG \
+  "Cannot use '%s' as a base of an incremental dump: %s."
+
+#define SHERR_DUMP_LAST 52040
 
 #define SHERR_DUMP_MAX 52999
 
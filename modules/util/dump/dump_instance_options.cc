@@ -63,6 +63,8 @@ const shcore::Option_pack_def<Dump_instance_options>
           .optional("users", &Dump_instance_options::m_dump_users)
           .include(&Dump_instance_options::m_filtering_options,
                    &common::Filtering_options::users)
+          .optional("incrementalBase",
+                    &Dump_instance_options::m_incremental_base)
           .on_done(&Dump_instance_options::on_unpacked_options)
           .on_log(&Dump_instance_options::on_log_options);
 
@@ -85,6 +87,12 @@ void Dump_instance_options::on_unpacked_options() {
     }
   }
 
+  if (!m_incremental_base.empty() && (!dump_ddl() || !dump_data())) {
+    throw std::invalid_argument(
+        "The 'incrementalBase' option cannot be used if the 'ddlOnly' or the "
+        "'dataOnly' option is set to true.");
+  }
+
   if (mds_compatibility()) {
     auto &schemas = filters().schemas();
     // if MDS compatibility option is set, the following schemas should be
@@ -48,12 +48,15 @@ class Dump_instance_options : public Dump_schemas_options {
 
   bool dump_users() const override { return m_dump_users; }
 
+  std::string incremental_base() const override { return m_incremental_base; }
+
  private:
   void on_unpacked_options();
 
   void validate_options() const override;
 
   bool m_dump_users = true;
+  std::string m_incremental_base;
 };
 
 }  // namespace dump
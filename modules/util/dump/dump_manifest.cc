@@ -25,6 +25,7 @@
 
 #include <chrono>
 #include <ctime>
+#include <future>
 #include <stdexcept>
 #include <unordered_set>
 #include <utility>
@@ -68,7 +69,7 @@ class Dump_manifest_object
                        const Dump_manifest_write_config_ptr &config,
                        const std::string &name, const std::string &prefix);
 
-  ~Dump_manifest_object() override = default;
+  ~Dump_manifest_object() override;
 
   /**
    * Opens the object for data operations:
@@ -99,9 +100,9 @@ class Dump_manifest_object
   std::string object_name() const;
 
   std::shared_ptr<Manifest_writer> m_writer;
-  std::unique_ptr<std::thread> m_par_thread;
+  std::future<void> m_par_creation;
   std::unique_ptr<mysqlshdk::oci::PAR> m_par;
-  std::string m_par_thread_error;
+  std::string m_par_creation_error;
   Dump_manifest_write_config_ptr m_config;
 };
 
@@ -111,18 +112,25 @@ Dump_manifest_object::Dump_manifest_object(
     const std::string &prefix)
     : Object(config, name, prefix), m_writer(writer), m_config(config) {}
 
+Dump_manifest_object::~Dump_manifest_object() {
+  // PAR creation uses this object
+  if (m_par_creation.valid()) {
+    m_par_creation.wait();
+  }
+}
+
 void Dump_manifest_object::open(mysqlshdk::storage::Mode mode) {
   // The PAR creation is done in parallel
-  m_par_thread = std::make_unique<std::thread>(
-      mysqlsh::spawn_scoped_thread([this]() { create_par(); }));
+  m_par_creation =
+      m_executor->submit(mysqlshdk::rest::Rest_executor::Priority::PAR,
+                         [this]() { create_par(); });
 
   Object::open(mode);
 }
 
 void Dump_manifest_object::close() {
-  if (m_par_thread) {
-    m_par_thread->join();
-    m_par_thread.reset();
+  if (m_par_creation.valid()) {
+    m_par_creation.get();
 
     // Getting the file size when a writer is open takes the value from the
     // writer rather than sending another request to the server
@@ -131,28 +139,33 @@ void Dump_manifest_object::close() {
     }
   }
 
-  {
-    if (m_par) {
-      m_writer->add_par(std::move(*m_par));
-    } else {
-      try {
-        this->remove();
-      } catch (const mysqlshdk::rest::Response_error &error) {
-        log_error("Failed removing object '%s' after PAR creation failed: %s",
-                  Object::full_path().masked().c_str(), error.what());
-      } catch (const mysqlshdk::rest::Connection_error &error) {
-        log_error("Failed removing object '%s' after PAR creation failed: %s",
-                  Object::full_path().masked().c_str(), error.what());
-      }
-    }
+  if (m_par) {
+    m_writer->add_par(std::move(*m_par));
   }
 
   Object::close();
 
   // throw only after everything is cleaned up
   if (!m_par) {
+    // the object is not going to be accessible, remove it asynchronously
+    m_executor->submit(
+        mysqlshdk::rest::Rest_executor::Priority::CLEANUP,
+        [config = m_config, path = Object::full_path()]() {
+          try {
+            config->container()->delete_object(path.real());
+          } catch (const mysqlshdk::rest::Response_error &error) {
+            log_error(
+                "Failed removing object '%s' after PAR creation failed: %s",
+                path.masked().c_str(), error.what());
+          } catch (const mysqlshdk::rest::Connection_error &error) {
+            log_error(
+                "Failed removing object '%s' after PAR creation failed: %s",
+                path.masked().c_str(), error.what());
+          }
+        });
+
     THROW_ERROR(SHERR_DUMP_MANIFEST_PAR_CREATION_FAILED, object_name().c_str(),
-                m_par_thread_error.c_str());
+                m_par_creation_error.c_str());
   }
 }
 
@@ -171,11 +184,11 @@ void Dump_manifest_object::create_par() {
         m_config->par_expire_time(), par_name, name);
     m_par = std::make_unique<mysqlshdk::oci::PAR>(std::move(par));
   } catch (const mysqlshdk::rest::Response_error &error) {
-    m_par_thread_error = error.what();
+    m_par_creation_error = error.what();
     log_error("Error creating PAR for object '%s': %s", name.c_str(),
               error.what());
   } catch (const mysqlshdk::rest::Connection_error &error) {
-    m_par_thread_error = error.what();
+    m_par_creation_error = error.what();
     log_error("Error creating PAR for object '%s': %s", name.c_str(),
               error.what());
   }
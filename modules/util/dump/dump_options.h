@@ -91,6 +91,10 @@ class Dump_options {
 
   void dont_rename_data_files() { m_rename_data_files = false; }
 
+  void set_encode_binary_columns(bool encode) {
+    m_encode_binary_columns = encode;
+  }
+
   // getters
   const std::string &output_url() const { return m_output_url; }
 
@@ -98,6 +102,8 @@ class Dump_options {
 
   bool use_base64() const { return m_use_base64; }
 
+  bool encode_binary_columns() const { return m_encode_binary_columns; }
+
   int64_t max_rate() const { return m_max_rate; }
 
   bool show_progress() const { return m_show_progress; }
@@ -186,6 +192,10 @@ class Dump_options {
 
   virtual bool par_manifest() const = 0;
 
+  virtual std::string metadata_cache() const = 0;
+
+  virtual std::string incremental_base() const = 0;
+
  protected:
   void enable_mds_compatibility() { m_is_mds = true; }
 
@@ -255,6 +265,7 @@ class Dump_options {
 
   // not configurable
   bool m_use_base64 = true;
+  bool m_encode_binary_columns = true;
 
   // common options
   int64_t m_max_rate = 0;
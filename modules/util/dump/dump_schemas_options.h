@@ -54,6 +54,8 @@ class Dump_schemas_options : public Ddl_dumper_options {
 
   bool dump_users() const override { return false; }
 
+  std::string incremental_base() const override { return {}; }
+
   void set_schemas(const std::vector<std::string> &schemas);
 
  protected:
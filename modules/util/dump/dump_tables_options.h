@@ -57,6 +57,8 @@ class Dump_tables_options : public Ddl_dumper_options {
 
   bool dump_users() const override { return false; }
 
+  std::string incremental_base() const override { return {}; }
+
  private:
   void validate_options() const override;
 
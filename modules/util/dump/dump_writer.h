@@ -66,6 +66,8 @@ class Dump_write_result final {
 
   void write_row() noexcept { ++m_rows_written; }
 
+  void write_rows(uint64_t rows) noexcept { m_rows_written += rows; }
+
   uint64_t rows_written() const noexcept { return m_rows_written; }
 
  private:
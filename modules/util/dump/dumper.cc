@@ -123,6 +123,8 @@ std::string quote_value(const std::string &value, mysqlshdk::db::Type type) {
   }
 }
 
+constexpr auto k_fingerprints_file = "@.fingerprints.json";
+
 auto refs(const std::string &s) {
   return rapidjson::StringRef(s.c_str(), s.length());
 }
@@ -142,6 +144,39 @@ void write_json(std::unique_ptr<mysqlshdk::storage::IFile> file,
   file->close();
 }
 
+std::string read_metadata_cache(const std::string &path) {
+  std::string contents;
+
+  if (!shcore::path_exists(path)) {
+    log_info("Metadata cache file '%s' does not exist.", path.c_str());
+  } else if (!shcore::load_text_file(path, contents)) {
+    current_console()->print_warning(
+        "Failed to read the metadata cache file '" + path +
+        "': " + shcore::get_last_error());
+    contents.clear();
+  }
+
+  return contents;
+}
+
+void write_metadata_cache(const std::string &path,
+                          const std::string &contents) {
+  // write to a temporary file first, so that an interrupted write does not
+  // leave a truncated cache behind
+  const auto tmp = path + ".tmp";
+
+  try {
+    if (!shcore::create_file(tmp, contents, true)) {
+      throw std::runtime_error(shcore::get_last_error());
+    }
+
+    shcore::rename_file(tmp, path);
+  } catch (const std::exception &e) {
+    current_console()->print_warning(
+        "Failed to write the metadata cache file '" + path + "': " + e.what());
+  }
+}
+
 Issue_status_set show_issues(const std::vector<Schema_dumper::Issue> &issues) {
   const auto console = current_console();
   Issue_status_set status;
@@ -226,23 +261,13 @@ using mysqlshdk::mysql::Gtid;
 using mysqlshdk::mysql::Gtid_range;
 using mysqlshdk::mysql::Gtid_set;
 
-bool check_if_transactions_are_ddl_safe(
+/**
+ * Lists binary logs which hold events between the given positions, if binary
+ * log of the starting position was purged, list begins with the oldest one.
+ */
+std::vector<std::string> list_binlogs_between(
     const mysqlshdk::mysql::IInstance &instance,
-    const Instance_cache::Binlog &from, const Instance_cache::Binlog &to,
-    const Gtid_set &gtid_set = {}) {
-  std::vector<Gtid_range> gtid_ranges;
-  uint64_t count = 0;
-
-  gtid_set.enumerate_ranges([&gtid_ranges, &count](const Gtid_range &range) {
-    gtid_ranges.emplace_back(range);
-    count += mysqlshdk::mysql::count(range);
-  });
-
-  const auto console = current_console();
-  console->print_note("Checking" + (count ? " " + std::to_string(count) : "") +
-                      " recent transactions for schema changes, use the "
-                      "'skipConsistencyChecks' option to skip this check.");
-
+    const Instance_cache::Binlog &from, const Instance_cache::Binlog &to) {
   std::vector<std::string> binlogs;
 
   if (from.file == to.file) {
@@ -261,6 +286,28 @@ bool check_if_transactions_are_ddl_safe(
                                                           : end.base()));
   }
 
+  return binlogs;
+}
+
+bool check_if_transactions_are_ddl_safe(
+    const mysqlshdk::mysql::IInstance &instance,
+    const Instance_cache::Binlog &from, const Instance_cache::Binlog &to,
+    const Gtid_set &gtid_set = {}) {
+  std::vector<Gtid_range> gtid_ranges;
+  uint64_t count = 0;
+
+  gtid_set.enumerate_ranges([&gtid_ranges, &count](const Gtid_range &range) {
+    gtid_ranges.emplace_back(range);
+    count += mysqlshdk::mysql::count(range);
+  });
+
+  const auto console = current_console();
+  console->print_note("Checking" + (count ? " " + std::to_string(count) : "") +
+                      " recent transactions for schema changes, use the "
+                      "'skipConsistencyChecks' option to skip this check.");
+
+  const auto binlogs = list_binlogs_between(instance, from, to);
+
   const auto include_gtid = [&gtid_ranges](const Gtid &gtid) {
     if (gtid_ranges.empty()) {
       return true;
@@ -756,6 +803,20 @@ class Dumper::Table_worker final {
     return Dumper::query(m_session, sql);
   }
 
+  static std::string partitions(const Table_data_task &table) {
+    std::string result;
+
+    if (!table.partitions.empty()) {
+      result = " PARTITION (" +
+               shcore::str_join(
+                   table.partitions.begin(), table.partitions.end(), ",",
+                   [](const auto &p) { return p.info->quoted_name; }) +
+               ")";
+    }
+
+    return result;
+  }
+
   std::string prepare_query(
       const Table_data_task &table,
       std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
@@ -763,7 +824,7 @@ class Dumper::Table_worker final {
     std::string query = "SELECT SQL_NO_CACHE ";
 
     for (const auto &column : table.info->columns) {
-      if (column->csv_unsafe) {
+      if (m_dumper->is_encoded(*column)) {
         query += (base64 ? "TO_BASE64(" : "HEX(") + column->quoted_name + ")";
 
         out_pre_encoded_columns->push_back(
@@ -782,15 +843,7 @@ class Dumper::Table_worker final {
     query.pop_back();
 
     query += " FROM " + table.quoted_name;
-
-    if (!table.partitions.empty()) {
-      query += " PARTITION (" +
-               shcore::str_join(
-                   table.partitions.begin(), table.partitions.end(), ",",
-                   [](const auto &p) { return p.info->quoted_name; }) +
-               ")";
-    }
-
+    query += partitions(table);
     query += where(table.where);
 
     if (table.info->index.valid()) {
@@ -802,7 +855,34 @@ class Dumper::Table_worker final {
     return query;
   }
 
+  void process_table_chunk(const Table_data_task &table) {
+    log_debug("%sProcessing %s (%s) using condition: %s", m_log_id.c_str(),
+              table.task_name.c_str(), table.id.c_str(), table.where.c_str());
+
+    Table_chunk chunk;
+
+    chunk.schema = table.schema;
+    chunk.table = table.name;
+    chunk.quoted_name = table.quoted_name;
+    chunk.partitions = partitions(table);
+    chunk.where = table.where;
+    chunk.id = table.id;
+    chunk.info = table.info;
+
+    const auto progress =
+        m_dumper->table_chunk_processor()->process(chunk, m_session);
+
+    release_session();
+
+    m_dumper->update_progress(progress);
+  }
+
   void dump_table_data(const Table_data_task &table) {
+    if (m_dumper->table_chunk_processor()) {
+      process_table_chunk(table);
+      return;
+    }
+
     log_debug("%sDumping %s (%s) using condition: %s", m_log_id.c_str(),
               table.task_name.c_str(), table.id.c_str(), table.where.c_str());
 
@@ -863,7 +943,7 @@ class Dumper::Table_worker final {
              controller->total_stats().data_bytes(), controller->longest_row());
 
     m_dumper->update_progress(controller->progress_stats());
-    m_dumper->finish_writing(table.schema, table.name, controller);
+    m_dumper->finish_writing(table, controller);
   }
 
   void push_table_data_task(Table_data_task &&task) {
@@ -892,6 +972,7 @@ class Dumper::Table_worker final {
 
     data_task.task_name = table.task_name;
     data_task.name = table.name;
+    data_task.basename = table.basename;
     data_task.quoted_name = table.quoted_name;
     data_task.schema = table.schema;
     data_task.info = table.info;
@@ -1024,6 +1105,37 @@ class Dumper::Table_worker final {
     std::size_t index_column;
   };
 
+  bool update_rows_per_chunk(Chunking_info *info) const {
+    const auto row_length =
+        m_dumper->written_row_length(info->table->basename);
+
+    if (0 == row_length) {
+      // nothing was written yet
+      return false;
+    }
+
+    const auto rows_per_chunk = std::max(
+        m_dumper->m_options.bytes_per_chunk() / row_length, UINT64_C(1));
+    const auto difference = rows_per_chunk > info->rows_per_chunk
+                                ? rows_per_chunk - info->rows_per_chunk
+                                : info->rows_per_chunk - rows_per_chunk;
+
+    // ignore small changes
+    if (difference <= info->rows_per_chunk / 10) {
+      return false;
+    }
+
+    log_info("%sAdjusting chunk size of %s, written row length: %" PRIu64
+             ", rows per chunk: %" PRIu64 " -> %" PRIu64,
+             m_log_id.c_str(), info->table->task_name.c_str(), row_length,
+             info->rows_per_chunk, rows_per_chunk);
+
+    info->rows_per_chunk = rows_per_chunk;
+    info->accuracy = std::max(info->rows_per_chunk / 10, UINT64_C(10));
+
+    return true;
+  }
+
   static std::string compare(const Chunking_info &info, const Row &value,
                              const std::string &op, bool eq) {
     const auto &columns = info.table->info->index.columns();
@@ -1250,7 +1362,7 @@ class Dumper::Table_worker final {
   }
 
   template <typename T>
-  std::size_t chunk_integer_column(const Chunking_info &info, const T &min,
+  std::size_t chunk_integer_column(Chunking_info &info, const T &min,
                                    const T &max) {
     std::size_t ranges_count = 0;
 
@@ -1287,7 +1399,7 @@ class Dumper::Table_worker final {
               };
 
     auto current = min;
-    const auto step = estimated_step;
+    auto step = estimated_step;
 
     log_info("%sChunking %s using integer algorithm with %s step",
              m_log_id.c_str(), info.table->task_name.c_str(),
@@ -1300,6 +1412,14 @@ class Dumper::Table_worker final {
         return ranges_count;
       }
 
+      // chunks of this table which were already written tell us the actual
+      // size of a row, use it to compute the remaining ranges
+      if (update_rows_per_chunk(&info)) {
+        step = cast<step_t>(ensure_not_zero(
+            index_range /
+            std::max(info.row_count / info.rows_per_chunk, UINT64_C(1))));
+      }
+
       chunk_id = std::to_string(ranges_count);
       const auto begin = current;
       auto new_step = next_step(current, step);
@@ -1322,7 +1442,7 @@ class Dumper::Table_worker final {
     return ranges_count;
   }
 
-  std::size_t chunk_integer_column(const Chunking_info &info, const Row &begin,
+  std::size_t chunk_integer_column(Chunking_info &info, const Row &begin,
                                    const Row &end) {
     log_info("%sChunking %s using integer algorithm", m_log_id.c_str(),
              info.table->task_name.c_str());
@@ -1346,7 +1466,7 @@ class Dumper::Table_worker final {
         mysqlshdk::db::to_string(type));
   }
 
-  std::size_t chunk_non_integer_column(const Chunking_info &info,
+  std::size_t chunk_non_integer_column(Chunking_info &info,
                                        const Row &begin, const Row &end) {
     log_info("%sChunking %s using non-integer algorithm", m_log_id.c_str(),
              info.table->task_name.c_str());
@@ -1363,9 +1483,10 @@ class Dumper::Table_worker final {
 
     const auto select = "SELECT SQL_NO_CACHE " + index + " FROM " +
                         info.table->quoted_name + info.partition + " ";
-    const auto order_by_and_limit = info.order_by + " LIMIT " +
-                                    std::to_string(info.rows_per_chunk - 1) +
-                                    ",2 ";
+    const auto order_by_and_limit = [&info]() {
+      return info.order_by + " LIMIT " +
+             std::to_string(info.rows_per_chunk - 1) + ",2 ";
+    };
 
     const auto fetch =
         [&end](const std::shared_ptr<mysqlshdk::db::IResult> &res) {
@@ -1376,11 +1497,14 @@ class Dumper::Table_worker final {
     std::shared_ptr<mysqlshdk::db::IResult> result;
 
     do {
+      // use the actual size of rows which were already written
+      update_rows_per_chunk(&info);
+
       const auto condition = where(ge(info, range_begin));
       const auto chunk_id = std::to_string(ranges_count);
       const auto comment = get_query_comment(*info.table, chunk_id);
 
-      result = query(select + condition + order_by_and_limit + comment);
+      result = query(select + condition + order_by_and_limit() + comment);
 
       if (m_dumper->m_worker_interrupt) {
         return 0;
@@ -1398,7 +1522,7 @@ class Dumper::Table_worker final {
     return ranges_count;
   }
 
-  std::size_t chunk_column(const Chunking_info &info) {
+  std::size_t chunk_column(Chunking_info &info) {
     if (!info.table->info->index.valid()) {
       log_info(
           "%sTable %s does not have a valid index, number of chunks is "
@@ -1586,9 +1710,15 @@ class Dumper::Table_worker final {
 
     const auto dumper = m_dumper->schema_dumper(m_session);
 
-    m_dumper->write_ddl(
-        *m_dumper->dump_table(dumper.get(), schema.name, table.name),
-        common::get_table_filename(table.basename));
+    if (!table.unchanged) {
+      // tables which already exist are re-created when incremental dump is
+      // loaded
+      dumper->opt_drop_table = nullptr != m_dumper->m_incremental_base;
+
+      m_dumper->write_ddl(
+          *m_dumper->dump_table(dumper.get(), schema.name, table.name),
+          common::get_table_filename(table.basename));
+    }
 
     if (m_dumper->m_options.dump_triggers() &&
         dumper->count_triggers_for_table(schema.name, table.name) > 0) {
@@ -1909,9 +2039,13 @@ void Dumper::do_run() {
 
     fetch_user_privileges();
 
+    read_incremental_base();
+
     {
       shcore::on_leave_scope read_locks([this]() { release_read_locks(); });
 
+      fetch_fingerprints_timestamp();
+
       acquire_read_locks();
 
       if (m_worker_interrupt) {
@@ -1996,6 +2130,10 @@ void Dumper::do_run() {
 
   rethrow();
 
+  if (!m_metadata_snapshot.empty() && !m_worker_interrupt) {
+    write_metadata_cache(m_options.metadata_cache(), m_metadata_snapshot);
+  }
+
 #ifndef NDEBUG
   if (m_server_version.version < Version(8, 0, 21) ||
       m_server_version.version > Version(8, 0, 23) || !dump_users()) {
@@ -2487,9 +2625,25 @@ void Dumper::initialize_instance_cache() {
 
   auto builder = Instance_cache_builder(session(), m_options.filters(),
                                         std::move(m_cache));
+  const auto metadata_cache = m_options.metadata_cache();
+
+  if (!metadata_cache.empty()) {
+    builder.use_snapshot(read_metadata_cache(metadata_cache));
+  }
 
   builder.metadata(m_options.included_partitions());
 
+  if (!m_options.is_export_only()) {
+    // written to the fingerprints file, used by incremental dumps
+    builder.fingerprints();
+  }
+
+  if (!metadata_cache.empty() && !m_options.is_dry_run()) {
+    // written once the dump succeeds, so that a failed dump does not leave
+    // the metadata it has used behind
+    m_metadata_snapshot = builder.snapshot();
+  }
+
   if (dump_users()) {
     builder.users();
   }
@@ -2519,6 +2673,201 @@ void Dumper::initialize_instance_cache() {
   print_object_stats();
 }
 
+void Dumper::read_incremental_base() {
+  const auto url = m_options.incremental_base();
+
+  if (url.empty()) {
+    return;
+  }
+
+  const auto dir =
+      mysqlshdk::storage::make_directory(url, m_options.storage_config());
+  const auto path = dir->full_path().masked();
+
+  const auto fail = [&path](const std::string &reason) {
+    THROW_ERROR(SHERR_DUMP_INVALID_INCREMENTAL_BASE, path.c_str(),
+                reason.c_str());
+  };
+
+  const auto fetch = [&dir, &fail](const std::string &name) {
+    const auto file = dir->file(name);
+
+    if (!file->exists()) {
+      fail("file " + name + " does not exist");
+    }
+
+    file->open(Mode::READ);
+    const auto contents = mysqlshdk::storage::read_file(file.get());
+    file->close();
+
+    shcore::Value metadata;
+
+    try {
+      metadata = shcore::Value::parse(contents);
+    } catch (const shcore::Exception &e) {
+      log_error("Failed to parse %s: %s", name.c_str(), e.format().c_str());
+    }
+
+    if (shcore::Map != metadata.type) {
+      fail("file " + name + " is not valid");
+    }
+
+    return metadata.as_map();
+  };
+
+  if (!dir->exists()) {
+    fail("directory does not exist");
+  }
+
+  if (!dir->file("@.done.json")->exists()) {
+    fail("dump is not complete");
+  }
+
+  const auto md = fetch("@.json");
+
+  if (md->get_string("origin") != name()) {
+    fail("it was not created by util." + std::string{name()} + "()");
+  }
+
+  if (md->get_string("server") !=
+      query("SELECT @@GLOBAL.HOSTNAME")->fetch_one()->get_string(0)) {
+    fail("it was created using a different server");
+  }
+
+  auto base = std::make_unique<Incremental_base>();
+
+  base->url = path;
+  base->begin = md->get_string("begin");
+  base->binlog.file = md->get_string("binlogFile");
+  base->binlog.position = md->get_uint("binlogPosition");
+  base->gtid_executed = md->get_string("gtidExecuted");
+
+  const auto for_each_name = [](const shcore::Array_t &names,
+                                 const auto &callback) {
+    if (names) {
+      for (const auto &name : *names) {
+        callback(name.as_string());
+      }
+    }
+  };
+
+  for_each_name(md->get_array("users"), [&base](std::string &&user) {
+    base->users.emplace_back(std::move(user));
+  });
+
+  const auto fingerprints = fetch(k_fingerprints_file);
+
+  base->timestamp = fingerprints->get_string("timestamp");
+  base->time_zone = fingerprints->get_string("timeZone");
+
+  if (const auto schemas = fingerprints->get_map("schemas")) {
+    for (const auto &s : *schemas) {
+      const auto info = s.second.as_map();
+      auto &schema = base->schemas[s.first];
+
+      if (const auto tables = info->get_map("tables")) {
+        for (const auto &t : *tables) {
+          const auto fingerprint = t.second.as_map();
+          auto &table = schema.tables[t.first];
+
+          table.create_time = fingerprint->get_string("createTime");
+          table.update_time = fingerprint->get_string("updateTime");
+          table.fingerprint = fingerprint->get_string("definition");
+
+          for_each_name(fingerprint->get_array("triggers"),
+                        [&table](std::string &&trigger) {
+                          table.triggers.emplace_back(std::move(trigger));
+                        });
+        }
+      }
+
+      for_each_name(info->get_array("views"), [&schema](std::string &&view) {
+        schema.views.try_emplace(std::move(view));
+      });
+      for_each_name(info->get_array("events"), [&schema](std::string &&event) {
+        schema.events.emplace(std::move(event));
+      });
+      for_each_name(info->get_array("functions"),
+                    [&schema](std::string &&function) {
+                      schema.functions.emplace(std::move(function));
+                    });
+      for_each_name(info->get_array("procedures"),
+                    [&schema](std::string &&procedure) {
+                      schema.procedures.emplace(std::move(procedure));
+                    });
+    }
+  }
+
+  current_console()->print_info(
+      "Creating an incremental dump, using the dump created at " +
+      base->begin + " as a base.");
+
+  if (m_server_version.version >= Version(8, 0, 0)) {
+    // UPDATE_TIME is used to detect modified tables, do not use cached values
+    execute("SET SESSION information_schema_stats_expiry = 0");
+  }
+
+  m_incremental_base = std::move(base);
+}
+
+void Dumper::fetch_fingerprints_timestamp() {
+  if (m_options.is_export_only()) {
+    return;
+  }
+
+  // UPDATE_TIME has a resolution of one second, tables modified in the same
+  // second in which they are listed are always considered to be modified in
+  // subsequent incremental dumps, timestamp is taken before tables are listed
+  const auto row =
+      query("SELECT NOW(),TIMEDIFF(NOW(),UTC_TIMESTAMP())")->fetch_one();
+
+  m_fingerprints_timestamp = row->get_as_string(0);
+  m_fingerprints_time_zone = row->get_as_string(1);
+
+  if (m_incremental_base &&
+      m_incremental_base->time_zone != m_fingerprints_time_zone) {
+    current_console()->print_warning(
+        "Time zone of the server has changed since the base dump was "
+        "created, data of all tables is going to be dumped.");
+  }
+}
+
+bool Dumper::is_table_unchanged(const std::string &schema,
+                                const std::string &table,
+                                const Instance_cache::Table &info) const {
+  if (!m_incremental_base ||
+      m_incremental_base->time_zone != m_fingerprints_time_zone) {
+    return false;
+  }
+
+  const auto &schemas = m_incremental_base->schemas;
+  const auto s = schemas.find(schema);
+
+  if (schemas.end() == s) {
+    return false;
+  }
+
+  const auto t = s->second.tables.find(table);
+
+  if (s->second.tables.end() == t) {
+    return false;
+  }
+
+  const auto &base = t->second;
+
+  // UPDATE_TIME is NULL if table was not modified since the server was started
+  // or since table was evicted from the cache, such tables are always dumped;
+  // times use the same format and can be compared as strings; in-place and
+  // instant ALTER TABLE do not modify CREATE_TIME, fingerprint of the table
+  // definition is compared as well
+  return !info.update_time.empty() && !info.fingerprint.empty() &&
+         info.create_time == base.create_time &&
+         info.update_time == base.update_time &&
+         info.fingerprint == base.fingerprint &&
+         info.create_time < m_incremental_base->timestamp &&
+         info.update_time < m_incremental_base->timestamp;
+}
+
 void Dumper::create_schema_tasks() {
   bool has_partitions = false;
 
@@ -2535,6 +2884,11 @@ void Dumper::create_schema_tasks() {
       table.basename =
           get_basename(common::encode_table_basename(schema.name, table.name));
       table.info = &t.second;
+      table.unchanged = is_table_unchanged(schema.name, table.name, t.second);
+
+      if (table.unchanged) {
+        ++m_unchanged_tables;
+      }
 
       for (const auto &p : t.second.partitions) {
         has_partitions = true;
@@ -2567,6 +2921,14 @@ void Dumper::create_schema_tasks() {
   if (has_partitions) {
     m_used_capabilities.emplace(Capability::PARTITION_AWARENESS);
   }
+
+  if (m_incremental_base) {
+    current_console()->print_info(
+        std::to_string(m_unchanged_tables) + " out of " +
+        std::to_string(m_cache.filtered.tables) +
+        " tables were not modified since the base dump was created, their "
+        "data is not going to be dumped.");
+  }
 }
 
 void Dumper::validate_mds() const {
@@ -2753,7 +3115,9 @@ void Dumper::initialize_counters() {
     m_total_views += schema.views.size();
 
     for (auto &table : schema.tables) {
-      m_total_rows += table.info->row_count;
+      if (!table.unchanged) {
+        m_total_rows += table.info->row_count;
+      }
     }
   }
 
@@ -3119,7 +3483,7 @@ void Dumper::create_table_tasks() {
                             shcore::Queue_priority::HIGH);
       }
 
-      if (m_options.dump_data()) {
+      if (m_options.dump_data() && !table.unchanged) {
         push_table_task(std::move(task));
       }
     }
@@ -3151,6 +3515,7 @@ Dumper::Table_task Dumper::create_table_task(const Schema_info &schema,
   task.basename = table.basename;
   task.info = table.info;
   task.partitions = table.partitions;
+  task.unchanged = table.unchanged;
   task.where = m_options.where(schema.name, table.name);
 
   on_create_table_task(task.schema, task.name, task.info);
@@ -3277,12 +3642,37 @@ Dumper::table_dump_multi_file_controller(const std::string &basename) const {
       basename, m_table_data_extension, m_options.bytes_per_chunk());
 }
 
-void Dumper::finish_writing(const std::string &schema, const std::string &table,
+void Dumper::finish_writing(const Table_data_task &table,
                             const Dump_writer_controller *controller) {
+  // controller may write multiple files
+  std::unordered_map<std::string, uint64_t> file_bytes;
+  controller->update_uncompressed_file_size(&file_bytes);
+
+  std::lock_guard<std::mutex> lock(m_table_data_stats_mutex);
+
+  auto &chunk_bytes = m_table_chunk_bytes[table.schema][table.name];
+
+  for (const auto &file : file_bytes) {
+    m_chunk_file_bytes[file.first] += file.second;
+    chunk_bytes.emplace_back(file.second);
+  }
+
+  m_table_data_stats[table.schema][table.name] += controller->total_stats();
+  m_basename_data_stats[table.basename] += controller->total_stats();
+}
+
+uint64_t Dumper::written_row_length(const std::string &basename) {
   std::lock_guard<std::mutex> lock(m_table_data_stats_mutex);
 
-  controller->update_uncompressed_file_size(&m_chunk_file_bytes);
-  m_table_data_stats[schema][table] += controller->total_stats();
+  const auto stats = m_basename_data_stats.find(basename);
+
+  if (m_basename_data_stats.end() == stats ||
+      0 == stats->second.rows_written()) {
+    return 0;
+  }
+
+  return std::max(
+      stats->second.data_bytes() / stats->second.rows_written(), UINT64_C(1));
 }
 
 void Dumper::write_metadata() const {
@@ -3291,6 +3681,7 @@ void Dumper::write_metadata() const {
   }
 
   write_dump_started_metadata();
+  write_fingerprints();
 }
 
 void Dumper::write_dump_started_metadata() const {
@@ -3414,6 +3805,186 @@ void Dumper::write_dump_started_metadata() const {
     doc.AddMember(StringRef("capabilities"), std::move(capabilities), a);
   }
 
+  if (m_incremental_base) {
+    const auto &base = *m_incremental_base;
+    Value incremental{Type::kObjectType};
+
+    incremental.AddMember(StringRef("base"), refs(base.url), a);
+    incremental.AddMember(StringRef("baseBegin"), refs(base.begin), a);
+    incremental.AddMember(StringRef("baseBinlogFile"), refs(base.binlog.file),
+                          a);
+    incremental.AddMember(StringRef("baseBinlogPosition"),
+                          base.binlog.position, a);
+    incremental.AddMember(StringRef("baseGtidExecuted"),
+                          refs(base.gtid_executed), a);
+
+    {
+      // binary logs which hold the changes made since the base was created,
+      // these can be used to replay transactions which were committed after
+      // this dump was created
+      Value binlogs{Type::kArrayType};
+
+      if (!base.binlog.file.empty() && !m_cache.binlog.file.empty()) {
+        try {
+          const auto files = list_binlogs_between(
+              mysqlshdk::mysql::Instance(session()), base.binlog,
+              m_cache.binlog);
+
+          if (files.empty() || files.front() != base.binlog.file) {
+            current_console()->print_warning(
+                "The binary log file " + base.binlog.file +
+                " has been purged, changes made since the base dump was "
+                "created cannot be replayed using the binary logs.");
+          }
+
+          for (const auto &file : files) {
+            binlogs.PushBack({file.c_str(), a}, a);
+          }
+        } catch (const std::exception &e) {
+          current_console()->print_warning(
+              std::string{"Failed to list the binary log files: "} + e.what());
+        }
+      }
+
+      incremental.AddMember(StringRef("binlogFiles"), std::move(binlogs), a);
+    }
+
+    {
+      // objects which were dropped since the base was created
+      const auto &filters = m_options.filters();
+      Value schemas{Type::kArrayType};
+      Value tables{Type::kObjectType};
+      Value views{Type::kObjectType};
+      Value triggers{Type::kObjectType};
+      Value functions{Type::kObjectType};
+      Value procedures{Type::kObjectType};
+      Value events{Type::kObjectType};
+
+      const auto add = [&a](Value *target, const std::string &key,
+                            Value &&names) {
+        if (!(names.IsArray() ? names.Empty() : names.ObjectEmpty())) {
+          target->AddMember(refs(key), std::move(names), a);
+        }
+      };
+
+      const auto dropped = [&a](const auto &base_names, const auto &current,
+                                const auto &is_included) {
+        Value names{Type::kArrayType};
+
+        for (const auto &name : base_names) {
+          if (std::find(current.begin(), current.end(), name) ==
+                  current.end() &&
+              is_included(name)) {
+            names.PushBack(refs(name), a);
+          }
+        }
+
+        return names;
+      };
+
+      for (const auto &s : base.schemas) {
+        const auto &schema = s.first;
+        const auto current = m_cache.schemas.find(schema);
+
+        if (m_cache.schemas.end() == current) {
+          if (filters.schemas().is_included(schema)) {
+            schemas.PushBack(refs(schema), a);
+          }
+
+          continue;
+        }
+
+        const auto &objects = current->second;
+        Value dropped_tables{Type::kArrayType};
+        Value table_triggers{Type::kObjectType};
+
+        for (const auto &t : s.second.tables) {
+          const auto &table = t.first;
+          const auto it = objects.tables.find(table);
+
+          if (objects.tables.end() == it) {
+            if (filters.tables().is_included(schema, table)) {
+              dropped_tables.PushBack(refs(table), a);
+            }
+          } else if (m_options.dump_triggers()) {
+            add(&table_triggers, table,
+                dropped(t.second.triggers, it->second.triggers,
+                        [&filters, &schema, &table](const std::string &name) {
+                          return filters.triggers().is_included(schema, table,
+                                                                name);
+                        }));
+          }
+        }
+
+        add(&tables, schema, std::move(dropped_tables));
+        add(&triggers, schema, std::move(table_triggers));
+
+        Value dropped_views{Type::kArrayType};
+
+        for (const auto &view : s.second.views) {
+          if (objects.views.end() == objects.views.find(view.first) &&
+              filters.tables().is_included(schema, view.first)) {
+            dropped_views.PushBack(refs(view.first), a);
+          }
+        }
+
+        add(&views, schema, std::move(dropped_views));
+
+        if (m_options.dump_events()) {
+          add(&events, schema,
+              dropped(s.second.events, objects.events,
+                      [&filters, &schema](const std::string &name) {
+                        return filters.events().is_included(schema, name);
+                      }));
+        }
+
+        if (m_options.dump_routines()) {
+          const auto is_routine_included = [&filters,
+                                            &schema](const std::string &name) {
+            return filters.routines().is_included(schema, name);
+          };
+
+          add(&functions, schema,
+              dropped(s.second.functions, objects.functions,
+                      is_routine_included));
+          add(&procedures, schema,
+              dropped(s.second.procedures, objects.procedures,
+                      is_routine_included));
+        }
+      }
+
+      Value objects{Type::kObjectType};
+
+      objects.AddMember(StringRef("schemas"), std::move(schemas), a);
+      objects.AddMember(StringRef("tables"), std::move(tables), a);
+      objects.AddMember(StringRef("views"), std::move(views), a);
+      objects.AddMember(StringRef("triggers"), std::move(triggers), a);
+      objects.AddMember(StringRef("functions"), std::move(functions), a);
+      objects.AddMember(StringRef("procedures"), std::move(procedures), a);
+      objects.AddMember(StringRef("events"), std::move(events), a);
+
+      if (dump_users()) {
+        std::vector<std::string> accounts;
+
+        for (const auto &user : schema_dumper(session())->get_users(
+                 filters.users())) {
+          accounts.emplace_back(shcore::make_account(user));
+        }
+
+        objects.AddMember(StringRef("users"),
+                          dropped(base.users, accounts,
+                                  [&filters](const std::string &name) {
+                                    return filters.users().is_included(name);
+                                  }),
+                          a);
+      }
+
+      incremental.AddMember(StringRef("dropped"), std::move(objects), a);
+    }
+
+    doc.AddMember(StringRef("incremental"), std::move(incremental), a);
+  }
+
   doc.AddMember(StringRef("begin"),
                 refs(m_progress_thread.duration().started_at()), a);
 
@@ -3476,9 +4047,109 @@ void Dumper::write_dump_finished_metadata() const {
     doc.AddMember(StringRef("chunkFileBytes"), std::move(files), a);
   }
 
+  {
+    Value chunks{Type::kObjectType};
+
+    for (const auto &schema : m_table_chunk_bytes) {
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.second) {
+        auto sizes = table.second;
+
+        if (sizes.empty()) {
+          continue;
+        }
+
+        std::sort(sizes.begin(), sizes.end());
+
+        Value distribution{Type::kObjectType};
+
+        distribution.AddMember(StringRef("count"),
+                               static_cast<uint64_t>(sizes.size()), a);
+        distribution.AddMember(StringRef("min"), sizes.front(), a);
+        distribution.AddMember(StringRef("median"), sizes[sizes.size() / 2],
+                               a);
+        distribution.AddMember(StringRef("max"), sizes.back(), a);
+
+        tables.AddMember(refs(table.first), std::move(distribution), a);
+      }
+
+      chunks.AddMember(refs(schema.first), std::move(tables), a);
+    }
+
+    doc.AddMember(StringRef("tableChunkBytes"), std::move(chunks), a);
+  }
+
   write_json(make_file("@.done.json"), &doc);
 }
 
+void Dumper::write_fingerprints() const {
+  using rapidjson::Document;
+  using rapidjson::StringRef;
+  using rapidjson::Type;
+  using rapidjson::Value;
+
+  Document doc{Type::kObjectType};
+  auto &a = doc.GetAllocator();
+
+  doc.AddMember(StringRef("timestamp"), refs(m_fingerprints_timestamp), a);
+  doc.AddMember(StringRef("timeZone"), refs(m_fingerprints_time_zone), a);
+
+  const auto names = [&a](const auto &container) {
+    Value array{Type::kArrayType};
+
+    for (const auto &name : container) {
+      array.PushBack(refs(name), a);
+    }
+
+    return array;
+  };
+
+  {
+    Value schemas{Type::kObjectType};
+
+    for (const auto &schema : m_cache.schemas) {
+      Value tables{Type::kObjectType};
+
+      for (const auto &table : schema.second.tables) {
+        Value fingerprint{Type::kObjectType};
+
+        fingerprint.AddMember(StringRef("createTime"),
+                              refs(table.second.create_time), a);
+        fingerprint.AddMember(StringRef("updateTime"),
+                              refs(table.second.update_time), a);
+        fingerprint.AddMember(StringRef("definition"),
+                              refs(table.second.fingerprint), a);
+        fingerprint.AddMember(StringRef("triggers"),
+                              names(table.second.triggers), a);
+
+        tables.AddMember(refs(table.first), std::move(fingerprint), a);
+      }
+
+      Value views{Type::kArrayType};
+
+      for (const auto &view : schema.second.views) {
+        views.PushBack(refs(view.first), a);
+      }
+
+      Value info{Type::kObjectType};
+
+      info.AddMember(StringRef("tables"), std::move(tables), a);
+      info.AddMember(StringRef("views"), std::move(views), a);
+      info.AddMember(StringRef("events"), names(schema.second.events), a);
+      info.AddMember(StringRef("functions"), names(schema.second.functions), a);
+      info.AddMember(StringRef("procedures"), names(schema.second.procedures),
+                     a);
+
+      schemas.AddMember(refs(schema.first), std::move(info), a);
+    }
+
+    doc.AddMember(StringRef("schemas"), std::move(schemas), a);
+  }
+
+  write_json(make_file(k_fingerprints_file), &doc);
+}
+
 void Dumper::write_schema_metadata(const Schema_info &schema) const {
   if (m_options.is_export_only()) {
     return;
@@ -3605,7 +4276,7 @@ void Dumper::write_table_metadata(
     for (const auto &c : table.info->columns) {
       cols.PushBack(refs(c->name), a);
 
-      if (c->csv_unsafe) {
+      if (is_encoded(*c)) {
         decode.AddMember(
             refs(c->name),
             StringRef(m_options.use_base64() ? "FROM_BASE64" : "UNHEX"), a);
@@ -3667,9 +4338,11 @@ void Dumper::write_table_metadata(
     doc.AddMember(StringRef("histograms"), std::move(histograms), a);
   }
 
-  doc.AddMember(StringRef("includesData"),
-                m_options.dump_data() && should_dump_data(table), a);
-  doc.AddMember(StringRef("includesDdl"), m_options.dump_ddl(), a);
+  doc.AddMember(
+      StringRef("includesData"),
+      m_options.dump_data() && !table.unchanged && should_dump_data(table), a);
+  doc.AddMember(StringRef("includesDdl"),
+                m_options.dump_ddl() && !table.unchanged, a);
 
   doc.AddMember(StringRef("extension"), refs(m_table_data_extension), a);
   doc.AddMember(StringRef("chunking"), m_options.split(), a);
@@ -3738,6 +4411,14 @@ void Dumper::summarize() const {
     }
   }
 
+  if (table_chunk_processor()) {
+    // data was not written, subclass is going to report the results
+    console->print_status("Total duration: " +
+                          m_progress_thread.duration().to_string());
+    summary();
+    return;
+  }
+
   console->print_status("Dump duration: " +
                         m_data_dump_stage->duration().to_string());
   console->print_status("Total duration: " +
@@ -3931,6 +4612,18 @@ bool Dumper::compressed() const {
   return mysqlshdk::storage::Compression::NONE != m_options.compression();
 }
 
+bool Dumper::is_encoded(const Instance_cache::Column &column) const {
+  if (!column.csv_unsafe) {
+    return false;
+  }
+
+  // binary data can be written as is, escaping is enough for LOAD DATA to
+  // handle it, geometry columns are always encoded, as server may reject the
+  // internal format
+  return m_options.encode_binary_columns() ||
+         mysqlshdk::db::Type::Geometry == column.type;
+}
+
 void Dumper::kill_query() const {
   const auto &s = session();
 
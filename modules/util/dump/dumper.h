@@ -56,6 +56,40 @@ namespace dump {
 
 class Schema_dumper;
 
+/**
+ * Describes a single chunk of table data.
+ */
+struct Table_chunk {
+  std::string schema;
+  std::string table;
+  // fully qualified, quoted name of the table
+  std::string quoted_name;
+  // PARTITION clause, empty if all partitions are used
+  std::string partitions;
+  // condition which selects rows of this chunk, empty if whole table is used
+  std::string where;
+  std::string id;
+  const Instance_cache::Table *info = nullptr;
+};
+
+/**
+ * Processes data of table chunks, instead of it being written to the output.
+ */
+class Table_chunk_processor {
+ public:
+  virtual ~Table_chunk_processor() = default;
+
+  /**
+   * Processes data of the given chunk using a worker session (which has an
+   * open transaction, if dump is consistent).
+   *
+   * @returns Progress information.
+   */
+  virtual Dump_write_result process(
+      const Table_chunk &chunk,
+      const std::shared_ptr<mysqlshdk::db::ISession> &session) = 0;
+};
+
 class Dumper {
  public:
   Dumper() = delete;
@@ -134,6 +168,8 @@ class Dumper {
   struct Table_info : public Object_info {
     const Instance_cache::Table *info = nullptr;
     std::vector<Partition_info> partitions;
+    // table was not modified since the base of an incremental dump was created
+    bool unchanged = false;
   };
 
   struct View_info : public Object_info {
@@ -179,6 +215,14 @@ class Dumper {
                                     const std::string &table,
                                     const Instance_cache::Table *cache) = 0;
 
+  /**
+   * If set, data of each table chunk is passed to this processor instead of
+   * being written to the output.
+   */
+  virtual Table_chunk_processor *table_chunk_processor() const {
+    return nullptr;
+  }
+
   const std::shared_ptr<mysqlshdk::db::ISession> &session() const;
 
   void do_run();
@@ -214,6 +258,13 @@ class Dumper {
 
   void initialize_instance_cache();
 
+  void read_incremental_base();
+
+  void fetch_fingerprints_timestamp();
+
+  bool is_table_unchanged(const std::string &schema, const std::string &table,
+                          const Instance_cache::Table &info) const;
+
   void create_schema_tasks();
 
   void validate_mds() const;
@@ -295,15 +346,23 @@ class Dumper {
   std::unique_ptr<Dump_writer_controller> table_dump_multi_file_controller(
       const std::string &basename) const;
 
-  void finish_writing(const std::string &schema, const std::string &table,
+  void finish_writing(const Table_data_task &table,
                       const Dump_writer_controller *controller);
 
+  /**
+   * Average length of a row written to the data files of the given table (or
+   * partition), 0 if no data was written yet.
+   */
+  uint64_t written_row_length(const std::string &basename);
+
   void write_metadata() const;
 
   void write_dump_started_metadata() const;
 
   void write_dump_finished_metadata() const;
 
+  void write_fingerprints() const;
+
   void write_schema_metadata(const Schema_info &schema) const;
 
   void write_table_metadata(
@@ -341,6 +400,8 @@ class Dumper {
 
   bool compressed() const;
 
+  bool is_encoded(const Instance_cache::Column &column) const;
+
   void kill_query() const;
 
   std::string get_query_comment(const std::string &quoted_name,
@@ -382,6 +443,24 @@ class Dumper {
   bool m_binlog_enabled = false;
   bool m_gtid_enabled = false;
 
+  // incremental dump
+  struct Incremental_base {
+    std::string url;
+    std::string begin;
+    Instance_cache::Binlog binlog;
+    std::string gtid_executed;
+    std::vector<std::string> users;
+    std::string timestamp;
+    std::string time_zone;
+    std::unordered_map<std::string, Instance_cache::Schema> schemas;
+  };
+
+  std::unique_ptr<Incremental_base> m_incremental_base;
+  // server time and its offset from UTC, taken before tables were listed
+  std::string m_fingerprints_timestamp;
+  std::string m_fingerprints_time_zone;
+  uint64_t m_unchanged_tables = 0;
+
   // user privileges
   std::unique_ptr<mysqlshdk::mysql::User_privileges> m_user_privileges;
   std::string m_user_account;
@@ -394,6 +473,8 @@ class Dumper {
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_output_dir;
   std::unique_ptr<mysqlshdk::storage::IFile> m_output_file;
   Instance_cache m_cache;
+  // contents of the metadata cache file, written once the dump succeeds
+  std::string m_metadata_snapshot;
   std::vector<Schema_info> m_schema_infos;
   std::unordered_map<std::string, std::size_t> m_truncated_basenames;
   std::string m_table_data_extension;
@@ -438,6 +519,14 @@ class Dumper {
   // path -> uncompressed bytes
   std::unordered_map<std::string, uint64_t> m_chunk_file_bytes;
 
+  // schema -> table -> uncompressed bytes of each data file
+  std::unordered_map<std::string,
+                     std::unordered_map<std::string, std::vector<uint64_t>>>
+      m_table_chunk_bytes;
+
+  // table/partition basename -> data stats, used to adjust the chunk size
+  std::unordered_map<std::string, Dump_write_result> m_basename_data_stats;
+
   // threads
   std::vector<std::thread> m_workers;
   std::vector<std::exception_ptr> m_worker_exceptions;
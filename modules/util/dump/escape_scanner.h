@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_DUMP_ESCAPE_SCANNER_H_
+#define MODULES_UTIL_DUMP_ESCAPE_SCANNER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace mysqlsh {
+namespace dump {
+
+/**
+ * Finds characters which need to be escaped when writing a field: control
+ * characters which have their own escape sequences (\0, \b, \n, \r, \t, \Z)
+ * and up to four dialect-specific characters.
+ *
+ * Input is checked eight bytes at a time, blocks which do not contain any of
+ * these characters are skipped without inspecting each byte.
+ */
+class Escape_scanner final {
+ public:
+  constexpr Escape_scanner() : Escape_scanner('\0', '\0', '\0', '\0') {}
+
+  /**
+   * Creates the scanner, unused characters should be set to '\0'.
+   */
+  constexpr Escape_scanner(char c0, char c1, char c2, char c3) {
+    const char characters[] = {'\0', '\b', '\n', '\r', '\t',
+                               '\x1A', c0, c1, c2, c3};
+
+    for (const auto c : characters) {
+      m_needs_escape[static_cast<unsigned char>(c)] = true;
+    }
+
+    m_patterns[0] = k_ones * static_cast<unsigned char>(c0);
+    m_patterns[1] = k_ones * static_cast<unsigned char>(c1);
+    m_patterns[2] = k_ones * static_cast<unsigned char>(c2);
+    m_patterns[3] = k_ones * static_cast<unsigned char>(c3);
+  }
+
+  constexpr bool needs_escape(char c) const noexcept {
+    return m_needs_escape[static_cast<unsigned char>(c)];
+  }
+
+  /**
+   * Returns pointer to the first character in [begin, end) which needs to be
+   * escaped, end if there are no such characters.
+   */
+  const char *find(const char *begin, const char *end) const noexcept {
+    auto p = begin;
+
+    while (end - p >= k_block_size) {
+      uint64_t block;
+      memcpy(&block, p, k_block_size);
+
+      if (!may_need_escape(block)) {
+        p += k_block_size;
+        continue;
+      }
+
+      // candidate block, check each byte (this can be a false positive, i.e.
+      // control characters without an escape sequence)
+      for (const auto block_end = p + k_block_size; p != block_end; ++p) {
+        if (needs_escape(*p)) {
+          return p;
+        }
+      }
+    }
+
+    while (p != end && !needs_escape(*p)) {
+      ++p;
+    }
+
+    return p;
+  }
+
+ private:
+  static constexpr std::ptrdiff_t k_block_size = sizeof(uint64_t);
+  static constexpr uint64_t k_ones = UINT64_C(0x0101010101010101);
+  static constexpr uint64_t k_high_bits = UINT64_C(0x8080808080808080);
+
+  // non-zero if any byte is lower than n, n has to be less than 128
+  static constexpr uint64_t has_less(uint64_t v, uint64_t n) noexcept {
+    return (v - k_ones * n) & ~v & k_high_bits;
+  }
+
+  static constexpr uint64_t has_zero(uint64_t v) noexcept {
+    return has_less(v, 1);
+  }
+
+  bool may_need_escape(uint64_t block) const noexcept {
+    // all control characters are below 0x20
+    return has_less(block, 0x20) | has_zero(block ^ m_patterns[0]) |
+           has_zero(block ^ m_patterns[1]) | has_zero(block ^ m_patterns[2]) |
+           has_zero(block ^ m_patterns[3]);
+  }
+
+  bool m_needs_escape[256] = {};
+  uint64_t m_patterns[4] = {};
+};
+
+}  // namespace dump
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_DUMP_ESCAPE_SCANNER_H_
@@ -89,6 +89,10 @@ class Export_table_options : public Dump_options {
 
   bool par_manifest() const override { return false; }
 
+  std::string metadata_cache() const override { return {}; }
+
+  std::string incremental_base() const override { return {}; }
+
  private:
   void on_set_session(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) override;
@@ -25,8 +25,15 @@
 
 #include <mysqld_error.h>
 
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <set>
 #include <stdexcept>
 #include <utility>
 
@@ -99,6 +106,215 @@ std::vector<std::unique_ptr<mysqlshdk::db::Warning>> fetch_warnings(
   return warnings;
 }
 
+// version of the format of the metadata snapshot
+constexpr int k_snapshot_version = 3;
+
+// columns of information_schema tables which define a table, used to detect
+// tables which were altered in-place
+const std::vector<std::pair<std::string, std::vector<std::string>>>
+    &definition_columns() {
+  static const std::vector<std::pair<std::string, std::vector<std::string>>>
+      s_columns = {
+          {"tables",
+           {"ENGINE", "TABLE_COLLATION", "CREATE_OPTIONS", "TABLE_COMMENT"}},
+          {"columns",
+           {"ORDINAL_POSITION", "COLUMN_NAME", "COLUMN_TYPE", "IS_NULLABLE",
+            "COLUMN_DEFAULT", "COLLATION_NAME", "EXTRA", "COLUMN_COMMENT"}},
+          {"statistics",
+           {"INDEX_NAME", "SEQ_IN_INDEX", "COLUMN_NAME", "NON_UNIQUE",
+            "NULLABLE", "SUB_PART", "INDEX_TYPE"}},
+          {"partitions", {"PARTITION_NAME", "SUBPARTITION_NAME"}},
+      };
+
+  return s_columns;
+}
+
+std::string hash_rows(const std::vector<std::string> &columns) {
+  // each row is hashed, hashes of all rows are XOR-ed, this way result does not
+  // depend on the order of rows and is not truncated by group_concat_max_len
+  return "BIT_XOR(CAST(CONV(LEFT(MD5(CONCAT_WS(0x00," +
+         shcore::str_join(
+             columns, ",",
+             [](const std::string &c) { return "IFNULL(" + c + ",0x01)"; }) +
+         ")),16),16,10) AS UNSIGNED))";
+}
+
+std::string to_string(
+    const Instance_cache_builder::Partition_filters &partitions) {
+  // sort everything, so that the result is repeatable
+  std::map<std::string, std::map<std::string, std::set<std::string>>> sorted;
+
+  for (const auto &schema : partitions) {
+    for (const auto &table : schema.second) {
+      sorted[schema.first][table.first].insert(table.second.begin(),
+                                               table.second.end());
+    }
+  }
+
+  std::string result;
+
+  for (const auto &schema : sorted) {
+    for (const auto &table : schema.second) {
+      result += shcore::quote_identifier(schema.first) + '.' +
+                shcore::quote_identifier(table.first) + ':' +
+                shcore::str_join(table.second, ",", [](const auto &p) {
+                  return shcore::quote_identifier(p);
+                }) +
+                ';';
+    }
+  }
+
+  return result;
+}
+
+bool is_unchanged(const Instance_cache::Table &previous,
+                  const Instance_cache::Table &current,
+                  const std::string &timestamp, bool compare_fingerprints) {
+  // CREATE_TIME and UPDATE_TIME have a resolution of one second, table which
+  // was modified in the same second in which snapshot was taken may have
+  // changed after its metadata was fetched
+  // in-place and instant ALTER TABLE do not modify CREATE_TIME, fingerprint of
+  // the table definition is compared as well, unless it's already known that
+  // none of the definitions has changed
+  return !current.create_time.empty() &&
+         previous.create_time == current.create_time &&
+         previous.update_time == current.update_time &&
+         (!compare_fingerprints ||
+          previous.fingerprint == current.fingerprint) &&
+         current.create_time < timestamp && current.update_time < timestamp;
+}
+
+void reuse_metadata(Instance_cache::Table *source,
+                    Instance_cache::Table *target) {
+  if (target->fingerprint.empty()) {
+    target->fingerprint = std::move(source->fingerprint);
+  }
+
+  // moving the vector preserves its buffer, index still points to the right
+  // columns
+  target->all_columns = std::move(source->all_columns);
+  target->index = std::move(source->index);
+  target->partitions = std::move(source->partitions);
+
+  target->columns.clear();
+
+  for (auto &column : target->all_columns) {
+    if (!column.generated) {
+      target->columns.emplace_back(&column);
+    }
+  }
+}
+
+const rapidjson::Value &get_member(const rapidjson::Value &object,
+                                   const char *name) {
+  if (!object.IsObject()) {
+    throw std::runtime_error("expected an object");
+  }
+
+  const auto it = object.FindMember(name);
+
+  if (object.MemberEnd() == it) {
+    throw std::runtime_error(std::string{"missing member: "} + name);
+  }
+
+  return it->value;
+}
+
+std::string get_string(const rapidjson::Value &object, const char *name) {
+  const auto &value = get_member(object, name);
+
+  if (!value.IsString()) {
+    throw std::runtime_error(std::string{"expected a string: "} + name);
+  }
+
+  return {value.GetString(), value.GetStringLength()};
+}
+
+uint64_t get_uint(const rapidjson::Value &object, const char *name) {
+  const auto &value = get_member(object, name);
+
+  if (!value.IsUint64()) {
+    throw std::runtime_error(std::string{"expected an integer: "} + name);
+  }
+
+  return value.GetUint64();
+}
+
+bool get_bool(const rapidjson::Value &object, const char *name) {
+  const auto &value = get_member(object, name);
+
+  if (!value.IsBool()) {
+    throw std::runtime_error(std::string{"expected a boolean: "} + name);
+  }
+
+  return value.GetBool();
+}
+
+const rapidjson::Value &get_array(const rapidjson::Value &object,
+                                  const char *name) {
+  const auto &value = get_member(object, name);
+
+  if (!value.IsArray()) {
+    throw std::runtime_error(std::string{"expected an array: "} + name);
+  }
+
+  return value;
+}
+
+Instance_cache::Table parse_table(const rapidjson::Value &json) {
+  Instance_cache::Table table;
+
+  table.create_time = get_string(json, "createTime");
+  table.update_time = get_string(json, "updateTime");
+  table.fingerprint = get_string(json, "fingerprint");
+
+  {
+    const auto &columns = get_array(json, "columns");
+    table.all_columns.reserve(columns.Size());
+
+    for (const auto &c : columns.GetArray()) {
+      Instance_cache::Column column;
+
+      column.name = get_string(c, "name");
+      column.quoted_name = shcore::quote_identifier(column.name);
+      column.type = mysqlshdk::db::string_to_type(get_string(c, "type"));
+      column.csv_unsafe = get_bool(c, "csvUnsafe");
+      column.generated = get_bool(c, "generated");
+      column.auto_increment = get_bool(c, "autoIncrement");
+      column.nullable = get_bool(c, "nullable");
+
+      table.all_columns.emplace_back(std::move(column));
+    }
+  }
+
+  {
+    const auto &index = get_member(json, "index");
+
+    table.index.set_primary(get_bool(index, "primary"));
+
+    for (const auto &c : get_array(index, "columns").GetArray()) {
+      if (!c.IsUint() || c.GetUint() >= table.all_columns.size()) {
+        throw std::runtime_error("invalid index column");
+      }
+
+      table.index.add_column(&table.all_columns[c.GetUint()]);
+    }
+  }
+
+  for (const auto &p : get_array(json, "partitions").GetArray()) {
+    Instance_cache::Partition partition;
+
+    partition.name = get_string(p, "name");
+    partition.quoted_name = shcore::quote_identifier(partition.name);
+    partition.row_count = get_uint(p, "rowCount");
+    partition.average_row_length = get_uint(p, "averageRowLength");
+
+    table.partitions.emplace_back(std::move(partition));
+  }
+
+  return table;
+}
+
 }  // namespace
 
 void Instance_cache::Index::reset() {
@@ -123,11 +339,14 @@ struct Instance_cache_builder::Iterate_schema {
   std::vector<std::string> extra_columns;
   std::string table_name;
   std::string where;
+  std::string group_by;
 };
 
 struct Instance_cache_builder::Iterate_table
     : public Instance_cache_builder::Iterate_schema {
   std::string table_column;
+  // skip tables which are using metadata from the snapshot
+  bool changed_only = false;
 };
 
 struct Instance_cache_builder::Query_helper {
@@ -266,6 +485,10 @@ struct Instance_cache_builder::Query_helper {
 
       *query += filter;
     }
+
+    if (!info.group_by.empty()) {
+      *query += " GROUP BY " + info.group_by;
+    }
   }
 
   template <typename C, typename T>
@@ -324,12 +547,200 @@ Instance_cache_builder::Instance_cache_builder(
   }
 }
 
+Instance_cache_builder &Instance_cache_builder::use_snapshot(
+    const std::string &previous) {
+  m_use_snapshot = true;
+
+  if (previous.empty()) {
+    return *this;
+  }
+
+  Profiler profiler{"reading metadata snapshot"};
+
+  try {
+    rapidjson::Document doc;
+    doc.Parse(previous.c_str(), previous.length());
+
+    if (doc.HasParseError()) {
+      throw std::runtime_error(
+          std::string{"failed to parse JSON: "} +
+          rapidjson::GetParseError_En(doc.GetParseError()));
+    }
+
+    if (k_snapshot_version != static_cast<int>(get_uint(doc, "version"))) {
+      throw std::runtime_error("unsupported version");
+    }
+
+    Snapshot snapshot;
+
+    snapshot.server = get_string(doc, "server");
+    snapshot.version = get_string(doc, "serverVersion");
+    snapshot.partitions = get_string(doc, "partitions");
+    snapshot.timestamp = get_string(doc, "timestamp");
+    snapshot.summary = get_string(doc, "summary");
+
+    const auto &schemas = get_member(doc, "schemas");
+
+    if (!schemas.IsObject()) {
+      throw std::runtime_error("expected an object: schemas");
+    }
+
+    for (const auto &schema : schemas.GetObject()) {
+      if (!schema.value.IsObject()) {
+        throw std::runtime_error("expected an object: tables");
+      }
+
+      auto &s = snapshot.schemas[{schema.name.GetString(),
+                                  schema.name.GetStringLength()}];
+
+      for (const auto &table : schema.value.GetObject()) {
+        s.tables.emplace(
+            std::string{table.name.GetString(), table.name.GetStringLength()},
+            parse_table(table.value));
+      }
+    }
+
+    m_previous_snapshot = std::move(snapshot);
+  } catch (const std::exception &e) {
+    log_warning("Ignoring invalid metadata snapshot: %s", e.what());
+  }
+
+  return *this;
+}
+
 Instance_cache_builder &Instance_cache_builder::metadata(
     const Partition_filters &partitions) {
   fetch_metadata(partitions);
   return *this;
 }
 
+Instance_cache_builder &Instance_cache_builder::fingerprints() {
+  // fingerprints may have already been fetched or reused by the snapshot
+  if (!m_has_fingerprints) {
+    fetch_table_fingerprints();
+  }
+
+  return *this;
+}
+
+std::string Instance_cache_builder::snapshot() const {
+  assert(m_use_snapshot);
+
+  Profiler profiler{"writing metadata snapshot"};
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+
+  const auto write = [&writer](const std::string &s) {
+    writer.String(s.c_str(), s.length());
+  };
+
+  writer.StartObject();
+
+  writer.Key("version");
+  writer.Int(k_snapshot_version);
+  writer.Key("server");
+  write(m_snapshot.server);
+  writer.Key("serverVersion");
+  write(m_snapshot.version);
+  writer.Key("partitions");
+  write(m_snapshot.partitions);
+  writer.Key("timestamp");
+  write(m_snapshot.timestamp);
+  writer.Key("summary");
+  write(m_snapshot.summary);
+
+  writer.Key("schemas");
+  writer.StartObject();
+
+  for (const auto &schema : m_cache.schemas) {
+    write(schema.first);
+    writer.StartObject();
+
+    for (const auto &table : schema.second.tables) {
+      const auto &t = table.second;
+
+      if (t.create_time.empty()) {
+        // there's no way to tell if such table has changed
+        continue;
+      }
+
+      write(table.first);
+      writer.StartObject();
+
+      writer.Key("createTime");
+      write(t.create_time);
+      writer.Key("updateTime");
+      write(t.update_time);
+      writer.Key("fingerprint");
+      write(t.fingerprint);
+
+      writer.Key("columns");
+      writer.StartArray();
+
+      for (const auto &column : t.all_columns) {
+        writer.StartObject();
+        writer.Key("name");
+        write(column.name);
+        writer.Key("type");
+        write(mysqlshdk::db::to_string(column.type));
+        writer.Key("csvUnsafe");
+        writer.Bool(column.csv_unsafe);
+        writer.Key("generated");
+        writer.Bool(column.generated);
+        writer.Key("autoIncrement");
+        writer.Bool(column.auto_increment);
+        writer.Key("nullable");
+        writer.Bool(column.nullable);
+        writer.EndObject();
+      }
+
+      writer.EndArray();
+
+      writer.Key("index");
+      writer.StartObject();
+      writer.Key("primary");
+      writer.Bool(t.index.primary());
+      writer.Key("columns");
+      writer.StartArray();
+
+      for (const auto column : t.index.columns()) {
+        // index holds pointers to all_columns, store positions instead
+        writer.Uint64(static_cast<uint64_t>(column - t.all_columns.data()));
+      }
+
+      writer.EndArray();
+      writer.EndObject();
+
+      writer.Key("partitions");
+      writer.StartArray();
+
+      for (const auto &partition : t.partitions) {
+        writer.StartObject();
+        writer.Key("name");
+        write(partition.name);
+        writer.Key("rowCount");
+        writer.Uint64(partition.row_count);
+        writer.Key("averageRowLength");
+        writer.Uint64(partition.average_row_length);
+        writer.EndObject();
+      }
+
+      writer.EndArray();
+
+      writer.EndObject();
+    }
+
+    writer.EndObject();
+  }
+
+  writer.EndObject();
+
+  writer.EndObject();
+
+  return {buffer.GetString(), buffer.GetSize()};
+}
+
 Instance_cache_builder &Instance_cache_builder::users() {
   Profiler profiler{"fetching users"};
 
@@ -514,7 +925,9 @@ void Instance_cache_builder::filter_tables() {
       "AVG_ROW_LENGTH",  // can be NULL
       "ENGINE",          // can be NULL
       "CREATE_OPTIONS",  // can be NULL
-      "TABLE_COMMENT"    // can be NULL in 8.0
+      "TABLE_COMMENT",   // can be NULL in 8.0
+      "CREATE_TIME",     // can be NULL
+      "UPDATE_TIME"      // can be NULL
   };
   info.table_name = "tables";
   info.where = table_filter(schema_column, table_column);
@@ -538,6 +951,8 @@ void Instance_cache_builder::filter_tables() {
         target.engine = row->get_string(5, "");           // ENGINE
         target.create_options = row->get_string(6, "");   // CREATE_OPTIONS
         target.comment = row->get_string(7, "");          // TABLE_COMMENT
+        target.create_time = row->get_as_string(8, "");   // CREATE_TIME
+        target.update_time = row->get_as_string(9, "");   // UPDATE_TIME
 
         if (is_table) {
           set_has_tables();
@@ -564,6 +979,7 @@ void Instance_cache_builder::fetch_metadata(
 
   fetch_ndbinfo();
   fetch_server_metadata();
+  reuse_snapshot(partitions);
   fetch_view_metadata();
   fetch_columns();
   fetch_table_indexes();
@@ -571,6 +987,195 @@ void Instance_cache_builder::fetch_metadata(
   fetch_table_partitions(partitions);
 }
 
+void Instance_cache_builder::fetch_table_fingerprints() {
+  Profiler profiler{"fetching table fingerprints"};
+
+  m_has_fingerprints = true;
+
+  if (!has_tables()) {
+    return;
+  }
+
+  for (auto &schema : m_cache.schemas) {
+    for (auto &table : schema.second.tables) {
+      table.second.fingerprint.clear();
+    }
+  }
+
+  for (const auto &definition : definition_columns()) {
+    const auto &table_name = definition.first;
+
+    Iterate_table info;
+    info.schema_column = "TABLE_SCHEMA";  // NOT NULL
+    info.table_column = "TABLE_NAME";     // NOT NULL
+    info.extra_columns = {hash_rows(definition.second)};
+    info.table_name = table_name;
+    info.group_by = "TABLE_SCHEMA,TABLE_NAME";
+
+    iterate_tables(info, [&table_name](const std::string &,
+                                       const std::string &,
+                                       Instance_cache::Table *table,
+                                       const mysqlshdk::db::IRow *row) {
+      table->fingerprint += table_name + '=' + row->get_as_string(2, "") + ';';
+    });
+  }
+}
+
+std::string Instance_cache_builder::fetch_tables_summary() const {
+  Profiler profiler{"fetching tables summary"};
+
+  // a single row which summarizes definitions of all the filtered tables,
+  // it's cheaper to fetch than fingerprints of each table
+  Iterate_table info;
+  info.schema_column = "TABLE_SCHEMA";
+  info.table_column = "TABLE_NAME";
+
+  auto filter = schema_and_table_filter(info);
+
+  if (!filter.empty()) {
+    filter = " WHERE " + filter;
+  }
+
+  std::string sql = "SELECT (SELECT COUNT(*) FROM information_schema.tables" +
+                    filter + (filter.empty() ? " WHERE " : " AND ") +
+                    "'BASE TABLE'=TABLE_TYPE)";
+
+  for (const auto &definition : definition_columns()) {
+    auto columns = definition.second;
+    columns.insert(columns.begin(), {info.schema_column, info.table_column});
+
+    sql += ",(SELECT " + hash_rows(columns) + " FROM information_schema." +
+           definition.first + filter + ")";
+  }
+
+  const auto result = query(sql);
+  const auto row = result->fetch_one();
+  std::string summary;
+
+  for (uint32_t i = 0, size = row->num_fields(); i < size; ++i) {
+    summary += row->get_as_string(i, "") + ';';
+  }
+
+  return summary;
+}
+
+void Instance_cache_builder::reuse_snapshot(
+    const Partition_filters &partitions) {
+  if (!m_use_snapshot) {
+    return;
+  }
+
+  Profiler profiler{"reusing metadata snapshot"};
+
+  {
+    const auto result = query("SELECT NOW(),@@GLOBAL.PORT");
+    const auto row = result->fetch_one();
+
+    m_snapshot.timestamp = row->get_as_string(0);
+    m_snapshot.server = m_cache.server + ':' + row->get_as_string(1);
+  }
+
+  m_snapshot.version = m_cache.server_version.version.get_full();
+  m_snapshot.partitions = to_string(partitions);
+  m_snapshot.summary = fetch_tables_summary();
+
+  auto previous = std::move(m_previous_snapshot);
+
+  if (previous.schemas.empty()) {
+    // there's nothing to compare with, fingerprints are not needed
+    return;
+  }
+
+  if (previous.server != m_snapshot.server ||
+      previous.version != m_snapshot.version ||
+      previous.partitions != m_snapshot.partitions) {
+    log_info(
+        "Metadata snapshot was taken for a different server or partitions, "
+        "ignoring it");
+    return;
+  }
+
+  // if definitions of tables have not changed since the snapshot was taken,
+  // comparing CREATE_TIME and UPDATE_TIME is enough, fingerprints of each table
+  // are fetched only if they're needed to find the altered ones
+  const auto compare_fingerprints = previous.summary != m_snapshot.summary;
+
+  if (compare_fingerprints) {
+    fetch_table_fingerprints();
+  }
+
+  // schema -> tables and views which need to be fetched
+  std::unordered_map<std::string, std::unordered_set<std::string>> changed;
+  std::vector<std::pair<Instance_cache::Table *, Instance_cache::Table *>>
+      reused;
+
+  for (auto &schema : m_cache.schemas) {
+    const auto s = previous.schemas.find(schema.first);
+
+    for (auto &table : schema.second.tables) {
+      if (previous.schemas.end() != s) {
+        const auto t = s->second.tables.find(table.first);
+
+        if (s->second.tables.end() != t &&
+            is_unchanged(t->second, table.second, previous.timestamp,
+                         compare_fingerprints)) {
+          reused.emplace_back(&t->second, &table.second);
+          continue;
+        }
+      }
+
+      changed[schema.first].emplace(table.first);
+    }
+
+    // definition of a view can change without modification of CREATE_TIME,
+    // views are always fetched
+    for (const auto &view : schema.second.views) {
+      changed[schema.first].emplace(view.first);
+    }
+  }
+
+  log_info("Reusing metadata of %zu tables from the snapshot", reused.size());
+
+  if (reused.empty()) {
+    return;
+  }
+
+  for (const auto &table : reused) {
+    reuse_metadata(table.first, table.second);
+  }
+
+  if (!compare_fingerprints) {
+    // fingerprints were copied from the snapshot, they can be used if all
+    // tables were reused and snapshot had them
+    m_has_fingerprints = std::all_of(
+        m_cache.schemas.begin(), m_cache.schemas.end(), [](const auto &schema) {
+          return std::none_of(schema.second.tables.begin(),
+                              schema.second.tables.end(), [](const auto &t) {
+                                return t.second.fingerprint.empty();
+                              });
+        });
+  }
+
+  if (changed.empty()) {
+    m_changed_filter = "FALSE";
+  } else {
+    m_changed_filter = "(" +
+                       shcore::str_join(
+                           changed.begin(), changed.end(), "OR",
+                           [](const auto &schema) {
+                             return "(" +
+                                    QH::case_sensitive_compare(
+                                        k_schema_template, schema.first) +
+                                    "=0 AND " +
+                                    QH::compare(
+                                        k_table_template + " COLLATE utf8_bin",
+                                        schema.second, true) +
+                                    ")";
+                           }) +
+                       ")";
+  }
+}
+
 void Instance_cache_builder::fetch_version() {
   Profiler profiler{"fetching version"};
 
@@ -635,6 +1240,7 @@ void Instance_cache_builder::fetch_view_metadata() {
       "COLLATION_CONNECTION"   // NOT NULL
   };
   info.table_name = "views";
+  info.changed_only = true;
 
   iterate_views(info, [](const std::string &, const std::string &,
                          Instance_cache::View *view,
@@ -663,6 +1269,7 @@ void Instance_cache_builder::fetch_columns() {
       "EXTRA",             // can be NULL in 8.0
   };
   info.table_name = "columns";
+  info.changed_only = true;
 
   // schema -> table -> columns
   std::unordered_map<
@@ -785,6 +1392,7 @@ void Instance_cache_builder::fetch_table_indexes() {
   };
   info.table_name = "statistics";
   info.where = "COLUMN_NAME IS NOT NULL AND NON_UNIQUE=0";
+  info.changed_only = true;
 
   const std::string primary_index = "PRIMARY";
   struct Index_info {
@@ -1006,6 +1614,7 @@ void Instance_cache_builder::fetch_table_partitions(
   };
   info.table_name = "partitions";
   info.where = "PARTITION_NAME IS NOT NULL";
+  info.changed_only = true;
 
   const auto include_partition =
       [&partitions](const std::string &schema, const std::string &table,
@@ -1259,8 +1868,14 @@ std::string Instance_cache_builder::schema_filter(
 
 std::string Instance_cache_builder::table_filter(
     const std::string &schema_column, const std::string &table_column) const {
+  return table_filter(m_table_filter, schema_column, table_column);
+}
+
+std::string Instance_cache_builder::table_filter(
+    const std::string &filter, const std::string &schema_column,
+    const std::string &table_column) {
   return shcore::str_subvars(
-      m_table_filter,
+      filter,
       [&schema_column, &table_column](std::string_view var) {
         if (var == k_schema_var) return schema_column;
         if (var == k_table_var) return table_column;
@@ -1280,6 +1895,15 @@ std::string Instance_cache_builder::schema_and_table_filter(
 
   result += filter;
 
+  if (info.changed_only && !m_changed_filter.empty()) {
+    if (!result.empty()) {
+      result += " AND ";
+    }
+
+    result += table_filter(m_changed_filter, info.schema_column,
+                           info.table_column);
+  }
+
   return result;
 }
 
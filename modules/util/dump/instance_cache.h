@@ -117,6 +117,11 @@ struct Instance_cache {
     std::vector<Histogram> histograms;
     std::vector<std::string> triggers;  // order of triggers is important
     std::vector<Partition> partitions;
+    std::string create_time;  // empty if NULL
+    std::string update_time;  // empty if NULL
+    // hash of table options, columns, indexes and partitions, set only if
+    // fingerprints are fetched or reused from the snapshot
+    std::string fingerprint;
   };
 
   struct View : public Table {
@@ -200,8 +205,34 @@ class Instance_cache_builder final {
   Instance_cache_builder &operator=(const Instance_cache_builder &) = delete;
   Instance_cache_builder &operator=(Instance_cache_builder &&) = delete;
 
+  /**
+   * Uses the metadata snapshot created by a previous run, metadata of tables
+   * which were not modified since the snapshot was taken is not fetched again.
+   * Needs to be called before metadata(), required by snapshot().
+   *
+   * @param previous Contents of the previous snapshot, can be empty. Snapshots
+   *                 which are invalid or which were created for a different
+   *                 server are ignored.
+   */
+  Instance_cache_builder &use_snapshot(const std::string &previous);
+
   Instance_cache_builder &metadata(const Partition_filters &partitions);
 
+  /**
+   * Creates a snapshot of metadata of tables, to be used by subsequent runs.
+   * Needs to be called after metadata().
+   *
+   * @returns Contents of the snapshot.
+   */
+  std::string snapshot() const;
+
+  /**
+   * Fetches fingerprints of definitions of tables, which allow to detect
+   * tables altered in-place. Needs to be called after metadata(), does not
+   * fetch them again if they were needed to validate the snapshot.
+   */
+  Instance_cache_builder &fingerprints();
+
   Instance_cache_builder &users();
 
   Instance_cache_builder &events();
@@ -231,12 +262,28 @@ class Instance_cache_builder final {
     std::string name;
   };
 
+  struct Snapshot {
+    std::string server;
+    std::string version;
+    std::string partitions;
+    std::string timestamp;
+    // summary of definitions of all tables
+    std::string summary;
+    std::unordered_map<std::string, Instance_cache::Schema> schemas;
+  };
+
   void filter_schemas();
 
   void filter_tables();
 
   void fetch_metadata(const Partition_filters &partitions);
 
+  void reuse_snapshot(const Partition_filters &partitions);
+
+  void fetch_table_fingerprints();
+
+  std::string fetch_tables_summary() const;
+
   void fetch_version();
 
   void fetch_explain_select_rows_index();
@@ -300,6 +347,10 @@ class Instance_cache_builder final {
   std::string table_filter(const std::string &schema_column,
                            const std::string &table_column) const;
 
+  static std::string table_filter(const std::string &filter,
+                                  const std::string &schema_column,
+                                  const std::string &table_column);
+
   std::string schema_and_table_filter(const Iterate_table &info) const;
 
   std::string object_filter(const Iterate_schema &info,
@@ -362,6 +413,17 @@ class Instance_cache_builder final {
 
   std::string m_table_filter;
 
+  // tables and views which were not found in the snapshot
+  std::string m_changed_filter;
+
+  bool m_use_snapshot = false;
+
+  Snapshot m_previous_snapshot;
+
+  Snapshot m_snapshot;
+
+  bool m_has_fingerprints = false;
+
   bool m_has_tables = false;
 
   bool m_has_views = false;
@@ -975,61 +975,101 @@ std::vector<Schema_dumper::Issue> Schema_dumper::check_ct_for_mysqlaas(
     }
   }
 
-  if (opt_mysqlaas) {
-    if (compatibility::check_create_table_for_data_index_dir_option(
-            *create_table, create_table))
-      res.emplace_back(
-          prefix + "had {DATA|INDEX} DIRECTORY table option commented out",
-          Issue::Status::FIXED);
+  // all checks operate on the same tokens, statement is rewritten once
+  compatibility::Ddl_rewriter rewriter;
+  bool data_index_dir = false;
+  bool encryption = false;
+  std::string engine;
+  bool remove_fixed_row_format = false;
+  bool fixed_row_format = false;
+  bool tablespace = false;
 
-    if (compatibility::check_create_table_for_encryption_option(*create_table,
-                                                                create_table))
-      res.emplace_back(prefix + "had ENCRYPTION table option commented out",
-                       Issue::Status::FIXED);
+  if (opt_mysqlaas) {
+    rewriter.add([&data_index_dir, &encryption](
+                     const compatibility::Ddl_tokens &tokens,
+                     compatibility::Ddl_edits *edits) {
+      data_index_dir =
+          compatibility::check_create_table_for_data_index_dir_option(tokens,
+                                                                      edits);
+      encryption =
+          compatibility::check_create_table_for_encryption_option(tokens,
+                                                                  edits);
+    });
   }
 
   if (opt_mysqlaas || opt_force_innodb) {
-    const auto engine = compatibility::check_create_table_for_engine_option(
-        *create_table, opt_force_innodb ? create_table : nullptr);
-    if (!engine.empty()) {
-      if (opt_force_innodb)
-        res.emplace_back(
-            prefix + "had unsupported engine " + engine + " changed to InnoDB",
-            Issue::Status::FIXED);
-      else
-        res.emplace_back(prefix + "uses unsupported storage engine " + engine,
-                         Issue::Status::USE_FORCE_INNODB);
-    }
+    rewriter.add([this, &engine, &remove_fixed_row_format, &fixed_row_format](
+                     const compatibility::Ddl_tokens &tokens,
+                     compatibility::Ddl_edits *edits) {
+      engine = compatibility::check_create_table_for_engine_option(
+          tokens, opt_force_innodb ? edits : nullptr);
+
+      // if engine is empty, table is already using InnoDB, we want to remove
+      // FIXED row format right away
+      remove_fixed_row_format = opt_force_innodb || engine.empty();
+
+      fixed_row_format =
+          compatibility::check_create_table_for_fixed_row_format(
+              tokens, remove_fixed_row_format ? edits : nullptr);
+    });
+  }
 
-    // if engine is empty, table is already using InnoDB, we want to remove
-    // FIXED row format right away
-    const auto remove_fixed_row_format = opt_force_innodb || engine.empty();
+  if (opt_mysqlaas || opt_strip_tablespaces) {
+    rewriter.add([this, &tablespace](const compatibility::Ddl_tokens &tokens,
+                                     compatibility::Ddl_edits *edits) {
+      tablespace = compatibility::check_create_table_for_tablespace_option(
+          tokens, opt_strip_tablespaces ? edits : nullptr);
+    });
+  }
 
-    if (compatibility::check_create_table_for_fixed_row_format(
-            *create_table, remove_fixed_row_format ? create_table : nullptr)) {
-      if (remove_fixed_row_format) {
-        res.emplace_back(
-            prefix + "had unsupported ROW_FORMAT=FIXED option removed",
-            Issue::Status::FIXED);
-      } else {
-        res.emplace_back(prefix + "uses unsupported ROW_FORMAT=FIXED option",
-                         Issue::Status::USE_FORCE_INNODB);
-      }
+  if (!rewriter.empty()) {
+    rewriter.rewrite(*create_table, create_table);
+
+    if (fixed_row_format && remove_fixed_row_format) {
+      // if new statement ends with comma, strip it as well
+      *create_table = shcore::str_strip(*create_table, " \r\n\t,");
     }
   }
 
-  if (opt_mysqlaas || opt_strip_tablespaces) {
-    if (compatibility::check_create_table_for_tablespace_option(
-            *create_table, opt_strip_tablespaces ? create_table : nullptr)) {
-      if (opt_strip_tablespaces)
-        res.emplace_back(prefix + "had unsupported tablespace option removed",
-                         Issue::Status::FIXED);
-      else
-        res.emplace_back(prefix + "uses unsupported tablespace option",
-                         Issue::Status::USE_STRIP_TABLESPACES);
+  if (data_index_dir)
+    res.emplace_back(
+        prefix + "had {DATA|INDEX} DIRECTORY table option commented out",
+        Issue::Status::FIXED);
+
+  if (encryption)
+    res.emplace_back(prefix + "had ENCRYPTION table option commented out",
+                     Issue::Status::FIXED);
+
+  if (!engine.empty()) {
+    if (opt_force_innodb)
+      res.emplace_back(
+          prefix + "had unsupported engine " + engine + " changed to InnoDB",
+          Issue::Status::FIXED);
+    else
+      res.emplace_back(prefix + "uses unsupported storage engine " + engine,
+                       Issue::Status::USE_FORCE_INNODB);
+  }
+
+  if (fixed_row_format) {
+    if (remove_fixed_row_format) {
+      res.emplace_back(
+          prefix + "had unsupported ROW_FORMAT=FIXED option removed",
+          Issue::Status::FIXED);
+    } else {
+      res.emplace_back(prefix + "uses unsupported ROW_FORMAT=FIXED option",
+                       Issue::Status::USE_FORCE_INNODB);
     }
   }
 
+  if (tablespace) {
+    if (opt_strip_tablespaces)
+      res.emplace_back(prefix + "had unsupported tablespace option removed",
+                       Issue::Status::FIXED);
+    else
+      res.emplace_back(prefix + "uses unsupported tablespace option",
+                       Issue::Status::USE_STRIP_TABLESPACES);
+  }
+
   if (opt_mysqlaas) {
     std::size_t count = 0;
 
@@ -68,6 +68,10 @@ Text_dump_writer::Text_dump_writer(const import_table::Dialect &dialect)
       m_escaped_characters[idx++] = m_dialect.lines_terminated_by[0];
     }
 
+    m_escape_scanner =
+        Escape_scanner{m_escaped_characters[0], m_escaped_characters[1],
+                       m_escaped_characters[2], m_escaped_characters[3]};
+
     for (size_t i = 0; i < idx; i++) {
       if (strchr(k_numeric_types_alphabet, m_escaped_characters[i]))
         m_numbers_need_escape = Escape_type::FULL;
@@ -206,11 +210,21 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
     } else {
       buffer()->will_write(2 * length);
       const auto end = data + length;
+      auto p = data;
+
+      while (p != end) {
+        // copy characters which do not need to be escaped in bulk
+        const auto next = m_escape_scanner.find(p, end);
+        buffer()->append(p, next - p);
+
+        if (next == end) {
+          break;
+        }
 
-      for (auto p = data; p != end; ++p) {
-        const auto c = *p;
-        char to_write = 0;
+        const auto c = *next;
+        char to_write = c;
         char escape = m_escape_char;
+        p = next + 1;
 
         // note: this doesn't produce output consistent with SELECT .. INTO
         // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
@@ -243,26 +257,19 @@ void Text_dump_writer::store_field(const mysqlshdk::db::IRow *row,
             break;
 
           default:
-            if (c == m_escaped_characters[0] || c == m_escaped_characters[1] ||
-                c == m_escaped_characters[2] || c == m_escaped_characters[3]) {
-              to_write = c;
-
-              // m_double_enclosed_by can only be true if fields_enclosed_by is
-              // not empty
-              if (m_double_enclosed_by &&
-                  to_write == m_dialect.fields_enclosed_by[0]) {
-                escape = to_write;
-              }
+            // one of m_escaped_characters, written as is
+
+            // m_double_enclosed_by can only be true if fields_enclosed_by is
+            // not empty
+            if (m_double_enclosed_by &&
+                to_write == m_dialect.fields_enclosed_by[0]) {
+              escape = to_write;
             }
             break;
         }
 
-        if (0 != to_write) {
-          buffer()->append(escape);
-          buffer()->append(to_write);
-        } else {
-          buffer()->append(c);
-        }
+        buffer()->append(escape);
+        buffer()->append(to_write);
       }
     }
 
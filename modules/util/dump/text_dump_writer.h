@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "modules/util/dump/dump_writer.h"
+#include "modules/util/dump/escape_scanner.h"
 #include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
@@ -79,6 +80,8 @@ class Text_dump_writer : public Dump_writer {
 
   char m_escaped_characters[4];
 
+  Escape_scanner m_escape_scanner;
+
   char m_escape_char;
 
   bool m_double_enclosed_by = false;
@@ -296,9 +296,12 @@ void Import_table::scan_file() {
           ? k_one_mb
           : 8192;
   // each thread fetches block_size bytes, a page holds enough memory for all
-  // threads
+  // threads, big pages are backed by huge pages
+  Allocator::Page_options page_options;
+  page_options.huge_pages = k_one_mb == block_size;
+
   m_allocator = std::make_unique<Allocator>(m_opt.threads_size() * block_size,
-                                            block_size);
+                                            block_size, page_options);
 
   Threaded_file_config config;
   config.file_path = m_opt.single_file();
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/adaptive_threads.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/db/result.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace mysqlsh {
+
+namespace {
+
+constexpr auto k_default_interval = std::chrono::seconds{5};
+
+// InnoDB starts flushing more aggressively when checkpoint age gets close to
+// the redo log capacity
+constexpr double k_checkpoint_age_high = 0.75;
+constexpr double k_checkpoint_age_low = 0.5;
+
+constexpr double k_history_length_high = 1000000;
+constexpr double k_history_length_low = 100000;
+
+// GR flow control kicks in when applier queue reaches the threshold
+constexpr double k_applier_queue_high = 0.8;
+constexpr double k_applier_queue_low = 0.3;
+
+constexpr double k_replica_lag_high = 60;
+constexpr double k_replica_lag_low = 10;
+
+std::optional<std::string> query_string(mysqlshdk::db::ISession *session,
+                                        const std::string &sql,
+                                        uint32_t field = 0) {
+  const auto result = session->query(sql);
+
+  if (const auto row = result->fetch_one(); row && !row->is_null(field)) {
+    return row->get_as_string(field);
+  }
+
+  return {};
+}
+
+std::optional<uint64_t> query_uint(mysqlshdk::db::ISession *session,
+                                   const std::string &sql,
+                                   uint32_t field = 0) {
+  if (const auto value = query_string(session, sql, field)) {
+    return shcore::lexical_cast<uint64_t>(*value);
+  }
+
+  return {};
+}
+
+std::optional<uint64_t> innodb_status_value(std::string_view status,
+                                            std::string_view name) {
+  const auto pos = status.find(name);
+
+  if (std::string_view::npos == pos) {
+    return {};
+  }
+
+  status.remove_prefix(pos + name.length());
+
+  const auto begin = status.find_first_not_of(' ');
+  const auto end = status.find_first_not_of("0123456789", begin);
+
+  if (std::string_view::npos == begin || begin == end) {
+    return {};
+  }
+
+  return shcore::lexical_cast<uint64_t>(status.substr(begin, end - begin));
+}
+
+}  // namespace
+
+Adaptive_threads::Adaptive_threads(
+    uint64_t max_threads, std::shared_ptr<mysqlshdk::db::ISession> session)
+    : m_max_threads(std::max<uint64_t>(1, max_threads)),
+      m_active(m_max_threads),
+      m_session(std::move(session)),
+      m_interval(k_default_interval) {
+  if (m_session) {
+    initialize();
+  }
+}
+
+Adaptive_threads::~Adaptive_threads() { stop(); }
+
+void Adaptive_threads::start(std::function<void()> on_increase) {
+  assert(!m_thread);
+
+  if (!m_session) {
+    return;
+  }
+
+  m_stop = false;
+  m_thread = std::make_unique<std::thread>(mysqlsh::spawn_scoped_thread(
+      [this, on_increase = std::move(on_increase)]() {
+        mysqlsh::Mysql_thread mysql_thread;
+
+        try {
+          std::unique_lock lock{m_stop_mutex};
+
+          // sampling may take a while, interval is measured from its end
+          while (!m_stop_cv.wait_for(lock, m_interval,
+                                     [this]() { return m_stop; })) {
+            lock.unlock();
+
+            const auto previous = m_active.load();
+
+            if (adjust(sample(), m_work_pending) > previous && on_increase) {
+              on_increase();
+            }
+
+            lock.lock();
+          }
+        } catch (const std::exception &e) {
+          log_warning(
+              "Adaptive threads: monitoring of the target instance has "
+              "stopped: %s",
+              e.what());
+        }
+      }));
+}
+
+void Adaptive_threads::stop() {
+  if (!m_thread) {
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_stop_mutex};
+    m_stop = true;
+  }
+
+  m_stop_cv.notify_one();
+  m_thread->join();
+  m_thread.reset();
+}
+
+void Adaptive_threads::initialize() {
+  try {
+    uint64_t log_file_size = 0;
+    uint64_t log_files_in_group = 0;
+    const auto result = m_session->query(
+        "SHOW GLOBAL VARIABLES WHERE Variable_name IN "
+        "('innodb_redo_log_capacity', 'innodb_log_file_size', "
+        "'innodb_log_files_in_group')");
+
+    while (const auto row = result->fetch_one()) {
+      const auto name = row->get_string(0);
+      const auto value = shcore::lexical_cast<uint64_t>(row->get_string(1));
+
+      if ("innodb_redo_log_capacity" == name) {
+        m_redo_log_capacity = value;
+      } else if ("innodb_log_file_size" == name) {
+        log_file_size = value;
+      } else {
+        log_files_in_group = value;
+      }
+    }
+
+    // innodb_redo_log_capacity takes precedence over the deprecated variables
+    if (0 == m_redo_log_capacity) {
+      m_redo_log_capacity = log_file_size * log_files_in_group;
+    }
+  } catch (const std::exception &e) {
+    log_warning("Adaptive threads: unable to obtain redo log capacity: %s",
+                e.what());
+  }
+
+  m_checkpoint_age_enabled = m_redo_log_capacity > 0;
+
+  try {
+    m_applier_threshold =
+        query_uint(m_session.get(),
+                   "SHOW GLOBAL VARIABLES LIKE "
+                   "'group_replication_flow_control_applier_threshold'",
+                   1)
+            .value_or(0);
+  } catch (const std::exception &e) {
+    log_debug("Adaptive threads: GR applier threshold not available: %s",
+              e.what());
+  }
+
+  m_applier_queue_enabled = m_applier_threshold > 0;
+
+  try {
+    m_replica_lag_enabled =
+        query_uint(m_session.get(),
+                   "SELECT COUNT(*) FROM "
+                   "performance_schema.replication_applier_status_by_worker "
+                   "WHERE CHANNEL_NAME NOT LIKE 'group_replication_%'")
+            .value_or(0) > 0;
+  } catch (const std::exception &e) {
+    log_debug("Adaptive threads: replication status not available: %s",
+              e.what());
+    m_replica_lag_enabled = false;
+  }
+
+  log_info(
+      "Adaptive threads: monitoring target instance, redo log capacity: "
+      "%" PRIu64 ", GR applier threshold: %" PRIu64 ", replica: %s",
+      m_redo_log_capacity, m_applier_threshold,
+      m_replica_lag_enabled ? "yes" : "no");
+}
+
+template <typename T, typename F>
+std::optional<T> Adaptive_threads::probe(bool *enabled, const char *name,
+                                         F &&f) {
+  if (!*enabled) {
+    return {};
+  }
+
+  try {
+    return f();
+  } catch (const std::exception &e) {
+    log_warning(
+        "Adaptive threads: unable to obtain %s, it is not going to be "
+        "monitored: %s",
+        name, e.what());
+    *enabled = false;
+    return {};
+  }
+}
+
+Adaptive_threads::Metrics Adaptive_threads::sample() {
+  Metrics metrics;
+
+  if (!m_session) {
+    return metrics;
+  }
+
+  const auto session = m_session.get();
+
+  metrics.threads_running =
+      probe<uint64_t>(&m_threads_running_enabled, "Threads_running", [=]() {
+        return query_uint(session, "SHOW GLOBAL STATUS LIKE 'Threads_running'",
+                          1);
+      });
+
+  metrics.history_length = probe<uint64_t>(
+      &m_history_length_enabled, "history list length", [=]() {
+        return query_uint(session,
+                          "SELECT COUNT FROM information_schema.INNODB_METRICS "
+                          "WHERE NAME = 'trx_rseg_history_len'");
+      });
+
+  metrics.checkpoint_age =
+      probe<double>(&m_checkpoint_age_enabled, "checkpoint age",
+                    [=]() -> std::optional<double> {
+                      const auto status = query_string(
+                          session, "SHOW ENGINE INNODB STATUS", 2);
+
+                      if (!status) return {};
+
+                      const auto lsn =
+                          innodb_status_value(*status, "Log sequence number");
+                      const auto checkpoint =
+                          innodb_status_value(*status, "Last checkpoint at");
+
+                      if (!lsn || !checkpoint || *lsn < *checkpoint) return {};
+
+                      return static_cast<double>(*lsn - *checkpoint) /
+                             m_redo_log_capacity;
+                    });
+
+  metrics.applier_queue = probe<double>(
+      &m_applier_queue_enabled, "GR applier queue",
+      [=]() -> std::optional<double> {
+        const auto queue = query_uint(
+            session,
+            "SELECT MAX(COUNT_TRANSACTIONS_REMOTE_IN_APPLIER_QUEUE) FROM "
+            "performance_schema.replication_group_member_stats");
+
+        if (!queue) return {};
+
+        return static_cast<double>(*queue) / m_applier_threshold;
+      });
+
+  metrics.replica_lag = probe<double>(
+      &m_replica_lag_enabled, "replication lag",
+      [=]() -> std::optional<double> {
+        // lag is measured using the transactions which are currently being
+        // applied, if nothing is being applied, there's no lag
+        const auto lag = query_uint(
+            session,
+            "SELECT MAX(TIMESTAMPDIFF(MICROSECOND, "
+            "APPLYING_TRANSACTION_ORIGINAL_COMMIT_TIMESTAMP, NOW(6))) FROM "
+            "performance_schema.replication_applier_status_by_worker WHERE "
+            "CHANNEL_NAME NOT LIKE 'group_replication_%' AND "
+            "APPLYING_TRANSACTION <> '' AND "
+            "UNIX_TIMESTAMP(APPLYING_TRANSACTION_ORIGINAL_COMMIT_TIMESTAMP) "
+            "> 0");
+
+        return lag.value_or(0) / 1000000.0;
+      });
+
+  return metrics;
+}
+
+uint64_t Adaptive_threads::adjust(const Metrics &metrics, bool work_pending) {
+  const uint64_t current = m_active;
+  std::vector<std::string> pressure;
+  bool relaxed = true;
+
+  const auto check = [&pressure, &relaxed](const char *name,
+                                           const std::optional<double> &value,
+                                           double high, double low) {
+    if (!value.has_value()) return;
+
+    if (*value >= high) {
+      pressure.emplace_back(
+          shcore::str_format("%s: %.2f (limit: %.2f)", name, *value, high));
+    }
+
+    if (*value >= low) {
+      relaxed = false;
+    }
+  };
+
+  if (metrics.threads_running.has_value()) {
+    // our own threads are also running, only other threads are taken into
+    // account
+    const auto running = *metrics.threads_running;
+    const auto others = running - std::min(running, current);
+
+    check("threads running", static_cast<double>(others),
+          static_cast<double>(m_max_threads), m_max_threads / 2.0);
+  }
+
+  if (metrics.history_length.has_value()) {
+    check("history list length", static_cast<double>(*metrics.history_length),
+          k_history_length_high, k_history_length_low);
+  }
+
+  check("checkpoint age", metrics.checkpoint_age, k_checkpoint_age_high,
+        k_checkpoint_age_low);
+  check("GR applier queue", metrics.applier_queue, k_applier_queue_high,
+        k_applier_queue_low);
+  check("replication lag", metrics.replica_lag, k_replica_lag_high,
+        k_replica_lag_low);
+
+  if (!pressure.empty()) {
+    if (current > 1) {
+      const auto active = std::max<uint64_t>(
+          1, std::min<uint64_t>(current - 1, current * 3 / 4));
+
+      log_info(
+          "Adaptive threads: decreasing number of active threads from "
+          "%" PRIu64 " to %" PRIu64 ", target instance is under pressure: %s",
+          current, active, shcore::str_join(pressure, ", ").c_str());
+
+      m_active = active;
+    } else {
+      log_info(
+          "Adaptive threads: keeping a single active thread, target instance "
+          "is under pressure: %s",
+          shcore::str_join(pressure, ", ").c_str());
+    }
+  } else if (relaxed && work_pending && current < m_max_threads) {
+    log_info(
+        "Adaptive threads: increasing number of active threads from "
+        "%" PRIu64 " to %" PRIu64 ", target instance is not under pressure",
+        current, current + 1);
+
+    m_active = current + 1;
+  } else {
+    log_debug("Adaptive threads: keeping %" PRIu64 " active threads",
+              current);
+  }
+
+  return m_active;
+}
+
+}  // namespace mysqlsh
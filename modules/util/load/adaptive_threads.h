@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
+#define MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "mysqlshdk/libs/db/session.h"
+
+namespace mysqlsh {
+
+/**
+ * Controls how many of the loader threads are allowed to work at the same
+ * time, based on the metrics periodically sampled from the target instance.
+ *
+ * The limit starts at the maximum number of threads, it's decreased
+ * multiplicatively when the target instance is under pressure, and increased
+ * by one when all the metrics are back to the normal levels.
+ *
+ * Metrics are sampled by a separate thread, so that the monitoring queries
+ * do not delay the scheduling of the loader threads.
+ */
+class Adaptive_threads final {
+ public:
+  struct Metrics {
+    // number of threads running in the target instance
+    std::optional<uint64_t> threads_running;
+    // length of the InnoDB history list
+    std::optional<uint64_t> history_length;
+    // InnoDB checkpoint age, as a fraction of the redo log capacity
+    std::optional<double> checkpoint_age;
+    // largest GR applier queue, as a fraction of the flow control threshold
+    std::optional<double> applier_queue;
+    // replication lag of the target instance, in seconds
+    std::optional<double> replica_lag;
+  };
+
+  /**
+   * Creates the controller.
+   *
+   * @param max_threads Maximum number of threads which can be active.
+   * @param session Session used to sample the metrics, if not set, metrics
+   *                are not sampled.
+   */
+  Adaptive_threads(uint64_t max_threads,
+                   std::shared_ptr<mysqlshdk::db::ISession> session);
+
+  Adaptive_threads(const Adaptive_threads &) = delete;
+  Adaptive_threads(Adaptive_threads &&) = delete;
+
+  Adaptive_threads &operator=(const Adaptive_threads &) = delete;
+  Adaptive_threads &operator=(Adaptive_threads &&) = delete;
+
+  ~Adaptive_threads();
+
+  /**
+   * Current number of threads which are allowed to be active.
+   */
+  uint64_t active() const { return m_active; }
+
+  uint64_t max_threads() const { return m_max_threads; }
+
+  /**
+   * Starts the thread which periodically samples the metrics and adjusts the
+   * limit. Does nothing if metrics are not sampled.
+   *
+   * @param on_increase Called by the monitoring thread when limit was
+   *                    increased.
+   */
+  void start(std::function<void()> on_increase);
+
+  /**
+   * Stops the monitoring thread.
+   */
+  void stop();
+
+  /**
+   * Informs the controller whether there are tasks waiting for a thread, limit
+   * is not increased if there's nothing to do.
+   */
+  void set_work_pending(bool work_pending) { m_work_pending = work_pending; }
+
+  /**
+   * Fetches the current metrics from the target instance. Metrics which cannot
+   * be obtained are not set.
+   */
+  Metrics sample();
+
+  /**
+   * Adjusts the limit using the given metrics.
+   *
+   * @param metrics Metrics of the target instance.
+   * @param work_pending Whether there are tasks waiting for a thread.
+   *
+   * @returns the new limit
+   */
+  uint64_t adjust(const Metrics &metrics, bool work_pending);
+
+  void set_interval(std::chrono::milliseconds interval) {
+    m_interval = interval;
+  }
+
+ private:
+  void initialize();
+
+  template <typename T, typename F>
+  std::optional<T> probe(bool *enabled, const char *name, F &&f);
+
+  const uint64_t m_max_threads;
+  std::atomic<uint64_t> m_active;
+  std::atomic<bool> m_work_pending = false;
+
+  std::shared_ptr<mysqlshdk::db::ISession> m_session;
+
+  std::chrono::milliseconds m_interval;
+
+  std::unique_ptr<std::thread> m_thread;
+  std::mutex m_stop_mutex;
+  std::condition_variable m_stop_cv;
+  bool m_stop = false;
+
+  // capacity of the redo log, in bytes
+  uint64_t m_redo_log_capacity = 0;
+  // GR flow control applier threshold
+  uint64_t m_applier_threshold = 0;
+
+  // probes are disabled if they fail
+  bool m_threads_running_enabled = true;
+  bool m_history_length_enabled = true;
+  bool m_checkpoint_age_enabled = true;
+  bool m_applier_queue_enabled = true;
+  bool m_replica_lag_enabled = true;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_ADAPTIVE_THREADS_H_
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/util/load/ddl_dependency_graph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <stdexcept>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/utils_lexing.h"
+#include "mysqlshdk/libs/utils/utils_sqlstring.h"
+
+namespace mysqlsh {
+
+namespace {
+
+std::string object_key(std::string_view schema, std::string_view name) {
+  return shcore::quote_identifier(schema) + "." +
+         shcore::quote_identifier(name);
+}
+
+bool is_identifier_start(char c) {
+  return '`' == c || '_' == c || '$' == c || std::isalpha(c) ||
+         static_cast<unsigned char>(c) >= 0x80;
+}
+
+/**
+ * Splits a (possibly qualified) identifier into its parts, returns an empty
+ * vector if token is not an identifier.
+ */
+std::vector<std::string> split_identifier(std::string_view token) {
+  std::vector<std::string> parts;
+
+  if (token.empty() || !is_identifier_start(token[0])) {
+    return parts;
+  }
+
+  const auto length = token.length();
+  std::size_t pos = 0;
+
+  while (pos < length) {
+    std::string part;
+
+    if ('`' == token[pos]) {
+      ++pos;
+
+      while (pos < length) {
+        if ('`' == token[pos]) {
+          if (pos + 1 < length && '`' == token[pos + 1]) {
+            part += '`';
+            pos += 2;
+          } else {
+            ++pos;
+            break;
+          }
+        } else {
+          part += token[pos++];
+        }
+      }
+    } else {
+      const auto end = std::min(token.find('.', pos), length);
+      part = token.substr(pos, end - pos);
+      pos = end;
+    }
+
+    parts.emplace_back(std::move(part));
+
+    if (pos < length) {
+      if ('.' != token[pos]) {
+        return {};
+      }
+
+      ++pos;
+    }
+  }
+
+  return parts;
+}
+
+}  // namespace
+
+Ddl_dependency_graph::Object_id Ddl_dependency_graph::add_object(
+    const std::string &schema, const std::string &name) {
+  assert(!m_started);
+
+  const auto id = m_objects.size();
+
+  if (!m_ids.emplace(object_key(schema, name), id).second) {
+    throw std::logic_error("Object " + object_key(schema, name) +
+                           " was already added");
+  }
+
+  m_objects.emplace_back().schema = schema;
+
+  return id;
+}
+
+void Ddl_dependency_graph::add_dependency(Object_id object,
+                                          Object_id dependency) {
+  assert(!m_started);
+  assert(object < m_objects.size());
+  assert(dependency < m_objects.size());
+
+  if (object != dependency) {
+    m_objects[object].dependencies.emplace_back(dependency);
+  }
+}
+
+void Ddl_dependency_graph::add_references(Object_id object,
+                                          std::string_view script) {
+  assert(object < m_objects.size());
+
+  const auto &schema = m_objects[object].schema;
+  const auto add = [this, object](std::string_view s, std::string_view n) {
+    const auto it = m_ids.find(object_key(s, n));
+
+    if (m_ids.end() != it) {
+      add_dependency(object, it->second);
+    }
+  };
+
+  mysqlshdk::utils::SQL_iterator it(script, 0, false);
+
+  while (true) {
+    const auto token = it.next_token();
+
+    if (token.empty()) {
+      break;
+    }
+
+    const auto parts = split_identifier(token);
+
+    switch (parts.size()) {
+      case 0:
+        break;
+
+      case 1:
+        add(schema, parts[0]);
+        break;
+
+      case 2:
+        // either schema.object or object.column
+        add(parts[0], parts[1]);
+        add(schema, parts[0]);
+        break;
+
+      default:
+        // schema.object.column
+        add(parts[0], parts[1]);
+        break;
+    }
+  }
+}
+
+std::vector<Ddl_dependency_graph::Object_id>
+Ddl_dependency_graph::dependencies(Object_id object) const {
+  assert(object < m_objects.size());
+
+  auto result = m_objects[object].dependencies;
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+
+  return result;
+}
+
+void Ddl_dependency_graph::start() {
+  std::lock_guard lock{m_mutex};
+
+  assert(!m_started);
+  m_started = true;
+
+  for (Object_id id = 0, size = m_objects.size(); id < size; ++id) {
+    auto &object = m_objects[id];
+    auto &deps = object.dependencies;
+
+    std::sort(deps.begin(), deps.end());
+    deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+
+    for (const auto dependency : deps) {
+      m_objects[dependency].dependents.emplace_back(id);
+    }
+
+    object.pending_dependencies = deps.size();
+
+    if (0 == object.pending_dependencies) {
+      object.state = State::READY;
+      m_ready.emplace_back(id);
+    }
+  }
+}
+
+std::vector<Ddl_dependency_graph::Object_id>
+Ddl_dependency_graph::fetch_ready() {
+  std::lock_guard lock{m_mutex};
+
+  assert(m_started);
+
+  for (const auto id : m_ready) {
+    m_objects[id].state = State::FETCHED;
+  }
+
+  m_in_progress += m_ready.size();
+
+  return std::exchange(m_ready, {});
+}
+
+void Ddl_dependency_graph::done(Object_id object) {
+  std::lock_guard lock{m_mutex};
+
+  assert(object < m_objects.size());
+  auto &o = m_objects[object];
+  assert(State::FETCHED == o.state);
+
+  o.state = State::DONE;
+  --m_in_progress;
+
+  for (const auto id : o.dependents) {
+    auto &dependent = m_objects[id];
+
+    if (0 == --dependent.pending_dependencies &&
+        State::PENDING == dependent.state) {
+      dependent.state = State::READY;
+      m_ready.emplace_back(id);
+    }
+  }
+}
+
+void Ddl_dependency_graph::defer(Object_id object) {
+  std::lock_guard lock{m_mutex};
+
+  assert(object < m_objects.size());
+  auto &o = m_objects[object];
+  assert(State::FETCHED == o.state);
+
+  o.state = State::DEFERRED;
+  --m_in_progress;
+}
+
+std::size_t Ddl_dependency_graph::in_progress() const {
+  std::lock_guard lock{m_mutex};
+  return m_in_progress;
+}
+
+std::vector<Ddl_dependency_graph::Object_id>
+Ddl_dependency_graph::fetch_unresolved() {
+  std::lock_guard lock{m_mutex};
+
+  assert(m_started);
+  assert(m_ready.empty());
+  assert(0 == m_in_progress);
+
+  std::vector<Object_id> result;
+
+  for (Object_id id = 0, size = m_objects.size(); id < size; ++id) {
+    auto &object = m_objects[id];
+
+    if (State::PENDING == object.state || State::DEFERRED == object.state) {
+      object.state = State::FETCHED;
+      result.emplace_back(id);
+    }
+  }
+
+  m_in_progress += result.size();
+
+  return result;
+}
+
+}  // namespace mysqlsh
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_LOAD_DDL_DEPENDENCY_GRAPH_H_
+#define MODULES_UTIL_LOAD_DDL_DEPENDENCY_GRAPH_H_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mysqlsh {
+
+/**
+ * Dependencies between the DDL objects of a dump, used to execute DDL of the
+ * independent objects concurrently.
+ *
+ * All objects are added first, then the dependencies are added, either
+ * explicitly or by scanning the DDL scripts for references to other objects.
+ * Once execution starts, objects become ready in topological waves: an object
+ * is ready once all the objects it depends on are done.
+ *
+ * References found in DDL are a superset of the real dependencies, extra ones
+ * only limit concurrency. Objects which cannot be ordered (i.e. they are in a
+ * dependency cycle) or were deferred are reported as unresolved, these are
+ * meant to be executed sequentially.
+ *
+ * Methods used during the execution are thread-safe.
+ */
+class Ddl_dependency_graph final {
+ public:
+  using Object_id = std::size_t;
+
+  Ddl_dependency_graph() = default;
+
+  Ddl_dependency_graph(const Ddl_dependency_graph &) = delete;
+  Ddl_dependency_graph(Ddl_dependency_graph &&) = delete;
+
+  Ddl_dependency_graph &operator=(const Ddl_dependency_graph &) = delete;
+  Ddl_dependency_graph &operator=(Ddl_dependency_graph &&) = delete;
+
+  ~Ddl_dependency_graph() = default;
+
+  /**
+   * Adds an object.
+   *
+   * @returns ID of the object
+   */
+  Object_id add_object(const std::string &schema, const std::string &name);
+
+  /**
+   * Marks the object as depending on another one.
+   */
+  void add_dependency(Object_id object, Object_id dependency);
+
+  /**
+   * Scans the DDL script of an object for references to other objects, each
+   * one is added as a dependency. Unqualified names are resolved using the
+   * schema of the object.
+   */
+  void add_references(Object_id object, std::string_view script);
+
+  std::size_t size() const { return m_objects.size(); }
+
+  /**
+   * Provides IDs of the objects the given object depends on, in ascending
+   * order.
+   */
+  std::vector<Object_id> dependencies(Object_id object) const;
+
+  /**
+   * Starts the execution, objects without dependencies become ready. No more
+   * objects or dependencies can be added.
+   */
+  void start();
+
+  /**
+   * Provides the objects which are ready to be executed, each object is
+   * returned once.
+   */
+  std::vector<Object_id> fetch_ready();
+
+  /**
+   * Marks an object as executed, objects which depend on it may become ready.
+   */
+  void done(Object_id object);
+
+  /**
+   * Marks an object as not executed because of incomplete dependency
+   * information, it's going to be reported as unresolved. Objects which depend
+   * on it are not going to become ready.
+   */
+  void defer(Object_id object);
+
+  /**
+   * Number of objects which were fetched, but are not done nor deferred yet.
+   */
+  std::size_t in_progress() const;
+
+  /**
+   * Provides the objects which are not going to become ready: the deferred
+   * ones, the ones in a dependency cycle and the ones depending on any of
+   * these. Should be called once nothing is ready nor in progress. Each object
+   * is returned once, in the order in which objects were added.
+   */
+  std::vector<Object_id> fetch_unresolved();
+
+ private:
+  enum class State {
+    PENDING,
+    READY,
+    FETCHED,
+    DEFERRED,
+    DONE,
+  };
+
+  struct Object {
+    std::string schema;
+    std::vector<Object_id> dependencies;
+    std::vector<Object_id> dependents;
+    std::size_t pending_dependencies = 0;
+    State state = State::PENDING;
+  };
+
+  mutable std::mutex m_mutex;
+  std::vector<Object> m_objects;
+  std::unordered_map<std::string, Object_id> m_ids;
+  std::vector<Object_id> m_ready;
+  std::size_t m_in_progress = 0;
+  bool m_started = false;
+};
+
+}  // namespace mysqlsh
+
+#endif  // MODULES_UTIL_LOAD_DDL_DEPENDENCY_GRAPH_H_
@@ -222,19 +222,20 @@ void execute_statement(const std::shared_ptr<mysqlshdk::db::ISession> &session,
 void execute_script(
     const std::shared_ptr<mysqlshdk::db::ISession> &session,
     const std::string &script, const std::string &error_prefix,
-    const std::function<bool(std::string_view, std::string *)> &process_stmt) {
+    const std::function<bool(std::string_view, std::string *)> &process_stmt,
+    int silent_error = -1) {
   std::stringstream stream(script);
 
   mysqlshdk::utils::iterate_sql_stream(
       &stream, 1024 * 64,
-      [&error_prefix, &session, &process_stmt](
+      [&error_prefix, &session, &process_stmt, silent_error](
           std::string_view s, std::string_view, size_t, size_t) {
         std::string new_stmt;
 
         if (process_stmt && process_stmt(s, &new_stmt)) s = new_stmt;
 
         if (!s.empty()) {
-          execute_statement(session, s, error_prefix);
+          execute_statement(session, s, error_prefix, silent_error);
         }
 
         return true;
@@ -559,6 +560,67 @@ void Dump_loader::Worker::Table_ddl_task::load_ddl(
   }
 }
 
+bool Dump_loader::Worker::View_ddl_task::execute(
+    const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
+    Worker *worker, Dump_loader *loader) {
+  log_debug("%swill execute DDL file for view %s", log_id(), key().c_str());
+
+  loader->post_worker_event(worker, Worker_event::VIEW_DDL_START);
+
+  const auto fail = [this, worker, loader](const std::exception &e) {
+    handle_current_exception(
+        worker, loader,
+        shcore::str_format("While executing DDL script for view %s: %s",
+                           key().c_str(), e.what()));
+  };
+
+  try {
+    // views are replacing placeholder tables, if this view references another
+    // one which was not detected as a dependency and is being created at the
+    // same time, its placeholder may be already gone
+    loader->execute_view_ddl(session, schema(), table(), *m_script, m_resuming,
+                             ER_NO_SUCH_TABLE);
+  } catch (const mysqlshdk::db::Error &e) {
+    if (ER_NO_SUCH_TABLE != e.code()) {
+      fail(e);
+      return false;
+    }
+
+    try {
+      // DDL script saves the character set of the session, changes it to the
+      // one used by the view and restores it after CREATE VIEW, which has just
+      // failed; session is going to be used by the subsequent tasks, restore
+      // the original values here
+      Dump_loader::execute(session,
+                           "SET character_set_client = @saved_cs_client, "
+                           "character_set_results = @saved_cs_results, "
+                           "collation_connection = @saved_col_connection");
+    } catch (const std::exception &restore_error) {
+      fail(restore_error);
+      return false;
+    }
+
+    // dependency information is incomplete, view is going to be retried
+    // sequentially
+    log_info("%sDDL script for view %s will be retried: %s", log_id(),
+             key().c_str(), e.format().c_str());
+    m_dependencies->defer(m_id);
+
+    return true;
+  } catch (const std::exception &e) {
+    fail(e);
+    return false;
+  }
+
+  m_dependencies->done(m_id);
+
+  log_debug("%sdone", log_id());
+  ++loader->m_ddl_executed;
+  loader->post_worker_event(worker, Worker_event::VIEW_DDL_END);
+
+  return true;
+}
+
 bool Dump_loader::Worker::Load_chunk_task::execute(
     const std::shared_ptr<mysqlshdk::db::mysql::Session> &session,
     Worker *worker, Dump_loader *loader) {
@@ -1292,13 +1354,14 @@ void Dump_loader::on_dump_end() {
             executef(query, m_dump->gtid_executed());
           }
         } else {
+          const auto gtid_set = gtid_set_to_append();
+
           current_console()->print_status(
               "Appending dumped gtid set to GTID_PURGED");
-          log_info("Appending %s to GTID_PURGED",
-                   m_dump->gtid_executed().c_str());
+          log_info("Appending %s to GTID_PURGED", gtid_set.c_str());
 
-          if (!m_options.dry_run()) {
-            executef(query, "+" + m_dump->gtid_executed());
+          if (!m_options.dry_run() && !gtid_set.empty()) {
+            executef(query, "+" + gtid_set);
           }
         }
         m_load_log->end_gtid_update();
@@ -1571,6 +1634,10 @@ size_t Dump_loader::handle_worker_events(
         return "TABLE_DDL_START";
       case Worker_event::Event::TABLE_DDL_END:
         return "TABLE_DDL_END";
+      case Worker_event::Event::VIEW_DDL_START:
+        return "VIEW_DDL_START";
+      case Worker_event::Event::VIEW_DDL_END:
+        return "VIEW_DDL_END";
       case Worker_event::Event::LOAD_START:
         return "LOAD_START";
       case Worker_event::Event::LOAD_END:
@@ -1596,12 +1663,59 @@ size_t Dump_loader::handle_worker_events(
   std::list<Worker *> idle_workers;
   const auto thread_count = m_options.threads_count();
 
+  const auto schedule_task = [this, &schedule_next,
+                              thread_count](Worker *worker) {
+    // no more work to do
+    if (m_worker_interrupt || (!schedule_next() && m_pending_tasks.empty())) {
+      return false;
+    }
+
+    assert(!m_pending_tasks.empty());
+
+    const auto pending_weight = m_pending_tasks.top()->weight();
+    const auto active_threads =
+        m_adaptive_threads ? m_adaptive_threads->active() : thread_count;
+
+    // a task is always scheduled if nothing else is running, even if it's
+    // heavier than the current limit of active threads
+    if (m_current_weight > 0 &&
+        m_current_weight + pending_weight > active_threads) {
+      // the task is too heavy, wait till more threads are idle
+      return false;
+    }
+
+    worker->schedule(m_pending_tasks.pop_top());
+    m_current_weight += pending_weight;
+
+    return true;
+  };
+
+  uint64_t active_threads =
+      m_adaptive_threads ? m_adaptive_threads->active() : thread_count;
+
   while (idle_workers.size() < m_workers.size()) {
     Worker_event event;
 
     // Wait for events from workers, but update progress and check for ^C
     // every now and then
     for (;;) {
+      if (m_adaptive_threads && !m_worker_interrupt) {
+        m_adaptive_threads->set_work_pending(!m_pending_tasks.empty());
+
+        if (const auto active = m_adaptive_threads->active();
+            active != active_threads) {
+          if (active > active_threads) {
+            // limit was raised, wake up the workers which were held back
+            while (!idle_workers.empty() &&
+                   schedule_task(idle_workers.front())) {
+              idle_workers.pop_front();
+            }
+          }
+
+          active_threads = active;
+        }
+      }
+
       auto event_opt = m_worker_events.try_pop(std::chrono::seconds{1});
       if (event_opt && event_opt->worker) {
         event = std::move(*event_opt);
@@ -1686,6 +1800,15 @@ size_t Dump_loader::handle_worker_events(
         break;
       }
 
+      case Worker_event::VIEW_DDL_START:
+        break;
+
+      case Worker_event::VIEW_DDL_END: {
+        const auto task = event.worker->current_task();
+        on_view_ddl_end(task->schema());
+        break;
+      }
+
       case Worker_event::INDEX_START: {
         const auto task = event.worker->current_task();
         on_index_start(task->schema(), task->table());
@@ -1733,23 +1856,8 @@ size_t Dump_loader::handle_worker_events(
     }
 
     // schedule more work if the worker became free
-    if (event.event == Worker_event::READY) {
-      // no more work to do
-      if (m_worker_interrupt || (!schedule_next() && m_pending_tasks.empty())) {
-        idle_workers.push_back(event.worker);
-      } else {
-        assert(!m_pending_tasks.empty());
-
-        const auto pending_weight = m_pending_tasks.top()->weight();
-
-        if (m_current_weight + pending_weight > thread_count) {
-          // the task is too heavy, wait till more threads are idle
-          idle_workers.push_back(event.worker);
-        } else {
-          event.worker->schedule(m_pending_tasks.pop_top());
-          m_current_weight += pending_weight;
-        }
-      }
+    if (event.event == Worker_event::READY && !schedule_task(event.worker)) {
+      idle_workers.push_back(event.worker);
     }
   }
 
@@ -2166,7 +2274,7 @@ void Dump_loader::check_server_version() {
                      0, 0,
                      "select GTID_SUBTRACT(@@global.gtid_executed, ?) = "
                      "@@global.gtid_executed",
-                     g)) {
+                     gtid_set_to_append())) {
         THROW_ERROR0(SHERR_LOAD_UPDATE_GTID_APPEND_SETS_INTERSECT);
       }
     }
@@ -2343,6 +2451,19 @@ bool Dump_loader::report_duplicates(
   return has_duplicates;
 }
 
+std::string Dump_loader::gtid_set_to_append() const {
+  if (!m_dump->is_incremental() ||
+      m_dump->incremental_base_gtid_executed().empty()) {
+    return m_dump->gtid_executed();
+  }
+
+  // transactions from the base dump were appended when it was loaded
+  return mysqlshdk::mysql::Instance(m_options.base_session())
+      .queryf_one_string(0, "", "SELECT GTID_SUBTRACT(?, ?)",
+                         m_dump->gtid_executed(),
+                         m_dump->incremental_base_gtid_executed());
+}
+
 void Dump_loader::check_existing_objects() {
   auto console = current_console();
 
@@ -2468,6 +2589,91 @@ void Dump_loader::check_existing_objects() {
   }
 }
 
+void Dump_loader::drop_removed_objects() {
+  const auto console = current_console();
+
+  console->print_note(
+      "The dump is an incremental dump created on top of a base dump which was "
+      "started at " +
+      m_dump->incremental_base_begin() +
+      ", it has to be loaded into an instance which contains the base dump.");
+
+  if (const auto &base_gtid_set = m_dump->incremental_base_gtid_executed();
+      !base_gtid_set.empty()) {
+    // if the base dump was loaded with the updateGtidSet option, its GTID set
+    // is part of gtid_executed of the target server
+    if (!mysqlshdk::mysql::Instance(m_options.base_session())
+             .queryf_one_int(0, 0,
+                             "SELECT GTID_SUBSET(?, @@GLOBAL.GTID_EXECUTED)",
+                             base_gtid_set)) {
+      THROW_ERROR0(SHERR_LOAD_INCREMENTAL_BASE_NOT_LOADED);
+    }
+  } else {
+    console->print_warning(
+        "The base dump was created without GTIDs, unable to verify that it was "
+        "loaded into the target instance.");
+  }
+
+  const auto &dropped = m_dump->dropped_objects();
+  std::size_t count = 0;
+
+  const auto drop = [this, &count](const std::string &sql) {
+    log_info("Executing: %s", sql.c_str());
+
+    if (!m_options.dry_run()) {
+      execute(sql);
+    }
+
+    ++count;
+  };
+
+  const auto drop_all =
+      [&drop](const char *type,
+              const std::map<std::string, std::vector<std::string>> &objects) {
+        for (const auto &schema : objects) {
+          for (const auto &name : schema.second) {
+            drop(shcore::str_format(
+                "DROP %s IF EXISTS %s.%s", type,
+                shcore::quote_identifier(schema.first).c_str(),
+                shcore::quote_identifier(name).c_str()));
+          }
+        }
+      };
+
+  console->print_status(
+      "Dropping objects which were removed since the base dump was "
+      "created...");
+
+  for (const auto &schema : dropped.triggers) {
+    for (const auto &table : schema.second) {
+      for (const auto &trigger : table.second) {
+        drop(shcore::str_format("DROP TRIGGER IF EXISTS %s.%s",
+                                shcore::quote_identifier(schema.first).c_str(),
+                                shcore::quote_identifier(trigger).c_str()));
+      }
+    }
+  }
+
+  drop_all("VIEW", dropped.views);
+  drop_all("TABLE", dropped.tables);
+  drop_all("EVENT", dropped.events);
+  drop_all("FUNCTION", dropped.functions);
+  drop_all("PROCEDURE", dropped.procedures);
+
+  for (const auto &schema : dropped.schemas) {
+    drop("DROP SCHEMA IF EXISTS " + shcore::quote_identifier(schema));
+  }
+
+  if (m_options.load_users()) {
+    for (const auto &account : dropped.users) {
+      drop("DROP USER IF EXISTS " + account);
+    }
+  }
+
+  console->print_status(std::to_string(count) + " object" +
+                        (1 == count ? " was" : "s were") + " dropped.");
+}
+
 void Dump_loader::setup_progress_file(bool *out_is_resuming) {
   auto console = current_console();
 
@@ -2786,20 +2992,23 @@ void Dump_loader::execute_view_ddl_tasks() {
       m_progress_thread.start_stage("Executing view DDL", std::move(config));
   shcore::on_leave_scope finish_stage([stage]() { stage->finish(); });
 
+  struct View_ddl {
+    std::string schema;
+    std::string name;
+    std::string script;
+    bool resuming;
+  };
+
   Load_progress_log::Status schema_load_status;
   std::string schema;
   std::list<Dump_reader::Name_and_file> views;
-  std::unordered_map<std::string, uint64_t> views_per_schema;
+  std::vector<View_ddl> scripts;
 
   const auto thread_pool_ptr = m_dump->create_thread_pool();
   const auto pool = thread_pool_ptr.get();
 
   log_debug("Begin loading view DDL");
 
-  // the DDL is executed in the main thread, in order to avoid concurrency
-  // issues (i.e. one thread removes the placeholder table for a view, while
-  // another one tries to create a view which references that deleted view)
-
   pool->start_threads();
 
   while (!m_worker_interrupt) {
@@ -2810,70 +3019,48 @@ void Dump_loader::execute_view_ddl_tasks() {
     schema_load_status = m_load_log->schema_ddl_status(schema);
 
     if (schema_load_status != Load_progress_log::DONE) {
-      if (views.empty()) {
-        // there are no views, mark schema as ready
-        m_load_log->end_schema_ddl(schema);
-      } else {
-        ddl_to_execute += views.size();
-        views_per_schema[schema] = views.size();
+      auto &views_per_schema = m_views_per_schema[schema];
 
-        // GCC 12 may warn about a possibly uninitialized usage of IFile in the
-        // lambda capture
+      // GCC 12 may warn about a possibly uninitialized usage of IFile in the
+      // lambda capture
 #if __GNUC__ >= 12 && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
-        for (auto &item : views) {
-          if (m_options.ignore_existing_objects() &&
-              m_dump->view_exists(schema, item.first)) {
-            // BUG#35102738: do not recreate existing views due to BUG#35154429
-            --ddl_to_execute;
-            --views_per_schema[schema];
-            continue;
-          }
-
-          pool->add_task(
-              [file = std::move(item.second), schema, view = item.first]() {
-                log_debug("Fetching view DDL for %s.%s", schema.c_str(),
-                          view.c_str());
-                file->open(mysqlshdk::storage::Mode::READ);
-                auto script = mysqlshdk::storage::read_file(file.get());
-                file->close();
-                return script;
-              },
-              [this, schema, view = item.first,
-               resuming = schema_load_status == Load_progress_log::INTERRUPTED,
-               pool, &views_per_schema](std::string &&script) {
-                log_info("%s DDL script for view `%s`.`%s`",
-                         (resuming ? "Re-executing" : "Executing"),
-                         schema.c_str(), view.c_str());
-
-                if (!m_options.dry_run()) {
-                  executef("use !", schema.c_str());
-
-                  // execute sql
-                  execute_script(
-                      m_session, script,
-                      shcore::str_format(
-                          "Error executing DDL script for view `%s`.`%s`",
-                          schema.c_str(), view.c_str()),
-                      m_default_sql_transforms);
-                }
-
-                ++m_ddl_executed;
-
-                if (0 == --views_per_schema[schema]) {
-                  m_load_log->end_schema_ddl(schema);
-                }
-
-                if (m_worker_interrupt) {
-                  pool->terminate();
-                }
-              });
+      for (auto &item : views) {
+        if (m_options.ignore_existing_objects() &&
+            m_dump->view_exists(schema, item.first)) {
+          // BUG#35102738: do not recreate existing views due to BUG#35154429
+          continue;
         }
+
+        ++ddl_to_execute;
+        ++views_per_schema;
+
+        pool->add_task(
+            [file = std::move(item.second), schema, view = item.first]() {
+              log_debug("Fetching view DDL for %s.%s", schema.c_str(),
+                        view.c_str());
+              file->open(mysqlshdk::storage::Mode::READ);
+              auto script = mysqlshdk::storage::read_file(file.get());
+              file->close();
+              return script;
+            },
+            [&scripts, schema, view = item.first,
+             resuming = schema_load_status == Load_progress_log::INTERRUPTED](
+                std::string &&script) {
+              scripts.emplace_back(
+                  View_ddl{schema, view, std::move(script), resuming});
+            });
+      }
 #if __GNUC__ >= 12 && !defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
+
+      if (0 == views_per_schema) {
+        // there are no views, mark schema as ready
+        m_views_per_schema.erase(schema);
+        m_load_log->end_schema_ddl(schema);
       }
     }
   }
@@ -2882,9 +3069,102 @@ void Dump_loader::execute_view_ddl_tasks() {
   pool->tasks_done();
   pool->process();
 
+  if (!m_worker_interrupt && !scripts.empty()) {
+    // the DDL is executed in topological waves: a view is created only after
+    // all the views it references were created, otherwise one thread could
+    // remove the placeholder table of a view, while another one tries to
+    // create a view which references that deleted placeholder
+    Ddl_dependency_graph dependencies;
+
+    for (const auto &view : scripts) {
+      dependencies.add_object(view.schema, view.name);
+    }
+
+    for (std::size_t id = 0, size = scripts.size(); id < size; ++id) {
+      dependencies.add_references(id, scripts[id].script);
+    }
+
+    dependencies.start();
+
+    execute_threaded([this, &dependencies, &scripts]() {
+      while (!m_worker_interrupt) {
+        const auto ready = dependencies.fetch_ready();
+
+        for (const auto id : ready) {
+          const auto &view = scripts[id];
+          push_pending_task(std::make_unique<Worker::View_ddl_task>(
+              view.schema, view.name, &view.script, view.resuming,
+              &dependencies, id));
+        }
+
+        if (!ready.empty()) {
+          return true;
+        }
+
+        // already scheduled tasks are going to be executed first, or there's
+        // nothing more which can become ready
+        if (!m_pending_tasks.empty() || 0 == dependencies.in_progress()) {
+          break;
+        }
+
+        // wait for the tasks which are being executed
+        shcore::sleep_ms(1);
+      }
+
+      return false;
+    });
+
+    if (!m_worker_interrupt) {
+      // views in a dependency cycle, deferred ones and the ones which depend
+      // on them are executed sequentially
+      const auto unresolved = dependencies.fetch_unresolved();
+
+      if (!unresolved.empty()) {
+        log_info("Executing DDL of %zu views sequentially", unresolved.size());
+      }
+
+      for (const auto id : unresolved) {
+        if (m_worker_interrupt) {
+          break;
+        }
+
+        const auto &view = scripts[id];
+
+        execute_view_ddl(m_session, view.schema, view.name, view.script,
+                         view.resuming);
+
+        dependencies.done(id);
+        ++m_ddl_executed;
+        on_view_ddl_end(view.schema);
+      }
+    }
+  }
+
+  m_views_per_schema.clear();
+
   log_debug("End loading view DDL");
 }
 
+void Dump_loader::execute_view_ddl(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &schema, const std::string &view,
+    const std::string &script, bool resuming, int silent_error) const {
+  log_info("%s DDL script for view `%s`.`%s`",
+           (resuming ? "Re-executing" : "Executing"), schema.c_str(),
+           view.c_str());
+
+  if (!m_options.dry_run()) {
+    executef(session, "use !", schema.c_str());
+
+    // execute sql
+    execute_script(
+        session, script,
+        shcore::str_format("Error executing DDL script for view `%s`.`%s`",
+                           schema.c_str(), view.c_str()),
+        m_default_sql_transforms, silent_error);
+  }
+}
+
 void Dump_loader::execute_tasks() {
   auto console = current_console();
 
@@ -2905,10 +3185,28 @@ void Dump_loader::execute_tasks() {
 
   handle_schema_option();
 
-  if (!m_resuming && m_options.load_ddl()) check_existing_objects();
+  if (!m_resuming && m_options.load_ddl()) {
+    if (m_dump->is_incremental()) {
+      // objects from the base dump already exist in the target instance
+      drop_removed_objects();
+    } else {
+      check_existing_objects();
+    }
+  }
 
   check_tables_without_primary_key();
 
+  if (m_options.adaptive_threads() && !m_options.dry_run()) {
+    // metrics are sampled using a separate session, so that monitoring is not
+    // interleaved with the statements executed by the main thread
+    m_adaptive_threads = std::make_unique<Adaptive_threads>(
+        m_options.threads_count(),
+        establish_session(m_options.connection_options(), false));
+    // an event without a worker wakes up the main thread when the limit is
+    // raised, so that workers which were held back can be scheduled
+    m_adaptive_threads->start([this]() { m_worker_events.push({}); });
+  }
+
   size_t num_idle_workers = 0;
 
   do {
@@ -2963,6 +3261,10 @@ void Dump_loader::execute_tasks() {
     }
   } while (!m_worker_interrupt);
 
+  if (m_adaptive_threads) {
+    m_adaptive_threads->stop();
+  }
+
   if (!m_worker_interrupt) {
     on_dump_end();
     m_load_log->cleanup();
@@ -3129,6 +3431,16 @@ void Dump_loader::on_table_ddl_end(
   on_ddl_done_for_schema(schema);
 }
 
+void Dump_loader::on_view_ddl_end(const std::string &schema) {
+  const auto it = m_views_per_schema.find(schema);
+  assert(m_views_per_schema.end() != it);
+
+  if (0 == --(it->second)) {
+    m_views_per_schema.erase(it);
+    m_load_log->end_schema_ddl(schema);
+  }
+}
+
 void Dump_loader::on_chunk_load_start(const std::string &schema,
                                       const std::string &table,
                                       const std::string &partition,
@@ -3198,125 +3510,118 @@ void Dump_loader::Sql_transform::add_strip_removed_sql_modes() {
   // Remove NO_AUTO_CREATE_USER from sql_mode, which doesn't exist in 8.0 but
   // does in 5.7
 
-  add([](std::string_view sql, std::string *out_new_sql) {
-    static std::regex re(
-        R"*((\/\*![0-9]+\s+)?(SET\s+sql_mode\s*=\s*')(.*)('.*))*",
-        std::regex::icase | std::regex::optimize);
+  m_rewriter.add([](const compatibility::Ddl_tokens &tokens,
+                    compatibility::Ddl_edits *edits) {
+    // SET sql_mode = '...'
+    if (tokens.size() < 4 || !shcore::str_caseeq(tokens[0].text, "SET") ||
+        !shcore::str_caseeq(tokens[1].text, "sql_mode") ||
+        "=" != tokens[2].text || '\'' != tokens[3].text[0]) {
+      return;
+    }
 
-    std::cmatch m;
-    if (std::regex_match(sql.data(), sql.data() + sql.size(), m, re)) {
-      auto modes = shcore::str_split(m[3].str(), ",");
-      std::string new_modes;
-      for (const auto &mode : modes) {
-        if (mode != "NO_AUTO_CREATE_USER")
-          new_modes.append(mode).append(1, ',');
-      }
-      if (!new_modes.empty()) new_modes.pop_back();  // strip last ,
+    const auto &value = tokens[3];
+    const auto modes = shcore::str_split(
+        value.text.substr(1, value.text.length() - 2), ",");
+    std::string new_modes;
+    bool removed = false;
 
-      *out_new_sql = m[1].str() + m[2].str() + new_modes + m[4].str();
-    } else {
-      *out_new_sql = sql;
+    for (const auto &mode : modes) {
+      if (mode != "NO_AUTO_CREATE_USER")
+        new_modes.append(mode).append(1, ',');
+      else
+        removed = true;
     }
+
+    if (!removed) return;
+
+    if (!new_modes.empty()) new_modes.pop_back();  // strip last ,
+
+    // replace contents of the quoted string
+    edits->replace(value.begin + 1, value.end - 1, std::move(new_modes));
   });
 }
 
 void Dump_loader::Sql_transform::add_execute_conditionally(
     std::function<bool(std::string_view, const std::string &)> f) {
-  add([f = std::move(f)](std::string_view sql, std::string *out_new_sql) {
-    *out_new_sql = sql;
+  m_rewriter.add([f = std::move(f)](const compatibility::Ddl_tokens &tokens,
+                                    compatibility::Ddl_edits *edits) {
+    const auto size = tokens.size();
+    std::size_t idx = 0;
 
-    std::string sql_str{sql};
-    mysqlshdk::utils::SQL_iterator it(sql_str, 0, false);
-
-    while (it.valid()) {
-      auto token = it.next_token();
+    while (idx < size &&
+           !shcore::str_caseeq(tokens[idx].text, "CREATE", "ALTER", "DROP")) {
+      ++idx;
+    }
 
-      if (!shcore::str_caseeq(token, "CREATE", "ALTER", "DROP")) continue;
+    if (idx >= size) return;
 
-      auto type = it.next_token();
+    auto type = tokens.text(++idx);
 
-      if (shcore::str_caseeq(type, "DEFINER")) {
-        // =
-        it.next_token();
-        // user
-        it.next_token();
-        // type or @
-        type = it.next_token();
+    if (shcore::str_caseeq(type, "DEFINER")) {
+      // =, user, type or @
+      idx += 3;
+      type = tokens.text(idx);
 
-        if (shcore::str_caseeq(type, "@")) {
-          // continuation of an account, host
-          it.next_token();
-          // type
-          type = it.next_token();
-        }
+      if (shcore::str_caseeq(type, "@")) {
+        // continuation of an account, host, type
+        idx += 2;
+        type = tokens.text(idx);
       }
+    }
 
-      if (shcore::str_caseeq(type, "EVENT", "FUNCTION", "PROCEDURE",
-                             "TRIGGER")) {
-        auto name = it.next_token();
-
-        if (shcore::str_caseeq(name, "IF")) {
-          // NOT or EXISTS
-          token = it.next_token();
+    if (shcore::str_caseeq(type, "EVENT", "FUNCTION", "PROCEDURE",
+                           "TRIGGER")) {
+      auto name = tokens.text(++idx);
 
-          if (shcore::str_caseeq(token, "NOT")) {
-            // EXISTS
-            it.next_token();
-          }
-
-          // name follows
-          name = it.next_token();
+      if (shcore::str_caseeq(name, "IF")) {
+        // NOT or EXISTS
+        if (shcore::str_caseeq(tokens.text(++idx), "NOT")) {
+          // EXISTS
+          ++idx;
         }
 
-        // name can be either object_name, `object_name` or
-        // schema.`object_name`, split_schema_and_table will handle all these
-        // cases and unquote the object name
-        std::string object_name;
-        shcore::split_schema_and_table(std::string{name}, nullptr, &object_name,
-                                       true);
-
-        if (!f(type, object_name)) {
-          out_new_sql->clear();
-        }
+        // name follows
+        name = tokens.text(++idx);
       }
 
-      return;
+      // name can be either object_name, `object_name` or
+      // schema.`object_name`, split_schema_and_table will handle all these
+      // cases and unquote the object name
+      std::string object_name;
+      shcore::split_schema_and_table(std::string{name}, nullptr, &object_name,
+                                     true);
+
+      if (!f(type, object_name)) {
+        edits->skip();
+      }
     }
   });
 }
 
 void Dump_loader::Sql_transform::add_rename_schema(std::string_view new_name) {
-  add([new_name = std::string{new_name}](std::string_view sql,
-                                         std::string *out_new_sql) {
-    std::string sql_str{sql};
-
-    mysqlshdk::utils::SQL_iterator it(sql_str, 0, false);
-    const auto token = it.next_token();
+  m_rewriter.add([new_name = std::string{new_name}](
+                     const compatibility::Ddl_tokens &tokens,
+                     compatibility::Ddl_edits *edits) {
+    const auto token = tokens.text(0);
 
     if (shcore::str_caseeq(token, "CREATE")) {
-      if (shcore::str_caseeq(it.next_token(), "DATABASE", "SCHEMA")) {
-        auto schema = it.next_token();
+      if (shcore::str_caseeq(tokens.text(1), "DATABASE", "SCHEMA")) {
+        std::size_t idx = 2;
 
-        if (shcore::str_caseeq(schema, "IF")) {
-          // NOT
-          it.next_token();
-          // EXISTS
-          it.next_token();
-          // schema follows
-          schema = it.next_token();
+        if (shcore::str_caseeq(tokens.text(idx), "IF")) {
+          // NOT EXISTS, schema follows
+          idx += 3;
         }
 
-        *out_new_sql = sql_str.substr(0, it.position() - schema.length()) +
-                       shcore::quote_identifier(new_name) +
-                       sql_str.substr(it.position());
-        return;
+        if (idx < tokens.size()) {
+          edits->replace(tokens[idx].begin, tokens[idx].end,
+                         shcore::quote_identifier(new_name));
+        }
       }
     } else if (shcore::str_caseeq(token, "USE")) {
-      *out_new_sql = "USE " + shcore::quote_identifier(new_name);
-      return;
+      edits->replace(0, tokens.ddl().length(),
+                     "USE " + shcore::quote_identifier(new_name));
     }
-
-    *out_new_sql = std::move(sql_str);
   });
 }
 
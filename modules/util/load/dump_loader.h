@@ -29,7 +29,6 @@
 #include <list>
 #include <memory>
 #include <queue>
-#include <regex>
 #include <set>
 #include <string>
 #include <string_view>
@@ -41,6 +40,8 @@
 
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/progress_thread.h"
+#include "modules/util/load/adaptive_threads.h"
+#include "modules/util/load/ddl_dependency_graph.h"
 
 #include "modules/util/load/dump_reader.h"
 #include "modules/util/load/load_dump_options.h"
@@ -185,6 +186,28 @@ class Dump_loader {
       bool m_exists = false;
     };
 
+    class View_ddl_task : public Task {
+     public:
+      View_ddl_task(const std::string &schema, const std::string &view,
+                    const std::string *script, bool resuming,
+                    Ddl_dependency_graph *dependencies,
+                    Ddl_dependency_graph::Object_id id)
+          : Task(schema, view),
+            m_script(script),
+            m_resuming(resuming),
+            m_dependencies(dependencies),
+            m_id(id) {}
+
+      bool execute(const std::shared_ptr<mysqlshdk::db::mysql::Session> &,
+                   Worker *, Dump_loader *) override;
+
+     private:
+      const std::string *m_script;
+      bool m_resuming;
+      Ddl_dependency_graph *m_dependencies;
+      Ddl_dependency_graph::Object_id m_id;
+    };
+
     class Load_chunk_task : public Task {
      public:
       Load_chunk_task(const std::string &schema, const std::string &table,
@@ -315,6 +338,8 @@ class Dump_loader {
       SCHEMA_DDL_END,
       TABLE_DDL_START,
       TABLE_DDL_END,
+      VIEW_DDL_START,
+      VIEW_DDL_END,
       LOAD_START,
       LOAD_END,
       INDEX_START,
@@ -336,6 +361,10 @@ class Dump_loader {
   void execute_tasks();
   void execute_table_ddl_tasks();
   void execute_view_ddl_tasks();
+  void execute_view_ddl(
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const std::string &schema, const std::string &view,
+      const std::string &script, bool resuming, int silent_error = -1) const;
 
   void wait_for_metadata();
   bool scan_for_more_data(bool wait = true);
@@ -367,6 +396,8 @@ class Dump_loader {
   void execute_threaded(const std::function<bool()> &schedule_next);
 
   void check_existing_objects();
+  void drop_removed_objects();
+  std::string gtid_set_to_append() const;
   bool report_duplicates(const std::string &what, const std::string &schema,
                          std::list<Dump_reader::Object_info *> *objects,
                          mysqlshdk::db::IResult *result);
@@ -393,6 +424,8 @@ class Dump_loader {
       const std::string &schema, const std::string &table, bool placeholder,
       std::unique_ptr<compatibility::Deferred_statements> deferred_indexes);
 
+  void on_view_ddl_end(const std::string &schema);
+
   void on_chunk_load_start(const std::string &schema, const std::string &table,
                            const std::string &partition, ssize_t index);
   void on_chunk_load_end(const std::string &schema, const std::string &table,
@@ -507,16 +540,9 @@ class Dump_loader {
   class Sql_transform {
    public:
     bool operator()(std::string_view sql, std::string *out_new_sql) const {
-      if (m_ops.empty()) return false;
+      if (m_rewriter.empty()) return false;
 
-      std::string orig_sql(sql);
-      std::string new_sql;
-
-      for (const auto &f : m_ops) {
-        f(orig_sql, &new_sql);
-        orig_sql = std::move(new_sql);
-      }
-      *out_new_sql = std::move(orig_sql);
+      m_rewriter.rewrite(sql, out_new_sql);
 
       return true;
     }
@@ -541,11 +567,7 @@ class Dump_loader {
     void add_rename_schema(std::string_view new_name);
 
    private:
-    void add(std::function<void(std::string_view, std::string *)> f) {
-      m_ops.emplace_back(std::move(f));
-    }
-
-    std::list<std::function<void(std::string_view, std::string *)>> m_ops;
+    compatibility::Ddl_rewriter m_rewriter;
   };
 
   const Load_dump_options &m_options;
@@ -570,6 +592,9 @@ class Dump_loader {
   Sql_transform m_default_sql_transforms;
 
   shcore::Synchronized_queue<Worker_event> m_worker_events;
+  // limits the number of active threads if adaptiveThreads is enabled, its
+  // monitoring thread posts to m_worker_events, so it's destroyed first
+  std::unique_ptr<Adaptive_threads> m_adaptive_threads;
   std::recursive_mutex m_skip_schemas_mutex;
   std::unordered_set<std::string> m_skip_schemas;
   std::unordered_set<std::string> m_skip_tables;
@@ -608,6 +633,7 @@ class Dump_loader {
 
   std::unordered_map<std::string, bool> m_schema_ddl_ready;
   std::unordered_map<std::string, uint64_t> m_ddl_in_progress_per_schema;
+  std::unordered_map<std::string, uint64_t> m_views_per_schema;
 
   // progress thread needs to be placed after any of the fields it uses, in
   // order to ensure that it is destroyed (and stopped) before any of those
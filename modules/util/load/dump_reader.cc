@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <functional>
 #include <numeric>
 #include <utility>
 
@@ -144,6 +145,9 @@ Dump_reader::Status Dump_reader::open() {
 
   if (md->has_key("tzUtc")) m_contents.tz_utc = md->get_bool("tzUtc");
 
+  if (md->has_key("incremental"))
+    parse_incremental_metadata(md->get_map("incremental"));
+
   if (md->has_key("mdsCompatibility"))
     m_contents.mds_compatibility = md->get_bool("mdsCompatibility");
 
@@ -1503,6 +1507,99 @@ bool Dump_reader::include_trigger(const std::string &schema,
                                                     table, trigger);
 }
 
+void Dump_reader::parse_incremental_metadata(
+    const shcore::Dictionary_t &incremental) {
+  m_contents.incremental = true;
+
+  if (incremental->has_key("baseBegin"))
+    m_contents.incremental_base_begin = incremental->get_string("baseBegin");
+
+  if (incremental->has_key("baseGtidExecuted")) {
+    m_contents.incremental_base_gtid_executed =
+        incremental->get_string("baseGtidExecuted");
+  }
+
+  if (!incremental->has_key("dropped")) return;
+
+  const auto dropped = incremental->get_map("dropped");
+  auto &objects = m_contents.dropped_objects;
+
+  const auto names = [](const shcore::Value &value) {
+    return value.to_string_container<std::vector<std::string>>();
+  };
+
+  const auto per_schema =
+      [this, &dropped, &names](
+          const char *key,
+          const std::function<bool(const std::string &, const std::string &)>
+              &is_included,
+          std::map<std::string, std::vector<std::string>> *target) {
+        if (!dropped->has_key(key)) return;
+
+        for (const auto &schema : *dropped->get_map(key)) {
+          if (!include_schema(schema.first)) continue;
+
+          for (const auto &name : names(schema.second)) {
+            if (is_included(schema.first, name)) {
+              (*target)[schema.first].emplace_back(name);
+            }
+          }
+        }
+      };
+
+  if (dropped->has_key("schemas")) {
+    for (const auto &schema : names(dropped->at("schemas"))) {
+      if (include_schema(schema)) {
+        objects.schemas.emplace_back(schema);
+      }
+    }
+  }
+
+  const auto is_table_included = [this](const std::string &schema,
+                                         const std::string &table) {
+    return include_table(schema, table);
+  };
+  const auto is_routine_included = [this](const std::string &schema,
+                                          const std::string &routine) {
+    return include_routine(schema, routine);
+  };
+
+  per_schema("tables", is_table_included, &objects.tables);
+  per_schema("views", is_table_included, &objects.views);
+  per_schema("functions", is_routine_included, &objects.functions);
+  per_schema("procedures", is_routine_included, &objects.procedures);
+  per_schema(
+      "events",
+      [this](const std::string &schema, const std::string &event) {
+        return include_event(schema, event);
+      },
+      &objects.events);
+
+  if (dropped->has_key("triggers")) {
+    for (const auto &schema : *dropped->get_map("triggers")) {
+      if (!include_schema(schema.first)) continue;
+
+      for (const auto &table : *schema.second.as_map()) {
+        if (!include_table(schema.first, table.first)) continue;
+
+        for (const auto &trigger : names(table.second)) {
+          if (include_trigger(schema.first, table.first, trigger)) {
+            objects.triggers[schema.first][table.first].emplace_back(trigger);
+          }
+        }
+      }
+    }
+  }
+
+  if (dropped->has_key("users")) {
+    for (const auto &account : names(dropped->at("users"))) {
+      if (m_options.filters().users().is_included(account)) {
+        objects.users.emplace_back(account);
+      }
+    }
+  }
+}
+
 const std::string &Dump_reader::override_schema(const std::string &s) const {
   if (!m_schema_override.has_value()) return s;
 
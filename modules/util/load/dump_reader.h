@@ -55,6 +55,24 @@ class Dump_reader {
   using Files = std::unordered_set<mysqlshdk::storage::IDirectory::File_info>;
   struct Object_info;
 
+  /**
+   * Objects which were removed from the source instance since the base of an
+   * incremental dump was created.
+   */
+  struct Dropped_objects {
+    std::vector<std::string> schemas;
+    // schema -> names
+    std::map<std::string, std::vector<std::string>> tables;
+    std::map<std::string, std::vector<std::string>> views;
+    std::map<std::string, std::vector<std::string>> functions;
+    std::map<std::string, std::vector<std::string>> procedures;
+    std::map<std::string, std::vector<std::string>> events;
+    // schema -> table -> names
+    std::map<std::string, std::map<std::string, std::vector<std::string>>>
+        triggers;
+    std::vector<std::string> users;
+  };
+
   Dump_reader(std::unique_ptr<mysqlshdk::storage::IDirectory> dump_dir,
               const Load_dump_options &options);
 
@@ -92,6 +110,33 @@ class Dump_reader {
 
   bool tz_utc() const { return m_contents.tz_utc; }
 
+  /**
+   * Checks whether this is an incremental dump, created on top of a base dump.
+   */
+  bool is_incremental() const { return m_contents.incremental; }
+
+  /**
+   * Start time of the base of an incremental dump.
+   */
+  const std::string &incremental_base_begin() const {
+    return m_contents.incremental_base_begin;
+  }
+
+  /**
+   * GTID set of the base of an incremental dump.
+   */
+  const std::string &incremental_base_gtid_executed() const {
+    return m_contents.incremental_base_gtid_executed;
+  }
+
+  /**
+   * Objects removed since the base of an incremental dump was created, already
+   * filtered using the load options.
+   */
+  const Dropped_objects &dropped_objects() const {
+    return m_contents.dropped_objects;
+  }
+
   /**
    * Checks whether this is a dump created by an old version of dumpTables(),
    * which has no schema SQL.
@@ -248,6 +293,8 @@ class Dump_reader {
   bool include_trigger(const std::string &schema, const std::string &table,
                        const std::string &trigger) const;
 
+  void parse_incremental_metadata(const shcore::Dictionary_t &incremental);
+
   void on_chunk_loaded(const std::string &schema, const std::string &table,
                        const std::string &partition);
 
@@ -446,6 +493,10 @@ class Dump_reader {
     std::string gtid_executed;
     bool gtid_executed_inconsistent = false;
     bool tz_utc = true;
+    bool incremental = false;
+    std::string incremental_base_begin;
+    std::string incremental_base_gtid_executed;
+    Dropped_objects dropped_objects;
     bool mds_compatibility = false;
     bool partial_revokes = false;
     bool create_invisible_pks = false;
@@ -69,6 +69,7 @@ const shcore::Option_pack_def<Load_dump_options> &Load_dump_options::options() {
   static const auto opts =
       shcore::Option_pack_def<Load_dump_options>()
           .optional("threads", &Load_dump_options::m_threads_count)
+          .optional("adaptiveThreads", &Load_dump_options::m_adaptive_threads)
           .optional("backgroundThreads",
                     &Load_dump_options::m_background_threads_count)
           .optional("showProgress", &Load_dump_options::m_show_progress)
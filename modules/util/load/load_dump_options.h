@@ -151,6 +151,8 @@ class Load_dump_options {
 
   uint64_t threads_count() const { return m_threads_count; }
 
+  bool adaptive_threads() const { return m_adaptive_threads; }
+
   uint64_t background_threads_count(uint64_t def) const {
     return m_background_threads_count.value_or(def);
   }
@@ -275,6 +277,7 @@ class Load_dump_options {
 
   std::string m_url;
   uint64_t m_threads_count = 4;
+  bool m_adaptive_threads = false;
   std::optional<uint64_t> m_background_threads_count;
   bool m_show_progress = isatty(fileno(stdout)) ? true : false;
 
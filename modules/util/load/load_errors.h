@@ -148,7 +148,15 @@
 #define SHERR_LOAD_MANIFEST_UNKNOWN_OBJECT 53028
 #define SHERR_LOAD_MANIFEST_UNKNOWN_OBJECT_MSG "Unknown object in manifest: %s"
 
-#define SHERR_LOAD_LAST 53028
+#define SHERR_LOAD_INCREMENTAL_BASE_NOT_LOADED 53029
+#define SHERR_LOAD_INCREMENTAL_BASE_NOT_LOADED_MSG                            \
+  "The incremental dump can only be loaded into an instance which contains "  \
+  "its base dump, but gtid_executed of the target server does not include "   \
+  "the GTID set of the base dump. The base dump has to be loaded using the "  \
+  "updateGtidSet option set to 'append' or 'replace' before the incremental " \
+  "dump is loaded."
+
+#define SHERR_LOAD_LAST 53029
 
 #define SHERR_LOAD_MAX 53999
 
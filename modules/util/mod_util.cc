@@ -29,6 +29,7 @@
 #include <vector>
 #include "modules/mod_utils.h"
 #include "modules/mysqlxtest_utils.h"
+#include "modules/util/compare/compare_operation.h"
 #include "modules/util/copy/copy_operation.h"
 #include "modules/util/dump/dump_instance.h"
 #include "modules/util/dump/dump_instance_options.h"
@@ -92,6 +93,12 @@ Util::Util(shcore::IShell_core *owner)
   expose("copyTables", &Util::copy_tables, "schema", "tables", "connectionData",
          "?options")
       ->cli();
+  expose("compareSchemas", &Util::compare_schemas, "schemas",
+         "connectionData", "?options")
+      ->cli();
+  expose("compareTables", &Util::compare_tables, "schema", "tables",
+         "connectionData", "?options")
+      ->cli();
 }
 
 REGISTER_HELP_FUNCTION(checkForServerUpgrade, util);
@@ -1039,6 +1046,17 @@ assigned more threads.
 LOAD DATA LOCAL INFILE is used to load table data and thus, the 'local_infile'
 MySQL global setting must be enabled.
 
+<b>Incremental dumps</b>
+
+An incremental dump, created by util.dumpInstance() with the 'incrementalBase'
+option, has to be loaded into an instance which already contains its base dump.
+If the base dump contains a GTID set, gtid_executed of the destination instance
+has to include it, which means that the base dump has to be loaded using the
+'updateGtidSet' option. Objects which were removed since the base dump was
+created are dropped, tables which were modified are recreated and their data is
+loaded again, remaining tables are left intact. Objects which already exist in
+the destination database are not reported as duplicates.
+
 <b>Resuming</b>
 
 The load command will store progress information into a file for each step of
@@ -1068,6 +1086,14 @@ loaded objects should be manually dropped first.
 
 Options dictionary:
 
+@li <b>adaptiveThreads</b>: bool (default: false) - If enabled, the number of
+threads which load the data concurrently is adjusted while the load is running,
+based on the metrics periodically sampled from the target server: number of
+running threads, InnoDB history list length and checkpoint age, Group
+Replication applier queue and replication lag. The number of active threads is
+reduced when the target server is under pressure, and increased again once it
+recovers, up to the value of the <b>threads</b> option. All decisions are
+written to the log file.
 @li <b>analyzeTables</b>: "off", "on", "histogram" (default: off) - If 'on',
 executes ANALYZE TABLE for all tables, once loaded. If set to 'histogram', only
 tables that have histogram information stored in the dump will be analyzed. This
@@ -1531,6 +1557,10 @@ compatibility issues with MySQL HeatWave Service.
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
+@li <b>metadataCache</b>: string (default: not set) - Path to a local file
+used to cache metadata of the dumped tables between runs. If the file exists,
+metadata of tables whose CREATE_TIME and UPDATE_TIME did not change since the
+file was written is read from it, instead of being fetched from the server.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
@@ -2127,6 +2157,13 @@ is not specified, all the accounts with the given user name are excluded.
 specified users. Each user is in the format of 'user_name'[@'host']. If the host
 is not specified, all the accounts with the given user name are included. By
 default, all users are included.
+@li <b>incrementalBase</b>: string (default: not set) - URL of a dump created by
+util.dumpInstance(), which is used as a base of an incremental dump. Only the
+tables which were modified since the base dump was created are dumped, objects
+which were removed are recorded, so that they are dropped when the dump is
+loaded. The base dump has to be loaded using the updateGtidSet option, its GTID
+set is used to verify that it was loaded before the incremental dump. Cannot be
+used with the ddlOnly or dataOnly options.
 
 ${TOPIC_UTIL_DUMP_DDL_COMMON_OPTIONS}
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
@@ -2292,6 +2329,19 @@ server.
 @li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
 maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
 limit.
+@li <b>maxMetadataMemory</b>: string (default: "0") - Limit the memory used to
+hold the metadata and DDL files which were written by the source side, but were
+not yet read by the target side. Table data is streamed directly to the target
+server and is not subject to this limit. Memory is reserved in 32M pages. When
+the limit is reached, writing waits until memory is released, unless
+<b>metadataSpillDir</b> is set. Use maxMetadataMemory="0" to set no limit.
+@li <b>metadataSpillDir</b>: string (default: not set) - Local directory used to
+temporarily hold the metadata and DDL files which do not fit in
+<b>maxMetadataMemory</b>. Requires <b>maxMetadataMemory</b> to be set.
+@li <b>metadataWaitTimeout</b>: float (default: 300) - Time in seconds writing
+of a metadata or DDL file waits for memory to be released when
+<b>maxMetadataMemory</b> is reached. If no memory is released during that time,
+the copy fails. Use metadataWaitTimeout=0 to wait indefinitely.
 @li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
 otherwise) - Enable or disable copy progress information.
 @li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set used
@@ -2511,4 +2561,169 @@ void Util::copy_tables(
   copy::copy<mysqlsh::dump::Dump_tables>(connection_options, &copy_options);
 }
 
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COMPARE_COMMON_DESCRIPTION, R"*(
+Tables are split into chunks in the same way as when dumping the data. For each
+chunk, source and target instances compute a checksum of its rows in parallel.
+If checksums differ, rows of the chunk are fetched from both instances and the
+differences are reported. Data definition (DDL) is not compared.
+
+Target instance should not be modified while the comparison is running. If the
+data differs, an exception is raised after all tables were compared.
+)*");
+
+REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_COMPARE_COMMON_OPTIONS, R"*(
+@li <b>where</b>: dictionary (default: not set) - A key-value pair of a table
+name in the format of <b>schema.table</b> and a valid SQL condition expression
+used to filter the data being compared.
+@li <b>partitions</b>: dictionary (default: not set) - A key-value pair of a
+table name in the format of <b>schema.table</b> and a list of valid partition
+names used to limit the comparison to just the specified partitions.
+
+@li <b>tzUtc</b>: bool (default: true) - Compare TIMESTAMP data using the UTC
+time zone.
+
+@li <b>consistent</b>: bool (default: true) - Enable or disable consistent data
+comparison. When enabled, data of the source instance is compared at a specific
+point in time.
+@li <b>skipConsistencyChecks</b>: bool (default: false) - Skips additional
+consistency checks which are executed when running consistent comparison and
+i.e. backup lock cannot not be acquired.
+
+@li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
+@li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
+number of bytes to be compared in each chunk, enables <b>chunking</b>.
+
+@li <b>threads</b>: int (default: 4) - Use N threads to compare the data.
+@li <b>maxRowDifferences</b>: int (default: 10) - Maximum number of different
+rows reported for each table. Use maxRowDifferences=0 to only compare the
+checksums.
+
+@li <b>maxRate</b>: string (default: "0") - Limit data read throughput to
+maximum rate, measured in bytes per second per thread. Use maxRate="0" to set no
+limit.
+@li <b>showProgress</b>: bool (default: true if stdout is a TTY device, false
+otherwise) - Enable or disable comparison progress information.
+@li <b>defaultCharacterSet</b>: string (default: "utf8mb4") - Character set
+used for the sessions created by the comparison.
+)*");
+
+REGISTER_HELP_FUNCTION(compareSchemas, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COMPARESCHEMAS, R"*(
+Compares data of schemas in the source and the target instance.
+
+@param schemas List of strings with names of schemas to be compared.
+@param connectionData Specifies the connection information required to establish
+a connection to the target instance.
+@param options Optional dictionary with the comparison options.
+
+Requires an open global Shell session to the source instance, if there is none,
+an exception is raised.
+
+${TOPIC_UTIL_COMPARE_COMMON_DESCRIPTION}
+
+<b>The following options are supported:</b>
+@li <b>excludeTables</b>: list of strings (default: empty) - List of tables to
+be excluded from the comparison in the format of <b>schema</b>.<b>table</b>.
+@li <b>includeTables</b>: list of strings (default: empty) - List of tables to
+be included in the comparison in the format of <b>schema</b>.<b>table</b>.
+
+${TOPIC_UTIL_COMPARE_COMMON_OPTIONS}
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARESCHEMAS_BRIEF)
+ *
+ * $(UTIL_COMPARESCHEMAS)
+ */
+#if DOXYGEN_JS
+Undefined Util::compareSchemas(List schemas, ConnectionData connectionData,
+                               Dictionary options);
+#elif DOXYGEN_PY
+None Util::compare_schemas(list schemas, ConnectionData connectionData,
+                           dict options);
+#endif
+void Util::compare_schemas(
+    const std::vector<std::string> &schemas,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<compare::Compare_schemas_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.compareSchemas()"};
+
+  auto compare_options = *options;
+  compare_options.dump_options()->set_schemas(schemas);
+  compare_options.dump_options()->set_session(session->get_core_session());
+
+  compare::compare<mysqlsh::dump::Dump_schemas>(connection_options,
+                                                &compare_options);
+}
+
+REGISTER_HELP_FUNCTION(compareTables, util);
+REGISTER_HELP_FUNCTION_TEXT(UTIL_COMPARETABLES, R"*(
+Compares data of tables in the source and the target instance.
+
+@param schema Name of the schema that contains tables to be compared.
+@param tables List of strings with names of tables to be compared.
+@param connectionData Specifies the connection information required to establish
+a connection to the target instance.
+@param options Optional dictionary with the comparison options.
+
+Requires an open global Shell session to the source instance, if there is none,
+an exception is raised.
+
+${TOPIC_UTIL_COMPARE_COMMON_DESCRIPTION}
+
+<b>The following options are supported:</b>
+@li <b>all</b>: bool (default: false) - Compare all tables from the specified
+schema, requires the <b>tables</b> argument to be an empty list.
+
+${TOPIC_UTIL_COMPARE_COMMON_OPTIONS}
+)*");
+
+/**
+ * \ingroup util
+ *
+ * $(UTIL_COMPARETABLES_BRIEF)
+ *
+ * $(UTIL_COMPARETABLES)
+ */
+#if DOXYGEN_JS
+Undefined Util::compareTables(String schema, List tables,
+                              ConnectionData connectionData,
+                              Dictionary options);
+#elif DOXYGEN_PY
+None Util::compare_tables(str schema, list tables,
+                          ConnectionData connectionData, dict options);
+#endif
+void Util::compare_tables(
+    const std::string &schema, const std::vector<std::string> &tables,
+    const mysqlshdk::db::Connection_options &connection_options,
+    const shcore::Option_pack_ref<compare::Compare_tables_options> &options) {
+  const auto session = _shell_core.get_dev_session();
+
+  if (!session || !session->is_open()) {
+    throw std::runtime_error(
+        "An open session is required to perform this operation.");
+  }
+
+  Scoped_log_sql log_sql{log_sql_for_dump_and_load()};
+  shcore::Log_sql_guard log_sql_context{"util.compareTables()"};
+
+  auto compare_options = *options;
+  compare_options.dump_options()->set_schema(schema);
+  compare_options.dump_options()->set_tables(tables);
+  compare_options.dump_options()->set_session(session->get_core_session());
+
+  compare::compare<mysqlsh::dump::Dump_tables>(connection_options,
+                                               &compare_options);
+}
+
 }  // namespace mysqlsh
@@ -30,6 +30,8 @@
 #include <vector>
 
 #include "modules/mod_extensible_object.h"
+#include "modules/util/compare/compare_schemas_options.h"
+#include "modules/util/compare/compare_tables_options.h"
 #include "modules/util/copy/copy_instance_options.h"
 #include "modules/util/copy/copy_schemas_options.h"
 #include "modules/util/copy/copy_tables_options.h"
@@ -184,6 +186,32 @@ class SHCORE_PUBLIC Util : public Extensible_object {
       const mysqlshdk::db::Connection_options &connection_options,
       const shcore::Option_pack_ref<copy::Copy_tables_options> &options = {});
 
+#if DOXYGEN_JS
+  Undefined compareSchemas(List schemas, ConnectionData connectionData,
+                           Dictionary options);
+#elif DOXYGEN_PY
+  None compare_schemas(list schemas, ConnectionData connectionData,
+                       dict options);
+#endif
+  void compare_schemas(
+      const std::vector<std::string> &schemas,
+      const mysqlshdk::db::Connection_options &connection_options,
+      const shcore::Option_pack_ref<compare::Compare_schemas_options> &options =
+          {});
+
+#if DOXYGEN_JS
+  Undefined compareTables(String schema, List tables,
+                          ConnectionData connectionData, Dictionary options);
+#elif DOXYGEN_PY
+  None compare_tables(str schema, list tables, ConnectionData connectionData,
+                      dict options);
+#endif
+  void compare_tables(
+      const std::string &schema, const std::vector<std::string> &tables,
+      const mysqlshdk::db::Connection_options &connection_options,
+      const shcore::Option_pack_ref<compare::Compare_tables_options> &options =
+          {});
+
  private:
   shcore::IShell_core &_shell_core;
 };
@@ -25,6 +25,7 @@
 #include <array>
 #include <map>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -37,6 +38,7 @@
 #include "mysqlshdk/libs/config/config_file.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/thread_pool.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_lexing.h"
@@ -424,18 +426,58 @@ class Routine_syntax_check : public Upgrade_check {
          "SHOW CREATE EVENT !.!", 3}};
 
     std::vector<Upgrade_issue> issues;
+    // definitions are fetched sequentially using the session, the syntax is
+    // checked in parallel
+    shcore::Thread_pool pool{
+        std::max<uint64_t>(std::thread::hardware_concurrency(), 1)};
+
+    pool.start_threads();
+
     for (const auto &obj : object_info) {
       auto result = session->queryf(obj.names_query);
 
-      // fetch all results because we need to query again in process_item()
+      // fetch all results because we need to query again in
+      // fetch_definition()
       result->buffer();
 
       while (auto row = result->fetch_one()) {
-        auto issue =
-            process_item(row, obj.show_query, obj.code_field, session.get());
-        if (!issue.description.empty()) issues.push_back(std::move(issue));
+        Upgrade_issue issue;
+
+        issue.schema = row->get_as_string(0);
+        issue.table = row->get_as_string(1);
+        issue.level = Upgrade_issue::ERROR;
+
+        // we need to get routine definitions with the SHOW command
+        // because INFORMATION_SCHEMA will eat up things like backslashes
+        // Bug#34534696	unparseable code returned in
+        // INFORMATION_SCHEMA.ROUTINES.ROUTINE_DEFINITION
+        auto sql = fetch_definition(session.get(), obj.show_query,
+                                    obj.code_field, issue.schema, issue.table);
+
+        if (sql.empty()) continue;
+
+        // keep the order of the issues, description is set once the check is
+        // done
+        const auto index = issues.size();
+        issues.emplace_back(std::move(issue));
+
+        pool.add_task(
+            [sql = std::move(sql)]() { return check_routine_syntax(sql); },
+            [&issues, index](std::string &&description) {
+              issues[index].description = std::move(description);
+            });
       }
     }
+
+    pool.tasks_done();
+    pool.process();
+
+    issues.erase(std::remove_if(issues.begin(), issues.end(),
+                                [](const Upgrade_issue &issue) {
+                                  return issue.description.empty();
+                                }),
+                 issues.end());
+
     return issues;
   }
 
@@ -452,52 +494,35 @@ class Routine_syntax_check : public Upgrade_check {
            "upgrading.";
   }
 
-  std::string check_routine_syntax(mysqlshdk::db::ISession *session,
-                                   const std::string &show_template,
-                                   int show_sql_field,
-                                   const std::string &schema,
-                                   const std::string &name) {
+  static std::string fetch_definition(mysqlshdk::db::ISession *session,
+                                      const std::string &show_template,
+                                      int show_sql_field,
+                                      const std::string &schema,
+                                      const std::string &name) {
     auto result = session->queryf(show_template, schema, name);
+
     if (auto row = result->fetch_one()) {
-      std::string sql = row->get_as_string(show_sql_field);
-      try {
-        sql = "DELIMITER $$$\n" + sql + "$$$\n";
-
-        mysqlshdk::parser::check_sql_syntax(sql);
-      } catch (const mysqlshdk::parser::Sql_syntax_error &err) {
-        return shcore::str_format("at line %i,%i: unexpected token '%s'",
-                                  static_cast<int>(err.line() - 1),
-                                  static_cast<int>(err.offset()),
-                                  err.token_text().c_str());
-      }
-    } else {
-      log_warning("Upgrade check query %s returned no rows for %s.%s",
-                  show_template.c_str(), schema.c_str(), name.c_str());
+      return row->get_as_string(show_sql_field);
     }
 
+    log_warning("Upgrade check query %s returned no rows for %s.%s",
+                show_template.c_str(), schema.c_str(), name.c_str());
+
     return "";
   }
 
-  Upgrade_issue process_item(const mysqlshdk::db::IRow *row,
-                             const std::string &show_template,
-                             int show_sql_field,
-                             mysqlshdk::db::ISession *session) {
-    Upgrade_issue issue;
-
-    issue.schema = row->get_as_string(0);
-    issue.table = row->get_as_string(1);
-    issue.level = Upgrade_issue::ERROR;
-
-    // we need to get routine definitions with the SHOW command
-    // because INFORMATION_SCHEMA will eat up things like backslashes
-    // Bug#34534696	unparseable code returned in
-    // INFORMATION_SCHEMA.ROUTINES.ROUTINE_DEFINITION
-
-    issue.description = check_routine_syntax(
-        session, show_template, show_sql_field, issue.schema, issue.table);
+  static std::string check_routine_syntax(const std::string &definition) {
+    try {
+      mysqlshdk::parser::check_sql_syntax("DELIMITER $$$\n" + definition +
+                                          "$$$\n");
+    } catch (const mysqlshdk::parser::Sql_syntax_error &err) {
+      return shcore::str_format("at line %i,%i: unexpected token '%s'",
+                                static_cast<int>(err.line() - 1),
+                                static_cast<int>(err.offset()),
+                                err.token_text().c_str());
+    }
 
-    if (issue.description.empty()) return {};
-    return issue;
+    return "";
   }
 };
 }  // namespace
@@ -30,6 +30,7 @@
 #include "mysql-secret-store/core/erase_command.h"
 #include "mysql-secret-store/core/get_command.h"
 #include "mysql-secret-store/core/list_command.h"
+#include "mysql-secret-store/core/serve_command.h"
 #include "mysql-secret-store/core/store_command.h"
 #include "mysql-secret-store/core/version_command.h"
 
@@ -45,6 +46,7 @@ Program::Program(std::unique_ptr<common::Helper> helper)
   m_commands.emplace_back(std::make_unique<Get_command>(ptr));
   m_commands.emplace_back(std::make_unique<Erase_command>(ptr));
   m_commands.emplace_back(std::make_unique<List_command>(ptr));
+  m_commands.emplace_back(std::make_unique<Serve_command>(ptr, m_commands));
 }
 
 int Program::run(int argc, char *argv[]) {
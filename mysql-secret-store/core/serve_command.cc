@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysql-secret-store/core/serve_command.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace mysql {
+namespace secret_store {
+namespace core {
+
+std::string Serve_command::help() const {
+  return "Executes commands read from the input, until it is closed.";
+}
+
+void Serve_command::execute(std::istream *input, std::ostream *output) {
+  std::string header;
+
+  while (std::getline(*input, header)) {
+    std::istringstream request{header};
+    std::string name;
+    std::size_t length = 0;
+
+    if (!(request >> name >> length)) {
+      throw std::runtime_error{"Invalid request: '" + header + "'"};
+    }
+
+    std::string data(length, '\0');
+
+    if (!input->read(data.data(), length)) {
+      throw std::runtime_error{"Failed to read input of the command: '" +
+                               name + "'"};
+    }
+
+    std::istringstream command_input{data};
+    std::ostringstream command_output;
+    int exit_code = 0;
+
+    try {
+      find_command(name)->execute(&command_input, &command_output);
+    } catch (const std::exception &ex) {
+      command_output.str(ex.what());
+      exit_code = 1;
+    }
+
+    const auto result = command_output.str();
+
+    *output << exit_code << ' ' << result.length() << '\n' << result;
+    output->flush();
+  }
+}
+
+Command *Serve_command::find_command(const std::string &name) const {
+  // nested sessions are not supported
+  if (this->name() != name) {
+    for (const auto &command : m_commands) {
+      if (command->name() == name) {
+        return command.get();
+      }
+    }
+  }
+
+  throw std::runtime_error{"Unknown command: '" + name + "'"};
+}
+
+}  // namespace core
+}  // namespace secret_store
+}  // namespace mysql
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQL_SECRET_STORE_CORE_SERVE_COMMAND_H_
+#define MYSQL_SECRET_STORE_CORE_SERVE_COMMAND_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysql-secret-store/core/command.h"
+
+namespace mysql {
+namespace secret_store {
+namespace core {
+
+/**
+ * Executes multiple commands in a single process, until the input is closed.
+ *
+ * Each request is a header line: "<command> <length of input>\n", followed by
+ * the input of the command. Each response is a header line:
+ * "<exit code> <length of output>\n", followed by the output of the command
+ * (or an error message if exit code is not 0).
+ */
+class Serve_command : public Command {
+ public:
+  Serve_command(common::Helper *helper,
+                const std::vector<std::unique_ptr<Command>> &commands)
+      : Command("serve", helper), m_commands(commands) {}
+
+  std::string help() const override;
+
+  void execute(std::istream *input, std::ostream *output) override;
+
+ private:
+  Command *find_command(const std::string &name) const;
+
+  const std::vector<std::unique_ptr<Command>> &m_commands;
+};
+
+}  // namespace core
+}  // namespace secret_store
+}  // namespace mysql
+
+#endif  // MYSQL_SECRET_STORE_CORE_SERVE_COMMAND_H_
@@ -141,6 +141,16 @@ class Helper_interface final {
    */
   Helper_name name() const noexcept;
 
+  /**
+   * Controls whether a single, long-lived process of the secret store helper
+   * is used to execute all of the operations, instead of starting a new
+   * process for each operation. If helper does not support this mode, a new
+   * process is started for each operation.
+   *
+   * @param persistent Whether to use a long-lived helper process.
+   */
+  void set_persistent(bool persistent) noexcept;
+
   /**
    * Stores the secret identified by spec.
    *
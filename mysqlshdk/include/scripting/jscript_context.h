@@ -47,6 +47,22 @@ class SHCORE_PUBLIC JScript_context {
   JScript_context(Object_registry *registry);
   ~JScript_context();
 
+  /**
+   * Writes a V8 startup snapshot of the initialized global context (global
+   * functions and the core module) to the given file.
+   */
+  static void create_snapshot(const std::string &path);
+
+  /**
+   * Loads the startup snapshot used by the new contexts, returns false if it
+   * cannot be used, in which case contexts are initialized from scratch. An
+   * empty path disables the snapshot. If not called explicitly, the snapshot
+   * is loaded from the share folder when the first context is created.
+   * Needs to be called before any context is created, as they use the loaded
+   * data.
+   */
+  static bool load_snapshot(const std::string &path);
+
   std::pair<Value, bool> execute(const std::string &code,
                                  const std::string &source = "");
   std::pair<Value, bool> execute_interactive(const std::string &code,
@@ -61,6 +77,7 @@ class SHCORE_PUBLIC JScript_context {
   Argument_list convert_args(const v8::FunctionCallbackInfo<v8::Value> &args);
 
   void set_global(const std::string &name, const Value &value);
+  void remove_global(const std::string &name);
   Value get_global(const std::string &name);
 
   void set_argv(const std::vector<std::string> &args);
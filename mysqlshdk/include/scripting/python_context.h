@@ -81,6 +81,7 @@ class TYPES_COMMON_PUBLIC Python_context {
 
   Value get_global(const std::string &value);
   void set_global(const std::string &name, const Value &value);
+  void remove_global(const std::string &name);
   void set_argv(const std::vector<std::string> &argv);
 
   py::Store get_global_py(const std::string &value);
@@ -112,6 +112,8 @@ class SHCORE_PUBLIC Shell_language {
 
   virtual void set_global(const std::string &name, const Value &value) = 0;
 
+  virtual void remove_global(const std::string & /*name*/) {}
+
   virtual void set_argv(const std::vector<std::string> & = {}) {}
 
   virtual bool handle_input_stream(std::istream * /*istream*/) {
@@ -181,6 +183,8 @@ class SHCORE_PUBLIC Shell_core : public shcore::IShell_core {
                   Mode_mask mode = Mode_mask::any()) override;
   Value get_global(const std::string &name) override;
   bool is_global(const std::string &name) override;
+  // removes the global variable, also from the languages which expose it
+  void remove_global(const std::string &name);
   std::vector<std::string> get_global_objects(Mode mode) override;
   std::vector<std::string> get_all_globals();
 
@@ -45,6 +45,8 @@ class Shell_javascript : public Shell_language {
 
   void set_global(const std::string &name, const Value &value) override;
 
+  void remove_global(const std::string &name) override;
+
   void set_argv(const std::vector<std::string> &argv = {}) override;
 
   void handle_input(std::string &code, Input_state &state) override;
@@ -52,6 +52,7 @@
 
 #define SHCORE_DB_NAME_CACHE "autocomplete.nameCache"
 #define SHCORE_DEVAPI_DB_OBJECT_HANDLES "devapi.dbObjectHandles"
+#define SHCORE_DEVAPI_PIPELINE_DEPTH "devapi.pipelineDepth"
 
 #define SHCORE_PAGER "pager"
 
@@ -97,7 +98,8 @@ class Shell_options final : public shcore::Options {
     std::string identity_file;
     std::string config_file;
     int timeout = 10;
-    unsigned int buffer_size = 10240;
+    unsigned int buffer_size = 65536;
+    unsigned int tunnel_threads = 1;
     std::string uri;
     std::string pwd;
     mysqlshdk::ssh::Ssh_connection_options uri_data;
@@ -119,6 +121,8 @@ class Shell_options final : public shcore::Options {
 
     std::string result_format;
     std::string wrap_json;
+    // --json=ndjson, rows of the results are printed as separate documents
+    bool wrap_json_rows = false;
     bool force = false;
     bool interactive = false;
     bool full_interactive = false;
@@ -130,6 +134,7 @@ class Shell_options final : public shcore::Options {
     bool trace_protocol = false;
     bool log_to_stderr = false;
     bool devapi_schema_object_handles = true;
+    int devapi_pipeline_depth = 64;
     bool db_name_cache = true;
     bool db_name_cache_set = false;
     std::string execute_statement;
@@ -169,6 +174,7 @@ class Shell_options final : public shcore::Options {
     Quiet_start quiet_start = Quiet_start::NOT_SET;
     bool show_column_type_info = false;
     bool default_compress = false;
+    bool startup_profile = false;
     std::string dbug_options;
 
     // override default plugin search path ; separated in windows, : elsewhere
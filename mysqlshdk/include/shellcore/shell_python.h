@@ -38,6 +38,8 @@ class Shell_python : public Shell_language {
 
   void set_global(const std::string &name, const Value &value) override;
 
+  void remove_global(const std::string &name) override;
+
   void set_argv(const std::vector<std::string> &argv = {}) override;
 
   void set_result_processor(
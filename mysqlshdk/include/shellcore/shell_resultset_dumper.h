@@ -35,6 +35,10 @@
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/utils/enumset.h"
 
+namespace shcore {
+class JSON_dumper;
+}  // namespace shcore
+
 namespace mysqlsh {
 namespace mysqlx {
 class SqlResult;
@@ -128,8 +132,12 @@ class Resultset_dumper_base {
   size_t dump_vertical();
   size_t dump_documents(bool is_doc_result);
   virtual bool show_column_type_info() const { return m_show_column_type_info; }
-  std::string format_json(const std::string &item_label, bool is_doc_result,
-                          bool pretty, int *count);
+  size_t format_json(const std::string &item_label, bool is_doc_result,
+                     bool pretty,
+                     const std::function<void(const std::string &)> &output);
+  size_t format_ndjson(const std::string &item_label, bool is_doc_result,
+                       const std::function<void(const std::string &)> &output);
+  void append_json_summary(shcore::JSON_dumper *dumper, bool is_doc_result);
   virtual size_t dump_json(const std::string &item_label, bool is_doc_result);
   void dump_warnings();
   std::string format_json_metadata(bool pretty);
@@ -144,6 +152,7 @@ class Resultset_dumper_base {
   bool m_cancelled = false;
   std::unique_ptr<Resultset_printer> m_printer;
   bool m_show_column_type_info;
+  bool m_ndjson = false;
 };
 
 /**
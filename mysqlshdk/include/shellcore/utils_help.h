@@ -183,6 +183,28 @@ class Help_registry {
     std::string description;
   };
 
+  /**
+   * Help text which is registered when it's needed for the first time.
+   */
+  struct Lazy_help {
+    enum class Type {
+      // add_help(token, data)
+      TEXT,
+      // add_split_help(token, data, ...)
+      SPLIT_TEXT,
+      // add_split_help(token, data, ...) followed by a reference to the first
+      // _DETAIL entry
+      TOPIC_TEXT,
+    };
+
+    Type type;
+    const char *token;
+    const char *data;
+    bool auto_brief = false;
+    bool nosuffix = false;
+    bool is_shell_command = false;
+  };
+
   virtual ~Help_registry();
 
   // Access to the singleton
@@ -191,6 +213,19 @@ class Help_registry {
   // Retrieves the help text associated to a specific token
   std::string get_token(const std::string &help) const;
 
+  /**
+   * Defers registration of the help text until any help text is accessed,
+   * this keeps the static initialization cheap.
+   *
+   * @param help The help text, strings need to have static storage duration.
+   */
+  static void add_lazy_help(const Lazy_help &help);
+
+  /**
+   * Checks if there is help text which was not registered yet.
+   */
+  static bool has_lazy_help();
+
   /**
    * Helper function to register multiple help entries for a topic at once.
    * @param prefix The token prefix under which the text entry will be
@@ -380,6 +415,18 @@ class Help_registry {
 
   static bool icomp(const std::string &lhs, const std::string &rhs);
 
+  // Registers all the pending lazy help text
+  void load_lazy_help();
+
+  // Queues the help text if lazy help was not registered yet, this way help
+  // registered while shell is initialized does not trigger the registration
+  // of all the lazy help; returns false if help needs to be registered now
+  bool defer_help(Lazy_help help, const std::string &token,
+                  const std::string &data);
+
+  // set while the pending lazy help text is being registered
+  bool m_loading_lazy_help = false;
+
   // Helper functions for add_help_topic
   void register_topic(Help_topic *topic, bool new_topic,
                       IShell_core::Mode_mask mode);
@@ -406,6 +453,11 @@ class Help_registry {
  * Helper structure to statically register help data.
  */
 struct Help_register {
+  Help_register(const char *token, const char *data) {
+    shcore::Help_registry::add_lazy_help(
+        {Help_registry::Lazy_help::Type::TEXT, token, data});
+  }
+
   Help_register(const std::string &token, const std::string &data) {
     shcore::Help_registry::get()->add_help(token, data);
   }
@@ -419,6 +471,13 @@ struct Help_register {
  * the full text directly.
  */
 struct Help_register_split {
+  Help_register_split(const char *prefix, const char *data, bool auto_brief,
+                      bool nosuffix, bool is_shell_command = false) {
+    shcore::Help_registry::add_lazy_help(
+        {Help_registry::Lazy_help::Type::SPLIT_TEXT, prefix, data, auto_brief,
+         nosuffix, is_shell_command});
+  }
+
   Help_register_split(const std::string &prefix, const std::string &data,
                       bool auto_brief, bool nosuffix,
                       bool is_shell_command = false) {
@@ -428,6 +487,12 @@ struct Help_register_split {
 };
 
 struct Help_register_topic_text {
+  Help_register_topic_text(const char *prefix, const char *data,
+                           bool auto_brief) {
+    shcore::Help_registry::add_lazy_help(
+        {Help_registry::Lazy_help::Type::TOPIC_TEXT, prefix, data, auto_brief});
+  }
+
   Help_register_topic_text(const std::string &prefix, const std::string &data,
                            bool auto_brief) {
     // Adds _DETAIL# entries for the whole thing
@@ -23,6 +23,9 @@
 
 #include "mysqlshdk/libs/config/config_server_handler.h"
 
+#include <iterator>
+#include <set>
+
 #include "mysqlshdk/libs/utils/logger.h"
 
 namespace mysqlshdk {
@@ -103,43 +106,113 @@ void Config_server_handler::set(const std::string &name,
 }
 
 void Config_server_handler::apply() {
-  for (const auto &var : m_change_sequence) {
-    try {
-      if (var.value.type == shcore::Value_type::Bool) {
-        bool value = *value_to_nullable_bool(var.value);
-        log_debug("Set '%s'=%s", var.name.c_str(), value ? "true" : "false");
-        m_instance->set_sysvar(var.name, value, var.qualifier);
-      } else if (var.value.type == shcore::Value_type::Integer) {
-        int64_t value = *value_to_nullable_int(var.value);
-        log_debug("Set '%s'=%" PRId64, var.name.c_str(), value);
-        m_instance->set_sysvar(var.name, value, var.qualifier);
-      } else {
-        std::string value = *value_to_nullable_string(var.value);
-        log_debug("Set '%s'='%s'", var.name.c_str(), value.c_str());
-        m_instance->set_sysvar(var.name, value, var.qualifier);
-      }
-    } catch (const std::exception &err) {
-      if (var.context.empty()) throw;
-
-      // Send error with context information (more user friendly).
-      std::string value =
-          (var.value.type == shcore::Value_type::Null)
-              ? "NULL"
-              : shcore::str_format("'%s'", var.value.as_string().c_str());
-      throw std::runtime_error(
-          shcore::str_format("Unable to set value %s for '%s': %s",
-                             value.c_str(), var.context.c_str(), err.what()));
+  auto batch_begin = m_change_sequence.cbegin();
+  std::set<std::string, shcore::Case_insensitive_comparator> batch_names;
+
+  for (auto it = m_change_sequence.cbegin(); it != m_change_sequence.cend();
+       ++it) {
+    // the same variable cannot be set twice in a single statement, changes
+    // which need to be delayed end the batch
+    if (!batch_names.emplace(it->name).second) {
+      apply(batch_begin, it);
+
+      batch_begin = it;
+      batch_names.clear();
+      batch_names.emplace(it->name);
     }
 
-    // Sleep after setting the variable if delay is defined (> 0).
-    if (var.timeout.count() > 0) shcore::sleep(var.timeout);
+    if (it->timeout.count() > 0) {
+      apply(batch_begin, std::next(it));
+
+      // Sleep after setting the variable if delay is defined (> 0).
+      shcore::sleep(it->timeout);
+
+      batch_begin = std::next(it);
+      batch_names.clear();
+    }
   }
 
+  apply(batch_begin, m_change_sequence.cend());
+
   m_change_sequence.clear();
   m_global_change_tracker.clear();
   m_session_change_tracker.clear();
 }
 
+void Config_server_handler::apply(std::vector<VarData>::const_iterator begin,
+                                  std::vector<VarData>::const_iterator end) {
+  const auto count = std::distance(begin, end);
+
+  if (0 == count) return;
+
+  if (1 == count) {
+    apply(*begin);
+    return;
+  }
+
+  std::vector<mysql::Sysvar_assignment> assignments;
+  assignments.reserve(count);
+
+  for (auto it = begin; it != end; ++it) {
+    mysql::Sysvar_assignment assignment;
+    assignment.name = it->name;
+    assignment.qualifier = it->qualifier;
+
+    if (it->value.type == shcore::Value_type::Bool) {
+      assignment.value = *value_to_nullable_bool(it->value);
+    } else if (it->value.type == shcore::Value_type::Integer) {
+      assignment.value = *value_to_nullable_int(it->value);
+    } else {
+      assignment.value = *value_to_nullable_string(it->value);
+    }
+
+    log_debug("Set '%s'=%s", it->name.c_str(), it->value.repr().c_str());
+    assignments.emplace_back(std::move(assignment));
+  }
+
+  try {
+    m_instance->set_sysvars(assignments);
+  } catch (const std::exception &err) {
+    // if any of the assignments fails, none of them is applied, apply the
+    // changes one by one to report the variable which caused the failure
+    log_debug("Failed to set %zu variables at once: %s", assignments.size(),
+              err.what());
+
+    for (auto it = begin; it != end; ++it) {
+      apply(*it);
+    }
+  }
+}
+
+void Config_server_handler::apply(const VarData &var) {
+  try {
+    if (var.value.type == shcore::Value_type::Bool) {
+      bool value = *value_to_nullable_bool(var.value);
+      log_debug("Set '%s'=%s", var.name.c_str(), value ? "true" : "false");
+      m_instance->set_sysvar(var.name, value, var.qualifier);
+    } else if (var.value.type == shcore::Value_type::Integer) {
+      int64_t value = *value_to_nullable_int(var.value);
+      log_debug("Set '%s'=%" PRId64, var.name.c_str(), value);
+      m_instance->set_sysvar(var.name, value, var.qualifier);
+    } else {
+      std::string value = *value_to_nullable_string(var.value);
+      log_debug("Set '%s'='%s'", var.name.c_str(), value.c_str());
+      m_instance->set_sysvar(var.name, value, var.qualifier);
+    }
+  } catch (const std::exception &err) {
+    if (var.context.empty()) throw;
+
+    // Send error with context information (more user friendly).
+    std::string value =
+        (var.value.type == shcore::Value_type::Null)
+            ? "NULL"
+            : shcore::str_format("'%s'", var.value.as_string().c_str());
+    throw std::runtime_error(
+        shcore::str_format("Unable to set value %s for '%s': %s",
+                           value.c_str(), var.context.c_str(), err.what()));
+  }
+}
+
 std::string Config_server_handler::get_server_uuid() const {
   return *get_string("server_uuid");
 }
@@ -241,5 +314,14 @@ std::optional<std::string> Config_server_handler::get_persisted_value(
   }
 }
 
+void Config_server_handler::prefetch(
+    const std::vector<std::string> &names) const {
+  m_instance->prefetch_sysvars(names, m_get_scope);
+}
+
+void Config_server_handler::clear_prefetched() const {
+  m_instance->clear_sysvars_cache();
+}
+
 }  // namespace config
 }  // namespace mysqlshdk
@@ -153,6 +153,9 @@ class Config_server_handler : public IConfig_handler {
    * internally without (immediately) applying them (i.e., not directly changing
    * the corresponding server system variables).
    * This function applies all recorded changes to the server system variables.
+   * Consecutive changes are applied using a single SET statement, if such
+   * statement fails, changes are applied one by one to report the variable
+   * which could not be set.
    *
    * @throw mysqlshdk::db::Error if any error occurs trying to set (apply) the
    *        configurations on the server.
@@ -355,6 +358,23 @@ class Config_server_handler : public IConfig_handler {
    */
   std::optional<std::string> get_persisted_value(const std::string &name) const;
 
+  /**
+   * Fetches the values of the specified server configurations (system
+   * variables) using a single query, subsequent gets of these configurations
+   * are not going to query the server.
+   *
+   * NOTE: Values are cached by the target instance, until they are changed
+   * using that instance or its cache is cleared.
+   *
+   * @param names names of the configurations to fetch.
+   */
+  void prefetch(const std::vector<std::string> &names) const;
+
+  /**
+   * Removes the values fetched by prefetch().
+   */
+  void clear_prefetched() const;
+
  private:
   /**
    * Auxiliary function to convert a shcore::Value (holding a bool) to a
@@ -416,6 +436,18 @@ class Config_server_handler : public IConfig_handler {
     std::string context;
   };
 
+  /**
+   * Applies the given changes using a single statement, falls back to applying
+   * them one by one if this fails.
+   */
+  void apply(std::vector<VarData>::const_iterator begin,
+             std::vector<VarData>::const_iterator end);
+
+  /**
+   * Applies a single change.
+   */
+  void apply(const VarData &var);
+
   // List of tuples with the change to apply.
   std::vector<VarData> m_change_sequence;
 
@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/db/mysql/result.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <utility>
@@ -226,15 +227,7 @@ const IRow *Result::fetch_one() {
           _fetched_row_count++;
         } else {
           _row.reset();
-          if (auto session = _session.lock()) {
-            int code = 0;
-            const char *state;
-            const char *err = session->get_last_error(&code, &state);
-            if (code != 0) throw mysqlshdk::db::Error(err, code, state);
-          }
-
-          // It means we are done, time to fetch the statement id
-          fetch_statement_id();
+          finish_fetch();
         }
       } else {
         _row.reset();
@@ -249,6 +242,55 @@ const IRow *Result::fetch_one() {
   return nullptr;
 }
 
+const Row_batch &Result::fetch_batch(std::size_t max_rows) {
+  if (_pre_fetched || _pre_fetched_clear_at_end || !has_resultset()) {
+    return IResult::fetch_batch(max_rows);
+  }
+
+  std::shared_ptr<MYSQL_RES> res = _result.lock();
+
+  if (!res || !_row) {
+    return IResult::fetch_batch(max_rows);
+  }
+
+  m_batch.reset(static_cast<uint32_t>(_metadata.size()));
+
+  // rows of a buffered result are valid until the result is freed, while the
+  // row buffer of an unbuffered result is reused by the next call to
+  // mysql_fetch_row(), in the latter case the batch holds a single row, which
+  // references that buffer, this way rows are never copied
+  const std::size_t batch_size =
+      m_buffered ? max_rows : std::min<std::size_t>(max_rows, 1);
+
+  while (m_batch.size() < batch_size) {
+    MYSQL_ROW mysql_row = mysql_fetch_row(res.get());
+
+    if (!mysql_row) {
+      _row.reset();
+      finish_fetch();
+      break;
+    }
+
+    m_batch.add_row(mysql_row, mysql_fetch_lengths(res.get()));
+
+    _fetched_row_count++;
+  }
+
+  return m_batch;
+}
+
+void Result::finish_fetch() {
+  if (auto session = _session.lock()) {
+    int code = 0;
+    const char *state;
+    const char *err = session->get_last_error(&code, &state);
+    if (code != 0) throw mysqlshdk::db::Error(err, code, state);
+  }
+
+  // It means we are done, time to fetch the statement id
+  fetch_statement_id();
+}
+
 void Result::fetch_statement_id() {
   if (!m_statement_id.has_value()) {
     if (auto s = _session.lock()) {
@@ -53,6 +53,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
 
   // Data Retrieving
   virtual const IRow *fetch_one();
+  const Row_batch &fetch_batch(std::size_t max_rows) override;
   virtual bool next_resultset();
   virtual std::unique_ptr<Warning> fetch_one_warning();
 
@@ -93,6 +94,7 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   void stop_pre_fetch();
 
   void fetch_metadata();
+  void finish_fetch();
   void fetch_statement_id();
   Type map_data_type(int raw_type, int flags, int collation_id);
 
@@ -28,6 +28,7 @@
 #define MYSQLSHDK_LIBS_DB_MYSQLX_SESSION_H_
 
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <set>
 #include <string>
@@ -56,6 +57,50 @@ struct GlobalNotice {
   Type type;
 };
 
+class XSession_impl;
+
+/**
+ * Result of a statement sent through the pipeline of a session. It becomes
+ * available once the results of all the statements sent before it are
+ * received.
+ */
+class SHCORE_PUBLIC Pipelined_result final {
+ public:
+  Pipelined_result(const Pipelined_result &) = delete;
+  Pipelined_result(Pipelined_result &&) = delete;
+
+  Pipelined_result &operator=(const Pipelined_result &) = delete;
+  Pipelined_result &operator=(Pipelined_result &&) = delete;
+
+  ~Pipelined_result() = default;
+
+  /**
+   * Whether the result was already received.
+   */
+  bool ready() const { return m_ready; }
+
+  /**
+   * Waits for the result of the statement.
+   *
+   * @returns The buffered result.
+   *
+   * @throws Error if execution of the statement has failed, or if execution
+   *         of any of the previous statements in the pipeline has failed.
+   */
+  std::shared_ptr<IResult> get();
+
+ private:
+  friend class XSession_impl;
+
+  explicit Pipelined_result(std::weak_ptr<XSession_impl> session)
+      : m_session(std::move(session)) {}
+
+  std::weak_ptr<XSession_impl> m_session;
+  bool m_ready = false;
+  std::shared_ptr<IResult> m_result;
+  std::unique_ptr<Error> m_error;
+};
+
 /*
  * Session implementation for the MySQL protocol.
  *
@@ -67,6 +112,7 @@ struct GlobalNotice {
 class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   friend class Session;  // The Session class instantiates this class
   friend class Result;   // The Reslt class uses some functions of this class
+  friend class Pipelined_result;  // Receives the pipelined results
 
  public:
   ~XSession_impl();
@@ -127,6 +173,23 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
 
   void deallocate_prep_stmt(uint32_t stmt_id);
 
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Insert &msg, size_t max_in_flight);
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Update &msg, size_t max_in_flight);
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Delete &msg, size_t max_in_flight);
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Sql::StmtExecute &msg, size_t max_in_flight);
+
+  template <class T>
+  std::shared_ptr<Pipelined_result> send_pipelined(const T &msg,
+                                                   size_t max_in_flight);
+
+  void recv_pipelined();
+
+  void drain_pipeline();
+
   void enable_notices(const std::vector<GlobalNotice::Type> &types);
 
   /** Registers a callback called when an async notice is received
@@ -162,6 +225,13 @@ class XSession_impl : public std::enable_shared_from_this<XSession_impl> {
   bool _case_sensitive_table_names = false;
 
   std::weak_ptr<Result> _prev_result;
+
+  // results of the statements sent through the pipeline, in order
+  std::deque<std::shared_ptr<Pipelined_result>> m_pipeline;
+  // whether response to the opening of the expectation block is pending
+  bool m_pipeline_open_pending = false;
+  // whether any of the statements in the pipeline has failed
+  bool m_pipeline_failed = false;
   mysqlshdk::db::Connection_options _connection_options;
   std::unique_ptr<Error> m_last_error;
 
@@ -255,6 +325,38 @@ class SHCORE_PUBLIC Session : public ISession,
 
   void deallocate_prep_stmt(uint32_t id) { _impl->deallocate_prep_stmt(id); }
 
+  /**
+   * Sends the statement without waiting for its result. Statements sent this
+   * way are executed in order, if any of them fails, all the following ones
+   * fail as well.
+   *
+   * @param msg Statement to be executed.
+   * @param max_in_flight Maximum number of statements which can await their
+   *        results, if reached, the oldest result is received before the
+   *        statement is sent.
+   *
+   * @returns Handle to the result of the statement.
+   */
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Insert &msg, size_t max_in_flight) {
+    return _impl->execute_async(msg, max_in_flight);
+  }
+
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Update &msg, size_t max_in_flight) {
+    return _impl->execute_async(msg, max_in_flight);
+  }
+
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Crud::Delete &msg, size_t max_in_flight) {
+    return _impl->execute_async(msg, max_in_flight);
+  }
+
+  std::shared_ptr<Pipelined_result> execute_async(
+      const ::Mysqlx::Sql::StmtExecute &msg, size_t max_in_flight) {
+    return _impl->execute_async(msg, max_in_flight);
+  }
+
   bool is_open() const override { return _impl->valid(); };
 
   const Error *get_last_error() const override {
@@ -23,6 +23,7 @@
 
 #include <mysqlx_version.h>
 
+#include <cassert>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -486,6 +487,13 @@ void XSession_impl::connect(const mysqlshdk::db::Connection_options &data) {
 }
 
 void XSession_impl::close() {
+  try {
+    // results of the pipelined statements are made available to their handles
+    drain_pipeline();
+  } catch (const std::exception &e) {
+    log_warning("Error occurred receiving pipelined results: %s", e.what());
+  }
+
   // This should be logged, for now commenting to
   // avoid having unneeded output on the script mode
   if (auto result = _prev_result.lock()) {
@@ -514,6 +522,8 @@ void XSession_impl::close() {
   _expired_account = false;
   _case_sensitive_table_names = false;
   _prev_result.reset();
+  m_pipeline_open_pending = false;
+  m_pipeline_failed = false;
   _connection_options = Connection_options();
 }
 
@@ -563,6 +573,9 @@ XSession_impl::~XSession_impl() {
 void XSession_impl::before_query() {
   if (!_mysql) throw std::logic_error("Not connected");
 
+  // pipelined statements were sent first, their results need to be received
+  drain_pipeline();
+
   if (auto result = _prev_result.lock()) {
     if (result->has_resultset()) {
       // buffer the previous result to remove it from the connection
@@ -758,6 +771,145 @@ void XSession_impl::deallocate_prep_stmt(uint32_t stmt_id) {
   m_prepared_statements.erase(stmt_id);
 }
 
+template <class T>
+std::shared_ptr<Pipelined_result> XSession_impl::send_pipelined(
+    const T &msg, size_t max_in_flight) {
+  if (!_mysql) throw std::logic_error("Not connected");
+
+  if (max_in_flight < 1) max_in_flight = 1;
+
+  while (m_pipeline.size() >= max_in_flight) {
+    recv_pipelined();
+  }
+
+  auto &protocol = _mysql->get_protocol();
+
+  if (m_pipeline.empty()) {
+    // flushes result of the previous query
+    before_query();
+
+    // pipelined statements are executed in an expectation block, once a
+    // statement fails, all the following statements fail as well
+    ::Mysqlx::Expect::Open open;
+    open.set_op(::Mysqlx::Expect::Open::EXPECT_CTX_EMPTY);
+    open.add_cond()->set_condition_key(
+        ::Mysqlx::Expect::Open::Condition::EXPECT_NO_ERROR);
+
+    check_error_and_throw(protocol.send(open));
+
+    m_pipeline_open_pending = true;
+    m_pipeline_failed = false;
+  }
+
+  try {
+    check_error_and_throw(protocol.send(msg));
+  } catch (...) {
+    if (m_pipeline.empty() && m_pipeline_open_pending) {
+      // the expectation block was opened for this statement, nothing is going
+      // to receive the response, close the block (if connection is still up),
+      // so that the responses to the next queries are not mismatched
+      m_pipeline_open_pending = false;
+
+      if (!protocol.recv_ok() && !protocol.send(::Mysqlx::Expect::Close())) {
+        protocol.recv_ok();
+      }
+    }
+
+    throw;
+  }
+
+  std::shared_ptr<Pipelined_result> result{
+      new Pipelined_result(shared_from_this())};
+  m_pipeline.emplace_back(result);
+
+  return result;
+}
+
+std::shared_ptr<Pipelined_result> XSession_impl::execute_async(
+    const ::Mysqlx::Crud::Insert &msg, size_t max_in_flight) {
+  return send_pipelined(msg, max_in_flight);
+}
+
+std::shared_ptr<Pipelined_result> XSession_impl::execute_async(
+    const ::Mysqlx::Crud::Update &msg, size_t max_in_flight) {
+  return send_pipelined(msg, max_in_flight);
+}
+
+std::shared_ptr<Pipelined_result> XSession_impl::execute_async(
+    const ::Mysqlx::Crud::Delete &msg, size_t max_in_flight) {
+  return send_pipelined(msg, max_in_flight);
+}
+
+std::shared_ptr<Pipelined_result> XSession_impl::execute_async(
+    const ::Mysqlx::Sql::StmtExecute &msg, size_t max_in_flight) {
+  auto log_sql_handler = shcore::current_log_sql();
+  log_sql_handler->log(get_thread_id(), msg.stmt());
+  DBUG_LOG("sqlall", get_thread_id() << ": QUERY: " << msg.stmt());
+
+  return send_pipelined(msg, max_in_flight);
+}
+
+void XSession_impl::recv_pipelined() {
+  assert(!m_pipeline.empty());
+
+  auto &protocol = _mysql->get_protocol();
+  const auto pending = m_pipeline.front();
+  m_pipeline.pop_front();
+
+  xcl::XError open_error;
+
+  if (m_pipeline_open_pending) {
+    m_pipeline_open_pending = false;
+    open_error = protocol.recv_ok();
+  }
+
+  xcl::XError error;
+  auto xresult = protocol.recv_resultset(&error);
+
+  if (open_error) error = open_error;
+
+  try {
+    if (error) throw Error(error.what(), error.error());
+
+    pending->m_result = after_query(std::move(xresult), true);
+  } catch (const Error &e) {
+    DBUG_LOG("sql", get_thread_id() << ": ERROR: " << e.format());
+    pending->m_error = std::make_unique<Error>(e);
+    m_pipeline_failed = true;
+  }
+
+  pending->m_ready = true;
+
+  if (m_pipeline.empty()) {
+    error = protocol.send(::Mysqlx::Expect::Close());
+
+    if (!error) error = protocol.recv_ok();
+
+    // if the expectation has failed, closing the block reports an error
+    if (!m_pipeline_failed) check_error_and_throw(error);
+  }
+}
+
+void XSession_impl::drain_pipeline() {
+  while (!m_pipeline.empty()) {
+    recv_pipelined();
+  }
+}
+
+std::shared_ptr<IResult> Pipelined_result::get() {
+  while (!m_ready) {
+    const auto session = m_session.lock();
+
+    if (!session) throw std::logic_error("Not connected");
+
+    session->recv_pipelined();
+  }
+
+  if (m_error) throw *m_error;
+
+  return m_result;
+}
+
 void XSession_impl::enable_notices(
     const std::vector<GlobalNotice::Type> &types) {
   if (!m_handler_installed) {
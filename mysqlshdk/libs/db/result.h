@@ -32,6 +32,7 @@
 #include <vector>
 #include "mysqlshdk/libs/db/column.h"
 #include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk/libs/db/row_batch.h"
 #include "mysqlshdk/libs/db/row_by_name.h"
 #include "mysqlshdk_export.h"
 
@@ -61,6 +62,33 @@ class SHCORE_PUBLIC IResult {
    */
   virtual const IRow *fetch_one() = 0;
 
+  /**
+   * Fetches up to max_rows rows from the resultset.
+   * @return Batch of rows, empty if there are no more rows
+   *
+   * The returned batch is only valid for as long as its result object
+   * is valid and up until the next call to fetch_batch() or fetch_one().
+   *
+   * Raw data of the fields can be accessed without a virtual call for each
+   * field, this is meant to be used by the loops which process large results.
+   *
+   * Batch may hold less than max_rows rows even if there are more rows to be
+   * fetched, i.e. unbuffered classic results return one row at a time.
+   */
+  virtual const Row_batch &fetch_batch(std::size_t max_rows) {
+    m_batch.reset(static_cast<uint32_t>(get_metadata().size()));
+
+    while (m_batch.size() < max_rows) {
+      const auto row = fetch_one();
+
+      if (!row) break;
+
+      m_batch.copy_row(*row);
+    }
+
+    return m_batch;
+  }
+
   Row_ref_by_name fetch_one_named() {
     return Row_ref_by_name(field_names(), fetch_one());
   }
@@ -113,6 +141,7 @@ class SHCORE_PUBLIC IResult {
 
  protected:
   double m_execution_time = 0.0;
+  Row_batch m_batch;
 };
 
 }  // namespace db
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/row_batch.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+constexpr std::size_t k_block_size = 64 * 1024;
+
+}  // namespace
+
+void Row_batch::reset(uint32_t num_fields) {
+  m_rows = 0;
+  m_num_fields = num_fields;
+
+  m_data.clear();
+  m_lengths.clear();
+
+  m_current_block = 0;
+  m_block_used = 0;
+}
+
+void Row_batch::add_row(const char *const *data, const unsigned long *lengths) {
+  m_data.insert(m_data.end(), data, data + m_num_fields);
+  m_lengths.insert(m_lengths.end(), lengths, lengths + m_num_fields);
+  ++m_rows;
+}
+
+void Row_batch::copy_row(const char *const *data,
+                         const unsigned long *lengths) {
+  for (uint32_t i = 0; i < m_num_fields; ++i) {
+    m_data.emplace_back(copy(data[i], lengths[i]));
+    m_lengths.emplace_back(data[i] ? lengths[i] : 0);
+  }
+
+  ++m_rows;
+}
+
+void Row_batch::copy_row(const IRow &row) {
+  assert(row.num_fields() == m_num_fields);
+
+  const char *data;
+  std::size_t length;
+
+  for (uint32_t i = 0; i < m_num_fields; ++i) {
+    row.get_raw_data(i, &data, &length);
+
+    m_data.emplace_back(copy(data, length));
+    m_lengths.emplace_back(data ? length : 0);
+  }
+
+  ++m_rows;
+}
+
+const char *Row_batch::copy(const char *data, std::size_t length) {
+  if (!data) {
+    return nullptr;
+  }
+
+  if (0 == length) {
+    return "";
+  }
+
+  while (m_current_block < m_blocks.size() &&
+         m_blocks[m_current_block].size - m_block_used < length) {
+    ++m_current_block;
+    m_block_used = 0;
+  }
+
+  if (m_current_block == m_blocks.size()) {
+    const auto size = std::max(k_block_size, length);
+    m_blocks.emplace_back(Block{std::make_unique<char[]>(size), size});
+    m_block_used = 0;
+  }
+
+  const auto ptr = m_blocks[m_current_block].data.get() + m_block_used;
+  std::memcpy(ptr, data, length);
+  m_block_used += length;
+
+  return ptr;
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
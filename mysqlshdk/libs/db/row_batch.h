@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Batch of rows fetched from a result, exposing raw field data without
+// dispatching through IRow for each field
+
+#ifndef MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
+#define MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mysqlshdk/include/mysqlshdk_export.h"
+#include "mysqlshdk/libs/db/row.h"
+
+namespace mysqlshdk {
+namespace db {
+
+/**
+ * Contiguous view of up to N rows, each field is stored as a (pointer, length)
+ * pair, NULL values have a null pointer.
+ *
+ * Field data either references buffers owned by the result (i.e. rows of a
+ * classic result), or is copied into memory owned by the batch. In both cases,
+ * data is valid for as long as its result object is valid and up until the next
+ * call to IResult::fetch_batch() or IResult::fetch_one().
+ */
+class SHCORE_PUBLIC Row_batch final {
+ public:
+  Row_batch() = default;
+
+  Row_batch(const Row_batch &) = delete;
+  Row_batch(Row_batch &&) = default;
+
+  Row_batch &operator=(const Row_batch &) = delete;
+  Row_batch &operator=(Row_batch &&) = default;
+
+  ~Row_batch() = default;
+
+  inline std::size_t size() const noexcept { return m_rows; }
+
+  inline bool empty() const noexcept { return 0 == m_rows; }
+
+  inline uint32_t num_fields() const noexcept { return m_num_fields; }
+
+  inline bool is_null(std::size_t row, uint32_t index) const noexcept {
+    return nullptr == m_data[offset(row, index)];
+  }
+
+  inline const char *data(std::size_t row, uint32_t index) const noexcept {
+    return m_data[offset(row, index)];
+  }
+
+  inline std::size_t length(std::size_t row, uint32_t index) const noexcept {
+    return m_lengths[offset(row, index)];
+  }
+
+  inline void get_raw_data(std::size_t row, uint32_t index,
+                           const char **out_data,
+                           std::size_t *out_size) const noexcept {
+    const auto idx = offset(row, index);
+    *out_data = m_data[idx];
+    *out_size = m_lengths[idx];
+  }
+
+  /**
+   * Removes all rows, sets the number of fields of the subsequent rows.
+   */
+  void reset(uint32_t num_fields);
+
+  /**
+   * Adds a row which references the given data, caller needs to make sure
+   * that it's valid for the lifetime of this batch.
+   */
+  void add_row(const char *const *data, const unsigned long *lengths);
+
+  /**
+   * Adds a copy of the given data.
+   */
+  void copy_row(const char *const *data, const unsigned long *lengths);
+
+  /**
+   * Adds a copy of raw data of the given row.
+   */
+  void copy_row(const IRow &row);
+
+ private:
+  inline std::size_t offset(std::size_t row, uint32_t index) const noexcept {
+    assert(row < m_rows);
+    assert(index < m_num_fields);
+    return row * m_num_fields + index;
+  }
+
+  const char *copy(const char *data, std::size_t length);
+
+  struct Block {
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+  };
+
+  std::size_t m_rows = 0;
+  uint32_t m_num_fields = 0;
+
+  std::vector<const char *> m_data;
+  std::vector<std::size_t> m_lengths;
+
+  // memory holding copied data, blocks are reused by the subsequent batches
+  std::vector<Block> m_blocks;
+  std::size_t m_current_block = 0;
+  std::size_t m_block_used = 0;
+};
+
+}  // namespace db
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_DB_ROW_BATCH_H_
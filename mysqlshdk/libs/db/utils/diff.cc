@@ -45,8 +45,6 @@ int compare_decimal_str(const std::string &n1, const std::string &n2) {
 }
 
 int compare_field(const IRow &lrow, const IRow &rrow, uint32_t field) {
-  assert(lrow.get_type(field) == rrow.get_type(field));
-
   if (lrow.is_null(field) && !rrow.is_null(field))
     return 1;
   else if (lrow.is_null(field) && rrow.is_null(field))
@@ -54,6 +52,12 @@ int compare_field(const IRow &lrow, const IRow &rrow, uint32_t field) {
   else if (rrow.is_null(field))
     return -1;
 
+  if (lrow.get_type(field) != rrow.get_type(field)) {
+    // i.e. column was altered, compare the text representation
+    const int r = lrow.get_as_string(field).compare(rrow.get_as_string(field));
+    return r < 0 ? -1 : (r > 0 ? 1 : 0);
+  }
+
   switch (lrow.get_type(field)) {
     case Type::Null:
       // not supposed to reach here
@@ -192,6 +196,17 @@ size_t find_different_row_fields(
   return c;
 }
 
+/**
+ * Results can be compared if they have the same number of fields. Other
+ * differences in metadata (i.e. type, length or collation of a field) do not
+ * prevent the comparison, values of such fields are reported as different if
+ * they differ.
+ */
+static void validate_fields(IResult *left, IResult *right) {
+  if (left->get_metadata().size() != right->get_metadata().size())
+    throw std::invalid_argument("Compared results have different fields");
+}
+
 static void reset_result(IResult *r) {
   Mutable_result *rs = dynamic_cast<Mutable_result *>(r);
   if (rs != nullptr) rs->reset();
@@ -219,8 +234,7 @@ size_t find_different_rows(
     IResult *left, IResult *right,
     std::function<bool(const IRow *, const IRow *, Row_difference)> callback,
     bool call_on_identical) {
-  if (left->get_metadata() != right->get_metadata())
-    throw std::invalid_argument("Compared results have different fields");
+  validate_fields(left, right);
 
   std::unique_ptr<IResult, void (*)(IResult *)> lr(left, reset_result);
   std::unique_ptr<IResult, void (*)(IResult *)> rr(right, reset_result);
@@ -257,8 +271,7 @@ size_t find_different_rows(
                        Row_difference)>
         callback,
     bool call_on_identical) {
-  if (left->get_metadata() != right->get_metadata())
-    throw std::invalid_argument("Compared results have different fields");
+  validate_fields(left, right);
 
   std::unique_ptr<IResult, void (*)(IResult *)> lr(left, reset_result);
   std::unique_ptr<IResult, void (*)(IResult *)> rr(right, reset_result);
@@ -352,8 +365,7 @@ size_t find_different_rows_with_key_indexes(
     IResult *left, IResult *right, const std::vector<uint32_t> &key_fields,
     std::function<bool(const IRow *, const IRow *, Row_difference)> callback,
     bool call_on_identical) {
-  if (left->get_metadata() != right->get_metadata())
-    throw std::invalid_argument("Compared results have different fields");
+  validate_fields(left, right);
 
   std::vector<bool> keys(left->get_metadata().size(), false);
   for (auto i : key_fields) {
@@ -372,8 +384,7 @@ size_t find_different_rows_with_key_names(
     const std::vector<std::string> &key_field_names,
     std::function<bool(const IRow *, const IRow *, Row_difference)> callback,
     bool call_on_identical) {
-  if (left->get_metadata() != right->get_metadata())
-    throw std::invalid_argument("Compared results have different fields");
+  validate_fields(left, right);
 
   std::vector<bool> keys(left->get_metadata().size(), false);
   std::size_t c = 0;
@@ -403,8 +414,7 @@ size_t find_different_rows_with_key_names(
                        Row_difference)>
         callback,
     bool call_on_identical) {
-  if (left->get_metadata() != right->get_metadata())
-    throw std::invalid_argument("Compared results have different fields");
+  validate_fields(left, right);
 
   std::vector<bool> keys(left->get_metadata().size(), false);
   std::size_t c = 0;
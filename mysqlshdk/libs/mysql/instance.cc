@@ -28,6 +28,7 @@
 #include <map>
 #include <string_view>
 #include <utility>
+#include <variant>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/utils/logger.h"
@@ -74,6 +75,7 @@ void Instance::register_warnings_callback(const Warnings_callback &callback) {
 void Instance::refresh() {
   m_uuid.clear();
   m_group_name.clear();
+  clear_sysvars_cache();
 }
 
 std::string Instance::descr() const { return get_canonical_address(); }
@@ -235,6 +237,7 @@ void Instance::set_sysvar(const std::string &name, const std::string &value,
   set_stmt.done();
 
   query(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -260,6 +263,7 @@ void Instance::set_sysvar_default(const std::string &name,
   set_stmt.done();
 
   query(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -287,6 +291,7 @@ void Instance::set_sysvar(const std::string &name, const int64_t value,
   set_stmt.done();
 
   query(set_stmt);
+  invalidate_sysvar(name);
 }
 
 /**
@@ -315,6 +320,107 @@ void Instance::set_sysvar(const std::string &name, const bool value,
   set_stmt.done();
 
   query(set_stmt);
+  invalidate_sysvar(name);
+}
+
+void Instance::set_sysvars(
+    const std::vector<Sysvar_assignment> &assignments) const {
+  if (assignments.empty()) return;
+
+  std::string set_stmt = "SET ";
+
+  for (const auto &assignment : assignments) {
+    std::string assignment_fmt;
+    if (assignment.qualifier == Var_qualifier::GLOBAL)
+      assignment_fmt = "GLOBAL ! = ?";
+    else if (assignment.qualifier == Var_qualifier::PERSIST)
+      assignment_fmt = "PERSIST ! = ?";
+    else if (assignment.qualifier == Var_qualifier::PERSIST_ONLY)
+      assignment_fmt = "PERSIST_ONLY ! = ?";
+    else
+      assignment_fmt = "SESSION ! = ?";
+
+    shcore::sqlstring assignment_stmt{assignment_fmt.c_str(), 0};
+    assignment_stmt << assignment.name;
+
+    if (const auto value = std::get_if<bool>(&assignment.value)) {
+      assignment_stmt << (*value ? "ON" : "OFF");
+    } else if (const auto value = std::get_if<int64_t>(&assignment.value)) {
+      assignment_stmt << *value;
+    } else {
+      assignment_stmt << std::get<std::string>(assignment.value);
+    }
+
+    assignment_stmt.done();
+
+    if (&assignment != &assignments.front()) set_stmt += ", ";
+    set_stmt += assignment_stmt.str();
+  }
+
+  // invalidate first, some of the variables may have been set even if the
+  // statement fails
+  for (const auto &assignment : assignments) {
+    invalidate_sysvar(assignment.name);
+  }
+
+  query(set_stmt);
+}
+
+void Instance::prefetch_sysvars(const std::vector<std::string> &names,
+                                const Var_qualifier scope) const {
+  if (names.empty()) return;
+
+  std::string query_format;
+  if (scope == Var_qualifier::GLOBAL)
+    query_format = "show GLOBAL variables where ! in (";
+  else if (scope == Var_qualifier::SESSION)
+    query_format = "show SESSION variables where ! in (";
+  else
+    throw std::runtime_error(
+        "Invalid variable scope to get variables value, "
+        "only GLOBAL and SESSION is supported.");
+
+  query_format += shcore::str_join(std::vector<std::string>(names.size(), "?"),
+                                   ", ") +
+                  ")";
+
+  shcore::sqlstring query(query_format.c_str(), 0);
+  query << "variable_name";
+
+  for (const auto &name : names) {
+    query << name;
+  }
+
+  query.done();
+
+  auto result = this->query(query);
+  auto &cache = sysvars_cache(scope);
+
+  // variables which are not returned do not exist
+  for (const auto &name : names) {
+    cache[name] = std::nullopt;
+  }
+
+  while (const auto row = result->fetch_one()) {
+    auto &value = cache[row->get_string(0)];
+
+    if (!row->is_null(1)) value = row->get_string(1);
+  }
+}
+
+void Instance::clear_sysvars_cache() const {
+  m_global_sysvars.clear();
+  m_session_sysvars.clear();
+}
+
+void Instance::invalidate_sysvar(const std::string &name) const {
+  m_global_sysvars.erase(name);
+  m_session_sysvars.erase(name);
+}
+
+Instance::Sysvars_cache &Instance::sysvars_cache(
+    const Var_qualifier scope) const {
+  return Var_qualifier::SESSION == scope ? m_session_sysvars : m_global_sysvars;
 }
 
 std::optional<std::string> Instance::get_system_variable(
@@ -329,6 +435,13 @@ std::optional<std::string> Instance::get_system_variable(
         "Invalid variable scope to get variables value, "
         "only GLOBAL and SESSION is supported.");
 
+  {
+    const auto &cache = sysvars_cache(scope);
+    const auto it = cache.find(std::string{name});
+
+    if (cache.end() != it) return it->second;
+  }
+
   query << "variable_name" << name;
   query.done();
 
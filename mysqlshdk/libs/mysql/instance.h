@@ -32,11 +32,13 @@
 #include <string_view>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "mysqlshdk/libs/db/result.h"
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/mysql/user_privileges.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/libs/utils/version.h"
 
 using Warnings_callback =
@@ -57,6 +59,16 @@ enum class Var_qualifier {
   PERSIST_ONLY,
 };
 
+/**
+ * Assignment of a value to a system variable, boolean values are set as
+ * ON/OFF.
+ */
+struct Sysvar_assignment {
+  std::string name;
+  std::variant<std::string, int64_t, bool> value;
+  Var_qualifier qualifier = Var_qualifier::GLOBAL;
+};
+
 struct Auth_options {
   std::string user;
   std::optional<std::string> password;
@@ -165,6 +177,13 @@ class IInstance {
   virtual void set_sysvar_default(
       const std::string &name,
       const Var_qualifier scope = Var_qualifier::GLOBAL) const = 0;
+  virtual void set_sysvars(
+      const std::vector<Sysvar_assignment> &assignments) const = 0;
+
+  virtual void prefetch_sysvars(
+      const std::vector<std::string> &names,
+      const Var_qualifier scope = Var_qualifier::GLOBAL) const = 0;
+  virtual void clear_sysvars_cache() const = 0;
 
   virtual bool has_variable_compiled_value(const std::string &name) const = 0;
   virtual bool is_performance_schema_enabled() const = 0;
@@ -412,6 +431,34 @@ class Instance : public IInstance {
       const std::string &name,
       const Var_qualifier qualifier = Var_qualifier::GLOBAL) const override;
 
+  /**
+   * Sets all the given system variables using a single SET statement. If any
+   * of the assignments fails, the whole statement fails.
+   *
+   * @param assignments Variables to be set, in order of assignment.
+   */
+  void set_sysvars(
+      const std::vector<Sysvar_assignment> &assignments) const override;
+
+  /**
+   * Fetches the values of the given system variables using a single query.
+   * Until a variable is set using this instance, clear_sysvars_cache() or
+   * refresh() is called, get_sysvar_*() methods are going to return the
+   * fetched value instead of querying the server. Variables which do not
+   * exist are cached as well.
+   *
+   * @param names Names of the system variables.
+   * @param scope GLOBAL or SESSION.
+   */
+  void prefetch_sysvars(
+      const std::vector<std::string> &names,
+      const Var_qualifier scope = Var_qualifier::GLOBAL) const override;
+
+  /**
+   * Removes the values fetched by prefetch_sysvars().
+   */
+  void clear_sysvars_cache() const override;
+
   bool has_variable_compiled_value(const std::string &name) const override;
   bool is_performance_schema_enabled() const override;
   bool is_ssl_enabled() const override;
@@ -518,6 +565,13 @@ class Instance : public IInstance {
   void process_result_warnings(const std::string &sql,
                                mysqlshdk::db::IResult &result) const;
 
+  void invalidate_sysvar(const std::string &name) const;
+
+  using Sysvars_cache = std::map<std::string, std::optional<std::string>,
+                                 shcore::Case_insensitive_comparator>;
+
+  Sysvars_cache &sysvars_cache(const Var_qualifier scope) const;
+
  private:
   std::shared_ptr<db::ISession> _session;
   mutable mysqlshdk::utils::Version _version;
@@ -532,6 +586,8 @@ class Instance : public IInstance {
   mutable uint32_t m_server_id = 0;
   int m_sql_binlog_suppress_count = 0;
   Warnings_callback m_warnings_callback = nullptr;
+  mutable Sysvars_cache m_global_sysvars;
+  mutable Sysvars_cache m_session_sysvars;
 };
 
 }  // namespace mysql
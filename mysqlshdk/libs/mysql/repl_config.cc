@@ -306,6 +306,16 @@ void check_server_variables_compatibility(
     }
   }
 
+  // fetch all the variables at once
+  std::vector<std::string> names;
+  names.reserve(requirements.size());
+
+  for (const auto &req : requirements) {
+    names.emplace_back(std::get<0>(req));
+  }
+
+  const auto clear_prefetched = prefetch_server_variables(config, names);
+
   for (auto &req : requirements) {
     std::string var_name;
     std::vector<std::string> valid_values;
@@ -498,5 +508,28 @@ void check_log_bin_compatibility(const mysqlshdk::mysql::IInstance &instance,
   }
 }
 
+shcore::on_leave_scope prefetch_server_variables(
+    const mysqlshdk::config::Config &config,
+    const std::vector<std::string> &names) {
+  if (!config.has_handler(mysqlshdk::config::k_dft_cfg_server_handler)) {
+    return {};
+  }
+
+  const auto srv_cfg_handler =
+      dynamic_cast<mysqlshdk::config::Config_server_handler *>(
+          config.get_handler(mysqlshdk::config::k_dft_cfg_server_handler));
+
+  // prefetching is just an optimization, skip it if the server handler is
+  // not a Config_server_handler
+  if (!srv_cfg_handler) {
+    return {};
+  }
+
+  srv_cfg_handler->prefetch(names);
+
+  return shcore::on_leave_scope(
+      [srv_cfg_handler]() { srv_cfg_handler->clear_prefetched(); });
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
@@ -124,6 +124,20 @@ void check_log_bin_compatibility(const mysqlshdk::mysql::IInstance &instance,
                                  const mysqlshdk::config::Config &config,
                                  std::vector<Invalid_config> *out_invalid_vec);
 
+/**
+ * Fetches the given variables using a single query, if the config has a
+ * server handler. Until the returned guard goes out of scope, these variables
+ * are read through the handler without querying the server.
+ *
+ * @param config Config object holding the server handler.
+ * @param names Names of the variables to fetch.
+ *
+ * @returns guard which discards the fetched values
+ */
+[[nodiscard]] shcore::on_leave_scope prefetch_server_variables(
+    const mysqlshdk::config::Config &config,
+    const std::vector<std::string> &names);
+
 }  // namespace mysql
 }  // namespace mysqlshdk
 
@@ -27,6 +27,81 @@
 namespace mysqlshdk {
 namespace parser {
 
+namespace internal {
+
+Parser_instance::Parser_instance()
+    : m_lexer(&m_input),
+      m_tokens(&m_lexer),
+      m_parser(&m_tokens),
+      m_bail_strategy(std::make_shared<antlr4::BailErrorStrategy>()),
+      m_default_strategy(std::make_shared<antlr4::DefaultErrorStrategy>()) {
+  m_lexer.removeErrorListeners();
+  m_lexer.addErrorListener(&m_error_listener);
+}
+
+void Parser_instance::load(const std::string &sql) {
+  m_parser.reset();
+  m_lexer.reset();
+  m_input.load(sql);
+  m_lexer.setInputStream(&m_input);
+  m_tokens.setTokenSource(&m_lexer);
+  m_parser.setTokenStream(&m_tokens);
+}
+
+parsers::MySQLParser::QueryContext *Parser_instance::parse_query() {
+  const auto interpreter =
+      m_parser.getInterpreter<antlr4::atn::ParserATNSimulator>();
+
+  // first stage: SLL prediction, bail out on the first error without
+  // reporting it, the statement may still be valid
+  interpreter->setPredictionMode(antlr4::atn::PredictionMode::SLL);
+  m_parser.setErrorHandler(m_bail_strategy);
+  m_parser.removeErrorListeners();
+
+  try {
+    return m_parser.query();
+  } catch (const antlr4::ParseCancellationException &) {
+    // fall back to the second stage
+  }
+
+  // second stage: full LL prediction, tokens are already buffered, rewind them
+  m_parser.reset();
+  interpreter->setPredictionMode(antlr4::atn::PredictionMode::LL);
+  m_parser.setErrorHandler(m_default_strategy);
+  m_parser.addErrorListener(&m_error_listener);
+
+  return m_parser.query();
+}
+
+void Parser_pool::Release::operator()(Parser_instance *instance) const {
+  auto &pool = get();
+  std::lock_guard lock{pool.m_mutex};
+  pool.m_instances.emplace_back(instance);
+}
+
+Parser_pool::Handle Parser_pool::acquire() {
+  auto &pool = get();
+
+  {
+    std::lock_guard lock{pool.m_mutex};
+
+    if (!pool.m_instances.empty()) {
+      auto instance = std::move(pool.m_instances.back());
+      pool.m_instances.pop_back();
+      return Handle{instance.release()};
+    }
+  }
+
+  return Handle{new Parser_instance()};
+}
+
+Parser_pool &Parser_pool::get() {
+  static Parser_pool s_pool;
+  return s_pool;
+}
+
+}  // namespace internal
+
 void prepare_lexer_parser(parsers::MySQLLexer *lexer,
                           parsers::MySQLParser *parser,
                           const mysqlshdk::utils::Version &mysql_version,
@@ -51,31 +126,23 @@ void prepare_lexer_parser(parsers::MySQLLexer *lexer,
 void check_sql_syntax(const std::string &script,
                       const mysqlshdk::utils::Version &mysql_version,
                       bool ansi_quotes, bool no_backslash_escapes) {
-  antlr4::ANTLRInputStream input;
-  parsers::MySQLLexer lexer(&input);
-  antlr4::CommonTokenStream tokens(&lexer);
-  parsers::MySQLParser parser(&tokens);
+  const auto instance = internal::Parser_pool::acquire();
+  const auto parser = instance->parser();
 
   // TODO(alfredo) stop forcing ansi_quotes when parser fixed
-  prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes || true,
-                       no_backslash_escapes);
+  prepare_lexer_parser(instance->lexer(), parser, mysql_version,
+                       ansi_quotes || true, no_backslash_escapes);
+
+  // only the syntax is checked, parse tree is not needed
+  parser->setBuildParseTree(false);
 
   std::stringstream stream(script);
   mysqlshdk::utils::iterate_sql_stream(
       &stream, 4098,
       [&](std::string_view stmt, std::string_view /*delim*/, size_t /*lnum*/,
           size_t /* offs */) {
-        internal::ParserErrorListener error_listener;
-        parser.reset();
-        lexer.reset();
-        lexer.addErrorListener(&error_listener);
-        parser.addErrorListener(&error_listener);
-        input.load(std::string(stmt));
-        lexer.setInputStream(&input);
-        tokens.setTokenSource(&lexer);
-        parser.setTokenStream(&tokens);
-
-        parser.query();
+        instance->load(std::string(stmt));
+        instance->parse_query();
 
         return true;
       },
@@ -26,6 +26,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -158,6 +159,78 @@ class ParserErrorListener : public antlr4::BaseErrorListener {
   }
 };
 
+/**
+ * Lexer and parser which are reused to parse multiple statements. The ATN and
+ * the DFA cache are shared by all instances.
+ */
+class Parser_instance final {
+ public:
+  Parser_instance();
+
+  Parser_instance(const Parser_instance &) = delete;
+  Parser_instance(Parser_instance &&) = delete;
+
+  Parser_instance &operator=(const Parser_instance &) = delete;
+  Parser_instance &operator=(Parser_instance &&) = delete;
+
+  ~Parser_instance() = default;
+
+  parsers::MySQLLexer *lexer() { return &m_lexer; }
+
+  parsers::MySQLParser *parser() { return &m_parser; }
+
+  /**
+   * Resets the state of lexer and parser, and sets the statement to be parsed.
+   */
+  void load(const std::string &sql);
+
+  /**
+   * Parses the loaded statement. The SLL prediction mode is used first, it is
+   * much faster but can fail on some valid input. Only if it fails, the
+   * statement is parsed again using the full LL prediction mode, which reports
+   * the syntax errors.
+   *
+   * The returned tree is valid until the next call to load().
+   *
+   * @throws Sql_syntax_error if the statement is not valid
+   */
+  parsers::MySQLParser::QueryContext *parse_query();
+
+ private:
+  ParserErrorListener m_error_listener;
+  antlr4::ANTLRInputStream m_input;
+  parsers::MySQLLexer m_lexer;
+  antlr4::CommonTokenStream m_tokens;
+  parsers::MySQLParser m_parser;
+  std::shared_ptr<antlr4::ANTLRErrorStrategy> m_bail_strategy;
+  std::shared_ptr<antlr4::ANTLRErrorStrategy> m_default_strategy;
+};
+
+/**
+ * Pool of parser instances shared by all threads.
+ */
+class Parser_pool final {
+ private:
+  struct Release {
+    void operator()(Parser_instance *instance) const;
+  };
+
+ public:
+  using Handle = std::unique_ptr<Parser_instance, Release>;
+
+  /**
+   * Provides a parser instance, it's returned to the pool once the handle is
+   * released.
+   */
+  static Handle acquire();
+
+ private:
+  static Parser_pool &get();
+
+  std::mutex m_mutex;
+  std::vector<std::unique_ptr<Parser_instance>> m_instances;
+};
+
 }  // namespace internal
 
 void prepare_lexer_parser(parsers::MySQLLexer *lexer,
@@ -173,22 +246,16 @@ void traverse_script_ast(
     const std::function<T *(const AST_rule_node &, bool enter, T *)> &on_rule,
     const std::function<T *(const AST_terminal_node &, T *)> &on_term,
     const std::function<T *(const AST_error_node &, T *)> &on_error) {
-  antlr4::ANTLRInputStream input;
-  parsers::MySQLLexer lexer(&input);
-  antlr4::CommonTokenStream tokens(&lexer);
-  parsers::MySQLParser parser(&tokens);
+  const auto instance = internal::Parser_pool::acquire();
+  const auto parser = instance->parser();
 
-  internal::ParserErrorListener error_listener;
-  lexer.addErrorListener(&error_listener);
-  parser.addErrorListener(&error_listener);
-
-  prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes,
+  prepare_lexer_parser(instance->lexer(), parser, mysql_version, ansi_quotes,
                        no_backslash_escapes);
 
-  parser.setBuildParseTree(true);
+  parser->setBuildParseTree(true);
 
-  auto &rule_names = parser.getRuleNames();
-  auto &vocabulary = parser.getVocabulary();
+  auto &rule_names = parser->getRuleNames();
+  auto &vocabulary = parser->getVocabulary();
 
   std::stringstream stream(script);
   mysqlshdk::utils::iterate_sql_stream(
@@ -199,17 +266,12 @@ void traverse_script_ast(
 
         std::string sql(stmt);
 
-        parser.reset();
-        lexer.reset();
-        input.load(sql);
-        lexer.setInputStream(&input);
-        tokens.setTokenSource(&lexer);
-        parser.setTokenStream(&tokens);
+        instance->load(sql);
 
         on_stmt(sql, offs, true);
         internal::do_traverse_statement_ast(rule_names, vocabulary,
-                                            parser.query(), root_data, on_rule,
-                                            on_term, on_error);
+                                            instance->parse_query(), root_data,
+                                            on_rule, on_term, on_error);
         on_stmt(sql, offs, false);
         return true;
       },
@@ -228,25 +290,22 @@ void traverse_statement_ast(
     const std::function<T *(const AST_rule_node &, bool enter, T *)> &on_rule,
     const std::function<T *(const AST_terminal_node &, T *)> &on_term,
     const std::function<T *(const AST_error_node &, T *)> &on_error) {
-  antlr4::ANTLRInputStream input(stmt);
-  parsers::MySQLLexer lexer(&input);
-  antlr4::CommonTokenStream tokens(&lexer);
-  parsers::MySQLParser parser(&tokens);
-
-  internal::ParserErrorListener error_listener;
-  lexer.addErrorListener(&error_listener);
-  parser.addErrorListener(&error_listener);
+  const auto instance = internal::Parser_pool::acquire();
+  const auto parser = instance->parser();
 
-  prepare_lexer_parser(&lexer, &parser, mysql_version, ansi_quotes,
+  prepare_lexer_parser(instance->lexer(), parser, mysql_version, ansi_quotes,
                        no_backslash_escapes);
 
-  parser.setBuildParseTree(true);
+  parser->setBuildParseTree(true);
+
+  auto &rule_names = parser->getRuleNames();
+  auto &vocabulary = parser->getVocabulary();
 
-  auto &rule_names = parser.getRuleNames();
-  auto &vocabulary = parser.getVocabulary();
+  instance->load(stmt);
 
-  internal::do_traverse_statement_ast(rule_names, vocabulary, parser.query(),
-                                      root_data, on_rule, on_term, on_error);
+  internal::do_traverse_statement_ast(rule_names, vocabulary,
+                                      instance->parse_query(), root_data,
+                                      on_rule, on_term, on_error);
 }
 
 void check_sql_syntax(const std::string &script,
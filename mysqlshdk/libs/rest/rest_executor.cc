@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/rest/rest_executor.h"
+
+#include <algorithm>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/rest/error.h"
+#include "mysqlshdk/libs/rest/response.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace rest {
+
+namespace {
+
+constexpr std::size_t k_shared_executor_threads = 16;
+
+std::mutex g_shared_executor_mutex;
+std::weak_ptr<Rest_executor> g_shared_executor;
+
+shcore::Queue_priority queue_priority(Rest_executor::Priority priority) {
+  switch (priority) {
+    case Rest_executor::Priority::CLEANUP:
+      return shcore::Queue_priority::LOW;
+
+    case Rest_executor::Priority::PAR:
+      return shcore::Queue_priority::MEDIUM;
+  }
+
+  throw std::logic_error("Unknown priority");
+}
+
+}  // namespace
+
+Rest_executor::Rest_executor(std::size_t max_threads)
+    : m_max_threads(std::max<std::size_t>(1, max_threads)) {}
+
+Rest_executor::~Rest_executor() {
+  std::lock_guard lock{m_workers_mutex};
+
+  // shutdown guards have the lowest priority, all pending tasks are going to
+  // be executed first
+  m_tasks.shutdown(m_workers.size());
+
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+std::shared_ptr<Rest_executor> Rest_executor::shared() {
+  std::lock_guard lock{g_shared_executor_mutex};
+  auto executor = g_shared_executor.lock();
+
+  if (!executor) {
+    executor = std::make_shared<Rest_executor>(k_shared_executor_threads);
+    g_shared_executor = executor;
+  }
+
+  return executor;
+}
+
+std::size_t Rest_executor::threads() const {
+  std::lock_guard lock{m_workers_mutex};
+  return m_workers.size();
+}
+
+void Rest_executor::push(Priority priority, Task &&task) {
+  {
+    std::lock_guard lock{m_workers_mutex};
+
+    // start a new thread if there are not enough idle ones to handle all the
+    // pending tasks
+    if (m_tasks.size() >= m_idle_threads && m_workers.size() < m_max_threads) {
+      m_workers.emplace_back(
+          mysqlsh::spawn_scoped_thread([this]() { worker(); }));
+    }
+  }
+
+  m_tasks.push(std::move(task), queue_priority(priority));
+}
+
+void Rest_executor::worker() {
+  while (true) {
+    ++m_idle_threads;
+    auto task = m_tasks.pop();
+    --m_idle_threads;
+
+    if (!task.run) {
+      // shutdown guard
+      break;
+    }
+
+    execute(&task);
+  }
+}
+
+void Rest_executor::execute(Task *task) {
+  const auto retry_strategy = task->retry_strategy.get();
+
+  if (retry_strategy) {
+    retry_strategy->init();
+  }
+
+  while (true) {
+    try {
+      task->run();
+      return;
+    } catch (const Response_error &error) {
+      if (!retry_strategy ||
+          !retry_strategy->should_retry(error.status_code(), error)) {
+        task->fail(std::current_exception());
+        return;
+      }
+
+      log_info("RETRYING REST operation: %s", error.what());
+    } catch (const Connection_error &error) {
+      if (!retry_strategy || !retry_strategy->should_retry(error)) {
+        task->fail(std::current_exception());
+        return;
+      }
+
+      log_info("RETRYING REST operation: %s", error.what());
+    } catch (...) {
+      task->fail(std::current_exception());
+      return;
+    }
+
+    retry_strategy->wait_for_retry();
+  }
+}
+
+}  // namespace rest
+}  // namespace mysqlshdk
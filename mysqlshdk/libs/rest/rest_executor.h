@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_REST_REST_EXECUTOR_H_
+#define MYSQLSHDK_LIBS_REST_REST_EXECUTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/rest/retry_strategy.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace mysqlshdk {
+namespace rest {
+
+/**
+ * Executes REST operations asynchronously, using a bounded number of threads.
+ *
+ * Threads are started on demand, up to the given limit. Pending operations are
+ * executed in order of their priority. All pending operations are executed
+ * before the executor is destroyed.
+ */
+class Rest_executor final {
+ public:
+  /**
+   * Priority classes of the operations, higher priority operations are
+   * executed first.
+   */
+  enum class Priority {
+    CLEANUP,
+    PAR,
+  };
+
+  Rest_executor() = delete;
+
+  explicit Rest_executor(std::size_t max_threads);
+
+  Rest_executor(const Rest_executor &) = delete;
+  Rest_executor(Rest_executor &&) = delete;
+
+  Rest_executor &operator=(const Rest_executor &) = delete;
+  Rest_executor &operator=(Rest_executor &&) = delete;
+
+  ~Rest_executor();
+
+  /**
+   * Provides the executor shared by all the storage backends. The executor
+   * is alive as long as any of the callers holds a reference to it.
+   */
+  static std::shared_ptr<Rest_executor> shared();
+
+  /**
+   * Schedules an operation.
+   *
+   * @param priority Priority of the operation.
+   * @param operation Operation to be executed.
+   * @param retry_strategy If set, operation is retried if it throws a
+   *        Response_error or a Connection_error which is retriable according
+   *        to this strategy.
+   *
+   * @returns future holding the result of the operation
+   */
+  template <typename F>
+  auto submit(Priority priority, F &&operation,
+              std::unique_ptr<Retry_strategy> retry_strategy = {}) {
+    using Result = std::invoke_result_t<std::decay_t<F> &>;
+
+    const auto promise = std::make_shared<std::promise<Result>>();
+    const auto callable = std::make_shared<std::decay_t<F>>(
+        std::forward<F>(operation));
+
+    Task task;
+
+    task.run = [promise, callable]() {
+      if constexpr (std::is_void_v<Result>) {
+        (*callable)();
+        promise->set_value();
+      } else {
+        promise->set_value((*callable)());
+      }
+    };
+    task.fail = [promise](std::exception_ptr e) {
+      promise->set_exception(std::move(e));
+    };
+    task.retry_strategy = std::move(retry_strategy);
+
+    auto future = promise->get_future();
+    push(priority, std::move(task));
+
+    return future;
+  }
+
+  std::size_t max_threads() const { return m_max_threads; }
+
+  /**
+   * Number of threads which were started so far.
+   */
+  std::size_t threads() const;
+
+ private:
+  struct Task {
+    std::function<void()> run;
+    std::function<void(std::exception_ptr)> fail;
+    std::unique_ptr<Retry_strategy> retry_strategy;
+  };
+
+  void push(Priority priority, Task &&task);
+
+  void worker();
+
+  static void execute(Task *task);
+
+  const std::size_t m_max_threads;
+  std::atomic<std::size_t> m_idle_threads{0};
+  mutable std::mutex m_workers_mutex;
+  std::vector<std::thread> m_workers;
+  shcore::Synchronized_queue<Task> m_tasks;
+};
+
+}  // namespace rest
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_REST_REST_EXECUTOR_H_
@@ -24,7 +24,11 @@
 #include "mysqlshdk/libs/rest/rest_service.h"
 
 #include <curl/curl.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -55,6 +59,141 @@ static constexpr auto k_application_json = "application/json";
 
 std::string get_user_agent() { return "mysqlsh/" MYSH_VERSION; }
 
+std::atomic<std::size_t> g_requests{0};
+std::atomic<std::size_t> g_connections{0};
+std::atomic<std::size_t> g_tls_handshakes{0};
+
+/**
+ * Data shared by all CURL handles: DNS cache and TLS sessions. Exists as long
+ * as there's at least one REST service.
+ *
+ * Connection cache is not shared, libcurl does not support using connections
+ * from the shared cache by handles which run concurrently in different
+ * threads. Each handle keeps its own connections alive, handles of services
+ * which no longer exist are pooled, so that new services can reuse their
+ * connections.
+ */
+class Curl_share final {
+ public:
+  Curl_share() : m_handle(curl_share_init()) {
+    if (!m_handle) {
+      throw std::runtime_error("Failed to initialize CURL share handle");
+    }
+
+    curl_share_setopt(m_handle, CURLSHOPT_LOCKFUNC, lock);
+    curl_share_setopt(m_handle, CURLSHOPT_UNLOCKFUNC, unlock);
+    curl_share_setopt(m_handle, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+
+  Curl_share(const Curl_share &) = delete;
+  Curl_share(Curl_share &&) = delete;
+
+  Curl_share &operator=(const Curl_share &) = delete;
+  Curl_share &operator=(Curl_share &&) = delete;
+
+  ~Curl_share() {
+    for (const auto handle : m_idle) {
+      curl_easy_cleanup(handle);
+    }
+
+    const std::size_t requests = g_requests;
+    const std::size_t connections = g_connections;
+
+    if (requests) {
+      log_debug(
+          "REST connections: %zu requests, %zu new connections (%.1f%% of "
+          "requests reused a connection), %zu TLS handshakes",
+          requests, connections,
+          connections >= requests
+              ? 0.0
+              : 100.0 * (requests - connections) / requests,
+          static_cast<std::size_t>(g_tls_handshakes));
+    }
+
+    curl_share_cleanup(m_handle);
+  }
+
+  static std::shared_ptr<Curl_share> get() {
+    static std::mutex s_mutex;
+    static std::weak_ptr<Curl_share> s_share;
+
+    std::lock_guard lock{s_mutex};
+    auto share = s_share.lock();
+
+    if (!share) {
+      share = std::make_shared<Curl_share>();
+      s_share = share;
+    }
+
+    return share;
+  }
+
+  CURLSH *handle() const { return m_handle; }
+
+  /**
+   * Provides a handle released by another service or a new one.
+   */
+  CURL *acquire() {
+    {
+      std::lock_guard lock{m_idle_mutex};
+
+      if (!m_idle.empty()) {
+        const auto handle = m_idle.back();
+        m_idle.pop_back();
+        return handle;
+      }
+    }
+
+    return curl_easy_init();
+  }
+
+  /**
+   * Puts the handle in the pool, its options are reset, live connections are
+   * kept.
+   */
+  void release(CURL *handle) {
+    if (!handle) {
+      return;
+    }
+
+    curl_easy_reset(handle);
+
+    {
+      std::lock_guard lock{m_idle_mutex};
+
+      if (m_idle.size() < k_max_idle_handles) {
+        m_idle.emplace_back(handle);
+        return;
+      }
+    }
+
+    curl_easy_cleanup(handle);
+  }
+
+ private:
+  static constexpr std::size_t k_max_idle_handles = 16;
+
+  static void lock(CURL *, curl_lock_data data, curl_lock_access,
+                   void *userptr) {
+    static_cast<Curl_share *>(userptr)->m_mutexes[data].lock();
+  }
+
+  static void unlock(CURL *, curl_lock_data data, void *userptr) {
+    static_cast<Curl_share *>(userptr)->m_mutexes[data].unlock();
+  }
+
+  CURLSH *m_handle;
+
+  std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+
+  std::mutex m_idle_mutex;
+
+  std::vector<CURL *> m_idle;
+};
+
 size_t request_callback(char *ptr, size_t size, size_t nitems, void *userdata) {
   // some older versions of CURL may call this callback when performing
   // POST-like request with Content-Length set to 0
@@ -212,7 +351,8 @@ class Rest_service::Impl {
    * Type of the HTTP request.
    */
   Impl(const Masked_string &base_url, bool verify, const std::string &label)
-      : m_handle(curl_easy_init(), &curl_easy_cleanup),
+      : m_share(Curl_share::get()),
+        m_handle(m_share->acquire(), &curl_easy_cleanup),
         m_base_url{base_url},
         m_request_sequence(0) {
     // Disable signal handlers used by libcurl, we're potentially going to use
@@ -225,6 +365,21 @@ class Rest_service::Impl {
     // introduce ourselves to the server
     curl_easy_setopt(m_handle.get(), CURLOPT_USERAGENT,
                      get_user_agent().c_str());
+    // reuse DNS entries and TLS sessions of other services
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, m_share->handle());
+#if LIBCURL_VERSION_NUM >= 0x072f00
+    // CURL_HTTP_VERSION_2TLS was added in libcurl 7.47.0, HTTP/2 is negotiated
+    // for HTTPS connections, this fails if libcurl does not support HTTP/2
+    if (const auto rc = curl_easy_setopt(m_handle.get(), CURLOPT_HTTP_VERSION,
+                                         CURL_HTTP_VERSION_2TLS);
+        CURLE_OK != rc) {
+      static std::once_flag s_logged;
+      std::call_once(s_logged, [rc]() {
+        log_info("HTTP/2 is not available, using HTTP/1.1: %s",
+                 curl_easy_strerror(rc));
+      });
+    }
+#endif
 
     mysqlshdk::db::uri::Generic_uri url;
     mysqlshdk::db::uri::Uri_parser parser(mysqlshdk::db::uri::Type::Generic);
@@ -270,7 +425,10 @@ class Rest_service::Impl {
         5, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890");
   }
 
-  ~Impl() = default;
+  ~Impl() {
+    // connections of this handle can be reused by other services
+    m_share->release(m_handle.release());
+  }
 
   void log_request(const Request &request) {
     if (shcore::current_logger()->get_log_level() >=
@@ -331,6 +489,9 @@ class Rest_service::Impl {
 
     // execute the request
     auto ret_val = curl_easy_perform(m_handle.get());
+
+    log_connection(m_request_sequence);
+
     if (ret_val != CURLE_OK) {
       log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
                 m_error_buffer, ret_val);
@@ -492,12 +653,60 @@ class Rest_service::Impl {
         header_list, &curl_slist_free_all};
   }
 
+  void log_connection(int sequence) {
+    long connections = 0;
+    curl_easy_getinfo(m_handle.get(), CURLINFO_NUM_CONNECTS, &connections);
+    double tls_handshake_time = 0.0;
+    curl_easy_getinfo(m_handle.get(), CURLINFO_APPCONNECT_TIME,
+                      &tls_handshake_time);
+    const auto tls_handshake = connections > 0 && tls_handshake_time > 0.0;
+
+    ++g_requests;
+    g_connections += connections;
+    if (tls_handshake) ++g_tls_handshakes;
+
+    if (shcore::current_logger()->get_log_level() >=
+        shcore::Logger::LOG_LEVEL::LOG_DEBUG2) {
+      long http_version = 0;
+#if LIBCURL_VERSION_NUM >= 0x073200
+      // CURLINFO_HTTP_VERSION was added in libcurl 7.50.0
+      curl_easy_getinfo(m_handle.get(), CURLINFO_HTTP_VERSION, &http_version);
+#endif
+
+      log_debug2("%s-%d: CONNECTION: %s%s, HTTP version: %s", m_id.c_str(),
+                 sequence, connections > 0 ? "new" : "reused",
+                 tls_handshake ? ", TLS handshake" : "",
+                 http_version_name(http_version));
+    }
+  }
+
+  static const char *http_version_name(long version) {
+    switch (version) {
+#if LIBCURL_VERSION_NUM >= 0x073200
+      case CURL_HTTP_VERSION_1_0:
+        return "1.0";
+
+      case CURL_HTTP_VERSION_1_1:
+        return "1.1";
+
+      case CURL_HTTP_VERSION_2_0:
+        return "2";
+#endif
+
+      default:
+        return "unknown";
+    }
+  }
+
   Response::Status_code get_status_code() const {
     long response_code = 0;
     curl_easy_getinfo(m_handle.get(), CURLINFO_RESPONSE_CODE, &response_code);
     return static_cast<Response::Status_code>(response_code);
   }
 
+  // needs to outlive the CURL handle
+  std::shared_ptr<Curl_share> m_share;
+
   std::unique_ptr<CURL, void (*)(CURL *)> m_handle;
 
   char m_error_buffer[CURL_ERROR_SIZE];
@@ -515,6 +724,16 @@ class Rest_service::Impl {
   long m_default_timeout;
 };
 
+Rest_service::Connection_stats Rest_service::connection_stats() {
+  Connection_stats stats;
+
+  stats.requests = g_requests;
+  stats.connections = g_connections;
+  stats.tls_handshakes = g_tls_handshakes;
+
+  return stats;
+}
+
 Rest_service::Rest_service(const Masked_string &base_url, bool verify_ssl,
                            const std::string &service_label)
     : m_impl(std::make_unique<Impl>(base_url, verify_ssl, service_label)) {}
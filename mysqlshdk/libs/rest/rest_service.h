@@ -24,6 +24,7 @@
 #ifndef MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 #define MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 
+#include <cstddef>
 #include <future>
 #include <memory>
 #include <string>
@@ -44,12 +45,33 @@ std::string type_name(Type t);
 class Retry_strategy;
 /**
  * A REST service. By default, requests will follow redirections and
- * keep the connections alive.
+ * keep the connections alive. DNS cache and TLS sessions are shared by all REST
+ * services, HTTP/2 is used if server supports it.
  *
  * This is a move-only type.
  */
 class Rest_service {
  public:
+  /**
+   * Statistics of the connections used by all REST services.
+   */
+  struct Connection_stats {
+    /**
+     * Number of executed requests.
+     */
+    std::size_t requests = 0;
+
+    /**
+     * Number of new connections which were established.
+     */
+    std::size_t connections = 0;
+
+    /**
+     * Number of performed TLS handshakes.
+     */
+    std::size_t tls_handshakes = 0;
+  };
+
   /**
    * Constructs an object which is going to handle requests to the REST service
    * located at the specified base URL.
@@ -187,6 +209,13 @@ class Rest_service {
    */
   Response::Status_code execute(Request *request, Response *response = nullptr);
 
+  /**
+   * Provides statistics of the connections used by all REST services.
+   *
+   * @returns Connection statistics.
+   */
+  static Connection_stats connection_stats();
+
  private:
   String_response execute_internal(Request *request);
 
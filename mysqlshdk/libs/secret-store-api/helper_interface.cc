@@ -262,6 +262,14 @@ class Helper_interface::Helper_interface_impl {
 
   Helper_name name() const noexcept { return m_invoker.name(); }
 
+  void set_persistent(bool persistent) noexcept {
+    try {
+      m_invoker.set_persistent(persistent);
+    } catch (const std::exception &ex) {
+      set_last_error(ex.what());
+    }
+  }
+
   bool store(const Secret_spec &spec, const std::string &secret) noexcept {
     try {
       validate_secret(spec.type, secret);
@@ -366,6 +374,10 @@ Helper_interface::~Helper_interface() noexcept = default;
 
 Helper_name Helper_interface::name() const noexcept { return m_impl->name(); }
 
+void Helper_interface::set_persistent(bool persistent) noexcept {
+  m_impl->set_persistent(persistent);
+}
+
 bool Helper_interface::store(const Secret_spec &spec,
                              const std::string &secret) noexcept {
   return m_impl->store(spec, secret);
@@ -23,6 +23,9 @@
 
 #include "mysqlshdk/libs/secret-store-api/helper_invoker.h"
 
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "mysqlshdk/libs/utils/process_launcher.h"
@@ -53,8 +56,113 @@ std::string hide_secret(const std::string &s) {
 
 }  // namespace
 
+/**
+ * Long-lived helper process, executes commands using the "serve" command of
+ * the helper.
+ */
+class Helper_invoker::Session final {
+ public:
+  explicit Session(const std::string &path)
+      : m_path(path), m_args{m_path.c_str(), "serve", nullptr}, m_app{m_args} {
+    logger::log("Starting helper session");
+    logger::log("  Command line: " + m_path + " serve");
+
+    m_app.start();
+  }
+
+  Session(const Session &) = delete;
+  Session(Session &&) = delete;
+
+  Session &operator=(const Session &) = delete;
+  Session &operator=(Session &&) = delete;
+
+  ~Session() {
+    try {
+      // helper exits once its input is closed
+      m_app.finish_writing();
+      const auto exit_code = m_app.wait();
+
+      logger::log("Helper session finished, exit code: " +
+                  std::to_string(exit_code));
+    } catch (const std::exception &ex) {
+      logger::log(std::string{"Failed to finish helper session: "} +
+                  ex.what());
+    }
+  }
+
+  bool invoke(const char *command, const std::string &input,
+              std::string *output) {
+    logger::log("Invoking helper session");
+    logger::log(std::string{"  Command: "} + command);
+    logger::log("  Input: " + hide_secret(input));
+
+    write(std::string{command} + ' ' + std::to_string(input.length()) + '\n');
+    write(input);
+
+    bool eof = false;
+    const auto header = m_app.read_line(&eof);
+    std::istringstream response{header};
+    int exit_code = 0;
+    std::size_t length = 0;
+
+    if (eof || !(response >> exit_code >> length)) {
+      throw std::runtime_error{"Invalid response: '" +
+                               shcore::str_strip(header) + "'"};
+    }
+
+    std::string data(length, '\0');
+
+    for (std::size_t offset = 0; offset < length;) {
+      const auto bytes = m_app.read(data.data() + offset, length - offset);
+
+      if (bytes <= 0) {
+        throw std::runtime_error{"Helper session has been closed"};
+      }
+
+      offset += bytes;
+    }
+
+    *output = shcore::str_strip(data);
+
+    logger::log("  Output: " + hide_secret(*output));
+    logger::log("  Exit code: " + std::to_string(exit_code));
+
+    return exit_code == 0;
+  }
+
+ private:
+  void write(const std::string &data) {
+    for (std::size_t offset = 0; offset < data.length();) {
+      const auto bytes =
+          m_app.write(data.c_str() + offset, data.length() - offset);
+
+      if (bytes <= 0) {
+        throw std::runtime_error{"Helper session has been closed"};
+      }
+
+      offset += bytes;
+    }
+  }
+
+  std::string m_path;
+  const char *const m_args[3];
+  shcore::Process_launcher m_app;
+};
+
 Helper_invoker::Helper_invoker(const Helper_name &name) : m_name{name} {}
 
+Helper_invoker::~Helper_invoker() = default;
+
+void Helper_invoker::set_persistent(bool persistent) {
+  std::lock_guard lock{m_session_mutex};
+
+  m_persistent = persistent;
+
+  if (!m_persistent) {
+    m_session.reset();
+  }
+}
+
 bool Helper_invoker::store(const std::string &input) const {
   std::string output;
   return store(input, &output);
@@ -94,6 +202,48 @@ bool Helper_invoker::version(std::string *output) const {
 
 bool Helper_invoker::invoke(const char *command, const std::string &input,
                             std::string *output) const {
+  {
+    std::lock_guard lock{m_session_mutex};
+
+    if (m_persistent && !m_session_unsupported) {
+      try {
+        return invoke_session(command, input, output);
+      } catch (const std::exception &ex) {
+        // start a new session next time, use a separate process this time
+        logger::log(std::string{"  Helper session failed: "} + ex.what());
+        m_session.reset();
+      }
+    }
+  }
+
+  return invoke_process(command, input, output);
+}
+
+bool Helper_invoker::invoke_session(const char *command,
+                                    const std::string &input,
+                                    std::string *output) const {
+  if (!m_session) {
+    auto session = std::make_unique<Session>(m_name.path());
+    std::string version;
+
+    try {
+      session->invoke("version", {}, &version);
+    } catch (const std::exception &) {
+      // helpers from older versions do not support the "serve" command
+      logger::log("  Helper does not support sessions");
+      m_session_unsupported = true;
+      throw;
+    }
+
+    m_session = std::move(session);
+  }
+
+  return m_session->invoke(command, input, output);
+}
+
+bool Helper_invoker::invoke_process(const char *command,
+                                    const std::string &input,
+                                    std::string *output) const {
   try {
     std::string path = m_name.path();
     const char *const args[] = {path.c_str(), command, nullptr};
@@ -24,6 +24,8 @@
 #ifndef MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 #define MYSQLSHDK_LIBS_SECRET_STORE_API_HELPER_INVOKER_H_
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
@@ -36,8 +38,23 @@ class Helper_invoker {
  public:
   explicit Helper_invoker(const Helper_name &name);
 
+  Helper_invoker(const Helper_invoker &) = delete;
+  Helper_invoker(Helper_invoker &&) = delete;
+
+  Helper_invoker &operator=(const Helper_invoker &) = delete;
+  Helper_invoker &operator=(Helper_invoker &&) = delete;
+
+  ~Helper_invoker();
+
   Helper_name name() const noexcept { return m_name; }
 
+  /**
+   * If set, a single helper process is started and used to execute all
+   * commands, instead of starting a new process for each command. If helper
+   * does not support this mode, a new process is started for each command.
+   */
+  void set_persistent(bool persistent);
+
   bool store(const std::string &input) const;
 
   bool store(const std::string &input, std::string *output) const;
@@ -55,9 +72,23 @@ class Helper_invoker {
   bool version(std::string *output) const;
 
  private:
+  class Session;
+
   bool invoke(const char *command, const std::string &input,
               std::string *output) const;
+
+  bool invoke_process(const char *command, const std::string &input,
+                      std::string *output) const;
+
+  bool invoke_session(const char *command, const std::string &input,
+                      std::string *output) const;
+
   Helper_name m_name;
+  bool m_persistent = false;
+  // helper does not support the persistent mode
+  mutable bool m_session_unsupported = false;
+  mutable std::unique_ptr<Session> m_session;
+  mutable std::mutex m_session_mutex;
 };
 
 }  // namespace api
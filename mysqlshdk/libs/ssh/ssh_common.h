@@ -57,6 +57,15 @@ void ssh_close_socket(int socket);
 
 std::string get_error();
 void set_socket_non_blocking(int sock);
+
+/**
+ * Creates a pair of connected, non-blocking sockets.
+ *
+ * @param sockets receives the sockets
+ *
+ * @throws Ssh_tunnel_exception if sockets could not be created
+ */
+void create_socket_pair(int sockets[2]);
 void init_libssh();
 
 enum class Ssh_return_type {
@@ -141,6 +150,12 @@ class Ssh_thread {
  protected:
   virtual void run() = 0;
 
+  /**
+   * Called by stop(), before waiting for the thread to finish. Descendants
+   * which can block in run() should use it to wake the thread up.
+   */
+  virtual void on_stop() {}
+
   std::atomic<bool> m_stop = {false};
   std::atomic<bool> m_finished = {true};
 
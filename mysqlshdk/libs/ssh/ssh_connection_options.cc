@@ -70,14 +70,15 @@ std::string Ssh_connection_options::key_file_uri() const {
 
 void Ssh_connection_options::set_default_data() {
   // Default values
-  if (!has_config_file()) {
-    auto options = mysqlsh::current_shell_options(true);
-    if (options) {
-      const auto &config_file = options->get().ssh.config_file;
-      if (!config_file.empty()) {
-        set_config_file(config_file);
-      }
+  if (const auto options = mysqlsh::current_shell_options(true)) {
+    const auto &ssh = options->get().ssh;
+
+    if (!has_config_file() && !ssh.config_file.empty()) {
+      set_config_file(ssh.config_file);
     }
+
+    if (ssh.buffer_size > 0) set_buffer_size(ssh.buffer_size);
+    set_tunnel_threads(ssh.tunnel_threads);
   }
 
   preload_ssh_config();
@@ -142,6 +143,7 @@ void Ssh_connection_options::dump_config() const {
   log_debug2("SSH: Connection config info:");
   log_debug2("SSH: connectTimeout: %zu", m_connection_timeout);
   log_debug2("SSH: bufferSize: %zu", m_buffer_size);
+  log_debug2("SSH: tunnelThreads: %zu", m_tunnel_threads);
   if (has_config_file())
     log_debug2("SSH: config file: %s", get_config_file().c_str());
   log_debug2("SSH: local host: %s", m_sourcehost.c_str());
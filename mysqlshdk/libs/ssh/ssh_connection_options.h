@@ -82,6 +82,8 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
 
   void set_buffer_size(std::size_t buffer_size) { m_buffer_size = buffer_size; }
 
+  void set_tunnel_threads(std::size_t threads) { m_tunnel_threads = threads; }
+
   void set_fingerprint(const std::string &fingerprint) {
     m_fingerprint = fingerprint;
   }
@@ -156,6 +158,8 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
 
   const std::size_t &get_buffer_size() const { return m_buffer_size; }
 
+  const std::size_t &get_tunnel_threads() const { return m_tunnel_threads; }
+
   const std::string &get_fingerprint() const { return m_fingerprint; }
 
   std::string get_server() const {
@@ -206,8 +210,9 @@ class Ssh_connection_options : public mysqlshdk::IConnection {
   std::string m_fingerprint;
   std::string m_key_password;
 
-  // Not really an SSH option, used to pass the configured shell option
-  std::size_t m_buffer_size = 10240;
+  // Not really SSH options, used to pass the configured shell options
+  std::size_t m_buffer_size = 65536;
+  std::size_t m_tunnel_threads = 1;
 };
 }  // namespace ssh
 }  // namespace mysqlshdk
@@ -172,7 +172,7 @@ Ssh_session::Ssh_session()
 Ssh_session::~Ssh_session() {}
 
 std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
-    const Ssh_connection_options &config) {
+    const Ssh_connection_options &config, bool interactive) {
   if (is_connected()) {
     throw std::logic_error(
         "Unable to connect already connected SSHSession, please disconnect "
@@ -181,7 +181,7 @@ std::tuple<Ssh_return_type, std::string> Ssh_session::connect(
 
   // auto lock = lock_session();
   m_options = config;
-  m_interactive = m_options.interactive();
+  m_interactive = interactive && m_options.interactive();
   // We need to set the host before reading the config, otherwise we will get
   // error. This will be of course overridden by optionsParseconfig
   try {
@@ -397,7 +397,7 @@ bool Ssh_session::open_channel(::ssh::Channel *chann) {
 void Ssh_session::clean_connect() {
   if (!ssh_is_connected(m_session->getCSession())) {
     disconnect();
-    connect(m_options);
+    connect(m_options, m_interactive);
   }
 }
 
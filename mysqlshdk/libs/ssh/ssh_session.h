@@ -70,11 +70,13 @@ class Ssh_session final {
    * handle fingerprint matching.
    *
    * @param config Ssh_connection_config
+   * @param interactive if false, user is not going to be prompted, even if
+   * the shell is running in interactive mode
    * @return tuple which holds return code and message assigned for the given
    * code.
    */
   std::tuple<Ssh_return_type, std::string> connect(
-      const Ssh_connection_options &config);
+      const Ssh_connection_options &config, bool interactive = true);
 
   void disconnect();
   bool is_connected() const;
@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/ssh/ssh_tunnel_handler.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,6 +41,9 @@ namespace mysqlshdk {
 namespace ssh {
 
 namespace {
+// event loop waits until there's something to do
+constexpr int k_wait_for_events = -1;
+
 int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
                     void *UNUSED(userdata)) {
   // the return should be:
@@ -50,6 +54,45 @@ int on_socket_event(socket_t UNUSED(fd), int UNUSED(revents),
   return 0;
 }
 
+int on_wakeup_event(socket_t fd, int UNUSED(revents), void *UNUSED(userdata)) {
+  char buff[64];
+
+  while (recv(fd, buff, sizeof(buff), 0) > 0) {
+  }
+
+  return 0;
+}
+
+void mark_channel_event(void *userdata) {
+  *static_cast<bool *>(userdata) = true;
+}
+
+int on_channel_data(ssh_session UNUSED(session), ssh_channel UNUSED(channel),
+                    void *UNUSED(data), uint32_t UNUSED(len),
+                    int UNUSED(is_stderr), void *userdata) {
+  mark_channel_event(userdata);
+  // data is left in the channel, it's going to be read by the event loop
+  return 0;
+}
+
+void on_channel_state(ssh_session UNUSED(session), ssh_channel UNUSED(channel),
+                      void *userdata) {
+  mark_channel_event(userdata);
+}
+
+// type of the 'bytes' argument differs between the libssh versions
+template <typename T>
+struct Write_wontblock;
+
+template <typename T>
+struct Write_wontblock<int (*)(ssh_session, ssh_channel, T, void *)> {
+  static int callback(ssh_session UNUSED(session), ssh_channel UNUSED(channel),
+                      T UNUSED(bytes), void *userdata) {
+    mark_channel_event(userdata);
+    return 0;
+  }
+};
+
 void cleanup_socket(ssh_event e, int sock,
                     std::unique_ptr<::ssh::Channel> chan) {
   ssh_event_remove_fd(e, sock);
@@ -57,38 +100,110 @@ void cleanup_socket(ssh_event e, int sock,
   ssh_close_socket(sock);
   chan.reset(nullptr);
 }
+
+std::size_t write_to_channel(::ssh::Channel *chan, const char *data,
+                             std::size_t length) {
+  int b_written = 0;
+
+  try {
+    b_written = chan->write(data, length);
+  } catch (::ssh::SshException &exc) {
+    throw Ssh_tunnel_exception(exc.getError());
+  }
+
+  // in non-blocking mode, only the data which fits into the remote window is
+  // written, which may be nothing at all; the window itself is managed by
+  // libssh and is not changed here
+  if (SSH_AGAIN == b_written) return 0;
+
+  if (b_written < 0) {
+    throw Ssh_tunnel_exception("unable to write, remote end disconnected");
+  }
+
+  return static_cast<std::size_t>(b_written);
+}
 }  // namespace
 
 Ssh_tunnel_handler::Ssh_tunnel_handler(uint16_t local_port, int local_socket,
                                        std::unique_ptr<Ssh_session> session)
     : m_session(std::move(session)),
       m_local_port(local_port),
-      m_local_socket(local_socket) {
+      m_local_socket(local_socket),
+      m_buffer(m_session->config().get_buffer_size()) {
+  if (m_buffer.empty()) m_buffer.resize(10240);
+
+  const auto cores = std::max(std::thread::hardware_concurrency(), 1u);
+  m_max_handlers = std::max<std::size_t>(
+      std::min<std::size_t>(m_session->config().get_tunnel_threads(), cores),
+      1);
+
+  memset(&m_channel_callbacks, 0, sizeof(m_channel_callbacks));
+  m_channel_callbacks.userdata = &m_channel_event;
+  m_channel_callbacks.channel_data_function = on_channel_data;
+  m_channel_callbacks.channel_eof_function = on_channel_state;
+  m_channel_callbacks.channel_close_function = on_channel_state;
+  m_channel_callbacks.channel_write_wontblock_function = Write_wontblock<
+      decltype(m_channel_callbacks.channel_write_wontblock_function)>::callback;
+  ssh_callbacks_init(&m_channel_callbacks);
+
+  create_socket_pair(m_wakeup_sockets);
+
   make_event();
 }
 
 Ssh_tunnel_handler::~Ssh_tunnel_handler() {
   stop();
+  m_handlers.clear();
+
   if (m_session) {
     cleanup_event();
     m_session->disconnect();
     m_session.reset();
   }
+
+  for (const auto sock : m_wakeup_sockets) {
+    if (sock != -1) ssh_close_socket(sock);
+  }
 }
 
 void Ssh_tunnel_handler::make_event() {
   m_event = ssh_event_new();
   ssh_event_add_session(m_event, m_session->get_csession());
+
+  if (ssh_event_add_fd(m_event, m_wakeup_sockets[0], POLLIN, on_wakeup_event,
+                       this) != SSH_OK) {
+    log_error(
+        "SSH: tunnel handler: Could not register wakeup event handler, new "
+        "connections may be delayed.");
+  }
 }
 
 void Ssh_tunnel_handler::cleanup_event() {
   if (m_event) {
+    ssh_event_remove_fd(m_event, m_wakeup_sockets[0]);
     ssh_event_remove_session(m_event, m_session->get_csession());
     ssh_event_free(m_event);
     m_event = nullptr;
   }
 }
 
+void Ssh_tunnel_handler::wakeup() {
+  const char byte = 0;
+  // if this fails, the socket is full and the event loop is going to wake up
+  // anyway
+  send(m_wakeup_sockets[1], &byte, 1, MSG_NOSIGNAL);
+}
+
+void Ssh_tunnel_handler::on_stop() {
+  wakeup();
+
+  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
+
+  for (const auto &handler : m_handlers) {
+    handler->stop();
+  }
+}
+
 int Ssh_tunnel_handler::local_socket() const { return m_local_socket; }
 
 int Ssh_tunnel_handler::local_port() const { return m_local_port; }
@@ -99,21 +214,16 @@ const Ssh_connection_options &Ssh_tunnel_handler::config() const {
 
 void Ssh_tunnel_handler::run() { handle_connection(); }
 
-// This is noop function so ssh_even_dopoll will exit once client socket will
-// have new data
-
 void Ssh_tunnel_handler::handle_connection() {
   log_debug3("SSH: tunnel handler: Start tunnel handler thread.");
   int rc = 0;
 
   do {
-    std::unique_lock<std::recursive_mutex> lock(m_new_connection_mtx);
-    if (!m_new_connection.empty()) {
-      prepare_tunnel(m_new_connection.front());
-      m_new_connection.pop();
-    }
-    lock.unlock();
-    rc = ssh_event_dopoll(m_event, 100);
+    prepare_new_tunnels();
+
+    // if a channel got data in the meantime, it needs to be handled without
+    // waiting for the socket events
+    rc = ssh_event_dopoll(m_event, m_channel_event ? 0 : k_wait_for_events);
 
     if (rc == SSH_ERROR) {
       auto ssh_error = m_session->get_ssh_error();
@@ -127,10 +237,7 @@ void Ssh_tunnel_handler::handle_connection() {
             "SSH: tunnel handler: There was an error handling connection poll, "
             "retrying");
 
-      for (auto &s_it : m_client_socket_list) {
-        cleanup_socket(m_event, s_it.first, std::move(s_it.second));
-      }
-      m_client_socket_list.clear();
+      close_all_tunnels();
 
       cleanup_event();
 
@@ -144,28 +251,46 @@ void Ssh_tunnel_handler::handle_connection() {
       continue;
     }
 
+    // channels can receive data while the other ones are being handled
+    m_channel_event = false;
+
     for (auto it = m_client_socket_list.begin();
          it != m_client_socket_list.end() && !m_stop;) {
       try {
-        transfer_data_from_client(it->first, it->second.get());
-        transfer_data_to_client(it->first, it->second.get());
+        if (!transfer_data_from_client(it->first, &it->second)) {
+          log_debug3("SSH: tunnel handler: Client disconnected.");
+          it = close_tunnel(it);
+          continue;
+        }
+
+        transfer_data_to_client(it->first, it->second.channel.get());
         ++it;
       } catch (const Ssh_tunnel_exception &exc) {
-        cleanup_socket(m_event, it->first, std::move(it->second));
-        it = m_client_socket_list.erase(it);
+        it = close_tunnel(it);
         log_error("SSH: tunnel handler: Error during data transfer: %s",
                   exc.what());
       }
     }
   } while (!m_stop);
 
-  for (auto &s_it : m_client_socket_list) {
-    cleanup_socket(m_event, s_it.first, std::move(s_it.second));
-  }
-  m_client_socket_list.clear();
+  close_all_tunnels();
   log_debug3("SSH: tunnel handler: Tunnel handler thread stopped.");
 }
 
+std::map<int, Ssh_tunnel_handler::Tunnel>::iterator
+Ssh_tunnel_handler::close_tunnel(std::map<int, Tunnel>::iterator it) {
+  cleanup_socket(m_event, it->first, std::move(it->second.channel));
+  --m_connections;
+  return m_client_socket_list.erase(it);
+}
+
+void Ssh_tunnel_handler::close_all_tunnels() {
+  for (auto it = m_client_socket_list.begin();
+       it != m_client_socket_list.end();) {
+    it = close_tunnel(it);
+  }
+}
+
 bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
   log_debug3("SSH: tunnel handler: About to handle new connection.");
   struct sockaddr_in client;
@@ -191,32 +316,122 @@ bool Ssh_tunnel_handler::handle_new_connection(int incoming_socket) {
     log_error("SSH: tunnel handler: Failed to set SO_NOSIGPIPE on socket");
 #endif
 
-  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
-  m_new_connection.push(client_sock);
+  const auto handler = select_handler();
+
+  {
+    std::lock_guard<std::recursive_mutex> guard(handler->m_new_connection_mtx);
+    handler->m_new_connection.push(client_sock);
+    ++handler->m_connections;
+  }
+
+  handler->wakeup();
+
   log_debug3("SSH: tunnel handler: Accepted new connection.");
   return true;
 }
 
-void Ssh_tunnel_handler::transfer_data_from_client(int sock,
-                                                   ::ssh::Channel *chan) {
-  ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
+Ssh_tunnel_handler *Ssh_tunnel_handler::select_handler() {
+  std::lock_guard<std::recursive_mutex> guard(m_new_connection_mtx);
 
-  while (!m_stop && (readlen = recv(sock, buff.data(), buff.size(), 0)) > 0) {
-    int b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
-         buff_ptr += b_written, readlen -= b_written) {
-      try {
-        b_written = chan->write(buff_ptr, readlen);
-        if (b_written <= 0) {
-          throw Ssh_tunnel_exception(
-              "unable to write, remote end disconnected");
-        }
-      } catch (::ssh::SshException &exc) {
-        throw Ssh_tunnel_exception(exc.getError());
-      }
+  Ssh_tunnel_handler *selected = this;
+
+  for (const auto &handler : m_handlers) {
+    if (handler->is_running() &&
+        handler->m_connections < selected->m_connections) {
+      selected = handler.get();
+    }
+  }
+
+  if (selected->m_connections > 0 && m_handlers.size() + 1 < m_max_handlers) {
+    if (auto handler = create_handler()) {
+      selected = handler.get();
+      m_handlers.emplace_back(std::move(handler));
+    } else {
+      // don't try again
+      m_max_handlers = m_handlers.size() + 1;
+    }
+  }
+
+  return selected;
+}
+
+std::unique_ptr<Ssh_tunnel_handler> Ssh_tunnel_handler::create_handler() {
+  log_debug2("SSH: tunnel handler: Starting additional tunnel handler.");
+
+  try {
+    auto session = std::make_unique<Ssh_session>();
+    // credentials were already provided, user is not prompted again
+    const auto ret_val = session->connect(m_session->config(), false);
+
+    if (Ssh_return_type::CONNECTED != std::get<0>(ret_val)) {
+      log_info(
+          "SSH: tunnel handler: Unable to open additional SSH connection, "
+          "connections to port %d are handled by %zu thread(s): %s",
+          static_cast<int>(m_local_port), m_handlers.size() + 1,
+          std::get<1>(ret_val).c_str());
+      return nullptr;
+    }
+
+    auto handler = std::make_unique<Ssh_tunnel_handler>(m_local_port, -1,
+                                                        std::move(session));
+    handler->start();
+    return handler;
+  } catch (const std::exception &e) {
+    log_info(
+        "SSH: tunnel handler: Unable to start additional tunnel handler: %s",
+        e.what());
+  }
+
+  return nullptr;
+}
+
+void Ssh_tunnel_handler::add_client_socket(int client_socket) {
+  if (ssh_event_add_fd(m_event, client_socket, POLLIN, on_socket_event,
+                       this) != SSH_OK) {
+    throw Ssh_tunnel_exception("could not register event handler");
+  }
+}
+
+bool Ssh_tunnel_handler::transfer_data_from_client(int sock, Tunnel *tunnel) {
+  // data which is still waiting for the window, needs to go first
+  if (!flush_pending_data(sock, tunnel)) return true;
+
+  ssize_t readlen = -1;
+
+  while (!m_stop && (readlen = recv(sock, m_buffer.data(), m_buffer.size(),
+                                    0)) > 0) {
+    const auto length = static_cast<std::size_t>(readlen);
+    const auto b_written =
+        write_to_channel(tunnel->channel.get(), m_buffer.data(), length);
+
+    if (b_written < length) {
+      // remote window is full, the rest is sent once it grows, client is not
+      // polled in the meantime
+      tunnel->pending.assign(m_buffer.data() + b_written,
+                             m_buffer.data() + length);
+      tunnel->pending_offset = 0;
+      ssh_event_remove_fd(m_event, sock);
+      break;
     }
   }
+
+  return readlen != 0;
+}
+
+bool Ssh_tunnel_handler::flush_pending_data(int sock, Tunnel *tunnel) {
+  if (tunnel->pending.empty()) return true;
+
+  tunnel->pending_offset += write_to_channel(
+      tunnel->channel.get(), tunnel->pending.data() + tunnel->pending_offset,
+      tunnel->pending.size() - tunnel->pending_offset);
+
+  if (tunnel->pending_offset < tunnel->pending.size()) return false;
+
+  tunnel->pending.clear();
+  tunnel->pending_offset = 0;
+  add_client_socket(sock);
+
+  return true;
 }
 
 namespace {
@@ -240,10 +455,9 @@ std::string err_code_to_string(int err) {
 void Ssh_tunnel_handler::transfer_data_to_client(int sock,
                                                  ::ssh::Channel *chan) {
   ssize_t readlen = 0;
-  std::vector<char> buff(m_session->config().get_buffer_size(), '\0');
   do {
     try {
-      readlen = chan->readNonblocking(buff.data(), buff.size());
+      readlen = chan->readNonblocking(m_buffer.data(), m_buffer.size());
     } catch (::ssh::SshException &exc) {
       throw Ssh_tunnel_exception(exc.getError());
     }
@@ -261,7 +475,7 @@ void Ssh_tunnel_handler::transfer_data_to_client(int sock,
     }
 
     ssize_t b_written = 0;
-    for (char *buff_ptr = buff.data(); readlen > 0 && !m_stop;
+    for (char *buff_ptr = m_buffer.data(); readlen > 0 && !m_stop;
          buff_ptr += b_written, readlen -= b_written) {
       do {
         b_written = send(sock, buff_ptr, readlen, MSG_NOSIGNAL);
@@ -312,37 +526,47 @@ std::unique_ptr<::ssh::Channel> Ssh_tunnel_handler::open_tunnel() {
   return channel;
 }
 
+void Ssh_tunnel_handler::prepare_new_tunnels() {
+  std::unique_lock<std::recursive_mutex> lock(m_new_connection_mtx);
+
+  while (!m_new_connection.empty()) {
+    const auto client_socket = m_new_connection.front();
+    m_new_connection.pop();
+
+    lock.unlock();
+    prepare_tunnel(client_socket);
+    lock.lock();
+  }
+}
+
 void Ssh_tunnel_handler::prepare_tunnel(int client_socket) {
   std::unique_ptr<::ssh::Channel> channel;
   try {
     channel = open_tunnel();
+    ssh_set_channel_callbacks(channel->getCChannel(), &m_channel_callbacks);
 
-    int16_t events = POLLIN;
-    if (ssh_event_add_fd(m_event, client_socket, events, on_socket_event,
-                         this) != SSH_OK) {
-      log_error(
-          "SSH: tunnel handler: Unable to open tunnel. Could not register "
-          "event handler.");
-      channel.reset();
-      ssh_close_socket(client_socket);
-    } else {
-      log_debug("SSH: tunnel handler: Tunnel created.");
-      m_client_socket_list.insert(
-          std::make_pair(client_socket, std::move(channel)));
-    }
+    add_client_socket(client_socket);
+
+    log_debug("SSH: tunnel handler: Tunnel created.");
+    m_client_socket_list[client_socket].channel = std::move(channel);
+    // server may have already sent something
+    m_channel_event = true;
+    return;
   } catch (const ssh::Ssh_tunnel_exception &exc) {
-    ssh_close_socket(client_socket);
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
         exc.what());
   } catch (::ssh::SshException &exc) {
-    ssh_close_socket(client_socket);
     log_error(
         "SSH: tunnel handler: Unable to open tunnel. Exception when opening "
         "tunnel: %s",
         exc.getError().c_str());
   }
+
+  channel.reset();
+  ssh_close_socket(client_socket);
+  --m_connections;
 }
 
 }  // namespace ssh
@@ -30,11 +30,13 @@
 #include <poll.h>
 #endif
 #include <string.h>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 #include "mysqlshdk/libs/ssh/ssh_common.h"
 #include "mysqlshdk/libs/ssh/ssh_session.h"
 
@@ -45,12 +47,16 @@ namespace ssh {
  * @brief Handle SSH data transfer between local port and remote port using
  * ssh::Channel.
  *
+ * Each handler runs an event loop serving its connections using a single SSH
+ * session. The handler which owns the local socket dispatches the incoming
+ * connections among itself and up to ssh.tunnelThreads - 1 additional
+ * handlers, each one having its own SSH session and thread.
  */
 class Ssh_tunnel_handler : public Ssh_thread {
  public:
   Ssh_tunnel_handler(uint16_t local_port, int local_socket,
                      std::unique_ptr<ssh::Ssh_session> session);
-  ~Ssh_tunnel_handler();
+  ~Ssh_tunnel_handler() override;
   int local_socket() const;
   int local_port() const;
   const Ssh_connection_options &config() const;
@@ -73,26 +79,61 @@ class Ssh_tunnel_handler : public Ssh_thread {
   }
 
  protected:
+  struct Tunnel {
+    std::unique_ptr<::ssh::Channel> channel;
+    // data received from the client which did not fit into the channel window
+    std::vector<char> pending;
+    std::size_t pending_offset = 0;
+  };
+
   void run() override;
+  void on_stop() override;
 
   std::unique_ptr<Ssh_session> m_session;
   uint16_t m_local_port;
   int m_local_socket;
-  std::map<int, std::unique_ptr<::ssh::Channel>> m_client_socket_list;
+  std::map<int, Tunnel> m_client_socket_list;
   ssh_event m_event = nullptr;
 
  private:
   void handle_connection();
-  void transfer_data_from_client(int sock, ::ssh::Channel *chan);
+  bool transfer_data_from_client(int sock, Tunnel *tunnel);
   void transfer_data_to_client(int sock, ::ssh::Channel *chan);
+  bool flush_pending_data(int sock, Tunnel *tunnel);
   std::unique_ptr<::ssh::Channel> open_tunnel();
   void prepare_tunnel(int client_socket);
+  void prepare_new_tunnels();
+  std::map<int, Tunnel>::iterator close_tunnel(
+      std::map<int, Tunnel>::iterator it);
+  void close_all_tunnels();
+  void add_client_socket(int client_socket);
   void make_event();
   void cleanup_event();
+  void wakeup();
+
+  Ssh_tunnel_handler *select_handler();
+  std::unique_ptr<Ssh_tunnel_handler> create_handler();
 
   std::recursive_mutex m_new_connection_mtx;
   std::queue<int> m_new_connection;
   std::atomic_int m_usage = 0;
+
+  // number of connections served by this handler, including the new ones
+  std::atomic<std::size_t> m_connections = 0;
+
+  // additional handlers serving connections of this tunnel
+  std::vector<std::unique_ptr<Ssh_tunnel_handler>> m_handlers;
+  std::size_t m_max_handlers = 1;
+
+  // wakes up the event loop, i.e. when there are new connections
+  int m_wakeup_sockets[2] = {-1, -1};
+
+  // set when a channel has data which was not transferred yet
+  bool m_channel_event = false;
+  ssh_channel_callbacks_struct m_channel_callbacks;
+
+  // used to transfer the data, shared by all connections of this handler
+  std::vector<char> m_buffer;
 };
 
 }  // namespace ssh
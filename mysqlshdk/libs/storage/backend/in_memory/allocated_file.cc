@@ -27,20 +27,35 @@
 #include <cstring>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/shexcept.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
 
 Allocated_file::Allocated_file(const std::string &name, Allocator *allocator,
-                               bool consume_if_first)
+                               bool consume_if_first,
+                               Virtual_fs::Spill *spill,
+                               std::chrono::milliseconds stall_timeout)
     : IFile(name),
       m_allocator(allocator),
       m_block_size(allocator->block_size()),
-      m_consume_if_first(consume_if_first) {}
+      m_consume_if_first(consume_if_first),
+      m_spill(spill),
+      m_stall_timeout(stall_timeout) {}
 
 Allocated_file::~Allocated_file() {
   m_allocator->free(m_blocks.begin(), m_blocks.end());
+
+  if (m_spill_file) {
+    m_spill_file.reset();
+    shcore::delete_file(m_spill_path);
+  }
 }
 
 void Allocated_file::open(bool read_mode) {
@@ -119,35 +134,47 @@ ssize_t Allocated_file::read(void *buffer, std::size_t length) {
     return 0;
   }
 
-  auto block_number = (m_offset - m_bytes_consumed) / m_block_size;
-  auto block_offset = m_offset - m_bytes_consumed - block_number * m_block_size;
-  decltype(block_offset) to_read = 0;
   auto char_buffer = static_cast<char *>(buffer);
   ssize_t result = 0;
 
-  while (length > 0 && m_offset != m_size) {
-    to_read = std::min(std::min(length, m_block_size - block_offset),
-                       m_size - m_offset);
+  if (m_offset < m_capacity) {
+    auto block_number = (m_offset - m_bytes_consumed) / m_block_size;
+    auto block_offset =
+        m_offset - m_bytes_consumed - block_number * m_block_size;
+    decltype(block_offset) to_read = 0;
+
+    while (length > 0 && m_offset != m_size && m_offset < m_capacity) {
+      to_read = std::min(std::min(length, m_block_size - block_offset),
+                         m_size - m_offset);
+
+      ::memcpy(char_buffer, m_blocks[block_number] + block_offset, to_read);
+
+      result += to_read;
+      m_offset += to_read;
+      char_buffer += to_read;
+      length -= to_read;
+
+      if (m_reading_from_beginning &&
+          (block_offset + to_read == m_block_size || m_offset == m_size)) {
+        // we're reading from the beginning and the whole block has been read,
+        // it can be discarded
+        m_bytes_consumed += m_block_size;
+        m_allocator->free(m_blocks.front());
+        m_blocks.pop_front();
+      } else {
+        ++block_number;
+      }
+
+      block_offset = 0;
+    }
+  }
 
-    ::memcpy(char_buffer, m_blocks[block_number] + block_offset, to_read);
+  if (length > 0 && m_offset != m_size) {
+    // the rest of the data is in the spill file
+    const auto to_read = read_spilled(char_buffer, length);
 
     result += to_read;
     m_offset += to_read;
-    char_buffer += to_read;
-    length -= to_read;
-
-    if (m_reading_from_beginning &&
-        (block_offset + to_read == m_block_size || m_offset == m_size)) {
-      // we're reading from the beginning and the whole block has been read, it
-      // can be discarded
-      m_bytes_consumed += m_block_size;
-      m_allocator->free(m_blocks.front());
-      m_blocks.pop_front();
-    } else {
-      ++block_number;
-    }
-
-    block_offset = 0;
   }
 
   return result;
@@ -164,31 +191,52 @@ ssize_t Allocated_file::write(const void *buffer, std::size_t length) {
                              ", it is opened for reading");
   }
 
-  if (m_capacity - m_offset < length) {
-    for (auto block : m_allocator->allocate(length - (m_capacity - m_offset))) {
+  if (!m_spill_file && m_capacity - m_offset < length) {
+    const auto missing = length - (m_capacity - m_offset);
+    std::vector<char *> blocks;
+
+    if (m_spill) {
+      blocks = m_allocator->try_allocate(missing);
+    } else {
+      try {
+        blocks = m_allocator->allocate(missing, m_stall_timeout);
+      } catch (const shcore::cancelled &) {
+        throw;
+      } catch (const std::runtime_error &e) {
+        throw std::runtime_error("Unable to write to file: " + name() + ", " +
+                                 e.what());
+      }
+    }
+
+    if (blocks.empty()) {
+      // memory limit was reached, rest of the file is going to be written to
+      // disk
+      start_spilling();
+    }
+
+    for (auto block : blocks) {
       m_blocks.emplace_back(block);
       m_capacity += m_block_size;
     }
   }
 
-  auto block_number = m_offset / m_block_size;
-  auto block_offset = m_offset - block_number * m_block_size;
-  decltype(block_offset) to_write = 0;
   auto char_buffer = static_cast<const char *>(buffer);
   const ssize_t result = length;
 
-  while (length > 0) {
-    to_write = std::min(length, m_block_size - block_offset);
+  if (m_offset < m_capacity) {
+    const auto to_write = std::min(length, m_capacity - m_offset);
 
-    ::memcpy(m_blocks[block_number] + block_offset, char_buffer, to_write);
+    write_memory(char_buffer, to_write);
 
     char_buffer += to_write;
     length -= to_write;
-    block_offset = 0;
-    ++block_number;
+    m_offset += to_write;
   }
 
-  m_offset += result;
+  if (length > 0) {
+    write_spilled(char_buffer, length);
+    m_offset += length;
+  }
 
   if (m_offset > m_size) {
     m_size = m_offset;
@@ -214,6 +262,69 @@ void Allocated_file::append(Scoped_data_block block) {
   block.relinquish();
 }
 
+void Allocated_file::write_memory(const char *buffer, std::size_t length) {
+  auto block_number = m_offset / m_block_size;
+  auto block_offset = m_offset - block_number * m_block_size;
+  decltype(block_offset) to_write = 0;
+
+  while (length > 0) {
+    to_write = std::min(length, m_block_size - block_offset);
+
+    ::memcpy(m_blocks[block_number] + block_offset, buffer, to_write);
+
+    buffer += to_write;
+    length -= to_write;
+    block_offset = 0;
+    ++block_number;
+  }
+}
+
+void Allocated_file::start_spilling() {
+  m_spill_path = shcore::path::join_path(
+      m_spill->directory,
+      "mysqlsh-spill-" + std::to_string(m_spill->next_id++) + "-" +
+          shcore::get_random_string(8, "abcdefghijklmnopqrstuvwxyz0123456789"));
+
+  m_spill_file = std::make_unique<std::fstream>(
+      m_spill_path, std::ios::in | std::ios::out | std::ios::binary |
+                        std::ios::trunc);
+
+  if (!m_spill_file->is_open()) {
+    m_spill_file.reset();
+    throw std::runtime_error("Unable to write to file: " + name() +
+                             ", could not create a spill file: " +
+                             m_spill_path);
+  }
+}
+
+void Allocated_file::write_spilled(const char *buffer, std::size_t length) {
+  m_spill_file->clear();
+  m_spill_file->seekp(m_offset - m_capacity);
+  m_spill_file->write(buffer, length);
+
+  if (!*m_spill_file) {
+    throw std::runtime_error("Unable to write to file: " + name() +
+                             ", could not write to the spill file: " +
+                             m_spill_path);
+  }
+
+  m_spill->bytes += length;
+}
+
+std::size_t Allocated_file::read_spilled(char *buffer, std::size_t length) {
+  m_spill_file->clear();
+  m_spill_file->seekg(m_offset - m_capacity);
+  m_spill_file->read(buffer, std::min(length, m_size - m_offset));
+
+  if (m_spill_file->bad()) {
+    throw std::runtime_error("Unable to read from file: " + name() +
+                             ", could not read from the spill file: " +
+                             m_spill_path);
+  }
+
+  return m_spill_file->gcount();
+}
+
 }  // namespace in_memory
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -24,7 +24,10 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATED_FILE_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATED_FILE_H_
 
+#include <chrono>
 #include <deque>
+#include <fstream>
+#include <memory>
 #include <string>
 
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
@@ -39,6 +42,10 @@ namespace in_memory {
  * the file contents once, then dynamically adds blocks of set size when writing
  * to a file. The whole file can be read only once, the blocks are released
  * while reading.
+ *
+ * If spill directory is given and allocator cannot provide more memory without
+ * exceeding its limit, the rest of the file is written to a temporary file in
+ * that directory, and read from there once the data held in memory is read.
  */
 class Allocated_file : public Virtual_fs::IFile {
  public:
@@ -50,9 +57,15 @@ class Allocated_file : public Virtual_fs::IFile {
    * @param allocator Allocator to use.
    * @param consume_if_first Blocks are released as long as reading starts at
    * the first block.
+   * @param spill Directory used to hold the data which does not fit in memory,
+   * if not set, writes wait until memory is available.
+   * @param stall_timeout If spill is not set, writes fail if no memory is
+   * released for this period of time, 0 to wait indefinitely.
    */
-  Allocated_file(const std::string &name, Allocator *allocator,
-                 bool consume_if_first = false);
+  Allocated_file(
+      const std::string &name, Allocator *allocator,
+      bool consume_if_first = false, Virtual_fs::Spill *spill = nullptr,
+      std::chrono::milliseconds stall_timeout = std::chrono::milliseconds{0});
 
   Allocated_file(const Allocated_file &) = delete;
   Allocated_file(Allocated_file &&) = default;
@@ -133,6 +146,7 @@ class Allocated_file : public Virtual_fs::IFile {
    *
    * @throws std::runtime_error If file is closed.
    * @throws std::runtime_error If file is opened for reading.
+   * @throws std::runtime_error If data cannot be written to the spill file.
    *
    * @returns Number of bytes written.
    */
@@ -148,6 +162,28 @@ class Allocated_file : public Virtual_fs::IFile {
   void append(Scoped_data_block block);
 
  private:
+  /**
+   * Writes the data to the memory blocks, at the current offset. Data must fit
+   * in the allocated blocks.
+   */
+  void write_memory(const char *buffer, std::size_t length);
+
+  /**
+   * Creates the spill file, subsequent writes past the current capacity are
+   * going to use it.
+   */
+  void start_spilling();
+
+  /**
+   * Writes the data to the spill file, at the current offset.
+   */
+  void write_spilled(const char *buffer, std::size_t length);
+
+  /**
+   * Reads the data from the spill file, at the current offset.
+   */
+  std::size_t read_spilled(char *buffer, std::size_t length);
+
   Allocator *m_allocator;
   bool m_is_open = false;
   bool m_read_mode = false;
@@ -161,6 +197,11 @@ class Allocated_file : public Virtual_fs::IFile {
   std::deque<char *> m_blocks;
   bool m_consume_if_first;
   bool m_accepts_append = true;
+  Virtual_fs::Spill *m_spill;
+  std::chrono::milliseconds m_stall_timeout;
+  // data past m_capacity is held in this file
+  std::string m_spill_path;
+  std::unique_ptr<std::fstream> m_spill_file;
 };
 
 }  // namespace in_memory
@@ -23,6 +23,10 @@
 
 #include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif  // __linux__
+
 #include <algorithm>
 #include <cassert>
 #include <chrono>
@@ -37,9 +41,130 @@ namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
 
+namespace {
+
+// threads cache at most this many bytes, per batch
+constexpr std::size_t k_cache_bytes = 256 * 1024;
+// maximum number of blocks moved between a cache and the shared pool
+constexpr std::size_t k_max_cache_batch = 32;
+// granularity used when memory is touched by the OS
+constexpr std::size_t k_os_page_size = 4096;
+
+std::atomic<uint64_t> g_next_allocator_id{0};
+
+#ifdef __linux__
+constexpr std::size_t k_huge_page_size = 2 * 1024 * 1024;
+
+char *map_huge_pages(std::size_t size) {
+  constexpr int k_protection = PROT_READ | PROT_WRITE;
+  constexpr int k_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+  if (0 == size % k_huge_page_size) {
+    // this succeeds only if huge pages were reserved by the administrator
+    if (const auto memory = ::mmap(nullptr, size, k_protection,
+                                   k_flags | MAP_HUGETLB, -1, 0);
+        MAP_FAILED != memory) {
+      return static_cast<char *>(memory);
+    }
+  }
+
+  // map more memory, so that it can be aligned to the huge page boundary,
+  // otherwise transparent huge pages would not be used
+  const auto length = size + k_huge_page_size;
+  const auto memory = ::mmap(nullptr, length, k_protection, k_flags, -1, 0);
+
+  if (MAP_FAILED == memory) {
+    throw std::bad_alloc();
+  }
+
+  const auto raw = static_cast<char *>(memory);
+  const auto aligned = reinterpret_cast<char *>(
+      (reinterpret_cast<uintptr_t>(raw) + k_huge_page_size - 1) &
+      ~(k_huge_page_size - 1));
+
+  if (const auto head = static_cast<std::size_t>(aligned - raw); head > 0) {
+    ::munmap(raw, head);
+  }
+
+  if (const auto tail = length - (aligned - raw) - size; tail > 0) {
+    ::munmap(aligned + size, tail);
+  }
+
+  // this is just advice, failure is not an error
+  ::madvise(aligned, size, MADV_HUGEPAGE);
+
+  return aligned;
+}
+#endif  // __linux__
+
+}  // namespace
+
+struct Allocator::Thread_caches {
+  struct Entry {
+    uint64_t allocator_id;
+    std::shared_ptr<Block_cache> cache;
+  };
+
+  ~Thread_caches() {
+    for (const auto &entry : entries) {
+      auto &cache = *entry.cache;
+      std::lock_guard lock{cache.mutex};
+
+      // allocator cannot be destroyed while we hold the lock
+      if (cache.owner) {
+        cache.owner->free(cache.blocks);
+        cache.blocks.clear();
+      }
+    }
+  }
+
+  std::vector<Entry> entries;
+};
+
+void Allocator::Page_deleter::operator()(char *memory) const {
+#ifdef __linux__
+  if (mapped) {
+    ::munmap(memory, size);
+    return;
+  }
+#endif  // __linux__
+
+  delete[] memory;
+}
+
+std::unique_ptr<char, Allocator::Page_deleter>
+Allocator::Page::allocate_memory(std::size_t page_size,
+                                 const Page_options &options) {
+  char *memory = nullptr;
+  bool mapped = false;
+
+#ifdef __linux__
+  if (options.huge_pages) {
+    memory = map_huge_pages(page_size);
+    mapped = true;
+  }
+#endif  // __linux__
+
+  if (!memory) {
+    // memory is not initialized, it's going to be faulted in when used
+    memory = new char[page_size];
+  }
+
+  std::unique_ptr<char, Page_deleter> result{memory,
+                                             Page_deleter{page_size, mapped}};
+
+  if (options.prefault) {
+    for (std::size_t i = 0; i < page_size; i += k_os_page_size) {
+      memory[i] = 0;
+    }
+  }
+
+  return result;
+}
+
 Allocator::Page::Page(std::size_t page_size, std::size_t blocks,
-                      std::size_t block_size)
-    : m_memory(std::make_unique<char[]>(page_size)) {
+                      std::size_t block_size, const Page_options &options)
+    : m_memory(allocate_memory(page_size, options)) {
   auto ptr = m_memory.get() + page_size;
   m_available_blocks.reserve(blocks);
 
@@ -66,6 +191,10 @@ std::size_t Allocator::Page::use_blocks(std::size_t blocks,
 }
 
 Allocator::Allocator(std::size_t page_size, std::size_t block_size)
+    : Allocator(page_size, block_size, Page_options{}) {}
+
+Allocator::Allocator(std::size_t page_size, std::size_t block_size,
+                     const Page_options &page_options)
     : m_blocks_per_page([=]() {
         if (!block_size) {
           throw std::runtime_error("The block size cannot be 0");
@@ -75,6 +204,9 @@ Allocator::Allocator(std::size_t page_size, std::size_t block_size)
       }()),
       m_block_size(block_size),
       m_page_size(m_blocks_per_page * m_block_size),
+      m_page_options(page_options),
+      m_id(++g_next_allocator_id),
+      m_cache_batch(std::min(k_max_cache_batch, k_cache_bytes / m_block_size)),
       m_pages(Compare_pages{m_page_size}),
       m_full_pages(Compare_pages{m_page_size}) {
   if (!m_blocks_per_page) {
@@ -85,6 +217,8 @@ Allocator::Allocator(std::size_t page_size, std::size_t block_size)
 }
 
 Allocator::~Allocator() {
+  drain_caches(true);
+
   // we should only have one page, with all blocks free
   assert(1 == m_pages.size());
   assert(m_empty_page == m_pages.begin()->get());
@@ -92,13 +226,68 @@ Allocator::~Allocator() {
 }
 
 std::vector<char *> Allocator::allocate(std::size_t memory) {
+  return do_allocate(memory, true);
+}
+
+std::vector<char *> Allocator::allocate(
+    std::size_t memory, std::chrono::milliseconds stall_timeout) {
+  return do_allocate(memory, true, stall_timeout);
+}
+
+std::vector<char *> Allocator::try_allocate(std::size_t memory) {
+  return do_allocate(memory, false);
+}
+
+std::vector<char *> Allocator::do_allocate(
+    std::size_t memory, bool wait, std::chrono::milliseconds stall_timeout) {
   auto blocks = block_count(memory);
   std::vector<char *> result;
-  result.reserve(blocks);
+
+  if (!blocks) {
+    return result;
+  }
 
   {
     std::unique_lock lock{m_mutex};
 
+    if (!can_allocate(blocks, wait)) {
+      if (!wait) {
+        return result;
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      const auto ready = [this, blocks]() {
+        return m_interrupted || can_allocate(blocks, true);
+      };
+
+      if (stall_timeout.count() > 0) {
+        auto freed = m_freed_blocks;
+
+        while (!m_memory_released.wait_for(lock, stall_timeout, ready)) {
+          if (freed == m_freed_blocks) {
+            m_stats.blocked_time += std::chrono::steady_clock::now() - start;
+
+            throw std::runtime_error(
+                "Memory limit has been reached and no memory was released "
+                "while waiting");
+          }
+
+          // some memory was released, but not enough, keep waiting
+          freed = m_freed_blocks;
+        }
+      } else {
+        m_memory_released.wait(lock, ready);
+      }
+
+      m_stats.blocked_time += std::chrono::steady_clock::now() - start;
+
+      if (m_interrupted) {
+        throw shcore::cancelled("Interrupted by user");
+      }
+    }
+
+    result.reserve(blocks);
+
     while (blocks > m_available_blocks) {
       add_page();
     }
@@ -128,19 +317,166 @@ std::vector<char *> Allocator::allocate(std::size_t memory) {
   return result;
 }
 
+char *Allocator::allocate_block() {
+  if (const auto batch = m_cache_batch.load()) {
+    auto &cache = thread_cache();
+    std::lock_guard lock{cache.mutex};
+
+    if (cache.blocks.empty()) {
+      cache.blocks = allocate_blocks(batch);
+    }
+
+    const auto block = cache.blocks.back();
+    cache.blocks.pop_back();
+
+    return block;
+  }
+
+  return allocate_blocks(1).front();
+}
+
 void Allocator::free(char *block) {
+  if (const auto batch = m_cache_batch.load()) {
+    auto &cache = thread_cache();
+    std::lock_guard lock{cache.mutex};
+
+    cache.blocks.emplace_back(block);
+
+    if (cache.blocks.size() >= 2 * batch) {
+      // return the least recently freed blocks to the shared pool
+      const auto begin = cache.blocks.begin();
+      const auto end = begin + batch;
+
+      free(begin, end);
+      cache.blocks.erase(begin, end);
+    }
+
+    return;
+  }
+
+  {
+    std::lock_guard lock{m_mutex};
+    free_block(block);
+  }
+
+  m_memory_released.notify_all();
+}
+
+void Allocator::set_memory_limit(std::size_t limit) {
+  {
+    std::lock_guard lock{m_mutex};
+    m_max_pages = limit ? std::max<std::size_t>(1, limit / m_page_size) : 0;
+  }
+
+  m_cache_batch =
+      limit ? 0 : std::min(k_max_cache_batch, k_cache_bytes / m_block_size);
+
+  if (limit) {
+    drain_caches();
+  }
+
+  m_memory_released.notify_all();
+}
+
+Allocator::Block_cache &Allocator::thread_cache() {
+  thread_local Thread_caches t_caches;
+  auto &entries = t_caches.entries;
+
+  for (const auto &entry : entries) {
+    if (m_id == entry.allocator_id) {
+      return *entry.cache;
+    }
+  }
+
+  // forget the caches of allocators which were destroyed
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](const Thread_caches::Entry &entry) {
+                                 std::lock_guard lock{entry.cache->mutex};
+                                 return !entry.cache->owner;
+                               }),
+                entries.end());
+
+  auto cache = std::make_shared<Block_cache>();
+  cache->owner = this;
+
+  {
+    std::lock_guard lock{m_caches_mutex};
+
+    // caches of the threads which have finished were already drained, they
+    // are no longer referenced by these threads
+    m_caches.erase(
+        std::remove_if(m_caches.begin(), m_caches.end(),
+                       [](const std::shared_ptr<Block_cache> &c) {
+                         return 1 == c.use_count();
+                       }),
+        m_caches.end());
+    m_caches.emplace_back(cache);
+  }
+
+  entries.emplace_back(Thread_caches::Entry{m_id, std::move(cache)});
+
+  return *entries.back().cache;
+}
+
+void Allocator::drain_caches(bool detach) {
+  std::lock_guard caches_lock{m_caches_mutex};
+
+  for (const auto &cache : m_caches) {
+    std::lock_guard lock{cache->mutex};
+
+    free(cache->blocks);
+    cache->blocks.clear();
+
+    if (detach) {
+      // threads which still hold this cache are going to discard it
+      cache->owner = nullptr;
+    }
+  }
+}
+
+void Allocator::interrupt() {
+  {
+    std::lock_guard lock{m_mutex};
+    m_interrupted = true;
+  }
+
+  m_memory_released.notify_all();
+}
+
+Allocator::Stats Allocator::stats() const {
   std::lock_guard lock{m_mutex};
-  free_block(block);
+  return m_stats;
+}
+
+bool Allocator::can_allocate(std::size_t blocks, bool oversized) const {
+  if (!m_max_pages || blocks <= m_available_blocks) {
+    return true;
+  }
+
+  const auto missing_pages =
+      (blocks - m_available_blocks + m_blocks_per_page - 1) / m_blocks_per_page;
+
+  if (page_count() + missing_pages <= m_max_pages) {
+    return true;
+  }
+
+  // request is bigger than the limit, it can only be served when nothing else
+  // is allocated, otherwise it would wait forever
+  return oversized && blocks > m_max_pages * m_blocks_per_page &&
+         page_count() * m_blocks_per_page == m_available_blocks;
 }
 
 void Allocator::add_page() {
-  auto page =
-      std::make_unique<Page>(m_page_size, m_blocks_per_page, m_block_size);
+  auto page = std::make_unique<Page>(m_page_size, m_blocks_per_page,
+                                     m_block_size, m_page_options);
 
   m_empty_page = page.get();
   m_pages.emplace(std::move(page));
 
   m_available_blocks += m_blocks_per_page;
+
+  m_stats.resident += m_page_size;
+  m_stats.peak_resident = std::max(m_stats.peak_resident, m_stats.resident);
 }
 
 void Allocator::remove_page(Pages::const_iterator page) {
@@ -153,6 +489,7 @@ void Allocator::remove_page(Pages::const_iterator page) {
   m_pages.erase(page);
 
   m_available_blocks -= m_blocks_per_page;
+  m_stats.resident -= m_page_size;
 }
 
 void Allocator::free_block(char *block) {
@@ -169,6 +506,7 @@ void Allocator::free_block(char *block) {
 
   page->m_available_blocks.emplace_back(block);
   ++m_available_blocks;
+  ++m_freed_blocks;
 
   if (m_blocks_per_page == page->m_available_blocks.size()) {
     // page is completely empty
@@ -24,6 +24,10 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATOR_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_ALLOCATOR_H_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -38,6 +42,30 @@ namespace in_memory {
  */
 class Allocator final {
  public:
+  /**
+   * Memory usage statistics.
+   */
+  struct Stats {
+    // memory currently held in pages
+    std::size_t resident = 0;
+    // highest value of resident memory
+    std::size_t peak_resident = 0;
+    // total time allocations spent waiting for the memory to be released
+    std::chrono::steady_clock::duration blocked_time{0};
+  };
+
+  /**
+   * Controls how memory of the pages is obtained.
+   */
+  struct Page_options {
+    // back the pages with huge pages if possible (Linux only), falls back to
+    // transparent huge pages, and then to regular pages
+    bool huge_pages = false;
+    // touch all memory when page is created, so that it's not faulted in
+    // while blocks are being used
+    bool prefault = false;
+  };
+
   /**
    * Initializes the allocator to serve memory blocks from pages of the given
    * size. The page size is rounded down to align with the block size.
@@ -51,6 +79,20 @@ class Allocator final {
    */
   explicit Allocator(std::size_t page_size, std::size_t block_size = 8192);
 
+  /**
+   * Initializes the allocator to serve memory blocks from pages of the given
+   * size, memory of the pages is obtained using the given options.
+   *
+   * @param page_size Size of a single memory page.
+   * @param block_size Size of a single block in the memory page.
+   * @param page_options How memory of the pages is obtained.
+   *
+   * @throws std::runtime_error If input arguments are invalid.
+   * @throws std::bad_alloc If memory cannot be allocated.
+   */
+  Allocator(std::size_t page_size, std::size_t block_size,
+            const Page_options &page_options);
+
   Allocator(const Allocator &) = delete;
   Allocator(Allocator &&) = delete;
 
@@ -90,24 +132,90 @@ class Allocator final {
   }
 
   /**
-   * Allocates a single memory block.
+   * Allocates a single memory block. Blocks are served from a cache local to
+   * the calling thread, if it's enabled.
    *
    * @returns allocated memory block
    */
-  inline char *allocate_block() { return allocate_blocks(1).front(); }
+  char *allocate_block();
 
   /**
    * Allocates the requested memory. Memory is returned in blocks of a constant
    * size, which means that more memory can be allocated than requested.
    *
+   * If memory limit is set and serving this request would exceed it, waits
+   * until enough memory is released.
+   *
    * @param memory Size of the memory to be allocated.
    *
+   * @throws shcore::cancelled If allocator was interrupted while waiting.
+   *
    * @returns allocated memory blocks
    */
   std::vector<char *> allocate(std::size_t memory);
 
   /**
-   * Frees a single memory block.
+   * Allocates the requested memory. Memory is returned in blocks of a constant
+   * size, which means that more memory can be allocated than requested.
+   *
+   * If memory limit is set and serving this request would exceed it, waits
+   * until enough memory is released. Gives up if no memory is released for the
+   * given period of time, as the memory may be held by data which is not going
+   * to be consumed until this request is served.
+   *
+   * @param memory Size of the memory to be allocated.
+   * @param stall_timeout Maximum time to wait for any memory to be released.
+   *
+   * @throws shcore::cancelled If allocator was interrupted while waiting.
+   * @throws std::runtime_error If no memory was released within the given
+   *                            time.
+   *
+   * @returns allocated memory blocks
+   */
+  std::vector<char *> allocate(std::size_t memory,
+                               std::chrono::milliseconds stall_timeout);
+
+  /**
+   * Allocates the requested memory, does not wait if serving this request
+   * would exceed the memory limit. Requests bigger than the limit always fail.
+   *
+   * @param memory Size of the memory to be allocated.
+   *
+   * @returns allocated memory blocks, empty if memory limit would be exceeded
+   */
+  std::vector<char *> try_allocate(std::size_t memory);
+
+  /**
+   * Limits the memory held by this allocator. The limit is rounded down to
+   * align with the page size, at least one page is always available. A request
+   * which is bigger than the limit is served by allocate() once all memory is
+   * released. Thread caches are disabled while the limit is set, so that all
+   * free memory is visible to the waiting threads. Should be called before any
+   * memory is allocated.
+   *
+   * @param limit Maximum memory, 0 means no limit.
+   */
+  void set_memory_limit(std::size_t limit);
+
+  /**
+   * Provides the memory limit, 0 if there's no limit.
+   */
+  std::size_t memory_limit() const { return m_max_pages * m_page_size; }
+
+  /**
+   * Wakes up all threads waiting for memory, allocate() is going to throw from
+   * now on if memory limit is reached.
+   */
+  void interrupt();
+
+  /**
+   * Provides memory usage statistics.
+   */
+  Stats stats() const;
+
+  /**
+   * Frees a single memory block. Block is returned to a cache local to the
+   * calling thread, if it's enabled.
    *
    * @param block A memory block to be freed.
    */
@@ -130,14 +238,29 @@ class Allocator final {
    */
   template <typename Iter>
   void free(Iter begin, Iter end) {
-    std::lock_guard lock{m_mutex};
+    {
+      std::lock_guard lock{m_mutex};
 
-    while (begin != end) {
-      free_block(*begin++);
+      while (begin != end) {
+        free_block(*begin++);
+      }
     }
+
+    m_memory_released.notify_all();
   }
 
  private:
+  /**
+   * Releases memory of a page.
+   */
+  struct Page_deleter {
+    void operator()(char *memory) const;
+
+    std::size_t size;
+    // memory was mapped, not allocated
+    bool mapped;
+  };
+
   /**
    * A page of memory.
    */
@@ -148,8 +271,19 @@ class Allocator final {
      * @param page_size Size of a page.
      * @param blocks Number of blocks in this page.
      * @param block_size Size of a single block.
+     * @param options How memory is obtained.
      */
-    Page(std::size_t page_size, std::size_t blocks, std::size_t block_size);
+    Page(std::size_t page_size, std::size_t blocks, std::size_t block_size,
+         const Page_options &options);
+
+    /**
+     * Obtains memory for a page.
+     *
+     * @param page_size Size of a page.
+     * @param options How memory is obtained.
+     */
+    static std::unique_ptr<char, Page_deleter> allocate_memory(
+        std::size_t page_size, const Page_options &options);
 
     /**
      * Uses the selected number of blocks.
@@ -162,7 +296,7 @@ class Allocator final {
     std::size_t use_blocks(std::size_t blocks, std::vector<char *> *result);
 
     // holds allocated memory
-    std::unique_ptr<char[]> m_memory;
+    std::unique_ptr<char, Page_deleter> m_memory;
     // blocks available for allocation
     std::vector<char *> m_available_blocks;
   };
@@ -201,6 +335,69 @@ class Allocator final {
 
   using Pages = std::set<std::unique_ptr<Page>, Compare_pages>;
 
+  /**
+   * Free blocks cached by a single thread, they are moved from/to the shared
+   * pool in batches, this reduces the contention on m_mutex when
+   * allocating/freeing single blocks. The mutex is only contended when caches
+   * are drained by the allocator.
+   */
+  struct Block_cache {
+    std::mutex mutex;
+    std::vector<char *> blocks;
+    // allocator which owns the blocks, nullptr once it's destroyed
+    Allocator *owner = nullptr;
+  };
+
+  /**
+   * Thread-local storage of all caches used by a thread. When the thread
+   * finishes, cached blocks are returned to their allocators.
+   */
+  struct Thread_caches;
+
+  /**
+   * Provides the cache of the calling thread, creates it if necessary.
+   */
+  Block_cache &thread_cache();
+
+  /**
+   * Moves all cached blocks back to the shared pool.
+   *
+   * @param detach Caches are no longer going to be used by this allocator.
+   */
+  void drain_caches(bool detach = false);
+
+  /**
+   * Allocates the requested memory.
+   *
+   * @param memory Size of the memory to be allocated.
+   * @param wait Whether to wait if memory limit would be exceeded.
+   * @param stall_timeout Maximum time to wait for any memory to be released,
+   *                      zero to wait indefinitely.
+   *
+   * @returns allocated memory blocks, empty if memory limit would be exceeded
+   *          and wait is false
+   */
+  std::vector<char *> do_allocate(
+      std::size_t memory, bool wait,
+      std::chrono::milliseconds stall_timeout = std::chrono::milliseconds{0});
+
+  /**
+   * Checks if the given number of blocks can be allocated without exceeding
+   * the memory limit. Needs to be called with m_mutex held.
+   *
+   * @param blocks Number of blocks to allocate.
+   * @param oversized Whether a request bigger than the limit can be served
+   *                  when nothing else is allocated.
+   */
+  bool can_allocate(std::size_t blocks, bool oversized) const;
+
+  /**
+   * Number of allocated pages.
+   */
+  inline std::size_t page_count() const {
+    return m_pages.size() + m_full_pages.size();
+  }
+
   /**
    * Adds a new page.
    */
@@ -226,6 +423,13 @@ class Allocator final {
   const std::size_t m_block_size;
   // size of a page
   const std::size_t m_page_size;
+  // how memory of the pages is obtained
+  const Page_options m_page_options;
+  // identifies this allocator in the thread caches, addresses can be reused
+  const uint64_t m_id;
+  // number of blocks moved between a cache and the shared pool, 0 if caches
+  // are disabled
+  std::atomic<std::size_t> m_cache_batch;
 
   // all pages
   Pages m_pages;
@@ -237,8 +441,25 @@ class Allocator final {
   // number of available blocks
   std::size_t m_available_blocks = 0;
 
+  // number of blocks released so far, used to detect if memory is released
+  std::size_t m_freed_blocks = 0;
+
+  // maximum number of pages, 0 - no limit
+  std::size_t m_max_pages = 0;
+
+  bool m_interrupted = false;
+
+  Stats m_stats;
+
   // controls access to memory
-  std::mutex m_mutex;
+  mutable std::mutex m_mutex;
+  // signalled when memory is released
+  std::condition_variable m_memory_released;
+
+  // controls access to the list of thread caches
+  std::mutex m_caches_mutex;
+  // caches of all threads which have used this allocator
+  std::vector<std::shared_ptr<Block_cache>> m_caches;
 };
 
 struct Data_block {
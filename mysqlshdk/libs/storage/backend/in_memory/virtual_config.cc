@@ -30,8 +30,9 @@ namespace mysqlshdk {
 namespace storage {
 namespace in_memory {
 
-Virtual_config::Virtual_config(std::size_t page_size)
-    : m_fs(std::make_unique<Virtual_fs>(page_size)) {}
+Virtual_config::Virtual_config(std::size_t page_size,
+                               const Allocator::Page_options &page_options)
+    : m_fs(std::make_unique<Virtual_fs>(page_size, 8192, page_options)) {}
 
 std::unique_ptr<IFile> Virtual_config::file(const std::string &name) const {
   return std::make_unique<Virtual_file>(name, m_fs.get());
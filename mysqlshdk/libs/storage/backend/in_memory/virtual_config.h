@@ -36,7 +36,8 @@ namespace in_memory {
 
 class Virtual_config : public Config {
  public:
-  explicit Virtual_config(std::size_t page_size);
+  explicit Virtual_config(std::size_t page_size,
+                          const Allocator::Page_options &page_options = {});
 
   Virtual_config(const Virtual_config &) = delete;
   Virtual_config(Virtual_config &&) = default;
@@ -80,9 +80,13 @@ Virtual_fs::IFile *Virtual_fs::Directory::create_file(const std::string &name) {
                            name, &m_fs->m_interrupted))
         .first->second.get();
   } else {
+    const auto spill =
+        m_fs->m_spill.directory.empty() ? nullptr : &m_fs->m_spill;
+
     return m_created_files
-        .emplace(name,
-                 std::make_unique<Allocated_file>(name, &m_fs->m_allocator))
+        .emplace(name, std::make_unique<Allocated_file>(
+                           name, &m_fs->m_allocator, false, spill,
+                           m_fs->m_memory_stall_timeout))
         .first->second.get();
   }
 }
@@ -173,8 +177,9 @@ void Virtual_fs::Directory::publish_created_file(const std::string &name) {
   }
 }
 
-Virtual_fs::Virtual_fs(std::size_t page_size, std::size_t block_size)
-    : m_allocator(page_size, block_size) {}
+Virtual_fs::Virtual_fs(std::size_t page_size, std::size_t block_size,
+                       const Allocator::Page_options &page_options)
+    : m_allocator(page_size, block_size, page_options) {}
 
 Virtual_fs::Directory *Virtual_fs::directory(const std::string &name) const {
   std::lock_guard lock{m_mutex};
@@ -211,7 +216,10 @@ std::vector<std::string> Virtual_fs::split_path(const std::string &path) {
   return shcore::str_split(path, std::string{1, k_path_separator});
 }
 
-void Virtual_fs::interrupt() { m_interrupted = true; }
+void Virtual_fs::interrupt() {
+  m_interrupted = true;
+  m_allocator.interrupt();
+}
 
 void Virtual_fs::set_uses_synchronized_io(
     std::function<bool(std::string_view)> callback) {
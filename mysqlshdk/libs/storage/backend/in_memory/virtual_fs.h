@@ -25,6 +25,7 @@
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_IN_MEMORY_VIRTUAL_FS_H_
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -49,6 +50,19 @@ class Virtual_fs final {
  public:
   class Directory;
 
+  /**
+   * Local directory used to hold the data of files which do not fit in the
+   * memory limit.
+   */
+  struct Spill {
+    // path to the directory
+    std::string directory;
+    // total number of bytes written to the directory
+    std::atomic<std::size_t> bytes = 0;
+    // used to generate unique file names
+    std::atomic<std::size_t> next_id = 0;
+  };
+
   /**
    * In-memory file.
    */
@@ -246,8 +260,10 @@ class Virtual_fs final {
    *
    * @param page_size Size of a single memory page.
    * @param block_size Size of a single block in the memory page.
+   * @param page_options How memory of the pages is obtained.
    */
-  explicit Virtual_fs(std::size_t page_size, std::size_t block_size = 8192);
+  explicit Virtual_fs(std::size_t page_size, std::size_t block_size = 8192,
+                      const Allocator::Page_options &page_options = {});
 
   Virtual_fs(const Virtual_fs &) = delete;
   Virtual_fs(Virtual_fs &&) = delete;
@@ -308,8 +324,58 @@ class Virtual_fs final {
    */
   void set_uses_synchronized_io(std::function<bool(std::string_view)> callback);
 
+  /**
+   * Limits the memory used to hold the contents of the files. When limit is
+   * reached, writes wait until memory is released by the readers, unless the
+   * spill directory is set. Memory is released when file is read or removed.
+   *
+   * @param limit Maximum memory, 0 means no limit.
+   */
+  void set_memory_limit(std::size_t limit) {
+    m_allocator.set_memory_limit(limit);
+  }
+
+  /**
+   * Provides the memory limit, 0 if there's no limit.
+   */
+  std::size_t memory_limit() const { return m_allocator.memory_limit(); }
+
+  /**
+   * Sets the local directory which is going to hold the data which does not
+   * fit in the memory limit. Needs to be called before any files are created.
+   *
+   * @param directory Path to an existing directory, empty to disable.
+   */
+  void set_spill_directory(const std::string &directory) {
+    m_spill.directory = directory;
+  }
+
+  /**
+   * Sets the maximum time a write waits for any memory to be released when the
+   * memory limit is reached and spill directory is not set. If nothing is
+   * released in that time, the write fails instead of waiting for the data
+   * which may never be read. Needs to be called before any files are created.
+   *
+   * @param timeout Maximum wait time, 0 to wait indefinitely.
+   */
+  void set_memory_stall_timeout(std::chrono::milliseconds timeout) {
+    m_memory_stall_timeout = timeout;
+  }
+
+  /**
+   * Provides memory usage statistics.
+   */
+  Allocator::Stats memory_stats() const { return m_allocator.stats(); }
+
+  /**
+   * Provides total number of bytes written to the spill directory.
+   */
+  std::size_t spilled_bytes() const { return m_spill.bytes; }
+
  private:
   Allocator m_allocator;
+  Spill m_spill;
+  std::chrono::milliseconds m_memory_stall_timeout{0};
   std::unordered_map<std::string, std::unique_ptr<Directory>> m_dirs;
   mutable std::mutex m_mutex;
   std::atomic<bool> m_interrupted = false;
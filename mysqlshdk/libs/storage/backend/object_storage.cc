@@ -163,6 +163,7 @@ Object::Object(const Config_ptr &config, const std::string &name,
     : m_name(name),
       m_prefix(prefix),
       m_container(config->container()),
+      m_executor(rest::Rest_executor::shared()),
       m_max_part_size(config->part_size()),
       m_writer{},
       m_reader{} {}
@@ -464,19 +465,32 @@ void Object::Writer::abort_multipart_upload(const char *context,
         context, maybe_error.c_str(), m_multipart.name.c_str(),
         m_multipart.upload_id.c_str());
 
-    // call reset() before aborting the upload, if abort throws it's not going
-    // to be attempted again
+    // cancellation is executed asynchronously, the caller does not need to
+    // wait for it
+    m_object->m_executor->submit(
+        rest::Rest_executor::Priority::CLEANUP,
+        [config = m_object->m_container->config(), multipart = m_multipart,
+         context = std::string{context}]() {
+          try {
+            config->container()->abort_multipart_upload(multipart);
+          } catch (const rest::Response_error &inner_error) {
+            log_error(
+                "Error cancelling multipart upload after %s, error: "
+                "%s\nobject: %s\nupload id: %s",
+                context.c_str(), inner_error.format().c_str(),
+                multipart.name.c_str(), multipart.upload_id.c_str());
+          } catch (const rest::Connection_error &inner_error) {
+            log_error(
+                "Error cancelling multipart upload after %s, error: "
+                "%s\nobject: %s\nupload id: %s",
+                context.c_str(), inner_error.what(), multipart.name.c_str(),
+                multipart.upload_id.c_str());
+          }
+        });
+
+    // call reset() after scheduling the cancellation, if it fails it's not
+    // going to be attempted again
     reset();
-
-    try {
-      m_object->m_container->abort_multipart_upload(m_multipart);
-    } catch (const rest::Response_error &inner_error) {
-      log_error(
-          "Error cancelling multipart upload after %s, error: %s\nobject: "
-          "%s\nupload id: %s",
-          context, inner_error.format().c_str(), m_multipart.name.c_str(),
-          m_multipart.upload_id.c_str());
-    }
   }
 }
 
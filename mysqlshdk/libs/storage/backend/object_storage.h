@@ -28,6 +28,7 @@
 #include <optional>
 #include <string>
 
+#include "mysqlshdk/libs/rest/rest_executor.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
 
@@ -270,6 +271,8 @@ class Object : public mysqlshdk::storage::IFile {
   std::string m_name;
   std::string m_prefix;
   std::unique_ptr<Container> m_container;
+  // executes the asynchronous operations, needs to outlive the writer
+  std::shared_ptr<rest::Rest_executor> m_executor;
   std::optional<Mode> m_open_mode;
   size_t m_max_part_size;
 
@@ -105,6 +105,8 @@ class SHCORE_PUBLIC Writer_base {
 
  public:
   const std::string &str() const { return _data.data; }
+
+  void clear() { _data.data.clear(); }
 };
 
 class SHCORE_PUBLIC Raw_writer : public Writer_base {
@@ -259,6 +261,13 @@ class SHCORE_PUBLIC JSON_dumper {
 
   const std::string &str() const { return _writer->str(); }
 
+  /**
+   * Discards the output produced so far, the state of the document being
+   * written is preserved. This allows to stream large documents: the caller
+   * consumes str() and then clears the buffer.
+   */
+  void clear() { _writer->clear(); }
+
  private:
   int _deep_level;
   size_t _binary_limit;
@@ -37,6 +37,7 @@
 #endif
 
 #include <list>
+#include <mutex>
 #include <stack>
 
 #include "mysqlshdk/include/shellcore/console.h"
@@ -96,6 +97,94 @@ std::unique_ptr<v8::Platform> g_platform;
 
 const std::string k_origin_shell = "(shell)";
 
+constexpr auto k_snapshot_file = "js_snapshot.bin";
+
+// index of the global context within the startup snapshot
+constexpr std::size_t k_snapshot_context_index = 0;
+
+/**
+ * Startup snapshot of the global context, file holds a header followed by the
+ * V8 blob.
+ */
+struct Startup_snapshot {
+  bool loaded = false;
+  std::string data;
+  v8::StartupData blob{nullptr, 0};
+};
+
+Startup_snapshot g_snapshot;
+
+std::string snapshot_header() {
+  return shcore::str_format("mysqlsh-js-snapshot %s %s\n", get_long_version(),
+                            v8::V8::GetVersion());
+}
+
+// contexts can be created concurrently by different threads
+std::mutex g_snapshot_mutex;
+
+bool load_startup_snapshot(const std::string &path) {
+  g_snapshot.loaded = true;
+  g_snapshot.blob = {nullptr, 0};
+  g_snapshot.data.clear();
+
+  if (path.empty() || !is_file(path)) {
+    return false;
+  }
+
+  std::string data;
+
+  if (!load_text_file(path, data)) {
+    log_warning("Failed to read the JavaScript startup snapshot '%s': %s",
+                path.c_str(), get_last_error().c_str());
+    return false;
+  }
+
+  const auto header = snapshot_header();
+
+  if (!str_beginswith(data, header)) {
+    log_warning(
+        "The JavaScript startup snapshot '%s' was created by a different "
+        "version, ignoring",
+        path.c_str());
+    return false;
+  }
+
+  g_snapshot.data = data.substr(header.length());
+
+  v8::StartupData blob{g_snapshot.data.data(),
+                       static_cast<int>(g_snapshot.data.size())};
+
+  if (!blob.IsValid()) {
+    log_warning("The JavaScript startup snapshot '%s' is corrupted, ignoring",
+                path.c_str());
+    g_snapshot.data.clear();
+    return false;
+  }
+
+  g_snapshot.blob = blob;
+  log_debug("Using the JavaScript startup snapshot '%s'", path.c_str());
+
+  return true;
+}
+
+v8::StartupData *startup_snapshot() {
+  std::lock_guard lock{g_snapshot_mutex};
+
+  if (!g_snapshot.loaded) {
+    std::string path;
+
+    try {
+      path = path::join_path(get_share_folder(), k_snapshot_file);
+    } catch (const std::exception &) {
+      // no share folder, context is going to be initialized from scratch
+    }
+
+    load_startup_snapshot(path);
+  }
+
+  return g_snapshot.blob.data ? &g_snapshot.blob : nullptr;
+}
+
 #ifdef ENABLE_V8_TRACING
 
 std::ofstream g_trace_file;
@@ -223,6 +312,8 @@ class JScript_context::Impl {
   explicit Impl(JScript_context *owner);
   ~Impl();
 
+  static void create_snapshot(const std::string &path);
+
   static v8::Local<v8::String> v8_string(v8::Isolate *isolate,
                                          const char *data);
   static v8::Local<v8::String> v8_string(v8::Isolate *isolate,
@@ -262,6 +353,8 @@ class JScript_context::Impl {
   static void f_unrepr(const V8_args &args);
   static void f_type(const V8_args &args);
   static void f_print(const V8_args &args, bool new_line);
+  static void f_print_text(const V8_args &args);
+  static void f_print_line(const V8_args &args);
   static void f_source(const V8_args &args);
   // private global functions
   static void f_list_native_modules(const V8_args &args);
@@ -269,16 +362,29 @@ class JScript_context::Impl {
   static void f_load_module(const V8_args &args);
   static void f_current_module_folder(const V8_args &args);
 
+  /**
+   * Native functions referenced by the global context, these need to be
+   * registered when startup snapshot is created and used.
+   */
+  static const intptr_t *external_references();
+
+  /**
+   * Creates the global context: registers the global functions and loads the
+   * core module.
+   */
+  static v8::Local<v8::Context> create_context(v8::Isolate *isolate);
+
   /*
    * load_core_module loads the content of the given module file
    * and inserts the definitions on the JS globals.
    */
-  void load_core_module() const;
+  static void load_core_module(v8::Local<v8::Context> context);
   void load_module(const std::string &path, v8::Local<v8::Value> module,
                    bool *js_exception = nullptr);
 
-  v8::Local<v8::FunctionTemplate> wrap_callback(
-      v8::FunctionCallback callback) const;
+  static v8::Local<v8::FunctionTemplate> wrap_callback(
+      v8::Isolate *isolate, v8::FunctionCallback callback);
+  static void call_wrapped(const V8_args &args);
 
   v8::Local<v8::Context> copy_global_context() const;
   void delete_context(v8::Local<v8::Context> context) const;
@@ -303,9 +409,16 @@ JScript_context::Impl::Impl(JScript_context *owner)
       m_allocator(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
   JScript_context_init();
 
+  const auto snapshot = startup_snapshot();
+
   v8::Isolate::CreateParams params;
   params.array_buffer_allocator = m_allocator.get();
 
+  if (snapshot) {
+    params.snapshot_blob = snapshot;
+    params.external_references = external_references();
+  }
+
   m_isolate = v8::Isolate::New(params);
   m_isolate->SetData(0, this);
 
@@ -314,50 +427,131 @@ JScript_context::Impl::Impl(JScript_context *owner)
   v8::Isolate::Scope isolate_scope(m_isolate);
   v8::HandleScope handle_scope(m_isolate);
 
-  v8::Local<v8::ObjectTemplate> globals = v8::ObjectTemplate::New(m_isolate);
+  v8::Local<v8::Context> lcontext;
+
+  if (snapshot) {
+    // the global context is already initialized
+    lcontext = v8::Context::FromSnapshot(m_isolate, k_snapshot_context_index)
+                   .FromMaybe(v8::Local<v8::Context>());
+
+    if (lcontext.IsEmpty()) {
+      log_warning("Failed to restore the JavaScript startup snapshot");
+    }
+  }
+
+  if (lcontext.IsEmpty()) {
+    lcontext = create_context(m_isolate);
+  }
+
+  m_context.Reset(m_isolate, lcontext);
+}
+
+void JScript_context::Impl::create_snapshot(const std::string &path) {
+  JScript_context_init();
+
+  std::string blob;
+
+  {
+    v8::SnapshotCreator creator{external_references()};
+    const auto isolate = creator.GetIsolate();
+
+    {
+      v8::HandleScope handle_scope(isolate);
+
+      // default context is used when copying the global context
+      creator.SetDefaultContext(v8::Context::New(isolate));
+
+      if (k_snapshot_context_index !=
+          creator.AddContext(create_context(isolate))) {
+        throw std::runtime_error("Unexpected index of the global context");
+      }
+    }
+
+    const auto data = creator.CreateBlob(
+        v8::SnapshotCreator::FunctionCodeHandling::kClear);
+
+    if (!data.data) {
+      throw std::runtime_error(
+          "Failed to create the JavaScript startup snapshot");
+    }
+
+    blob.assign(data.data, data.raw_size);
+    delete[] data.data;
+  }
+
+  if (!create_file(path, snapshot_header() + blob, true)) {
+    throw std::runtime_error(
+        "Failed to write the JavaScript startup snapshot '" + path +
+        "': " + get_last_error());
+  }
+}
+
+const intptr_t *JScript_context::Impl::external_references() {
+  static const intptr_t s_references[] = {
+      reinterpret_cast<intptr_t>(&Impl::call_wrapped),
+      reinterpret_cast<intptr_t>(&Impl::f_repr),
+      reinterpret_cast<intptr_t>(&Impl::f_unrepr),
+      reinterpret_cast<intptr_t>(&Impl::f_type),
+      reinterpret_cast<intptr_t>(&Impl::f_print_text),
+      reinterpret_cast<intptr_t>(&Impl::f_print_line),
+      reinterpret_cast<intptr_t>(&Impl::f_source),
+      reinterpret_cast<intptr_t>(&Impl::f_list_native_modules),
+      reinterpret_cast<intptr_t>(&Impl::f_load_native_module),
+      reinterpret_cast<intptr_t>(&Impl::f_load_module),
+      reinterpret_cast<intptr_t>(&Impl::f_current_module_folder),
+      0,
+  };
+
+  return s_references;
+}
+
+v8::Local<v8::Context> JScript_context::Impl::create_context(
+    v8::Isolate *isolate) {
+  v8::EscapableHandleScope handle_scope(isolate);
+
+  v8::Local<v8::ObjectTemplate> globals = v8::ObjectTemplate::New(isolate);
+
+  const auto set = [isolate, &globals](const char *name,
+                                       v8::FunctionCallback callback) {
+    globals->Set(v8_string(isolate, name), wrap_callback(isolate, callback));
+  };
 
   // register symbols to be exported to JS in global namespace
 
   // repr(object) -> string
-  globals->Set(v8_string("repr"), wrap_callback(&Impl::f_repr));
+  set("repr", &Impl::f_repr);
 
   // unrepr(string) -> object
-  globals->Set(v8_string("unrepr"), wrap_callback(&Impl::f_unrepr));
+  set("unrepr", &Impl::f_unrepr);
 
   // type(object) -> string
-  globals->Set(v8_string("type"), wrap_callback(&Impl::f_type));
+  set("type", &Impl::f_type);
 
   // print('hello')
-  globals->Set(v8_string("print"), wrap_callback([](const V8_args &args) {
-                 f_print(args, false);
-               }));
+  set("print", &Impl::f_print_text);
 
   // println('hello')
-  globals->Set(v8_string("println"),
-               wrap_callback([](const V8_args &args) { f_print(args, true); }));
+  set("println", &Impl::f_print_line);
 
   // source('module')
-  globals->Set(v8_string("source"), wrap_callback(&Impl::f_source));
+  set("source", &Impl::f_source);
 
   // private functions
-  globals->Set(v8_string("__list_native_modules"),
-               wrap_callback(&Impl::f_list_native_modules));
+  set("__list_native_modules", &Impl::f_list_native_modules);
 
-  globals->Set(v8_string("__load_native_module"),
-               wrap_callback(&Impl::f_load_native_module));
+  set("__load_native_module", &Impl::f_load_native_module);
 
-  globals->Set(v8_string("__load_module"), wrap_callback(&Impl::f_load_module));
+  set("__load_module", &Impl::f_load_module);
 
-  globals->Set(v8_string("__current_module_folder"),
-               wrap_callback(&Impl::f_current_module_folder));
+  set("__current_module_folder", &Impl::f_current_module_folder);
 
   // create the global context
-  v8::Local<v8::Context> lcontext =
-      v8::Context::New(m_isolate, nullptr, globals);
-  m_context.Reset(m_isolate, lcontext);
+  const auto context = v8::Context::New(isolate, nullptr, globals);
 
   // Loads the core module
-  load_core_module();
+  load_core_module(context);
+
+  return handle_scope.Escape(context);
 }
 
 JScript_context::Impl::~Impl() {
@@ -383,23 +577,24 @@ JScript_context::Impl::~Impl() {
   m_isolate->Dispose();
 }
 
-void JScript_context::Impl::load_core_module() const {
-  v8::Isolate::Scope isolate_scope(m_isolate);
-  v8::HandleScope handle_scope(m_isolate);
-  v8::TryCatch try_catch{m_isolate};
-  const auto lcontext = context();
-  v8::Context::Scope context_scope(lcontext);
+void JScript_context::Impl::load_core_module(
+    v8::Local<v8::Context> context) {
+  const auto isolate = context->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::TryCatch try_catch{isolate};
+  v8::Context::Scope context_scope(context);
 
   shcore::Scoped_naming_style style(NamingStyle::LowerCamelCase);
 
-  v8::ScriptOrigin script_origin{m_isolate, v8_string("core.js")};
+  v8::ScriptOrigin script_origin{isolate, v8_string(isolate, "core.js")};
   auto script = v8::Script::Compile(
-      lcontext, v8_string("(function (){" + shcore::js_core_module + "})();"),
+      context,
+      v8_string(isolate, "(function (){" + shcore::js_core_module + "})();"),
       &script_origin);
 
   v8::MaybeLocal<v8::Value> result;
   if (!script.IsEmpty()) {
-    result = script.ToLocalChecked()->Run(lcontext);
+    result = script.ToLocalChecked()->Run(context);
   }
 
   if (result.IsEmpty()) {
@@ -568,6 +763,14 @@ void JScript_context::Impl::f_print(const V8_args &args, bool new_line) {
   mysqlsh::current_console()->print(text);
 }
 
+void JScript_context::Impl::f_print_text(const V8_args &args) {
+  f_print(args, false);
+}
+
+void JScript_context::Impl::f_print_line(const V8_args &args) {
+  f_print(args, true);
+}
+
 void JScript_context::Impl::f_source(const V8_args &args) {
   const auto isolate = args.GetIsolate();
   const auto self = static_cast<Impl *>(isolate->GetData(0));
@@ -771,23 +974,22 @@ bool JScript_context::Impl::is_terminating() const { return m_terminating; }
 void JScript_context::Impl::clear_is_terminating() { m_terminating = false; }
 
 v8::Local<v8::FunctionTemplate> JScript_context::Impl::wrap_callback(
-    v8::FunctionCallback callback) const {
+    v8::Isolate *isolate, v8::FunctionCallback callback) {
   const auto data =
-      v8::External::New(m_isolate, reinterpret_cast<void *>(callback));
+      v8::External::New(isolate, reinterpret_cast<void *>(callback));
+
+  return v8::FunctionTemplate::New(isolate, &Impl::call_wrapped, data);
+}
 
-  return v8::FunctionTemplate::New(
-      m_isolate,
-      [](const V8_args &args) {
-        const auto isolate = args.GetIsolate();
-        const auto self = static_cast<Impl *>(isolate->GetData(0));
+void JScript_context::Impl::call_wrapped(const V8_args &args) {
+  const auto isolate = args.GetIsolate();
+  const auto self = static_cast<Impl *>(isolate->GetData(0));
 
-        if (self->is_terminating()) return;
+  if (self->is_terminating()) return;
 
-        const auto func = reinterpret_cast<v8::FunctionCallback>(
-            v8::External::Cast(*args.Data())->Value());
-        func(args);
-      },
-      data);
+  const auto func = reinterpret_cast<v8::FunctionCallback>(
+      v8::External::Cast(*args.Data())->Value());
+  func(args);
 }
 
 /**
@@ -883,6 +1085,15 @@ JScript_context::JScript_context(Object_registry *registry)
 
 JScript_context::~JScript_context() { m_types->dispose(); }
 
+void JScript_context::create_snapshot(const std::string &path) {
+  Impl::create_snapshot(path);
+}
+
+bool JScript_context::load_snapshot(const std::string &path) {
+  std::lock_guard lock{g_snapshot_mutex};
+  return load_startup_snapshot(path);
+}
+
 void JScript_context::set_global_item(const std::string &global_name,
                                       const std::string &item_name,
                                       const Value &value) {
@@ -913,6 +1124,16 @@ void JScript_context::set_global(const std::string &name, const Value &value) {
   m_impl->set_global(name, convert(value));
 }
 
+void JScript_context::remove_global(const std::string &name) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::TryCatch try_catch{isolate()};
+  const auto ctx = context();
+  v8::Context::Scope context_scope(ctx);
+
+  ctx->Global()->Delete(ctx, v8_string(name)).FromJust();
+}
+
 Value JScript_context::get_global(const std::string &name) {
   // makes isolate the default isolate for this context
   v8::Isolate::Scope isolate_scope(isolate());
@@ -954,6 +954,18 @@ void Python_context::set_global(const std::string &name, const Value &value) {
   PyObject_SetAttrString(_mysqlsh_globals.get(), name.c_str(), p.get());
 }
 
+void Python_context::remove_global(const std::string &name) {
+  WillEnterPython lock;
+
+  if (PyDict_DelItemString(_globals, name.c_str())) {
+    PyErr_Clear();
+  }
+
+  if (PyObject_DelAttrString(_mysqlsh_globals.get(), name.c_str())) {
+    PyErr_Clear();
+  }
+}
+
 Value Python_context::convert(PyObject *value) {
   return py::convert(value, this);
 }
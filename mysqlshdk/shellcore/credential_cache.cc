@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/shellcore/credential_cache.h"
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include <memory>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace shcore {
+
+namespace {
+
+constexpr int k_iv_length = 12;
+constexpr int k_tag_length = 16;
+
+using Cipher_context =
+    std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)>;
+
+Cipher_context new_context() {
+  return Cipher_context{EVP_CIPHER_CTX_new(), ::EVP_CIPHER_CTX_free};
+}
+
+inline unsigned char *to_uchar(std::string *s) {
+  return reinterpret_cast<unsigned char *>(s->data());
+}
+
+inline const unsigned char *to_uchar(const std::string &s) {
+  return reinterpret_cast<const unsigned char *>(s.data());
+}
+
+}  // namespace
+
+Credential_cache::Credential_cache(Clock::duration ttl) : m_ttl(ttl) {
+  m_has_key = 1 == RAND_bytes(m_key, sizeof(m_key));
+
+  if (!m_has_key) {
+    log_warning(
+        "Failed to generate the encryption key, credentials are not going to "
+        "be cached.");
+  }
+}
+
+Credential_cache::~Credential_cache() {
+  clear();
+  OPENSSL_cleanse(m_key, sizeof(m_key));
+}
+
+void Credential_cache::set_ttl(Clock::duration ttl) {
+  std::lock_guard lock{m_mutex};
+  m_ttl = ttl;
+  m_entries.clear();
+}
+
+void Credential_cache::put(const std::string &url,
+                           const std::string &credential) {
+  std::lock_guard lock{m_mutex};
+
+  if (!enabled() || !m_has_key) {
+    return;
+  }
+
+  Entry entry;
+
+  if (encrypt(credential, &entry)) {
+    entry.expires = Clock::now() + m_ttl;
+    m_entries[url] = std::move(entry);
+  } else {
+    m_entries.erase(url);
+  }
+}
+
+bool Credential_cache::get(const std::string &url, std::string *credential) {
+  std::lock_guard lock{m_mutex};
+
+  const auto entry = m_entries.find(url);
+
+  if (m_entries.end() == entry) {
+    return false;
+  }
+
+  if (Clock::now() >= entry->second.expires ||
+      !decrypt(entry->second, credential)) {
+    m_entries.erase(entry);
+    return false;
+  }
+
+  return true;
+}
+
+void Credential_cache::remove(const std::string &url) {
+  std::lock_guard lock{m_mutex};
+  m_entries.erase(url);
+}
+
+void Credential_cache::clear() {
+  std::lock_guard lock{m_mutex};
+  m_entries.clear();
+}
+
+bool Credential_cache::encrypt(const std::string &credential,
+                               Entry *entry) const {
+  const auto ctx = new_context();
+  int length = 0;
+
+  entry->iv.resize(k_iv_length);
+  entry->tag.resize(k_tag_length);
+  entry->data.resize(credential.length());
+
+  if (!ctx || 1 != RAND_bytes(to_uchar(&entry->iv), k_iv_length) ||
+      1 != EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_gcm(), nullptr, m_key,
+                              to_uchar(entry->iv)) ||
+      1 != EVP_EncryptUpdate(ctx.get(), to_uchar(&entry->data), &length,
+                             to_uchar(credential),
+                             static_cast<int>(credential.length())) ||
+      1 != EVP_EncryptFinal_ex(ctx.get(), to_uchar(&entry->data) + length,
+                               &length) ||
+      1 != EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_GET_TAG, k_tag_length,
+                               to_uchar(&entry->tag))) {
+    log_debug("Failed to encrypt the credential");
+    return false;
+  }
+
+  return true;
+}
+
+bool Credential_cache::decrypt(const Entry &entry,
+                               std::string *credential) const {
+  const auto ctx = new_context();
+  std::string tag = entry.tag;
+  std::string result(entry.data.length(), '\0');
+  int length = 0;
+
+  if (!ctx ||
+      1 != EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_gcm(), nullptr, m_key,
+                              to_uchar(entry.iv)) ||
+      1 != EVP_DecryptUpdate(ctx.get(), to_uchar(&result), &length,
+                             to_uchar(entry.data),
+                             static_cast<int>(entry.data.length())) ||
+      1 != EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_SET_TAG, k_tag_length,
+                               to_uchar(&tag)) ||
+      1 != EVP_DecryptFinal_ex(ctx.get(), to_uchar(&result) + length,
+                               &length)) {
+    log_debug("Failed to decrypt the credential");
+    return false;
+  }
+
+  *credential = std::move(result);
+
+  return true;
+}
+
+}  // namespace shcore
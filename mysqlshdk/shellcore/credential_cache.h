@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_SHELLCORE_CREDENTIAL_CACHE_H_
+#define MYSQLSHDK_SHELLCORE_CREDENTIAL_CACHE_H_
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace shcore {
+
+/**
+ * In-memory cache of credentials, used to avoid invoking the credential
+ * helper each time the same credential is needed.
+ *
+ * Credentials are encrypted with a key which is randomly generated when cache
+ * is created, each entry expires once its time to live passes.
+ */
+class Credential_cache final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * Creates the cache.
+   *
+   * @param ttl Time to live of the cached credentials, zero disables the
+   *            cache.
+   */
+  explicit Credential_cache(Clock::duration ttl);
+
+  Credential_cache(const Credential_cache &) = delete;
+  Credential_cache(Credential_cache &&) = delete;
+
+  Credential_cache &operator=(const Credential_cache &) = delete;
+  Credential_cache &operator=(Credential_cache &&) = delete;
+
+  ~Credential_cache();
+
+  /**
+   * Sets time to live of the cached credentials, removes all entries.
+   */
+  void set_ttl(Clock::duration ttl);
+
+  inline Clock::duration ttl() const noexcept { return m_ttl; }
+
+  inline bool enabled() const noexcept { return m_ttl > Clock::duration{}; }
+
+  /**
+   * Stores the credential of the given URL, replacing the existing one.
+   */
+  void put(const std::string &url, const std::string &credential);
+
+  /**
+   * Fetches the credential of the given URL.
+   *
+   * @returns false if credential is not cached or if it has expired.
+   */
+  bool get(const std::string &url, std::string *credential);
+
+  void remove(const std::string &url);
+
+  void clear();
+
+ private:
+  struct Entry {
+    std::string iv;
+    std::string tag;
+    std::string data;
+    Clock::time_point expires;
+  };
+
+  bool encrypt(const std::string &credential, Entry *entry) const;
+
+  bool decrypt(const Entry &entry, std::string *credential) const;
+
+  Clock::duration m_ttl;
+  unsigned char m_key[32];
+  bool m_has_key = false;
+  std::unordered_map<std::string, Entry> m_entries;
+  std::mutex m_mutex;
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_SHELLCORE_CREDENTIAL_CACHE_H_
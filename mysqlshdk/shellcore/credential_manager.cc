@@ -24,6 +24,8 @@
 #include "mysqlshdk/shellcore/credential_manager.h"
 
 #include <algorithm>
+#include <chrono>
+#include <limits>
 
 #include "mysql-secret-store/include/mysql-secret-store/api.h"
 #include "mysqlshdk/include/shellcore/scoped_contexts.h"
@@ -51,6 +53,8 @@ constexpr auto k_disabled_helper_name = "<disabled>";
 constexpr auto k_credential_helper_option = "credentialStore.helper";
 constexpr auto k_save_passwords_option = "credentialStore.savePasswords";
 constexpr auto k_exclude_filters_option = "credentialStore.excludeFilters";
+constexpr auto k_cache_ttl_option = "credentialStore.cacheTtl";
+constexpr auto k_persistent_helper_option = "credentialStore.persistentHelper";
 
 constexpr auto k_credential_helper_cmdline = "--credential-store-helper=<h>";
 constexpr auto k_save_passwords_cmdline = "--save-passwords=<value>";
@@ -62,6 +66,8 @@ constexpr auto k_save_passwords_always = "always";
 constexpr auto k_save_passwords_never = "never";
 constexpr auto k_save_passwords_prompt = "prompt";
 
+constexpr int k_default_cache_ttl = 60;
+
 constexpr auto k_no_such_secret_error = "Could not find the secret";
 constexpr auto k_invalid_url_error = "Invalid URL";
 
@@ -151,7 +157,9 @@ std::string to_string(Credential_manager::Save_passwords val) {
 
 }  // namespace
 
-Credential_manager::Credential_manager() {
+Credential_manager::Credential_manager()
+    : m_cache_ttl(k_default_cache_ttl),
+      m_cache(std::chrono::seconds{k_default_cache_ttl}) {
   observe_notification(SN_SHELL_OPTION_CHANGED);
 }
 
@@ -166,6 +174,8 @@ void Credential_manager::initialize() {
       log_debug2("%.*s", (int)msg.size(), msg.data());
     });
 
+    set_cache_ttl();
+
     if (k_disabled_helper_name == m_helper_string) {
       log_info("Credential store mechanism has been disabled by the user.");
     } else {
@@ -259,7 +269,14 @@ void Credential_manager::register_options(Options *options) {
         }
 
         return ret_val.json(false);
-      });
+      })(
+      &m_cache_ttl, k_default_cache_ttl, k_cache_ttl_option,
+      "Number of seconds for which the passwords fetched from or stored by "
+      "the credential helper are cached in memory, 0 disables the cache.",
+      opts::Range<int>(0, std::numeric_limits<int>::max()))(
+      &m_persistent_helper, false, k_persistent_helper_option,
+      "Starts the credential helper once and uses it to execute all "
+      "operations, instead of starting it for each operation.");
 }
 
 void Credential_manager::handle_notification(const std::string &name,
@@ -274,18 +291,31 @@ void Credential_manager::handle_notification(const std::string &name,
       log_info(
           "Credential store helper changed to: %s",
           m_helper ? m_helper->name().path().c_str() : k_disabled_helper_name);
+    } else if (data->get_string("option") == k_cache_ttl_option) {
+      set_cache_ttl();
+    } else if (data->get_string("option") == k_persistent_helper_option) {
+      if (m_helper) {
+        m_helper->set_persistent(m_persistent_helper);
+      }
     }
   }
 }
 
 void Credential_manager::set_helper(const std::string &helper) {
+  m_cache.clear();
+
   if (k_disabled_helper_name == helper) {
     m_helper.reset(nullptr);
   } else {
     m_helper = get_helper(helper);
+    m_helper->set_persistent(m_persistent_helper);
   }
 }
 
+void Credential_manager::set_cache_ttl() {
+  m_cache.set_ttl(std::chrono::seconds{m_cache_ttl});
+}
+
 std::vector<std::string> Credential_manager::list_credential_helpers() const {
   std::vector<std::string> helpers;
 
@@ -298,10 +328,18 @@ std::vector<std::string> Credential_manager::list_credential_helpers() const {
 
 bool Credential_manager::get_password(mysqlshdk::IConnection *options) const {
   if (m_helper) {
+    const auto spec = get_secret_spec(*options);
     std::string password;
-    bool ret = m_helper->get(get_secret_spec(*options), &password);
+
+    if (m_cache.get(spec.url, &password)) {
+      options->set_password(password);
+      return true;
+    }
+
+    bool ret = m_helper->get(spec, &password);
 
     if (ret) {
+      m_cache.put(spec.url, password);
       options->set_password(password);
     } else {
       auto error = m_helper->get_last_error();
@@ -319,10 +357,15 @@ bool Credential_manager::get_password(mysqlshdk::IConnection *options) const {
 
 bool Credential_manager::save_password(const mysqlshdk::IConnection &options) {
   if (m_helper && should_save_password(get_url(options))) {
-    bool ret =
-        m_helper->store(get_secret_spec(options), options.get_password());
+    const auto spec = get_secret_spec(options);
+    // different URLs may refer to the same secret, invalidate all of them
+    m_cache.clear();
 
-    if (!ret) {
+    bool ret = m_helper->store(spec, options.get_password());
+
+    if (ret) {
+      m_cache.put(spec.url, options.get_password());
+    } else {
       mysqlsh::current_console()->print_error("Failed to store the password: " +
                                               m_helper->get_last_error());
     }
@@ -336,6 +379,8 @@ bool Credential_manager::save_password(const mysqlshdk::IConnection &options) {
 bool Credential_manager::remove_password(
     const mysqlshdk::IConnection &options) {
   if (m_helper) {
+    m_cache.clear();
+
     bool ret = m_helper->erase(get_secret_spec(options));
 
     if (!ret) {
@@ -356,8 +401,14 @@ bool Credential_manager::get_credential(const std::string &url,
         "Cannot get the credential, current credential helper is invalid");
   }
 
+  if (m_cache.get(url, credential)) {
+    return true;
+  }
+
   bool ret = m_helper->get({Secret_type::PASSWORD, url}, credential);
-  if (!ret) {
+  if (ret) {
+    m_cache.put(url, *credential);
+  } else {
     auto error = m_helper->get_last_error();
     if (k_no_such_secret_error != error) {
       mysqlsh::current_console()->print_error(
@@ -374,6 +425,8 @@ void Credential_manager::store_credential(const std::string &url,
         "Cannot save the credential, current credential helper is invalid");
   }
 
+  m_cache.clear();
+
   if (!m_helper->store({Secret_type::PASSWORD, url}, credential)) {
     auto error = m_helper->get_last_error();
 
@@ -391,6 +444,8 @@ void Credential_manager::delete_credential(const std::string &url) {
         "Cannot delete the credential, current credential helper is invalid");
   }
 
+  m_cache.clear();
+
   if (!m_helper->erase({Secret_type::PASSWORD, url})) {
     auto error = m_helper->get_last_error();
 
@@ -411,6 +466,8 @@ void Credential_manager::delete_all_credentials() {
 
   std::vector<Secret_spec> specs;
 
+  m_cache.clear();
+
   if (!m_helper->list(&specs)) {
     throw Exception::runtime_error(
         "Failed to obtain list of credentials to delete: " +
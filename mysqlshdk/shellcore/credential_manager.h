@@ -32,6 +32,7 @@
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/utils/connection.h"
 #include "mysqlshdk/libs/utils/options.h"
+#include "mysqlshdk/shellcore/credential_cache.h"
 
 namespace mysql {
 namespace secret_store {
@@ -96,11 +97,17 @@ class Credential_manager : public NotificationObserver {
 
   bool is_ignored_url(const std::string &url) const;
 
+  void set_cache_ttl();
+
   std::unique_ptr<::mysql::secret_store::api::Helper_interface> m_helper;
   std::string m_helper_string;
   Save_passwords m_save_passwords = Save_passwords::PROMPT;
   std::vector<std::string> m_ignore_filters;
+  int m_cache_ttl;
+  bool m_persistent_helper = false;
   bool m_is_initialized = false;
+  // credentials fetched from or stored by the helper
+  mutable Credential_cache m_cache;
 };
 
 }  // namespace shcore
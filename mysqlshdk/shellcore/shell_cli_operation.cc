@@ -160,6 +160,21 @@ void Shell_cli_operation::set_method_name(const std::string &name) {
   m_cli_mapper.set_operation_name(name);
 }
 
+std::string Shell_cli_operation::get_target_object() const {
+  if (const auto &chain = m_cli_mapper.get_object_chain(); !chain.empty()) {
+    return chain.front();
+  }
+
+  if (const auto &args = m_cli_mapper.get_cmdline_args(); !args.empty()) {
+    if (const auto &name = args.front().definition;
+        !name.empty() && name[0] != '-') {
+      return name;
+    }
+  }
+
+  return {};
+}
+
 /**
  * Parses the command line to identify the operation to be executed as well as
  * to aggregate the received arguments into a list for further processing.
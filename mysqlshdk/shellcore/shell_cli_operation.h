@@ -51,6 +51,15 @@ class Shell_cli_operation {
 
   bool help_requested() { return m_cli_mapper.help_requested(); }
 
+  /**
+   * Returns the name of the top level object the operation is going to be
+   * executed on, this is available before prepare() is called.
+   *
+   * @returns empty string if there's no target object, i.e. global CLI help
+   * was requested.
+   */
+  std::string get_target_object() const;
+
   void prepare();
 
   Value execute();
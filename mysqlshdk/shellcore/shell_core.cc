@@ -243,6 +243,22 @@ void Shell_core::set_global(const std::string &name, const Value &value,
   }
 }
 
+void Shell_core::remove_global(const std::string &name) {
+  const auto global = _globals.find(name);
+
+  if (_globals.end() == global) {
+    return;
+  }
+
+  for (const auto &lang : _langs) {
+    if (global->second.first.is_set(lang.first)) {
+      lang.second->remove_global(name);
+    }
+  }
+
+  _globals.erase(global);
+}
+
 bool Shell_core::is_global(const std::string &name) {
   return _globals.find(name) != _globals.end();
 }
@@ -81,6 +81,10 @@ void Shell_javascript::set_global(const std::string &name, const Value &value) {
   _js->set_global(name, value);
 }
 
+void Shell_javascript::remove_global(const std::string &name) {
+  _js->remove_global(name);
+}
+
 void Shell_javascript::set_argv(const std::vector<std::string> &argv) {
   _js->set_argv(argv);
 }
@@ -334,9 +334,13 @@ Shell_options::Shell_options(
          }
          return value;
       })
-    (&storage.ssh.buffer_size, 10240, "ssh.bufferSize",
-    "Set buffer size in bytes for data transfer, default is 10240 (10Kb)",
-      shcore::opts::Range<int>(0, std::numeric_limits<int>::max()));
+    (&storage.ssh.buffer_size, 65536, "ssh.bufferSize",
+    "Set buffer size in bytes for data transfer, default is 65536 (64Kb)",
+      shcore::opts::Range<int>(0, std::numeric_limits<int>::max()))
+    (&storage.ssh.tunnel_threads, 1, "ssh.tunnelThreads",
+    "Maximum number of threads, each using a separate SSH connection, which "
+    "transfer data of a single SSH tunnel, default is 1",
+      shcore::opts::Range<int>(1, 64));
 
 #ifdef _WIN32
   add_startup_options()
@@ -555,14 +559,18 @@ Shell_options::Shell_options(
     (cmdline("--pym <module>"),
        "Run Python library module as a script. Remaining args are forwarded to it.")
     (&storage.wrap_json, "off", cmdline("--json[=<format>]"),
-        "Produce output in JSON format. Allowed values: raw, pretty, and off. "
-        "If no format is specified pretty format is produced.",
-        [](const std::string &val, Source) {
+        "Produce output in JSON format. Allowed values: raw, pretty, ndjson "
+        "and off. If no format is specified pretty format is produced. The "
+        "ndjson format is the same as raw, but rows of the results are "
+        "printed as separate documents, one per line.",
+        [this](const std::string &val, Source) {
+          storage.wrap_json_rows = val == "ndjson";
+
           if (val == "off") return "off";
           if (val.empty() || val == "pretty") return "json";
-          if (val == "raw") return "json/raw";
+          if (val == "raw" || val == "ndjson") return "json/raw";
           throw std::invalid_argument(
-              "Value for --json must be either pretty, raw or off.");
+              "Value for --json must be either pretty, raw, ndjson or off.");
         })
     (cmdline("--table"),
         "Produce output in table format (default for interactive mode). This "
@@ -608,6 +616,10 @@ Shell_options::Shell_options(
     (&storage.devapi_schema_object_handles, true,
         SHCORE_DEVAPI_DB_OBJECT_HANDLES,
         "Enable table and collection name handles for the DevAPI db object.")
+    (&storage.devapi_pipeline_depth, 64, SHCORE_DEVAPI_PIPELINE_DEPTH,
+        "Maximum number of DevAPI operations executed using executeAsync() "
+        "which can await their results.",
+        shcore::opts::Range<int>(1, std::numeric_limits<int>::max()))
     (&storage.log_sql_ignore, "*SELECT*:SHOW*",
         SHCORE_LOG_SQL_IGNORE,
         "Colon separated list of SQL statement patterns to filter out, unless logSql is set to 'all' or 'unfiltered'."
@@ -812,6 +824,8 @@ Shell_options::Shell_options(
         assign_value(&storage.wizards, false))
     (&storage.no_password, false, cmdline("--no-password"),
         "Sets empty password and disables prompt for password.")
+    (&storage.startup_profile, false, cmdline("--startup-profile"),
+        "Prints the time spent in each of the startup phases.")
     (cmdline("-V", "--version"),
         "Prints the version of MySQL Shell.", [this](const std::string&, const char*) {
         if (print_cmd_line_version) {
@@ -1426,7 +1440,8 @@ void Shell_options::check_ssh_conflicts() {
 void Shell_options::check_result_format() {
   if (storage.wrap_json != "off" &&
       get_option_source(SHCORE_RESULT_FORMAT) == Source::Command_line &&
-      storage.wrap_json != storage.result_format)
+      storage.wrap_json != storage.result_format &&
+      !(storage.wrap_json == "json/raw" && storage.result_format == "ndjson"))
     throw std::invalid_argument(shcore::str_format(
         "Conflicting options: " SHCORE_RESULT_FORMAT
         " cannot be set to '%s' when "
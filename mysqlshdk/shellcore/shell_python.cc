@@ -105,6 +105,10 @@ void Shell_python::set_global(const std::string &name, const Value &value) {
   _py->set_global(name, value);
 }
 
+void Shell_python::remove_global(const std::string &name) {
+  _py->remove_global(name);
+}
+
 void Shell_python::set_argv(const std::vector<std::string> &argv) {
   _py->set_argv(argv);
 }
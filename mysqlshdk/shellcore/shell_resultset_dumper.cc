@@ -47,6 +47,10 @@
 // in order to calculate column widths
 static constexpr const int k_pre_fetch_result_rows = 1000;
 
+// max # of bytes of JSON output buffered when dumping resultsets wrapped in
+// JSON, before they are flushed to the output
+static constexpr const size_t k_json_flush_size = 64 * 1024;
+
 namespace mysqlsh {
 
 /* Calculates the required buffer size and display size considering:
@@ -488,6 +492,14 @@ class String_printer : public Resultset_printer {
   std::string m_output;
 };
 
+/**
+ * Format of the results, --json=ndjson takes precedence over the configured
+ * result format.
+ */
+std::string default_result_format(const Shell_options::Storage &options) {
+  return options.wrap_json_rows ? "ndjson" : options.result_format;
+}
+
 }  // namespace
 
 Resultset_dumper_base::Resultset_dumper_base(
@@ -499,17 +511,20 @@ Resultset_dumper_base::Resultset_dumper_base(
       m_format(format),
       m_printer(std::move(printer)),
       m_show_column_type_info(show_column_type_info) {
-  if (m_format == "ndjson") m_format = "json/raw";
+  if (m_format == "ndjson") {
+    m_ndjson = m_wrap_json == "json/raw";
+    m_format = "json/raw";
+  }
 }
 
 Resultset_dumper::Resultset_dumper(mysqlshdk::db::IResult *target,
                                    bool show_column_type_info)
-    : Resultset_dumper(target,
-                       mysqlsh::current_shell_options()->get().wrap_json,
-                       mysqlsh::current_shell_options()->get().result_format,
-                       mysqlsh::current_shell_options()->get().show_warnings,
-                       mysqlsh::current_shell_options()->get().interactive,
-                       show_column_type_info) {}
+    : Resultset_dumper(
+          target, mysqlsh::current_shell_options()->get().wrap_json,
+          default_result_format(mysqlsh::current_shell_options()->get()),
+          mysqlsh::current_shell_options()->get().show_warnings,
+          mysqlsh::current_shell_options()->get().interactive,
+          show_column_type_info) {}
 
 Resultset_dumper::Resultset_dumper(mysqlshdk::db::IResult *target,
                                    const std::string &wrap_json,
@@ -812,56 +827,145 @@ size_t Resultset_dumper_base::format_vertical(bool has_header, bool align_right,
  * - Statistics
  * - Warnings
  *
+ * The document is streamed to the given output callback as the rows are
+ * fetched, memory usage does not depend on the size of the result.
+ *
  * This function is used when JSON Wrapping is turned ON
  */
-std::string Resultset_dumper_base::format_json(const std::string &item_label,
-                                               bool is_doc_result, bool pretty,
-                                               int *row_count) {
-  assert(row_count);
+size_t Resultset_dumper_base::format_json(
+    const std::string &item_label, bool is_doc_result, bool pretty,
+    const std::function<void(const std::string &)> &output) {
+  const auto has_resultset = m_result->has_resultset();
+
+  // metadata is a separate document, it has to be printed before the result
+  if (has_resultset && show_column_type_info()) dump_metadata();
+
   shcore::JSON_dumper dumper(
       pretty, mysqlsh::current_shell_options()->get().binary_limit);
 
   dumper.start_object();
   dumper.append_string("hasData");
-  dumper.append_bool(m_result->has_resultset());
+  dumper.append_bool(has_resultset);
 
   dumper.append_string(item_label + "s");
   dumper.start_array();
 
-  *row_count = 0;
-  if (m_result->has_resultset()) {
-    if (show_column_type_info()) dump_metadata();
+  size_t row_count = 0;
 
+  if (has_resultset) {
     const auto &metadata = m_result->get_metadata();
     auto row = m_result->fetch_one();
-    while (row) {
+    while (row && !m_cancelled) {
       if (is_doc_result) {
         dumper.append_json(row->get_string(0));
       } else {
         dump_json_row(&dumper, metadata, row);
       }
-      (*row_count)++;
+      ++row_count;
+
+      if (dumper.str().size() >= k_json_flush_size) {
+        output(dumper.str());
+        dumper.clear();
+      }
+
       row = m_result->fetch_one();
     }
   }
 
   dumper.end_array();
 
-  dumper.append_string("executionTime");
-  dumper.append_string(
+  append_json_summary(&dumper, is_doc_result);
+
+  dumper.end_object();
+
+  output(dumper.str());
+
+  return row_count;
+}
+
+/**
+ * Streams the result as newline delimited JSON: each row is written as a
+ * separate document in its own line, followed by a document holding the
+ * statistics and warnings.
+ *
+ * This function is used when JSON Wrapping is turned ON and the ndjson format
+ * was requested.
+ */
+size_t Resultset_dumper_base::format_ndjson(
+    const std::string &item_label, bool is_doc_result,
+    const std::function<void(const std::string &)> &output) {
+  const auto has_resultset = m_result->has_resultset();
+  const auto binary_limit =
+      mysqlsh::current_shell_options()->get().binary_limit;
+
+  if (has_resultset && show_column_type_info()) dump_metadata();
+
+  std::string buffer;
+  size_t row_count = 0;
+
+  if (has_resultset) {
+    const auto &metadata = m_result->get_metadata();
+    auto row = m_result->fetch_one();
+    while (row && !m_cancelled) {
+      shcore::JSON_dumper dumper(false, binary_limit);
+
+      if (is_doc_result) {
+        dumper.append_json(row->get_string(0));
+      } else {
+        dump_json_row(&dumper, metadata, row);
+      }
+      ++row_count;
+
+      buffer += dumper.str();
+      buffer += '\n';
+
+      if (buffer.size() >= k_json_flush_size) {
+        output(buffer);
+        buffer.clear();
+      }
+
+      row = m_result->fetch_one();
+    }
+  }
+
+  shcore::JSON_dumper dumper(false, binary_limit);
+
+  dumper.start_object();
+  dumper.append_string("hasData");
+  dumper.append_bool(has_resultset);
+  dumper.append_string(item_label + "Count");
+  dumper.append_uint64(row_count);
+
+  append_json_summary(&dumper, is_doc_result);
+
+  dumper.end_object();
+
+  buffer += dumper.str();
+  output(buffer);
+
+  return row_count;
+}
+
+/**
+ * Appends the statistics and warnings of the result to an open JSON object.
+ */
+void Resultset_dumper_base::append_json_summary(shcore::JSON_dumper *dumper,
+                                                bool is_doc_result) {
+  dumper->append_string("executionTime");
+  dumper->append_string(
       mysqlshdk::utils::format_seconds(m_result->get_execution_time()));
   if (!is_doc_result) {
-    dumper.append_string("affectedRowCount");
-    dumper.append_uint64(m_result->get_affected_row_count());
+    dumper->append_string("affectedRowCount");
+    dumper->append_uint64(m_result->get_affected_row_count());
   }
-  dumper.append_string("affectedItemsCount");
-  dumper.append_uint64(m_result->get_affected_row_count());
-  dumper.append_string("warningCount");
-  dumper.append_int64(m_result->get_warning_count());
-  dumper.append_string("warningsCount");
-  dumper.append_uint64(m_result->get_warning_count());
-  dumper.append_string("warnings");
-  dumper.start_array();
+  dumper->append_string("affectedItemsCount");
+  dumper->append_uint64(m_result->get_affected_row_count());
+  dumper->append_string("warningCount");
+  dumper->append_int64(m_result->get_warning_count());
+  dumper->append_string("warningsCount");
+  dumper->append_uint64(m_result->get_warning_count());
+  dumper->append_string("warnings");
+  dumper->start_array();
   auto warning = m_result->fetch_one_warning();
   while (warning) {
     std::string level;
@@ -876,39 +980,41 @@ std::string Resultset_dumper_base::format_json(const std::string &item_label,
         level = "Error";
         break;
     }
-    dumper.start_object();
-    dumper.append_string("Level", level);
-    dumper.append_string("Code");
-    dumper.append_int(warning->code);
-    dumper.append_string("Message", warning->msg);
-    dumper.end_object();
+    dumper->start_object();
+    dumper->append_string("Level", level);
+    dumper->append_string("Code");
+    dumper->append_int(warning->code);
+    dumper->append_string("Message", warning->msg);
+    dumper->end_object();
     warning = m_result->fetch_one_warning();
   }
-  dumper.end_array();
+  dumper->end_array();
 
-  dumper.append_string("info");
-  dumper.append_string(m_result->get_info());
+  dumper->append_string("info");
+  dumper->append_string(m_result->get_info());
 
-  dumper.append_string("autoIncrementValue");
-  dumper.append_int64(m_result->get_auto_increment_value());
+  dumper->append_string("autoIncrementValue");
+  dumper->append_int64(m_result->get_auto_increment_value());
 
   if (const auto statement_id = m_result->get_statement_id();
       !statement_id.empty()) {
-    dumper.append_string("statementId");
-    dumper.append_string(statement_id);
+    dumper->append_string("statementId");
+    dumper->append_string(statement_id);
   }
-
-  dumper.end_object();
-
-  return dumper.str();
 }
 
 size_t Resultset_dumper_base::dump_json(const std::string &item_label,
                                         bool is_doc_result) {
-  int row_count = 0;
+  const auto output = [this](const std::string &s) { m_printer->raw_print(s); };
+  size_t row_count = 0;
+
+  if (m_ndjson) {
+    row_count = format_ndjson(item_label, is_doc_result, output);
+  } else {
+    row_count =
+        format_json(item_label, is_doc_result, m_wrap_json == "json", output);
+  }
 
-  m_printer->raw_print(format_json(item_label, is_doc_result,
-                                   m_wrap_json == "json", &row_count));
   m_printer->raw_print("\n");
 
   return row_count;
@@ -1139,15 +1245,21 @@ bool Gui_resultset_dumper::show_column_type_info() const {
 
 size_t Gui_resultset_dumper::dump_json(const std::string &item_label,
                                        bool is_doc_result) {
-  int row_count = 0;
+  size_t row_count = 0;
   if (shcore::str_beginswith(m_format, "json")) {
     auto pretty = m_format == "json/pretty";
     if (mysqlsh::current_shell_options()->get().show_column_type_info) {
       m_printer->print(format_json_metadata(pretty));
     }
 
-    m_printer->print(
-        format_json(item_label, is_doc_result, pretty, &row_count));
+    // each print() is sent to the GUI as a separate message, document needs
+    // to be printed at once
+    std::string output;
+    row_count =
+        format_json(item_label, is_doc_result, pretty,
+                    [&output](const std::string &s) { output += s; });
+
+    m_printer->print(output);
     m_printer->print("\n");
   } else {
     row_count = Resultset_dumper::dump_json(item_label, is_doc_result);
@@ -1157,9 +1269,10 @@ size_t Gui_resultset_dumper::dump_json(const std::string &item_label,
 }
 
 Resultset_writer::Resultset_writer(mysqlshdk::db::IResult *target)
-    : Resultset_writer(target, std::make_unique<String_printer>(),
-                       mysqlsh::current_shell_options()->get().wrap_json,
-                       mysqlsh::current_shell_options()->get().result_format) {}
+    : Resultset_writer(
+          target, std::make_unique<String_printer>(),
+          mysqlsh::current_shell_options()->get().wrap_json,
+          default_result_format(mysqlsh::current_shell_options()->get())) {}
 
 Resultset_writer::Resultset_writer(mysqlshdk::db::IResult *target,
                                    std::unique_ptr<Resultset_printer> printer,
@@ -1217,7 +1330,7 @@ size_t dump_result(mysqlshdk::db::IResult *target,
 
   bool gui_mode = options.gui_mode;
 
-  std::string format = opt_format.value_or(options.result_format);
+  std::string format = opt_format.value_or(default_result_format(options));
 
   std::shared_ptr<Resultset_dumper> dumper;
   // The GUI dumper is used in the cases that require specific formatting for
@@ -22,7 +22,9 @@
  */
 
 #include "shellcore/utils_help.h"
+#include <atomic>
 #include <cctype>
+#include <deque>
 #include <regex>
 #include <vector>
 #include "mysqlshdk/libs/textui/textui.h"
@@ -74,6 +76,20 @@ const std::regex k_cli_option_help_regexp(
     "b>)?(:\\s|\\s-\\s)((([a-z|A-Z|\\s]+)(\\s\\([default|required]*(.*)\\))?"
     "\\s-\\s)?(.*))$");
 
+struct Lazy_help_registry {
+  std::mutex mutex;
+  std::vector<Help_registry::Lazy_help> entries;
+  // copies of the help text which was not registered statically
+  std::deque<std::string> strings;
+  // number of entries which were added, but were not registered yet
+  std::atomic<std::size_t> pending{0};
+};
+
+Lazy_help_registry &lazy_help_registry() {
+  static Lazy_help_registry s_registry;
+  return s_registry;
+}
+
 std::map<std::string, std::string> parse_cli_option_data(
     const std::vector<std::string> &data) {
   std::map<std::string, std::string> options;
@@ -420,9 +436,108 @@ Help_registry *Help_registry::get() {
   return &instance;
 }
 
+void Help_registry::add_lazy_help(const Lazy_help &help) {
+  auto &registry = lazy_help_registry();
+  std::lock_guard lock{registry.mutex};
+  registry.entries.emplace_back(help);
+  ++registry.pending;
+}
+
+bool Help_registry::has_lazy_help() {
+  return lazy_help_registry().pending > 0;
+}
+
+void Help_registry::load_lazy_help() {
+  // lazy help always goes to the global registry
+  if (m_threaded) return get()->load_lazy_help();
+
+  auto &registry = lazy_help_registry();
+
+  if (0 == registry.pending) return;
+
+  // registry lock is held until all the pending entries are registered, this
+  // way threads which request or add help at the same time wait until it's
+  // done
+  auto lock = ensure_lock();
+
+  if (m_loading_lazy_help) return;
+
+  m_loading_lazy_help = true;
+  shcore::Scoped_callback loaded([this]() { m_loading_lazy_help = false; });
+
+  std::vector<Lazy_help> entries;
+
+  {
+    std::lock_guard entries_lock{registry.mutex};
+
+    if (registry.entries.empty()) return;
+
+    std::swap(entries, registry.entries);
+  }
+
+  for (const auto &entry : entries) {
+    switch (entry.type) {
+      case Lazy_help::Type::TEXT:
+        add_help(entry.token, entry.data);
+        break;
+
+      case Lazy_help::Type::SPLIT_TEXT:
+        add_split_help(entry.token, entry.data, entry.auto_brief,
+                       entry.nosuffix, entry.is_shell_command);
+        break;
+
+      case Lazy_help::Type::TOPIC_TEXT:
+        add_split_help(entry.token, entry.data, entry.auto_brief, false);
+        add_help(entry.token, std::string{"${"} + entry.token + "_DETAIL}");
+        break;
+    }
+  }
+
+  registry.pending -= entries.size();
+
+  if (0 == registry.pending) {
+    // copies are no longer referenced
+    std::lock_guard entries_lock{registry.mutex};
+    registry.strings.clear();
+  }
+}
+
+bool Help_registry::defer_help(Lazy_help help, const std::string &token,
+                               const std::string &data) {
+  // lazy help always goes to the global registry
+  if (m_threaded) return false;
+
+  auto &registry = lazy_help_registry();
+
+  if (0 == registry.pending) return false;
+
+  auto lock = ensure_lock();
+
+  // help registered while lazy help is being loaded is registered right away
+  if (m_loading_lazy_help || 0 == registry.pending) return false;
+
+  std::lock_guard entries_lock{registry.mutex};
+
+  help.token = registry.strings.emplace_back(token).c_str();
+  help.data = registry.strings.emplace_back(data).c_str();
+
+  registry.entries.emplace_back(help);
+  ++registry.pending;
+
+  return true;
+}
+
 void Help_registry::add_split_help(const std::string &prefix,
                                    const std::string &data, bool auto_brief,
                                    bool nosuffix, bool is_shell_command) {
+  // if lazy help was not registered yet, this help is registered after it, to
+  // preserve the order
+  if (defer_help({Lazy_help::Type::SPLIT_TEXT, nullptr, nullptr, auto_brief,
+                  nosuffix, is_shell_command},
+                 prefix, data)) {
+    return;
+  }
+
   std::map<std::string, int> current_index;
 
   auto token = [&prefix, &current_index](const std::string &suffix) {
@@ -573,6 +688,13 @@ void Help_registry::add_split_help(const std::string &prefix,
 
 void Help_registry::add_help(const std::string &token, const std::string &data,
                              Keyword_location loc) {
+  // if lazy help was not registered yet, this help is registered after it, to
+  // preserve the order
+  if (Keyword_location::GLOBAL_CTX == loc &&
+      defer_help({Lazy_help::Type::TEXT, nullptr, nullptr}, token, data)) {
+    return;
+  }
+
   auto lock = ensure_lock();
   if (loc == Keyword_location::LOCAL_CTX) {
     get_thread_context_help()->m_help_data[token] = data;
@@ -1024,6 +1146,9 @@ void Help_registry::register_keyword(const std::string &keyword,
 }
 
 std::string Help_registry::get_token(const std::string &token) const {
+  // help text is registered on first use
+  get()->load_lazy_help();
+
   std::string ret_val;
 
   try {
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Creates the V8 startup snapshot used by the JavaScript mode, i.e.:
+//
+//   mysqlsh_js_snapshot path/to/js_snapshot.bin
+//
+// This is executed at build time, the snapshot is then installed in the share
+// folder.
+
+#include <iostream>
+#include <stdexcept>
+
+#include "mysqlshdk/include/scripting/jscript_context.h"
+
+namespace shcore {
+extern void JScript_context_init();
+extern void JScript_context_fini();
+}  // namespace shcore
+
+int main(int argc, char **argv) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " path/to/js_snapshot.bin\n";
+    return 1;
+  }
+
+  int rc = 0;
+
+  shcore::JScript_context_init();
+
+  try {
+    shcore::JScript_context::create_snapshot(argv[1]);
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    rc = 1;
+  }
+
+  shcore::JScript_context_fini();
+
+  return rc;
+}
@@ -577,6 +577,22 @@ static std::shared_ptr<mysqlsh::Shell_options> process_args(int *argc,
   return shell_options;
 }
 
+static void print_startup_profile() {
+  const auto &timer = mysqlsh::Mysql_shell::startup_timer();
+  std::string profile = "Startup profile:\n";
+
+  for (const auto &tp : timer.trace_points()) {
+    profile += std::string(2 * (tp.depth + 1), ' ');
+    profile += shcore::str_format("%s: %.3f ms\n", tp.note,
+                                  tp.milliseconds_elapsed());
+  }
+
+  profile += shcore::str_format("Total: %.3f ms",
+                                timer.total_milliseconds_elapsed());
+
+  mysqlsh::current_console()->print_diag(profile);
+}
+
 static void init_shell(std::shared_ptr<mysqlsh::Command_line_shell> shell) {
 #ifdef ENABLE_SESSION_RECORDING
   init_debug_shell(shell);
@@ -703,9 +719,13 @@ int main(int argc, char **argv) {
   shcore::setenv("LC_ALL", "en_US.UTF-8");
 #endif  // _WIN32
 
+  auto &startup_timer = mysqlsh::Mysql_shell::startup_timer();
+
+  startup_timer.stage_begin("global init");
   mysqlsh::global_init();
 
   setup_path_env();
+  startup_timer.stage_end();
 
   // Has to be called once in main so internal static variable is properly set
   // with the main thread id.
@@ -718,15 +738,18 @@ int main(int argc, char **argv) {
   mysqlsh::Scoped_interrupt interrupt_handler(
       shcore::Interrupts::create(&sighelper));
 
+  startup_timer.stage_begin("options");
   std::shared_ptr<mysqlsh::Shell_options> shell_options =
       process_args(&argc, &argv);
   const mysqlsh::Shell_options::Storage &options = shell_options->get();
+  startup_timer.stage_end();
 
   if (options.exit_code != 0) return options.exit_code;
 
   mysqlsh::Scoped_shell_options scoped_shell_options(shell_options);
 
   std::shared_ptr<shcore::Logger> logger;
+  startup_timer.stage_begin("logger");
   try {
     // Setup logging
     logger = shcore::Logger::create_instance(
@@ -736,6 +759,7 @@ int main(int argc, char **argv) {
     fprintf(stderr, "%s\n", e.what());
     exit(1);
   }
+  startup_timer.stage_end();
 
   mysqlsh::Scoped_logger scoped_logger(logger);
 
@@ -762,6 +786,8 @@ int main(int argc, char **argv) {
 
     bool valid_color_capability = detect_color_capability();
 
+    startup_timer.stage_begin("shell");
+
     // The Json_shell mode is enabled when this env variable is defined
     char *json_shell = getenv("MYSQLSH_JSON_SHELL");
     if (json_shell) {
@@ -782,6 +808,7 @@ int main(int argc, char **argv) {
     }
 
     init_shell(shell);
+    startup_timer.stage_end();
 
     // Since log initialization errors are not critical but just warnings, they
     // get printed in a delayed way to have them properly formatted based on the
@@ -848,11 +875,15 @@ int main(int argc, char **argv) {
                 "insecure.");
           }
 
+          startup_timer.stage_begin("connect");
+
           // Connect to the requested instance
           shell->connect(target, options.recreate_database);
 
           // If redirect is requested, then reconnect to the right instance
           handle_redirect(shell, options.redirect_session);
+
+          startup_timer.stage_end();
         } catch (const mysqlshdk::db::Error &e) {
           std::string error = "MySQL Error ";
           error.append(std::to_string(e.code()));
@@ -885,6 +916,8 @@ int main(int argc, char **argv) {
         }
       }
 
+      startup_timer.stage_begin("extra globals");
+
       try {
         // initialize globals requested via command line (i.e. --cluster,
         // --replicaset)
@@ -896,6 +929,10 @@ int main(int argc, char **argv) {
 
       if (valid_color_capability) shell->load_prompt_theme(pick_prompt_theme());
 
+      startup_timer.stage_end();
+
+      if (options.startup_profile) print_startup_profile();
+
       const auto shell_cli_operation = shell_options->get_shell_cli_operation();
 
       if (shell_cli_operation) {
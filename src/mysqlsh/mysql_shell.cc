@@ -25,9 +25,11 @@
 #include <mysqld_error.h>
 #include <algorithm>
 #include <atomic>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
@@ -197,6 +199,109 @@ std::optional<std::string> parse_param_for_use_cmd(const std::string &line) {
   return line.substr(start, end - start);
 }
 
+// name of the file which declares what is provided by a lazily loaded plugin
+constexpr auto k_plugin_manifest = "manifest.json";
+
+/**
+ * Placeholder of a global object provided by a plugin which is loaded on
+ * demand. Plugin is loaded when this object is used for the first time, all
+ * the calls are then forwarded to the global object registered by the plugin.
+ */
+class Lazy_global final : public shcore::Cpp_object_bridge {
+ public:
+  Lazy_global(const std::string &name, std::function<shcore::Value()> load)
+      : m_name(name), m_load(std::move(load)) {}
+
+  std::string class_name() const override { return m_name; }
+
+  std::vector<std::string> get_members() const override {
+    return target()->get_members();
+  }
+
+  shcore::Value get_member(const std::string &prop) const override {
+    return target()->get_member(prop);
+  }
+
+  bool has_member(const std::string &prop) const override {
+    return target()->has_member(prop);
+  }
+
+  void set_member(const std::string &prop, shcore::Value value) override {
+    target()->set_member(prop, std::move(value));
+  }
+
+  bool has_method(const std::string &name) const override {
+    return target()->has_method(name);
+  }
+
+  shcore::Value call(const std::string &name,
+                     const shcore::Argument_list &args) override {
+    return target()->call(name, args);
+  }
+
+  shcore::Value get_member_advanced(const std::string &prop) const override {
+    return target()->get_member_advanced(prop);
+  }
+
+  bool has_member_advanced(const std::string &prop) const override {
+    return target()->has_member_advanced(prop);
+  }
+
+  void set_member_advanced(const std::string &prop,
+                           shcore::Value value) override {
+    target()->set_member_advanced(prop, std::move(value));
+  }
+
+  bool has_method_advanced(const std::string &name) const override {
+    return target()->has_method_advanced(name);
+  }
+
+  shcore::Value call_advanced(
+      const std::string &name, const shcore::Argument_list &args,
+      const shcore::Dictionary_t &kwargs = {}) override {
+    return target()->call_advanced(name, args, kwargs);
+  }
+
+  std::string &append_descr(std::string &s_out, int indent = -1,
+                            int quote_strings = 0) const override {
+    return target()->append_descr(s_out, indent, quote_strings);
+  }
+
+  std::string &append_repr(std::string &s_out) const override {
+    return target()->append_repr(s_out);
+  }
+
+  std::string help(const std::string &item = {}) override {
+    return target()->help(item);
+  }
+
+ private:
+  const std::shared_ptr<shcore::Cpp_object_bridge> &target() const {
+    // plugin is loaded once, even if placeholder is used by many threads
+    std::call_once(m_load_once, [this]() {
+      const auto load = std::move(m_load);
+      m_load = nullptr;
+
+      if (const auto global = load(); global.type == shcore::Object) {
+        m_target = global.as_object<shcore::Cpp_object_bridge>();
+      }
+    });
+
+    if (!m_target) {
+      throw shcore::Exception::runtime_error(
+          "The '" + m_name +
+          "' global object was not registered by its plugin.");
+    }
+
+    return m_target;
+  }
+
+  std::string m_name;
+  mutable std::once_flag m_load_once;
+  mutable std::function<shcore::Value()> m_load;
+  mutable std::shared_ptr<shcore::Cpp_object_bridge> m_target;
+};
+
 }  // namespace
 
 class Shell_command_provider : public shcore::completer::Provider {
@@ -703,29 +808,60 @@ Mysql_shell::Mysql_shell(const std::shared_ptr<Shell_options> &cmdline_options,
 
 Mysql_shell::~Mysql_shell() { DEBUG_OBJ_DEALLOC(Mysql_shell); }
 
+mysqlshdk::utils::Profile_timer &Mysql_shell::startup_timer() {
+  static mysqlshdk::utils::Profile_timer s_timer;
+  return s_timer;
+}
+
 void Mysql_shell::finish_init() {
-  // Python needs to be initialized in case there are python start files/plugins
-  // but we do this only once for the whole application.
-  if (mysqlshdk::utils::in_main_thread()) shell_context()->init_py();
+  const auto main_thread = mysqlshdk::utils::in_main_thread();
+  const auto profile = main_thread && options().startup_profile;
+  const auto stage_begin = [profile](const char *note) {
+    if (profile) startup_timer().stage_begin(note);
+  };
+  const auto stage_end = [profile]() {
+    if (profile) startup_timer().stage_end();
+  };
 
+  // Python is initialized when it's used for the first time, in case there are
+  // python start files/plugins this is done when they are loaded, or when
+  // plugins which are loaded on demand are registered
+  stage_begin("initial mode");
   Base_shell::finish_init();
+  stage_end();
 
-  // if Python is disabled it means we're creating another instance of shell in
+  // if not in main thread it means we're creating another instance of shell in
   // a thread. because of that we don't want to initialize everything again for
   // the scripting languages.
   // Also the shell_cli_operation is not needed as context won't need that.
 
-  if (mysqlshdk::utils::in_main_thread()) {
+  if (main_thread) {
+    stage_begin("startup files");
     File_list startup_files;
     get_startup_scripts(&startup_files);
     load_files(startup_files, "startup files");
+    stage_end();
 
+    stage_begin("plugins");
     File_list plugins;
     get_plugins(&plugins);
     load_files(plugins, "plugins");
+    register_lazy_plugins();
+    stage_end();
 
     auto shell_cli_operation = m_shell_options.get()->get_shell_cli_operation();
     if (shell_cli_operation) {
+      stage_begin("cli providers");
+
+      // only the plugin which provides the target object needs to be loaded,
+      // if it's not known (global help), all of them are needed
+      if (const auto target = shell_cli_operation->get_target_object();
+          target.empty()) {
+        load_lazy_plugins();
+      } else {
+        load_lazy_plugins_with_global(target);
+      }
+
       auto providers = shell_cli_operation->get_provider();
 
       providers->register_provider("dba", _global_dba);
@@ -782,6 +918,8 @@ void Mysql_shell::finish_init() {
             _shell->get_global(name).as_object<Extensible_object>();
         if (extension_object) register_providers(providers, extension_object);
       }
+
+      stage_end();
     }
   }
 }
@@ -895,8 +1033,8 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
         } else if (is_js) {
           ret_val = true;
 #ifdef HAVE_V8
-          (*file_list)[shcore::IShell_core::Mode::JavaScript].emplace_back(
-              init_js, allow_recursive);
+          add_plugin(file_list, shcore::IShell_core::Mode::JavaScript, init_js,
+                     allow_recursive);
 #else
           log_warning("Ignoring plugin at '%s', JavaScript is not available.",
                       plugin_dir.c_str());
@@ -904,8 +1042,8 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
         } else if (is_py) {
           ret_val = true;
 #ifdef HAVE_PYTHON
-          (*file_list)[shcore::IShell_core::Mode::Python].emplace_back(
-              init_py, allow_recursive);
+          add_plugin(file_list, shcore::IShell_core::Mode::Python, init_py,
+                     allow_recursive);
 #else
           log_warning("Ignoring plugin at '%s', Python is not available.",
                         plugin_dir.c_str());
@@ -935,6 +1073,125 @@ bool Mysql_shell::get_plugins(File_list *file_list, const std::string &dir,
   return ret_val;
 }
 
+void Mysql_shell::add_plugin(File_list *file_list,
+                             shcore::IShell_core::Mode mode,
+                             const std::string &init_file, bool main) {
+  Lazy_plugin plugin{mode, {init_file, main}, {}, {}};
+
+  if (read_plugin_manifest(shcore::path::dirname(init_file), &plugin)) {
+    log_debug("- %s will be loaded on demand", init_file.c_str());
+    m_lazy_plugins.emplace_back(std::move(plugin));
+  } else {
+    (*file_list)[mode].emplace_back(init_file, main);
+  }
+}
+
+/**
+ * Reads the manifest file of the plugin, which declares the global objects and
+ * the reports registered by that plugin:
+ *
+ * {
+ *   "globals": [ "object" ],
+ *   "reports": [ "report" ]
+ * }
+ *
+ * @returns true if plugin has a valid manifest and can be loaded on demand.
+ */
+bool Mysql_shell::read_plugin_manifest(const std::string &plugin_dir,
+                                       Lazy_plugin *plugin) {
+  const auto path = shcore::path::join_path(plugin_dir, k_plugin_manifest);
+
+  if (!shcore::is_file(path)) {
+    return false;
+  }
+
+  try {
+    shcore::Option_unpacker unpacker(
+        shcore::Value::parse(shcore::get_text_file(path)).as_map());
+    unpacker.optional("globals", &plugin->globals)
+        .optional("reports", &plugin->reports)
+        .end("in plugin manifest");
+  } catch (const std::exception &e) {
+    print_warning(shcore::str_format(
+        "Error reading manifest of plugin at '%s', plugin will be loaded at "
+        "startup: %s",
+        plugin_dir.c_str(), e.what()));
+    return false;
+  }
+
+  return !plugin->globals.empty() || !plugin->reports.empty();
+}
+
+void Mysql_shell::register_lazy_plugins() {
+  for (auto &plugin : m_lazy_plugins) {
+    if (shcore::IShell_core::Mode::Python == plugin.mode) {
+      // plugin can be loaded by any thread which uses its global object,
+      // Python needs to be initialized in the main thread
+      shell_context()->init_py();
+    }
+
+    for (const auto &name : plugin.globals) {
+      if (_shell->is_global(name)) {
+        // name is already taken, plugin is loaded right away, it's going to
+        // report the problem when registering the global object
+        load_lazy_plugin(&plugin);
+        break;
+      }
+
+      _shell->set_global(name,
+                         shcore::Value(std::make_shared<Lazy_global>(
+                             name,
+                             [this, name]() {
+                               load_lazy_plugins_with_global(name);
+                               return _shell->get_global(name);
+                             })),
+                         shcore::IShell_core::all_scripting_modes());
+    }
+  }
+}
+
+void Mysql_shell::load_lazy_plugin(Lazy_plugin *plugin) {
+  if (plugin->loaded) {
+    return;
+  }
+
+  plugin->loaded = true;
+
+  // placeholders need to be removed, so that plugin can register the globals
+  for (const auto &name : plugin->globals) {
+    if (const auto global = _shell->get_global(name);
+        global.type == shcore::Object && global.as_object<Lazy_global>()) {
+      _shell->remove_global(name);
+    }
+  }
+
+  load_files({{plugin->mode, {plugin->definition}}}, "plugins");
+}
+
+void Mysql_shell::load_lazy_plugins() {
+  for (auto &plugin : m_lazy_plugins) {
+    load_lazy_plugin(&plugin);
+  }
+}
+
+void Mysql_shell::load_lazy_plugins_with_global(const std::string &name) {
+  for (auto &plugin : m_lazy_plugins) {
+    if (std::find(plugin.globals.begin(), plugin.globals.end(), name) !=
+        plugin.globals.end()) {
+      load_lazy_plugin(&plugin);
+    }
+  }
+}
+
+void Mysql_shell::load_lazy_plugins_with_report(const std::string &name) {
+  for (auto &plugin : m_lazy_plugins) {
+    if (std::find(plugin.reports.begin(), plugin.reports.end(), name) !=
+        plugin.reports.end()) {
+      load_lazy_plugin(&plugin);
+    }
+  }
+}
+
 void Mysql_shell::get_plugins(File_list *file_list) {
   const auto initial_mode = _shell->interactive_mode();
 
@@ -1340,6 +1597,9 @@ Mysql_shell::create_default_replicaset_object(bool for_help) {
 }
 
 bool Mysql_shell::cmd_print_shell_help(const std::vector<std::string> &args) {
+  // help of the plugins is available only once they are loaded
+  load_lazy_plugins();
+
   const auto pager = current_console()->enable_pager();
   return Command_help(_shell)(args);
 }
@@ -1848,10 +2108,22 @@ bool Mysql_shell::cmd_process_file(const std::vector<std::string> &params) {
 }
 
 bool Mysql_shell::cmd_show(const std::vector<std::string> &args) {
+  if (args.size() > 1) {
+    load_lazy_plugins_with_report(args[1]);
+  } else {
+    load_lazy_plugins();
+  }
+
   return Command_show(_shell, _global_shell->get_shell_reports())(args);
 }
 
 bool Mysql_shell::cmd_watch(const std::vector<std::string> &args) {
+  if (args.size() > 1) {
+    load_lazy_plugins_with_report(args[1]);
+  } else {
+    load_lazy_plugins();
+  }
+
   return Command_watch(_shell, _global_shell->get_shell_reports())(args);
 }
 
@@ -33,6 +33,7 @@
 #include "modules/mod_sys.h"
 #include "mysqlshdk/libs/db/connection_options.h"
 #include "mysqlshdk/libs/ssh/ssh_manager.h"
+#include "mysqlshdk/libs/utils/profiling.h"
 #include "scripting/types.h"
 #include "shellcore/base_shell.h"
 #include "shellcore/shell_core.h"
@@ -109,6 +110,12 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   std::shared_ptr<mysqlsh::Shell> get_shell() const { return _global_shell; }
 
+  /**
+   * Measures the duration of the startup phases of the main shell instance,
+   * these are reported if the --startup-profile option is used.
+   */
+  static mysqlshdk::utils::Profile_timer &startup_timer();
+
  protected:
   static void set_sql_safe_for_logging(const std::string &patterns);
 
@@ -151,6 +158,30 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   virtual void toggle_print() {}
 
+  /**
+   * A plugin which has a manifest file, it is loaded on demand, when any of
+   * the global objects or reports it declares is used for the first time.
+   */
+  struct Lazy_plugin {
+    shcore::IShell_core::Mode mode;
+    shcore::Plugin_definition definition;
+    std::vector<std::string> globals;
+    std::vector<std::string> reports;
+    bool loaded = false;
+  };
+
+  void add_plugin(File_list *list, shcore::IShell_core::Mode mode,
+                  const std::string &init_file, bool main);
+  bool read_plugin_manifest(const std::string &plugin_dir,
+                            Lazy_plugin *plugin);
+  void register_lazy_plugins();
+  void load_lazy_plugin(Lazy_plugin *plugin);
+  void load_lazy_plugins();
+  void load_lazy_plugins_with_global(const std::string &name);
+  void load_lazy_plugins_with_report(const std::string &name);
+
+  std::vector<Lazy_plugin> m_lazy_plugins;
+
 #ifdef FRIEND_TEST
   FRIEND_TEST(Cmdline_shell, check_password_history_linenoise);
   FRIEND_TEST(Cmdline_shell, check_history_overflow_del);
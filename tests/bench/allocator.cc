@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the in-memory allocator, i.e.:
+//
+//   bench_allocator [seconds] [block size] [huge pages] [prefault]
+//
+// Each thread repeatedly allocates a small batch of blocks, writes to them and
+// releases them. Runs with 1, 2, 4, ..., 128 threads and reports the number of
+// blocks allocated per second.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/backend/in_memory/allocator.h"
+
+namespace {
+
+using mysqlshdk::storage::in_memory::Allocator;
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t k_max_threads = 128;
+constexpr std::size_t k_batch = 8;
+
+double run(std::size_t threads, std::chrono::milliseconds duration,
+           std::size_t block_size, const Allocator::Page_options &options) {
+  Allocator allocator{32 * 1024 * 1024, block_size, options};
+  std::atomic<bool> stop = false;
+  std::atomic<std::size_t> total = 0;
+  std::vector<std::thread> workers;
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back([&]() {
+      std::size_t count = 0;
+      char *blocks[k_batch];
+
+      while (!stop) {
+        for (auto &block : blocks) {
+          block = allocator.allocate_block();
+          block[0] = 1;
+        }
+
+        for (auto block : blocks) {
+          allocator.free(block);
+        }
+
+        count += k_batch;
+      }
+
+      total += count;
+    });
+  }
+
+  const auto start = Clock::now();
+  std::this_thread::sleep_for(duration);
+  stop = true;
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+  return total / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  try {
+    const std::chrono::milliseconds duration{
+        (argc > 1 ? std::stoul(argv[1]) : 2) * 1000};
+    const std::size_t block_size = argc > 2 ? std::stoul(argv[2]) : 8192;
+
+    Allocator::Page_options options;
+    options.huge_pages = argc > 3 && std::stoul(argv[3]) > 0;
+    options.prefault = argc > 4 && std::stoul(argv[4]) > 0;
+
+    std::cout << "block size: " << block_size
+              << ", huge pages: " << options.huge_pages
+              << ", prefault: " << options.prefault << '\n';
+
+    for (std::size_t threads = 1; threads <= k_max_threads; threads *= 2) {
+      const auto rate = run(threads, duration, block_size, options);
+      std::printf("threads: %3zu, blocks/s: %14.0f\n", threads, rate);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
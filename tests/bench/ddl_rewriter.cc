@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the CREATE TABLE compatibility checks, i.e.:
+//
+//   bench_ddl_rewriter [statements] [columns]
+//
+// Each statement has the given number of columns and a set of table options
+// which need to be rewritten. Statements are rewritten by applying the string
+// based checks one after another and by a single pass of the Ddl_rewriter,
+// reports statements/s.
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "modules/util/dump/compatibility.h"
+#include "modules/util/dump/ddl_rewriter.h"
+
+namespace {
+
+using mysqlsh::compatibility::Ddl_edits;
+using mysqlsh::compatibility::Ddl_rewriter;
+using mysqlsh::compatibility::Ddl_tokens;
+
+using Clock = std::chrono::steady_clock;
+
+std::string create_table(std::size_t id, std::size_t columns) {
+  std::string ddl = "CREATE TABLE `t" + std::to_string(id) + "` (\n";
+
+  for (std::size_t i = 0; i < columns; ++i) {
+    ddl += "  `c" + std::to_string(i) +
+           "` varchar(255) DEFAULT NULL COMMENT 'ENGINE=MyISAM DATA "
+           "DIRECTORY',\n";
+  }
+
+  ddl +=
+      "  PRIMARY KEY (`c0`)\n"
+      ") /*!50100 TABLESPACE `ts` */ ENGINE=MyISAM DEFAULT "
+      "CHARSET=utf8mb4 DATA DIRECTORY='/tmp' INDEX DIRECTORY='/tmp' "
+      "ROW_FORMAT=FIXED ENCRYPTION='N'";
+
+  return ddl;
+}
+
+template <typename F>
+double run(const std::vector<std::string> &statements, F f) {
+  std::size_t total = 0;
+  const auto start = Clock::now();
+
+  for (const auto &statement : statements) {
+    total += f(statement).length();
+  }
+
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+  // prevent the loop from being optimized away
+  if (0 == total) {
+    throw std::logic_error("Statements were not rewritten");
+  }
+
+  return statements.size() / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  try {
+    const std::size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    const std::size_t columns = argc > 2 ? std::stoul(argv[2]) : 16;
+
+    std::vector<std::string> statements;
+    statements.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      statements.emplace_back(create_table(i, columns));
+    }
+
+    std::cout << "statements: " << count << ", columns: " << columns << '\n';
+
+    const auto sequential = run(statements, [](const std::string &ddl) {
+      using namespace mysqlsh::compatibility;
+
+      std::string rewritten;
+      check_create_table_for_data_index_dir_option(ddl, &rewritten);
+      check_create_table_for_encryption_option(rewritten, &rewritten);
+      check_create_table_for_engine_option(rewritten, &rewritten);
+      check_create_table_for_tablespace_option(rewritten, &rewritten);
+      check_create_table_for_fixed_row_format(rewritten, &rewritten);
+
+      return rewritten;
+    });
+
+    std::cout << "sequential: " << static_cast<uint64_t>(sequential)
+              << " statements/s\n";
+
+    Ddl_rewriter rewriter;
+    rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+      mysqlsh::compatibility::check_create_table_for_data_index_dir_option(
+          tokens, edits);
+    });
+    rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+      mysqlsh::compatibility::check_create_table_for_encryption_option(tokens,
+                                                                       edits);
+    });
+    rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+      mysqlsh::compatibility::check_create_table_for_engine_option(tokens,
+                                                                   edits);
+    });
+    rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+      mysqlsh::compatibility::check_create_table_for_tablespace_option(tokens,
+                                                                       edits);
+    });
+    rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+      mysqlsh::compatibility::check_create_table_for_fixed_row_format(tokens,
+                                                                      edits);
+    });
+
+    const auto single_pass = run(statements, [&rewriter](
+                                                 const std::string &ddl) {
+      std::string rewritten;
+      rewriter.rewrite(ddl, &rewritten);
+      return rewritten;
+    });
+
+    std::cout << "single pass: " << static_cast<uint64_t>(single_pass)
+              << " statements/s\n";
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the dump writers, i.e.:
+//
+//   bench_dump_writer [rows] [field length] [escape every N characters]
+//
+// Each row has four text fields, one in N characters of each field needs to
+// be escaped (0 means none). Rows are written to memory using both the
+// specialized dialect writers and the generic text writer, reports MB/s.
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "modules/util/dump/text_dump_writer.h"
+#include "modules/util/import_table/dialect.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+namespace {
+
+using mysqlsh::dump::Dump_writer;
+using mysqlsh::import_table::Dialect;
+using mysqlshdk::db::Type;
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t k_fields = 4;
+
+struct Bench_dialect {
+  const char *name;
+  std::unique_ptr<Dump_writer> writer;
+  Dialect dialect;
+};
+
+class Text_row : public mysqlshdk::db::IRow {
+ public:
+  explicit Text_row(std::vector<std::string> fields)
+      : m_fields(std::move(fields)) {}
+
+  uint32_t num_fields() const override {
+    return static_cast<uint32_t>(m_fields.size());
+  }
+
+  Type get_type(uint32_t) const override { return Type::String; }
+
+  bool is_null(uint32_t) const override { return false; }
+
+  std::string get_as_string(uint32_t index) const override {
+    return m_fields[index];
+  }
+
+  std::string get_string(uint32_t index) const override {
+    return m_fields[index];
+  }
+
+  int64_t get_int(uint32_t) const override { throw std::logic_error("int"); }
+
+  uint64_t get_uint(uint32_t) const override {
+    throw std::logic_error("uint");
+  }
+
+  float get_float(uint32_t) const override { throw std::logic_error("float"); }
+
+  double get_double(uint32_t) const override {
+    throw std::logic_error("double");
+  }
+
+  std::pair<const char *, size_t> get_string_data(
+      uint32_t index) const override {
+    return {m_fields[index].data(), m_fields[index].length()};
+  }
+
+  void get_raw_data(uint32_t index, const char **out_data,
+                    size_t *out_size) const override {
+    *out_data = m_fields[index].data();
+    *out_size = m_fields[index].length();
+  }
+
+  std::tuple<uint64_t, int> get_bit(uint32_t) const override {
+    throw std::logic_error("bit");
+  }
+
+ private:
+  std::vector<std::string> m_fields;
+};
+
+std::vector<mysqlshdk::db::Column> metadata() {
+  std::vector<mysqlshdk::db::Column> columns;
+
+  for (uint32_t i = 0; i < k_fields; ++i) {
+    const auto name = "c" + std::to_string(i);
+    columns.emplace_back("def", "bench", "t", "t", name, name, 0, 0,
+                         Type::String, 255, false, false, false);
+  }
+
+  return columns;
+}
+
+std::string field(std::size_t length, std::size_t escape_every) {
+  static constexpr char k_special[] = {'\n', '\t', '\\', '"', ',', '\r'};
+  std::string result;
+
+  for (std::size_t i = 0; i < length; ++i) {
+    if (escape_every > 0 && i % escape_every == escape_every - 1) {
+      result += k_special[i % sizeof(k_special)];
+    } else {
+      result += static_cast<char>('a' + i % 26);
+    }
+  }
+
+  return result;
+}
+
+double run(Dump_writer *writer, const mysqlshdk::db::IRow &row,
+           std::size_t rows) {
+  mysqlshdk::storage::backend::Memory_file output{"bench"};
+  uint64_t bytes = 0;
+
+  output.open(mysqlshdk::storage::Mode::WRITE);
+  writer->set_output_file(&output);
+  writer->open();
+  writer->write_preamble(metadata());
+
+  const auto start = Clock::now();
+
+  for (std::size_t i = 0; i < rows; ++i) {
+    bytes += writer->write_row(&row).data_bytes();
+
+    // don't let the output grow indefinitely
+    if (output.file_size() > 64 * 1024 * 1024) {
+      output.open(mysqlshdk::storage::Mode::WRITE);
+    }
+  }
+
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+  writer->write_postamble();
+  writer->close();
+  output.close();
+
+  return bytes / elapsed.count() / 1000000.0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  try {
+    const std::size_t rows = argc > 1 ? std::stoul(argv[1]) : 1000000;
+    const std::size_t length = argc > 2 ? std::stoul(argv[2]) : 256;
+    const std::size_t escape_every = argc > 3 ? std::stoul(argv[3]) : 64;
+
+    const Text_row row{std::vector<std::string>(k_fields,
+                                                field(length, escape_every))};
+
+    std::cout << "rows: " << rows << ", field length: " << length
+              << ", escape every: " << escape_every << '\n';
+
+    std::vector<Bench_dialect> dialects;
+    dialects.push_back({"default",
+                        std::make_unique<mysqlsh::dump::Default_dump_writer>(),
+                        Dialect::default_()});
+    dialects.push_back({"csv",
+                        std::make_unique<mysqlsh::dump::Csv_dump_writer>(),
+                        Dialect::csv()});
+    dialects.push_back({"tsv",
+                        std::make_unique<mysqlsh::dump::Tsv_dump_writer>(),
+                        Dialect::tsv()});
+    dialects.push_back({"json",
+                        std::make_unique<mysqlsh::dump::Json_dump_writer>(),
+                        Dialect::json()});
+
+    for (const auto &d : dialects) {
+      mysqlsh::dump::Text_dump_writer text{d.dialect};
+
+      std::printf("%-8s dialect writer: %8.1f MB/s, text writer: %8.1f MB/s\n",
+                  d.name, run(d.writer.get(), row, rows),
+                  run(&text, row, rows));
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
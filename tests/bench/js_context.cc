@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures creation time of the JavaScript context, i.e.:
+//
+//   bench_js_context [iterations] [snapshot]
+//
+// Creates the given number of contexts, first initializing them from scratch,
+// then using the V8 startup snapshot. If snapshot file is not given, it is
+// created in the current directory. Reports the average wall time of each
+// scenario.
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "mysqlshdk/include/scripting/jscript_context.h"
+#include "mysqlshdk/include/scripting/object_registry.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace shcore {
+extern void JScript_context_init();
+extern void JScript_context_fini();
+}  // namespace shcore
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void run(const char *name, std::size_t iterations) {
+  shcore::Object_registry registry;
+  std::chrono::duration<double, std::milli> total{0};
+  std::chrono::duration<double, std::milli> min{0};
+  std::chrono::duration<double, std::milli> max{0};
+
+  for (std::size_t i = 0; i < iterations; ++i) {
+    const auto start = Clock::now();
+
+    {
+      shcore::JScript_context context{&registry};
+      // make sure core module is usable
+      context.execute("require");
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+        Clock::now() - start;
+
+    total += elapsed;
+
+    if (0 == i || elapsed < min) min = elapsed;
+    if (0 == i || elapsed > max) max = elapsed;
+  }
+
+  std::printf("%-20s avg: %8.2f ms, min: %8.2f ms, max: %8.2f ms\n", name,
+              total.count() / iterations, min.count(), max.count());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t iterations = argc > 1 ? std::stoul(argv[1]) : 50;
+  const std::string snapshot = argc > 2 ? argv[2] : "bench_js_snapshot.bin";
+
+  mysqlsh::Scoped_logger logger(
+      shcore::Logger::create_instance("bench_js_context.log"));
+
+  shcore::JScript_context_init();
+
+  int rc = 0;
+
+  try {
+    if (argc <= 2) {
+      shcore::JScript_context::create_snapshot(snapshot);
+    }
+
+    shcore::JScript_context::load_snapshot("");
+    run("cold", iterations);
+
+    if (!shcore::JScript_context::load_snapshot(snapshot)) {
+      throw std::runtime_error("Failed to load the snapshot: " + snapshot);
+    }
+
+    run("snapshot", iterations);
+
+    if (argc <= 2) {
+      shcore::delete_file(snapshot);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    rc = 1;
+  }
+
+  shcore::JScript_context_fini();
+
+  return rc;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the REST service against a local HTTPS server, i.e.:
+//
+//   mysqlsh --py --file unittest/data/rest/test-server.py 8080
+//   bench_rest_service https://127.0.0.1:8080 [threads] [requests]
+//
+// Each thread executes the given number of GET requests, first using a single
+// REST service, then creating a new service for each request (like workers
+// which access many different objects do). Reports requests per second and
+// number of new connections and TLS handshakes.
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/rest/rest_service.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace {
+
+using mysqlshdk::rest::Request;
+using mysqlshdk::rest::Response;
+using mysqlshdk::rest::Rest_service;
+
+using Clock = std::chrono::steady_clock;
+
+void get(Rest_service *service) {
+  Request request{"/get"};
+
+  if (Response::Status_code::OK != service->get(&request).status) {
+    throw std::runtime_error("Request has failed");
+  }
+}
+
+void run(const std::string &name, std::size_t threads, std::size_t requests,
+         const std::function<void(std::size_t)> &worker) {
+  const auto before = Rest_service::connection_stats();
+  const auto start = Clock::now();
+  std::vector<std::thread> workers;
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back([&]() {
+      try {
+        worker(requests);
+      } catch (const std::exception &e) {
+        std::cerr << "Error: " << e.what() << '\n';
+      }
+    });
+  }
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+  const auto after = Rest_service::connection_stats();
+
+  std::printf(
+      "%-20s requests/s: %10.1f, requests: %zu, connections: %zu, TLS "
+      "handshakes: %zu\n",
+      name.c_str(), (after.requests - before.requests) / elapsed.count(),
+      after.requests - before.requests, after.connections - before.connections,
+      after.tls_handshakes - before.tls_handshakes);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " url [threads] [requests]\n";
+    return 1;
+  }
+
+  const std::string url = argv[1];
+  const std::size_t threads = argc > 2 ? std::stoul(argv[2]) : 16;
+  const std::size_t requests = argc > 3 ? std::stoul(argv[3]) : 100;
+
+  mysqlsh::Scoped_logger logger(
+      shcore::Logger::create_instance("bench_rest_service.log"));
+
+  try {
+    // keeps the shared DNS cache and TLS sessions alive between the runs
+    Rest_service main_service{url, false};
+    get(&main_service);
+
+    run("service per thread", threads, requests, [&url](std::size_t count) {
+      Rest_service service{url, false};
+
+      for (std::size_t i = 0; i < count; ++i) {
+        get(&service);
+      }
+    });
+
+    run("service per request", threads, requests, [&url](std::size_t count) {
+      for (std::size_t i = 0; i < count; ++i) {
+        Rest_service service{url, false};
+        get(&service);
+      }
+    });
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the SQL parser used by the upgrade checker, i.e.:
+//
+//   bench_sql_parser script [iterations] [threads]
+//
+// The script is a corpus of statements, i.e. the stored routines, triggers and
+// events of a real schema (unittest/data/sql/sakila-schema.sql). Statements
+// are parsed using a new parser instance with the full LL prediction, using
+// the pooled parser instances with the two-stage SLL/LL prediction, and then
+// with the pooled instances in the given number of threads, reports
+// statements/s.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/parser/mysql_parser_utils.h"
+#include "mysqlshdk/libs/utils/utils_mysql_parsing.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+namespace {
+
+using mysqlshdk::parser::internal::Parser_pool;
+
+using Clock = std::chrono::steady_clock;
+
+std::vector<std::string> load_statements(const std::string &path) {
+  std::ifstream file{path};
+
+  if (!file) {
+    throw std::runtime_error("Failed to open: " + path);
+  }
+
+  std::vector<std::string> statements;
+
+  mysqlshdk::utils::iterate_sql_stream(
+      &file, 4098,
+      [&statements](std::string_view stmt, std::string_view, size_t, size_t) {
+        if (!shcore::str_ibeginswith(stmt, "delimiter")) {
+          statements.emplace_back(stmt);
+        }
+
+        return true;
+      },
+      [](std::string_view msg) {
+        throw std::runtime_error("Error splitting SQL: " + std::string{msg});
+      });
+
+  return statements;
+}
+
+std::size_t parse_ll(const std::string &sql) {
+  antlr4::ANTLRInputStream input(sql);
+  parsers::MySQLLexer lexer(&input);
+  antlr4::CommonTokenStream tokens(&lexer);
+  parsers::MySQLParser parser(&tokens);
+
+  mysqlshdk::parser::internal::ParserErrorListener error_listener;
+  lexer.addErrorListener(&error_listener);
+  parser.addErrorListener(&error_listener);
+
+  mysqlshdk::parser::prepare_lexer_parser(&lexer, &parser, {}, true, false);
+
+  return parser.query()->children.size();
+}
+
+std::size_t parse_pooled(const std::string &sql) {
+  const auto instance = Parser_pool::acquire();
+
+  mysqlshdk::parser::prepare_lexer_parser(instance->lexer(),
+                                          instance->parser(), {}, true, false);
+  instance->parser()->setBuildParseTree(true);
+  instance->load(sql);
+
+  return instance->parse_query()->children.size();
+}
+
+template <typename F>
+double run(const std::vector<std::string> &statements, std::size_t iterations,
+           std::size_t threads, F f) {
+  std::atomic<std::size_t> next{0};
+  std::atomic<std::size_t> total{0};
+  const auto count = statements.size() * iterations;
+  const auto start = Clock::now();
+
+  const auto worker = [&]() {
+    std::size_t nodes = 0;
+
+    for (auto i = next++; i < count; i = next++) {
+      nodes += f(statements[i % statements.size()]);
+    }
+
+    total += nodes;
+  };
+
+  std::vector<std::thread> workers;
+
+  for (std::size_t i = 1; i < threads; ++i) {
+    workers.emplace_back(worker);
+  }
+
+  worker();
+
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+  // prevent the loop from being optimized away
+  if (0 == total) {
+    throw std::logic_error("Statements were not parsed");
+  }
+
+  return count / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  try {
+    if (argc < 2) {
+      std::cerr << "Usage: " << argv[0] << " script [iterations] [threads]\n";
+      return 1;
+    }
+
+    const auto statements = load_statements(argv[1]);
+    const std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 10;
+    const std::size_t threads =
+        argc > 3 ? std::stoul(argv[3])
+                 : std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (statements.empty()) {
+      throw std::runtime_error("Script does not contain any statements");
+    }
+
+    std::cout << "statements: " << statements.size()
+              << ", iterations: " << iterations << ", threads: " << threads
+              << '\n';
+
+    const auto ll = run(statements, iterations, 1, parse_ll);
+
+    std::cout << "LL, new parser: " << static_cast<uint64_t>(ll)
+              << " statements/s\n";
+
+    const auto pooled = run(statements, iterations, 1, parse_pooled);
+
+    std::cout << "SLL/LL, pooled: " << static_cast<uint64_t>(pooled)
+              << " statements/s\n";
+
+    const auto parallel = run(statements, iterations, threads, parse_pooled);
+
+    std::cout << "SLL/LL, pooled, parallel: "
+              << static_cast<uint64_t>(parallel) << " statements/s\n";
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
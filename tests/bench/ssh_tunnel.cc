@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures throughput of the SSH tunnel, using a local SSH server, i.e.:
+//
+//   bench_ssh_tunnel user@localhost [connections] [megabytes] [threads]
+//
+// SSH server must accept the public key authentication (or the SSH agent) and
+// its fingerprint must be known. Each connection sends the given amount of
+// data through the tunnel to a local sink, then receives the same amount.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
+#include "mysqlshdk/libs/ssh/ssh_connection_options.h"
+#include "mysqlshdk/libs/ssh/ssh_session.h"
+#include "mysqlshdk/libs/ssh/ssh_tunnel_manager.h"
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::size_t k_chunk_size = 64 * 1024;
+
+int listen_on_loopback(uint16_t *port) {
+  const int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0) throw std::runtime_error("socket() failed");
+
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  memset(&addr, 0, len);
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  addr.sin_port = htons(0);
+
+  if (bind(sock, (struct sockaddr *)&addr, len) != 0 ||
+      listen(sock, 128) != 0 ||
+      getsockname(sock, (struct sockaddr *)&addr, &len) != 0) {
+    close(sock);
+    throw std::runtime_error("unable to listen on loopback");
+  }
+
+  *port = ntohs(addr.sin_port);
+  return sock;
+}
+
+int connect_to_loopback(uint16_t port) {
+  const int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0) throw std::runtime_error("socket() failed");
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  addr.sin_port = htons(port);
+
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    close(sock);
+    throw std::runtime_error("unable to connect to the tunnel");
+  }
+
+  return sock;
+}
+
+void send_all(int sock, std::size_t bytes) {
+  std::vector<char> buffer(k_chunk_size, 'x');
+
+  while (bytes > 0) {
+    const auto sent =
+        send(sock, buffer.data(), std::min(bytes, buffer.size()), 0);
+    if (sent <= 0) throw std::runtime_error("send() failed");
+    bytes -= static_cast<std::size_t>(sent);
+  }
+}
+
+void recv_all(int sock, std::size_t bytes) {
+  std::vector<char> buffer(k_chunk_size);
+
+  while (bytes > 0) {
+    const auto received =
+        recv(sock, buffer.data(), std::min(bytes, buffer.size()), 0);
+    if (received <= 0) throw std::runtime_error("recv() failed");
+    bytes -= static_cast<std::size_t>(received);
+  }
+}
+
+// receives the data sent by each connection, then sends it back
+void run_sink(int listener, std::size_t connections, std::size_t bytes) {
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < connections; ++i) {
+    const int sock = accept(listener, nullptr, nullptr);
+    if (sock < 0) break;
+
+    threads.emplace_back([sock, bytes]() {
+      try {
+        recv_all(sock, bytes);
+        send_all(sock, bytes);
+      } catch (const std::exception &e) {
+        std::cerr << "sink: " << e.what() << '\n';
+      }
+
+      close(sock);
+    });
+  }
+
+  for (auto &t : threads) t.join();
+}
+
+double mb_per_s(std::size_t bytes, Clock::duration duration) {
+  const auto ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+  return ms ? static_cast<double>(bytes) / 1000.0 / ms : 0.0;
+}
+
+void run(uint16_t tunnel_port, int listener, std::size_t connections,
+         std::size_t bytes) {
+  std::thread sink(run_sink, listener, connections, bytes);
+
+  std::vector<std::thread> clients;
+  std::atomic<std::size_t> failed{0};
+  std::atomic<Clock::rep> upload{0};
+
+  const auto t_start = Clock::now();
+
+  for (std::size_t i = 0; i < connections; ++i) {
+    clients.emplace_back([&]() {
+      try {
+        const int sock = connect_to_loopback(tunnel_port);
+        const auto t_conn = Clock::now();
+
+        send_all(sock, bytes);
+        // upload is finished when the sink starts to send the data back
+        recv_all(sock, 1);
+
+        const auto elapsed = (Clock::now() - t_conn).count();
+        auto current = upload.load();
+        while (current < elapsed &&
+               !upload.compare_exchange_weak(current, elapsed)) {
+        }
+
+        recv_all(sock, bytes - 1);
+        close(sock);
+      } catch (const std::exception &e) {
+        std::cerr << "client: " << e.what() << '\n';
+        ++failed;
+      }
+    });
+  }
+
+  for (auto &t : clients) t.join();
+  const auto t_end = Clock::now();
+  sink.join();
+
+  const auto total = bytes * connections;
+  const auto upload_time = Clock::duration{upload.load()};
+
+  std::cout << "# " << connections << " connection(s), " << total
+            << " bytes each direction, " << failed << " failed\n";
+  std::cout << "#   upload:   " << mb_per_s(total, upload_time)
+            << " Mbytes/s\n";
+  std::cout << "#   total:    " << mb_per_s(2 * total, t_end - t_start)
+            << " Mbytes/s @ "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   t_end - t_start)
+                   .count()
+            << "ms\n";
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " ssh-uri [connections] [megabytes] [threads]\n";
+    return 1;
+  }
+
+  const std::size_t connections = argc > 2 ? std::stoul(argv[2]) : 8;
+  const std::size_t bytes =
+      (argc > 3 ? std::stoul(argv[3]) : 256) * 1024 * 1024;
+
+  if (0 == connections || 0 == bytes) {
+    std::cerr << "Number of connections and megabytes must be positive\n";
+    return 1;
+  }
+
+  mysqlsh::Scoped_logger logger(
+      shcore::Logger::create_instance("bench_ssh_tunnel.log"));
+
+  auto options = std::make_shared<mysqlsh::Shell_options>();
+  options->set("useWizards", "false");
+  if (argc > 4) options->set("ssh.tunnelThreads", argv[4]);
+  mysqlsh::Scoped_shell_options shell_options(options);
+
+  try {
+    uint16_t sink_port = 0;
+    const int listener = listen_on_loopback(&sink_port);
+
+    mysqlshdk::ssh::Ssh_connection_options config(argv[1]);
+    config.set_remote_host("127.0.0.1");
+    config.set_remote_port(sink_port);
+    config.set_default_data();
+
+    auto session = std::make_unique<mysqlshdk::ssh::Ssh_session>();
+    const auto ret_val = session->connect(config, false);
+
+    if (mysqlshdk::ssh::Ssh_return_type::CONNECTED != std::get<0>(ret_val)) {
+      std::cerr << "Unable to connect: " << std::get<1>(ret_val) << '\n';
+      return 1;
+    }
+
+    mysqlshdk::ssh::Ssh_tunnel_manager manager;
+    manager.start();
+
+    const auto tunnel_port =
+        std::get<1>(manager.create_tunnel(std::move(session)));
+
+    run(tunnel_port, listener, 1, bytes);
+    run(tunnel_port, listener, connections, bytes);
+
+    close(listener);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Measures startup time of the shell, i.e.:
+//
+//   bench_startup path/to/mysqlsh [iterations] [mysqlsh options...]
+//
+// Launches the shell the given number of times and reports the average wall
+// time of each scenario. By default two scenarios are executed: startup and
+// immediate exit, and startup followed by a help query (which loads the help
+// text). If options are given, only this scenario is measured.
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/process_launcher.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Scenario {
+  std::string name;
+  std::vector<std::string> args;
+};
+
+void run(const std::string &mysqlsh, std::size_t iterations,
+         const Scenario &scenario) {
+  std::vector<const char *> argv;
+  argv.emplace_back(mysqlsh.c_str());
+
+  for (const auto &arg : scenario.args) {
+    argv.emplace_back(arg.c_str());
+  }
+
+  argv.emplace_back(nullptr);
+
+  std::chrono::duration<double, std::milli> total{0};
+  std::chrono::duration<double, std::milli> min{0};
+  std::chrono::duration<double, std::milli> max{0};
+
+  for (std::size_t i = 0; i < iterations; ++i) {
+    const auto start = Clock::now();
+
+    shcore::Process_launcher process{&argv[0]};
+    process.start();
+    const auto output = process.read_all();
+
+    if (const auto rc = process.wait(); 0 != rc) {
+      throw std::runtime_error("Process has failed with exit code " +
+                               std::to_string(rc) + ", output:\n" + output);
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+        Clock::now() - start;
+
+    total += elapsed;
+
+    if (0 == i || elapsed < min) min = elapsed;
+    if (0 == i || elapsed > max) max = elapsed;
+  }
+
+  std::printf("%-20s avg: %8.2f ms, min: %8.2f ms, max: %8.2f ms\n",
+              scenario.name.c_str(), total.count() / iterations, min.count(),
+              max.count());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0]
+              << " path/to/mysqlsh [iterations] [mysqlsh options...]\n";
+    return 1;
+  }
+
+  const std::string mysqlsh = argv[1];
+  const std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 20;
+  std::vector<Scenario> scenarios;
+
+  if (argc > 3) {
+    scenarios.push_back({"custom", {argv + 3, argv + argc}});
+  } else {
+    scenarios.push_back({"startup", {"--js", "-e", "1"}});
+    scenarios.push_back({"startup + help", {"--js", "-e", "shell.help()"}});
+  }
+
+  try {
+    for (const auto &scenario : scenarios) {
+      run(mysqlsh, iterations, scenario);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+
+  return 0;
+}
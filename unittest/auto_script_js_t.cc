@@ -363,6 +363,9 @@ class Credential_store_test : public Auto_script_js {
     execute("shell.options.unset(\"credentialStore.helper\");");
     execute("shell.options.unset(\"credentialStore.savePasswords\");");
     execute("shell.options.unset(\"credentialStore.excludeFilters\");");
+    execute("shell.options.unset(\"credentialStore.cacheTtl\");");
+    execute(
+        "shell.options.unset(\"credentialStore.persistentHelper\");");
   }
 
   void set_options() override {
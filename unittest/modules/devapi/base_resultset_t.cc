@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/devapi/base_resultset.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/naming_style.h"
+#include "mysqlshdk/include/scripting/obj_date.h"
+#include "mysqlshdk/libs/db/row_copy.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Type;
+
+namespace {
+
+std::shared_ptr<const Row_layout> make_layout(
+    std::vector<std::string> names) {
+  return std::make_shared<Row_layout>(
+      std::make_shared<std::vector<std::string>>(std::move(names)));
+}
+
+}  // namespace
+
+TEST(Row_layout, fields_and_properties) {
+  const auto layout =
+      make_layout({"id", "first name", "length", "id", "getField", "value"});
+
+  EXPECT_EQ(0u, layout->field_index("id"));
+  EXPECT_EQ(1u, layout->field_index("first name"));
+  EXPECT_EQ(2u, layout->field_index("length"));
+  EXPECT_EQ(4u, layout->field_index("getField"));
+  EXPECT_EQ(5u, layout->field_index("value"));
+  EXPECT_EQ(Row_layout::npos, layout->field_index("missing"));
+
+  // fields which are not valid identifiers, clash with the members of Row or
+  // are duplicated are not exposed as properties
+  EXPECT_EQ(0u, layout->property_index("id"));
+  EXPECT_EQ(Row_layout::npos, layout->property_index("first name"));
+  EXPECT_EQ(Row_layout::npos, layout->property_index("length"));
+  EXPECT_EQ(Row_layout::npos, layout->property_index("getField"));
+  EXPECT_EQ(5u, layout->property_index("value"));
+  EXPECT_EQ((std::vector<std::string>{"id", "value"}), layout->properties());
+}
+
+TEST(Row, values_are_decoded_on_access) {
+  const auto layout = make_layout({"id", "name", "created", "missing"});
+  std::unique_ptr<Row> row;
+
+  {
+    Mutable_row fetched({Type::Integer, Type::String, Type::DateTime,
+                         Type::String},
+                        -5, "first", "2023-01-02 03:04:05", nullptr);
+    row = std::make_unique<Row>(layout, fetched);
+
+    // the row holds a copy of the fetched row, which is valid only until the
+    // next row is fetched
+    fetched.set_field(0, 7);
+    fetched.set_field(1, "second");
+  }
+
+  EXPECT_EQ(4u, row->get_length());
+
+  EXPECT_EQ(shcore::Value(-5), row->get_member(0));
+  EXPECT_EQ(shcore::Value("first"), row->get_field("name"));
+  EXPECT_EQ(shcore::Value::Null(), row->get_member("missing"));
+
+  const auto created = row->get_member_advanced("created");
+  ASSERT_EQ(shcore::Object, created.type);
+  const auto date = created.as_object<shcore::Date>();
+  ASSERT_NE(nullptr, date);
+  EXPECT_EQ(2023, date->get_year());
+  EXPECT_EQ(5, date->get_sec());
+
+  // values are decoded once
+  EXPECT_EQ(row->get_member(0).as_int(), row->get_member("id").as_int());
+
+  EXPECT_EQ(shcore::Value(), row->get_member(4));
+  EXPECT_THROW(row->get_field("unknown"), shcore::Exception);
+
+  std::string descr;
+  row->append_descr(descr);
+  EXPECT_EQ("[-5, \"first\", \"2023-01-02 03:04:05\", null]", descr);
+
+  // all fields were decoded, copy of the row was released, decoded values
+  // are still available
+  EXPECT_EQ(shcore::Value("first"), row->get_member(1));
+
+  const auto object = row->as_object();
+  EXPECT_EQ(4u, object->size());
+  EXPECT_EQ("first", object->get_string("name"));
+}
+
+TEST(Row, members_of_fetched_rows) {
+  const auto layout = make_layout({"id", "length"});
+  const Mutable_row fetched({Type::UInteger, Type::Integer}, 10u, 20);
+
+  for (const auto style : {shcore::NamingStyle::LowerCamelCase,
+                           shcore::NamingStyle::LowerCaseUnderscores}) {
+    SCOPED_TRACE(static_cast<int>(style));
+    shcore::Scoped_naming_style naming_style(style);
+
+    const auto get_field = shcore::get_member_name("getField", style);
+    const auto get_length = shcore::get_member_name("getLength", style);
+
+    {
+      // members are reported before they are registered
+      Row row(layout, fetched);
+
+      EXPECT_TRUE(row.has_member("length"));
+      EXPECT_TRUE(row.has_member("getField"));
+      EXPECT_TRUE(row.has_method("getField"));
+      EXPECT_FALSE(row.has_method("length"));
+      EXPECT_TRUE(row.has_member_advanced("id"));
+      EXPECT_TRUE(row.has_member_advanced(get_field));
+      EXPECT_TRUE(row.has_method_advanced(get_length));
+      EXPECT_FALSE(row.has_method_advanced("id"));
+      EXPECT_FALSE(row.has_member_advanced("unknown"));
+
+      // length is the number of fields, not the field named length
+      EXPECT_EQ(shcore::Value(2), row.get_member("length"));
+
+      shcore::Argument_list args;
+      EXPECT_EQ(shcore::Value(2), row.call_advanced(get_length, args));
+
+      args.push_back(shcore::Value("length"));
+      EXPECT_EQ(shcore::Value(20), row.call_advanced(get_field, args));
+    }
+
+    {
+      // members are registered when they are listed
+      const Row row(layout, fetched);
+
+      EXPECT_EQ((std::vector<std::string>{"length", "id", get_field,
+                                          get_length, "help"}),
+                row.get_members());
+      EXPECT_EQ(shcore::Value(10u), row.get_member_advanced("id"));
+      EXPECT_EQ(shcore::Function, row.get_member_advanced(get_field).type);
+    }
+  }
+}
+
+}  // namespace mysqlsh
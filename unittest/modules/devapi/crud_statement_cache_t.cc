@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "modules/devapi/crud_statement_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace mysqlx {
+
+TEST(Crud_statement_cache, parse_criteria) {
+  Crud_statement_cache cache{[](uint32_t) { FAIL(); }};
+
+  {
+    std::vector<std::string> placeholders;
+    const auto expr = cache.parse_criteria("a = :x and b = :y", true,
+                                           &placeholders);
+    ASSERT_NE(nullptr, expr);
+    EXPECT_EQ((std::vector<std::string>{"x", "y"}), placeholders);
+    EXPECT_EQ(0u, cache.statistics().expression_hits);
+    EXPECT_EQ(1u, cache.statistics().expression_misses);
+  }
+
+  {
+    std::vector<std::string> placeholders;
+    const auto first =
+        cache.parse_criteria("a = :x and b = :y", true, &placeholders);
+    placeholders.clear();
+    const auto second =
+        cache.parse_criteria("a = :x and b = :y", true, &placeholders);
+
+    // each call returns a copy of the expression
+    ASSERT_NE(first.get(), second.get());
+    EXPECT_EQ(first->SerializeAsString(), second->SerializeAsString());
+    EXPECT_EQ((std::vector<std::string>{"x", "y"}), placeholders);
+    EXPECT_EQ(2u, cache.statistics().expression_hits);
+    EXPECT_EQ(1u, cache.statistics().expression_misses);
+  }
+
+  {
+    // the same criteria in the table mode is a different entry
+    std::vector<std::string> placeholders;
+    cache.parse_criteria("a = :x and b = :y", false, &placeholders);
+    EXPECT_EQ(2u, cache.statistics().expression_hits);
+    EXPECT_EQ(2u, cache.statistics().expression_misses);
+  }
+
+  {
+    // errors are not cached
+    std::vector<std::string> placeholders;
+    EXPECT_ANY_THROW(cache.parse_criteria("a = ", true, &placeholders));
+    placeholders.clear();
+    EXPECT_ANY_THROW(cache.parse_criteria("a = ", true, &placeholders));
+    EXPECT_EQ(2u, cache.statistics().expression_hits);
+    EXPECT_EQ(4u, cache.statistics().expression_misses);
+  }
+}
+
+TEST(Crud_statement_cache, execute) {
+  std::vector<uint32_t> deallocated;
+  Crud_statement_cache cache{
+      [&deallocated](uint32_t id) { deallocated.emplace_back(id); }, 2};
+
+  auto stmt = cache.execute("one");
+  EXPECT_EQ(0u, stmt.executions);
+  EXPECT_EQ(0u, stmt.id);
+
+  stmt = cache.execute("one");
+  EXPECT_EQ(1u, stmt.executions);
+  EXPECT_EQ(0u, stmt.id);
+  cache.set_prepared("one", 1);
+
+  stmt = cache.execute("one");
+  EXPECT_EQ(2u, stmt.executions);
+  EXPECT_EQ(1u, stmt.id);
+
+  stmt = cache.execute("two");
+  EXPECT_EQ(0u, stmt.executions);
+  stmt = cache.execute("two");
+  EXPECT_EQ(1u, stmt.executions);
+  cache.set_prepared("two", 2);
+
+  // "one" is the least recently used, it's evicted and deallocated
+  stmt = cache.execute("three");
+  EXPECT_EQ(0u, stmt.executions);
+  EXPECT_EQ(std::vector<uint32_t>{1}, deallocated);
+
+  stmt = cache.execute("three");
+  EXPECT_EQ(1u, stmt.executions);
+
+  // "one" evicts "two", then "two" evicts "one" which was not prepared
+  cache.execute("one");
+  cache.set_prepared("three", 3);
+  cache.execute("two");
+  EXPECT_EQ((std::vector<uint32_t>{1, 2}), deallocated);
+
+  // "three" was prepared and then evicted
+  cache.execute("four");
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), deallocated);
+
+  const auto &stats = cache.statistics();
+  EXPECT_EQ(4u, stats.statement_hits);
+  EXPECT_EQ(6u, stats.statement_misses);
+  EXPECT_EQ(3u, stats.statements_prepared);
+  EXPECT_EQ(3u, stats.statements_evicted);
+
+  // statements are not deallocated when cache is cleared
+  cache.clear();
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), deallocated);
+  EXPECT_EQ(0u, cache.statistics().statement_misses);
+
+  stmt = cache.execute("four");
+  EXPECT_EQ(0u, stmt.executions);
+}
+
+TEST(Crud_statement_cache, set_prepared_evicted) {
+  std::vector<uint32_t> deallocated;
+  Crud_statement_cache cache{
+      [&deallocated](uint32_t id) { deallocated.emplace_back(id); }, 1};
+
+  cache.execute("one");
+  cache.execute("one");
+  cache.execute("two");
+
+  // "one" was evicted before it was prepared, it's deallocated immediately
+  cache.set_prepared("one", 7);
+  EXPECT_EQ(std::vector<uint32_t>{7}, deallocated);
+  EXPECT_EQ(0u, cache.statistics().statements_prepared);
+  EXPECT_EQ(0u, cache.statistics().statements_evicted);
+}
+
+TEST(Crud_statement_cache, forget) {
+  std::vector<uint32_t> deallocated;
+  Crud_statement_cache cache{
+      [&deallocated](uint32_t id) { deallocated.emplace_back(id); }};
+
+  // unknown statements are ignored
+  cache.forget("one");
+
+  // statement which was not prepared is not deallocated
+  cache.execute("one");
+  cache.forget("one");
+  EXPECT_TRUE(deallocated.empty());
+
+  cache.execute("one");
+  cache.execute("one");
+  cache.set_prepared("one", 3);
+  cache.forget("one");
+  EXPECT_EQ(std::vector<uint32_t>{3}, deallocated);
+  EXPECT_EQ(1u, cache.statistics().statements_evicted);
+
+  // statement is prepared again
+  auto stmt = cache.execute("one");
+  EXPECT_EQ(0u, stmt.executions);
+  EXPECT_EQ(0u, stmt.id);
+
+  stmt = cache.execute("one");
+  EXPECT_EQ(1u, stmt.executions);
+  EXPECT_EQ(0u, stmt.id);
+}
+
+}  // namespace mysqlx
+}  // namespace mysqlsh
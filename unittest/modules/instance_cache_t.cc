@@ -26,10 +26,12 @@
 #include <array>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
 
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -1723,6 +1725,228 @@ TEST_F(Instance_cache_test, table_histograms) {
   }
 }
 
+TEST_F(Instance_cache_test, metadata_snapshot) {
+  {
+    // setup
+    m_session->execute("CREATE SCHEMA first;");
+    m_session->execute(
+        "CREATE TABLE first.one (id INT, data INT, PRIMARY KEY (id));");
+    m_session->execute(
+        "CREATE TABLE first.two (id INT, data INT NOT NULL, UNIQUE (data)) "
+        "PARTITION BY KEY (data) PARTITIONS 2;");
+    m_session->execute("CREATE VIEW first.three AS SELECT * FROM first.one;");
+    m_session->execute(
+        "CREATE TABLE first.four (id INT, data INT, PRIMARY KEY (id));");
+    m_session->execute(
+        "CREATE TABLE first.five (id INT, data INT, PRIMARY KEY (id));");
+    m_session->execute("CREATE TABLE first.six (id INT, data INT NOT NULL);");
+  }
+
+  // CREATE_TIME has a resolution of one second, metadata of tables created in
+  // the same second in which snapshot is taken is not reused
+  shcore::sleep_ms(1100);
+
+  Filtering_options filters;
+  std::string snapshot;
+
+  {
+    // fingerprints allow to find the tables which were altered in-place
+    auto builder = Instance_cache_builder(m_session, filters);
+    builder.use_snapshot({}).metadata({}).fingerprints();
+    snapshot = builder.snapshot();
+  }
+
+  // rename the columns stored in the snapshot, to detect if it was used
+  snapshot = shcore::str_replace(snapshot, "\"name\":\"data\"",
+                                 "\"name\":\"cached\"");
+
+  const auto column_names = [](const Instance_cache::Table &table) {
+    std::vector<std::string> names;
+
+    for (const auto &column : table.all_columns) {
+      names.emplace_back(column.name);
+    }
+
+    return names;
+  };
+
+  using Names = std::vector<std::string>;
+
+  {
+    SCOPED_TRACE("snapshot is used");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({})
+                           .build();
+    const auto &first = cache.schemas.at("first");
+
+    {
+      const auto &one = first.tables.at("one");
+      EXPECT_EQ((Names{"id", "cached"}), column_names(one));
+      ASSERT_EQ(2, one.columns.size());
+      EXPECT_EQ(&one.all_columns[1], one.columns[1]);
+      EXPECT_TRUE(one.index.primary());
+      ASSERT_EQ(1, one.index.columns().size());
+      EXPECT_EQ(&one.all_columns[0], one.index.columns()[0]);
+    }
+
+    {
+      const auto &two = first.tables.at("two");
+      EXPECT_EQ((Names{"id", "cached"}), column_names(two));
+      EXPECT_FALSE(two.index.primary());
+      ASSERT_EQ(1, two.index.columns().size());
+      EXPECT_EQ(&two.all_columns[1], two.index.columns()[0]);
+      ASSERT_EQ(2, two.partitions.size());
+      EXPECT_EQ("`p0`", two.partitions[0].quoted_name);
+    }
+
+    // views are always fetched
+    EXPECT_EQ((Names{"id", "data"}), column_names(first.views.at("three")));
+  }
+
+  {
+    SCOPED_TRACE("modified table is fetched");
+
+    m_session->execute(
+        "ALTER TABLE first.one ADD COLUMN extra INT, ALGORITHM=COPY;");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({})
+                           .build();
+    const auto &first = cache.schemas.at("first");
+
+    EXPECT_EQ((Names{"id", "data", "extra"}),
+              column_names(first.tables.at("one")));
+    EXPECT_TRUE(first.tables.at("one").index.primary());
+    EXPECT_EQ((Names{"id", "cached"}), column_names(first.tables.at("two")));
+  }
+
+  if (_target_server_version >= Version(8, 0, 12)) {
+    SCOPED_TRACE("table modified using ALGORITHM=INSTANT is fetched");
+
+    m_session->execute(
+        "ALTER TABLE first.four ADD COLUMN extra INT, ALGORITHM=INSTANT;");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({})
+                           .build();
+
+    EXPECT_EQ((Names{"id", "data", "extra"}),
+              column_names(cache.schemas.at("first").tables.at("four")));
+  }
+
+  {
+    SCOPED_TRACE("column renamed using ALGORITHM=INPLACE is fetched");
+
+    m_session->execute(
+        "ALTER TABLE first.five CHANGE COLUMN data renamed INT, "
+        "ALGORITHM=INPLACE;");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({})
+                           .build();
+
+    EXPECT_EQ((Names{"id", "renamed"}),
+              column_names(cache.schemas.at("first").tables.at("five")));
+  }
+
+  {
+    SCOPED_TRACE("index added using ALGORITHM=INPLACE is fetched");
+
+    m_session->execute(
+        "ALTER TABLE first.six ADD UNIQUE INDEX (data), ALGORITHM=INPLACE;");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({})
+                           .build();
+    const auto &six = cache.schemas.at("first").tables.at("six");
+
+    EXPECT_EQ((Names{"id", "data"}), column_names(six));
+    ASSERT_EQ(1, six.index.columns().size());
+    EXPECT_EQ(&six.all_columns[1], six.index.columns()[0]);
+  }
+
+  {
+    SCOPED_TRACE("snapshot taken with different partitions is ignored");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot(snapshot)
+                           .metadata({{"first", {{"two", {"p1"}}}}})
+                           .build();
+    const auto &two = cache.schemas.at("first").tables.at("two");
+
+    EXPECT_EQ((Names{"id", "data"}), column_names(two));
+    ASSERT_EQ(1, two.partitions.size());
+    EXPECT_EQ("p1", two.partitions[0].name);
+  }
+
+  {
+    SCOPED_TRACE("invalid snapshot is ignored");
+
+    const auto cache = Instance_cache_builder(m_session, filters)
+                           .use_snapshot("{\"version\":1}")
+                           .metadata({})
+                           .build();
+
+    EXPECT_EQ((Names{"id", "data"}),
+              column_names(cache.schemas.at("first").tables.at("two")));
+  }
+
+  // tables were modified by ALGORITHM=COPY above
+  shcore::sleep_ms(1100);
+
+  {
+    auto builder = Instance_cache_builder(m_session, filters);
+    builder.use_snapshot({}).metadata({});
+    snapshot = builder.snapshot();
+  }
+
+  // fingerprints are not fetched if there's no snapshot to compare with
+  EXPECT_EQ(std::string::npos, snapshot.find("tables="));
+
+  snapshot = shcore::str_replace(snapshot, "\"name\":\"data\"",
+                                 "\"name\":\"cached\"");
+
+  {
+    SCOPED_TRACE("snapshot without fingerprints is used");
+
+    auto builder = Instance_cache_builder(m_session, filters);
+    builder.use_snapshot(snapshot).metadata({});
+
+    // fingerprints are not needed if nothing has changed
+    EXPECT_EQ(std::string::npos, builder.snapshot().find("tables="));
+
+    const auto cache = builder.build();
+
+    EXPECT_EQ((Names{"id", "cached"}),
+              column_names(cache.schemas.at("first").tables.at("two")));
+  }
+
+  {
+    SCOPED_TRACE("snapshot without fingerprints is not used if table changed");
+
+    m_session->execute(
+        "ALTER TABLE first.six ADD COLUMN other INT, ALGORITHM=INPLACE;");
+
+    auto builder = Instance_cache_builder(m_session, filters);
+    builder.use_snapshot(snapshot).metadata({});
+
+    EXPECT_NE(std::string::npos, builder.snapshot().find("tables="));
+
+    const auto cache = builder.build();
+    const auto &first = cache.schemas.at("first");
+
+    EXPECT_EQ((Names{"id", "data"}), column_names(first.tables.at("two")));
+    EXPECT_EQ((Names{"id", "data", "other"}),
+              column_names(first.tables.at("six")));
+  }
+}
+
 #if defined(_WIN32) || defined(__APPLE__)
 TEST_F(Instance_cache_test, filter_schemas_and_tables_case_sensitive) {
   {
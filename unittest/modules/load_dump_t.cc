@@ -26,6 +26,7 @@
 #include "modules/util/common/dump/utils.h"
 #include "modules/util/dump/compatibility.h"
 #include "modules/util/dump/schema_dumper.h"
+#include "modules/util/load/adaptive_threads.h"
 #include "modules/util/load/dump_loader.h"
 #include "modules/util/load/dump_reader.h"
 #include "modules/util/load/load_dump_options.h"
@@ -761,4 +762,73 @@ TEST_F(Load_dump_mocked, bug_34110375) {
   load_dump(4, false, "createInvisiblePKs", m_create_invisible_pks);
 }
 
+TEST(Load_dump, adaptive_threads) {
+  Adaptive_threads threads{8, nullptr};
+  Adaptive_threads::Metrics metrics;
+
+  EXPECT_EQ(8, threads.active());
+
+  // no metrics, nothing to do
+  EXPECT_EQ(8, threads.adjust(metrics, true));
+
+  // checkpoint age is too high, decrease multiplicatively
+  metrics.checkpoint_age = 0.9;
+  EXPECT_EQ(6, threads.adjust(metrics, true));
+  EXPECT_EQ(4, threads.adjust(metrics, true));
+  EXPECT_EQ(3, threads.adjust(metrics, true));
+  EXPECT_EQ(2, threads.adjust(metrics, true));
+  EXPECT_EQ(1, threads.adjust(metrics, true));
+  // never goes below one thread
+  EXPECT_EQ(1, threads.adjust(metrics, true));
+
+  // between the low and high marks, keep the current limit
+  metrics.checkpoint_age = 0.6;
+  EXPECT_EQ(1, threads.adjust(metrics, true));
+
+  // no pressure, but also no work to do
+  metrics.checkpoint_age = 0.1;
+  EXPECT_EQ(1, threads.adjust(metrics, false));
+
+  // no pressure, increase additively
+  EXPECT_EQ(2, threads.adjust(metrics, true));
+  EXPECT_EQ(3, threads.adjust(metrics, true));
+
+  // any of the metrics can decrease the limit
+  metrics.replica_lag = 120;
+  EXPECT_EQ(2, threads.adjust(metrics, true));
+  metrics.replica_lag = 0;
+
+  metrics.applier_queue = 1.0;
+  EXPECT_EQ(1, threads.adjust(metrics, true));
+  metrics.applier_queue = 0.0;
+
+  EXPECT_EQ(2, threads.adjust(metrics, true));
+
+  metrics.history_length = 2000000;
+  EXPECT_EQ(1, threads.adjust(metrics, true));
+  metrics.history_length = 10;
+
+  for (int i = 0; i < 20; ++i) {
+    threads.adjust(metrics, true);
+  }
+
+  // never goes above the maximum
+  EXPECT_EQ(8, threads.active());
+
+  // our own threads are not taken into account
+  metrics.threads_running = 10;
+  EXPECT_EQ(8, threads.adjust(metrics, true));
+  metrics.threads_running = 16;
+  EXPECT_EQ(6, threads.adjust(metrics, true));
+  metrics.threads_running = 8;
+  EXPECT_EQ(7, threads.adjust(metrics, true));
+
+  // without a session nothing is monitored
+  bool increased = false;
+  threads.start([&increased]() { increased = true; });
+  threads.stop();
+  EXPECT_FALSE(increased);
+  EXPECT_EQ(7, threads.active());
+}
+
 }  // namespace mysqlsh
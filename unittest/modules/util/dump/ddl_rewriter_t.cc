@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <string>
+
+#include "modules/util/dump/compatibility.h"
+#include "modules/util/dump/ddl_rewriter.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace compatibility {
+
+TEST(Ddl_rewriter_test, tokens) {
+  const std::string ddl =
+      "CREATE TABLE `t` (a int) /*!50100 TABLESPACE `ts` */ COMMENT='x y'";
+  const Ddl_tokens tokens{ddl};
+
+  ASSERT_EQ(12, tokens.size());
+
+  EXPECT_EQ("CREATE", tokens[0].text);
+  EXPECT_EQ(0, tokens[0].begin);
+  EXPECT_EQ(6, tokens[0].end);
+  EXPECT_FALSE(tokens[0].inside_hint);
+
+  EXPECT_EQ("`t`", tokens[2].text);
+  EXPECT_EQ("TABLESPACE", tokens[7].text);
+  EXPECT_TRUE(tokens[7].inside_hint);
+  EXPECT_EQ("`ts`", tokens[8].text);
+  EXPECT_TRUE(tokens[8].inside_hint);
+  EXPECT_EQ("'x y'", tokens[11].text);
+  EXPECT_FALSE(tokens[11].inside_hint);
+
+  for (const auto &token : tokens) {
+    EXPECT_EQ(token.text, ddl.substr(token.begin, token.end - token.begin));
+  }
+
+  EXPECT_EQ("", tokens.text(12));
+
+  EXPECT_EQ(0, tokens.first_at(0));
+  EXPECT_EQ(1, tokens.first_at(1));
+  EXPECT_EQ(7, tokens.first_at(tokens[6].end));
+  EXPECT_EQ(12, tokens.first_at(ddl.length()));
+
+  EXPECT_EQ(7, tokens.find("tablespace"));
+  EXPECT_EQ(9, tokens.find("comment", 3));
+  EXPECT_EQ(12, tokens.find("engine"));
+  EXPECT_EQ(12, tokens.find("create", 1));
+}
+
+TEST(Ddl_rewriter_test, edits) {
+  const std::string ddl = "CREATE TABLE t (a int) ENGINE=MyISAM COMMENT='x'";
+
+  {
+    Ddl_edits edits;
+    EXPECT_TRUE(edits.empty());
+    EXPECT_EQ(ddl, edits.apply(ddl));
+  }
+
+  {
+    // edits are applied in order of offsets
+    Ddl_edits edits;
+    edits.replace(30, 36, "InnoDB");
+    edits.remove(36, 48);
+    edits.replace(13, 14, "`t`");
+    EXPECT_FALSE(edits.empty());
+    EXPECT_EQ("CREATE TABLE `t` (a int) ENGINE=InnoDB", edits.apply(ddl));
+  }
+
+  {
+    Ddl_edits edits;
+    edits.comment_out(23, 36, false);
+    EXPECT_EQ("CREATE TABLE t (a int) /* ENGINE=MyISAM*/  COMMENT='x'",
+              edits.apply(ddl));
+  }
+
+  {
+    Ddl_edits edits;
+    edits.comment_out(23, 36, true);
+    EXPECT_EQ("CREATE TABLE t (a int) -- ENGINE=MyISAM\n COMMENT='x'",
+              edits.apply(ddl));
+  }
+
+  {
+    // overlapping edits: comments are clipped, replacements are dropped
+    Ddl_edits edits;
+    edits.comment_out(23, 36, false);
+    edits.comment_out(30, 48, false);
+    edits.replace(30, 36, "InnoDB");
+    EXPECT_EQ("CREATE TABLE t (a int) /* ENGINE=MyISAM*/  /* COMMENT='x'*/ ",
+              edits.apply(ddl));
+  }
+
+  {
+    Ddl_edits edits;
+    edits.replace(30, 36, "InnoDB");
+    edits.skip();
+    EXPECT_TRUE(edits.skipped());
+    EXPECT_FALSE(edits.empty());
+    EXPECT_EQ("", edits.apply(ddl));
+  }
+}
+
+TEST(Ddl_rewriter_test, rewrite) {
+  Ddl_rewriter rewriter;
+  std::string out;
+
+  EXPECT_TRUE(rewriter.empty());
+  EXPECT_FALSE(rewriter.rewrite("CREATE TABLE t (a int)", &out));
+  EXPECT_EQ("CREATE TABLE t (a int)", out);
+
+  int calls = 0;
+
+  rewriter.add([&calls](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    ++calls;
+    const auto idx = tokens.find("ENGINE");
+
+    if (idx + 2 < tokens.size()) {
+      edits->replace(tokens[idx + 2].begin, tokens[idx + 2].end, "InnoDB");
+    }
+  });
+
+  rewriter.add([&calls](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    ++calls;
+    const auto idx = tokens.find("COMMENT");
+
+    if (idx + 2 < tokens.size()) {
+      edits->remove(tokens[idx].begin, tokens[idx + 2].end);
+    }
+  });
+
+  EXPECT_FALSE(rewriter.empty());
+
+  EXPECT_FALSE(rewriter.rewrite("CREATE TABLE t (a int)", &out));
+  EXPECT_EQ("CREATE TABLE t (a int)", out);
+  EXPECT_EQ(2, calls);
+
+  EXPECT_TRUE(rewriter.rewrite(
+      "CREATE TABLE t (a int) ENGINE=MyISAM COMMENT='x' ROW_FORMAT=FIXED",
+      &out));
+  EXPECT_EQ("CREATE TABLE t (a int) ENGINE=InnoDB  ROW_FORMAT=FIXED", out);
+  EXPECT_EQ(4, calls);
+}
+
+TEST(Ddl_rewriter_test, create_table_options_single_pass) {
+  const std::string ddl = R"(CREATE TABLE `t` (
+  `id` int NOT NULL,
+  PRIMARY KEY (`id`)
+) /*!50100 TABLESPACE `ts1` */ ENGINE=MyISAM DEFAULT CHARSET=latin1 )"
+      R"(DATA DIRECTORY='/tmp' ROW_FORMAT=FIXED ENCRYPTION='N')";
+
+  // result of a single pass is the same as the result of the checks applied
+  // one after another
+  std::string expected;
+  check_create_table_for_data_index_dir_option(ddl, &expected);
+  check_create_table_for_encryption_option(expected, &expected);
+  EXPECT_EQ("MyISAM",
+            check_create_table_for_engine_option(expected, &expected));
+  check_create_table_for_tablespace_option(expected, &expected);
+  check_create_table_for_fixed_row_format(expected, &expected);
+
+  Ddl_rewriter rewriter;
+  std::string engine;
+
+  rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    EXPECT_TRUE(check_create_table_for_data_index_dir_option(tokens, edits));
+  });
+  rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    EXPECT_TRUE(check_create_table_for_encryption_option(tokens, edits));
+  });
+  rewriter.add([&engine](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    engine = check_create_table_for_engine_option(tokens, edits);
+  });
+  rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    EXPECT_TRUE(check_create_table_for_tablespace_option(tokens, edits));
+  });
+  rewriter.add([](const Ddl_tokens &tokens, Ddl_edits *edits) {
+    EXPECT_TRUE(check_create_table_for_fixed_row_format(tokens, edits));
+  });
+
+  std::string out;
+  EXPECT_TRUE(rewriter.rewrite(ddl, &out));
+  // string variant of the fixed row format check strips the result
+  EXPECT_EQ(expected, shcore::str_strip(out, " \r\n\t,"));
+  EXPECT_EQ("MyISAM", engine);
+}
+
+}  // namespace compatibility
+}  // namespace mysqlsh
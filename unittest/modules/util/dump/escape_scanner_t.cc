@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <string>
+
+#include "modules/util/dump/escape_scanner.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+std::size_t find(const Escape_scanner &scanner, const std::string &s,
+                 std::size_t offset = 0) {
+  return scanner.find(s.data() + offset, s.data() + s.length()) - s.data();
+}
+
+}  // namespace
+
+TEST(Escape_scanner_test, control_characters) {
+  const Escape_scanner scanner;
+
+  EXPECT_EQ(0, find(scanner, ""));
+  EXPECT_EQ(3, find(scanner, "abc"));
+  EXPECT_EQ(17, find(scanner, "abcdefghijklmnopq"));
+
+  for (const auto c : {'\0', '\b', '\n', '\r', '\t', '\x1A'}) {
+    SCOPED_TRACE(static_cast<int>(c));
+
+    for (std::size_t pos = 0; pos < 20; ++pos) {
+      std::string s(20, 'x');
+      s[pos] = c;
+
+      EXPECT_EQ(pos, find(scanner, s));
+      EXPECT_EQ(pos, find(scanner, s, pos));
+      EXPECT_EQ(20, find(scanner, s, pos + 1));
+    }
+  }
+
+  // control characters without escape sequences are not reported
+  EXPECT_EQ(20, find(scanner, std::string(20, '\x01')));
+  EXPECT_EQ(20, find(scanner, std::string(20, '\x1F')));
+  // neither are multibyte characters
+  EXPECT_EQ(20, find(scanner, std::string(10, 'x') + "óóóóó"));
+}
+
+TEST(Escape_scanner_test, dialect_characters) {
+  const Escape_scanner scanner{'\\', ',', '\r', '"'};
+
+  for (const auto c : {'\\', ',', '"'}) {
+    SCOPED_TRACE(c);
+
+    for (std::size_t pos = 0; pos < 20; ++pos) {
+      std::string s(20, 'x');
+      s[pos] = c;
+
+      EXPECT_EQ(pos, find(scanner, s));
+      EXPECT_EQ(20, find(scanner, s, pos + 1));
+    }
+  }
+
+  // first match is returned
+  EXPECT_EQ(9, find(scanner, "abcdefghi\"jk,lmn\\"));
+  EXPECT_EQ(12, find(scanner, "abcdefghi\"jk,lmn\\", 10));
+  EXPECT_EQ(16, find(scanner, "abcdefghi\"jk,lmn\\", 13));
+
+  // characters which are not escaped by this dialect
+  EXPECT_EQ(20, find(scanner, std::string(20, '\'')));
+  EXPECT_EQ(20, find(scanner, std::string(20, '\xFF')));
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include "modules/util/load/ddl_dependency_graph.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+
+using Ids = std::vector<Ddl_dependency_graph::Object_id>;
+
+TEST(Ddl_dependency_graph_test, references) {
+  Ddl_dependency_graph graph;
+
+  const auto v1 = graph.add_object("s", "v1");
+  const auto v2 = graph.add_object("s", "v2");
+  const auto v3 = graph.add_object("s", "v3");
+  const auto v4 = graph.add_object("t", "v1");
+  const auto w = graph.add_object("t", "w`x");
+
+  graph.add_references(v1, R"(DROP TABLE IF EXISTS `s`.`v1`;
+CREATE VIEW `s`.`v1` AS select `s`.`v2`.`a` AS `a` from `s`.`v2`)");
+  // unqualified names use schema of the object
+  graph.add_references(v2, "CREATE VIEW v2 AS select v3.a from v3");
+  // names in strings and comments are not references
+  graph.add_references(
+      v3, "CREATE VIEW `v3` AS select 'v1' AS a /* `s`.`v2` */ from dual");
+  graph.add_references(v4, "CREATE VIEW `t`.`v1` AS select * from `t`.`w``x`");
+  graph.add_references(w, "CREATE VIEW `t`.`w``x` AS select * from `s`.`v1`");
+
+  EXPECT_EQ((Ids{v2}), graph.dependencies(v1));
+  EXPECT_EQ((Ids{v3}), graph.dependencies(v2));
+  EXPECT_EQ((Ids{}), graph.dependencies(v3));
+  EXPECT_EQ((Ids{w}), graph.dependencies(v4));
+  EXPECT_EQ((Ids{v1}), graph.dependencies(w));
+
+  EXPECT_THROW(graph.add_object("s", "v1"), std::logic_error);
+}
+
+TEST(Ddl_dependency_graph_test, waves) {
+  Ddl_dependency_graph graph;
+
+  const auto a = graph.add_object("s", "a");
+  const auto b = graph.add_object("s", "b");
+  const auto c = graph.add_object("s", "c");
+  const auto d = graph.add_object("s", "d");
+
+  // d -> b, c -> a
+  graph.add_dependency(b, a);
+  graph.add_dependency(c, a);
+  graph.add_dependency(d, b);
+  graph.add_dependency(d, c);
+
+  graph.start();
+
+  EXPECT_EQ((Ids{a}), graph.fetch_ready());
+  EXPECT_EQ((Ids{}), graph.fetch_ready());
+  EXPECT_EQ(1, graph.in_progress());
+
+  graph.done(a);
+  EXPECT_EQ((Ids{b, c}), graph.fetch_ready());
+  EXPECT_EQ(2, graph.in_progress());
+
+  graph.done(b);
+  EXPECT_EQ((Ids{}), graph.fetch_ready());
+
+  graph.done(c);
+  EXPECT_EQ((Ids{d}), graph.fetch_ready());
+
+  graph.done(d);
+  EXPECT_EQ(0, graph.in_progress());
+  EXPECT_EQ((Ids{}), graph.fetch_ready());
+  EXPECT_EQ((Ids{}), graph.fetch_unresolved());
+}
+
+TEST(Ddl_dependency_graph_test, unresolved) {
+  Ddl_dependency_graph graph;
+
+  const auto a = graph.add_object("s", "a");
+  const auto b = graph.add_object("s", "b");
+  const auto c = graph.add_object("s", "c");
+  const auto d = graph.add_object("s", "d");
+  const auto e = graph.add_object("s", "e");
+  const auto f = graph.add_object("s", "f");
+
+  // cycle: a -> b -> a, c depends on the cycle
+  graph.add_dependency(a, b);
+  graph.add_dependency(b, a);
+  graph.add_dependency(c, a);
+  // e is going to be deferred, f depends on it
+  graph.add_dependency(f, e);
+
+  graph.start();
+
+  EXPECT_EQ((Ids{d, e}), graph.fetch_ready());
+
+  graph.done(d);
+  graph.defer(e);
+
+  EXPECT_EQ((Ids{}), graph.fetch_ready());
+  EXPECT_EQ(0, graph.in_progress());
+
+  EXPECT_EQ((Ids{a, b, c, e, f}), graph.fetch_unresolved());
+  EXPECT_EQ(5, graph.in_progress());
+
+  for (const auto id : {a, b, c, e, f}) {
+    graph.done(id);
+  }
+
+  EXPECT_EQ(0, graph.in_progress());
+  EXPECT_EQ((Ids{}), graph.fetch_ready());
+}
+
+}  // namespace mysqlsh
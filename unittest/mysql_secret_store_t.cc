@@ -27,6 +27,7 @@
 #include <iterator>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -1593,6 +1594,74 @@ TEST_P(Helper_executable_test, version_command) {
   output.clear();
 }
 
+TEST_P(Helper_executable_test, serve_command) {
+  const std::string spec =
+      R"("ServerURL":"user@host","SecretType":"password")";
+  const auto get = "{" + spec + "}";
+  const auto store = "{" + spec + R"(,"Secret":"pass"})";
+  const auto request = [](const std::string &command,
+                          const std::string &input) {
+    return command + " " + std::to_string(input.length()) + "\n" + input;
+  };
+
+  const char *const args[] = {tester.get_invoker().m_path.c_str(), "serve",
+                              nullptr};
+  shcore::Process_launcher app{args};
+
+  app.start();
+
+  const auto input = request("store", store) + request("get", get) +
+                     request("version", "") + request("unknown", "") +
+                     request("serve", "") + request("erase", get) +
+                     request("get", get);
+  app.write(input.c_str(), input.length());
+  app.finish_writing();
+
+  const auto output = app.read_all();
+  EXPECT_EQ(0, app.wait());
+
+  std::istringstream responses{output};
+  const auto next_response = [&responses](int *exit_code) {
+    std::size_t length = 0;
+    std::string data;
+
+    if (responses >> *exit_code >> length && responses.get() == '\n') {
+      data.resize(length);
+      responses.read(data.data(), length);
+    } else {
+      ADD_FAILURE() << "Invalid response";
+    }
+
+    return data;
+  };
+  int exit_code = -1;
+
+  EXPECT_EQ("", shcore::str_strip(next_response(&exit_code)));
+  EXPECT_EQ(0, exit_code);
+
+  EXPECT_THAT(next_response(&exit_code), ::testing::HasSubstr("pass"));
+  EXPECT_EQ(0, exit_code);
+
+  EXPECT_THAT(next_response(&exit_code),
+              ::testing::HasSubstr(shcore::get_long_version()));
+  EXPECT_EQ(0, exit_code);
+
+  EXPECT_THAT(next_response(&exit_code),
+              ::testing::HasSubstr("Unknown command"));
+  EXPECT_NE(0, exit_code);
+
+  // nested sessions are not allowed
+  EXPECT_THAT(next_response(&exit_code),
+              ::testing::HasSubstr("Unknown command"));
+  EXPECT_NE(0, exit_code);
+
+  EXPECT_EQ("", shcore::str_strip(next_response(&exit_code)));
+  EXPECT_EQ(0, exit_code);
+
+  next_response(&exit_code);
+  EXPECT_NE(0, exit_code);
+}
+
 REGISTER_TESTS(Helper_executable_test);
 
 }  // namespace tests
@@ -551,6 +551,12 @@ class Mysqlsh_plugin_test : public Mysqlsh_extension_test {
         contents);
   }
 
+  void write_user_plugin_manifest(const std::string &name,
+                                  const std::string &contents) {
+    shcore::create_file(
+        join_path(get_user_plugin_folder(), name, "manifest.json"), contents);
+  }
+
   void delete_plugin(const std::string &name) {
     auto path = join_path(get_plugin_folder(), name);
     if (shcore::is_folder(path)) {
@@ -1871,4 +1877,104 @@ shell.registerGlobal('gl', gl);
   delete_user_plugin("bug31693096");
 }
 
+TEST_F(Mysqlsh_plugin_test, lazy_plugin_global) {
+  // plugin with a manifest is loaded when its global object is used
+  write_user_plugin("lazy-js", R"(println('lazy-js loaded');
+var obj = shell.createExtensionObject();
+shell.addExtensionObjectMember(obj, "testFunction", function() {
+  println('lazy object called');
+}, {cli: true});
+shell.registerGlobal('lazyObject', obj);
+)",
+                    ".js");
+  write_user_plugin_manifest("lazy-js", R"({"globals": ["lazyObject"]})");
+
+  add_js_test("lazyObject.testFunction()", "lazy object called");
+  add_py_test("\\py", "Switching to Python mode...");
+  add_py_test("lazyObject.test_function()", "lazy object called");
+
+  add_expected_js_log(
+      join_path(get_user_plugin_folder(), "lazy-js", "init.js") +
+      " will be loaded on demand");
+
+  run({"--log-level=debug"});
+
+  for (const auto &output : get_expected_output()) {
+    MY_EXPECT_CMD_OUTPUT_CONTAINS(output);
+  }
+
+  validate_log();
+  wipe_out();
+
+#ifdef HAVE_V8
+  // CLI calls load the plugin which provides the target object
+  run_cli_plugin({"--", "lazyObject", "test-function"});
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy-js loaded");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("lazy object called");
+  wipe_out();
+
+  // plugin is not loaded if it's not used
+  run_cli_plugin({"--", "shell", "status"});
+  MY_EXPECT_CMD_OUTPUT_NOT_CONTAINS("lazy-js loaded");
+  wipe_out();
+#endif  // HAVE_V8
+
+  delete_user_plugin("lazy-js");
+}
+
+TEST_F(Mysqlsh_plugin_test, lazy_plugin_report) {
+  // plugin with a manifest is loaded when its report is used
+  write_user_plugin("lazy-py", R"(print('lazy-py loaded')
+
+def report(session):
+  print('lazy PY report')
+  return {'report': []}
+
+shell.register_report('lazy_py', 'print', report)
+)",
+                    ".py");
+  write_user_plugin_manifest("lazy-py", R"({"reports": ["lazy_py"]})");
+
+  add_test("select 'before report';");
+  add_py_test("\\show lazy_py", "lazy PY report");
+
+  run({"--sql"});
+
+  MY_EXPECT_CMD_OUTPUT_CONTAINS(expected_output());
+
+#ifdef HAVE_PYTHON
+  const auto before = _output.find("before report");
+  const auto loaded = _output.find("lazy-py loaded");
+  EXPECT_NE(std::string::npos, before);
+  EXPECT_NE(std::string::npos, loaded);
+  EXPECT_LT(before, loaded);
+#endif  // HAVE_PYTHON
+
+  wipe_out();
+
+  delete_user_plugin("lazy-py");
+}
+
+TEST_F(Mysqlsh_plugin_test, lazy_plugin_invalid_manifest) {
+  // plugin with an invalid manifest is loaded at startup
+  write_user_plugin("invalid-manifest", R"(println('plugin loaded');
+)",
+                    ".js");
+  write_user_plugin_manifest("invalid-manifest", R"({"objects": ["a"]})");
+
+  add_js_test("println('plugin used')", "plugin used");
+
+  run();
+
+#ifdef HAVE_V8
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("WARNING: Error reading manifest of plugin at");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("Invalid options in plugin manifest: objects");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS("plugin loaded");
+  MY_EXPECT_CMD_OUTPUT_CONTAINS(expected_output());
+#endif  // HAVE_V8
+  wipe_out();
+
+  delete_user_plugin("invalid-manifest");
+}
+
 }  // namespace tests
@@ -617,6 +617,77 @@ TEST_F(Config_server_handler_test, apply_errors) {
   }
 }
 
+TEST_F(Config_server_handler_test, apply_multiple) {
+  // Test changes applied using a single statement.
+  mysqlshdk::mysql::Instance instance(m_session);
+
+  const auto lc_messages =
+      instance.get_sysvar_string("lc_messages", Var_qualifier::SESSION);
+  const auto wait_timeout =
+      instance.get_sysvar_int("wait_timeout", Var_qualifier::SESSION);
+  const auto sql_warnings =
+      instance.get_sysvar_bool("sql_warnings", Var_qualifier::SESSION);
+
+  {
+    SCOPED_TRACE("All changes are applied.");
+    Config_server_handler cfg_h(&instance, Var_qualifier::SESSION);
+    cfg_h.set("lc_messages", std::optional<std::string>("fr_FR"));
+    cfg_h.set("wait_timeout", std::optional<int64_t>(1234));
+    cfg_h.set("sql_warnings", std::optional<bool>(!*sql_warnings));
+    cfg_h.set("wait_timeout", std::optional<int64_t>(5678));
+    cfg_h.apply();
+
+    EXPECT_EQ("fr_FR",
+              *instance.get_sysvar_string("lc_messages",
+                                          Var_qualifier::SESSION));
+    EXPECT_EQ(5678,
+              *instance.get_sysvar_int("wait_timeout", Var_qualifier::SESSION));
+    EXPECT_EQ(!*sql_warnings,
+              *instance.get_sysvar_bool("sql_warnings",
+                                        Var_qualifier::SESSION));
+  }
+
+  {
+    SCOPED_TRACE("Variable which failed is reported.");
+    Config_server_handler cfg_h(&instance, Var_qualifier::SESSION);
+    cfg_h.set("lc_messages", std::optional<std::string>("pt_PT"));
+    cfg_h.set("not_exist_int", std::optional<int64_t>(1234), "notExistInt");
+    cfg_h.set("wait_timeout", std::optional<int64_t>(1234));
+    EXPECT_THROW_LIKE(cfg_h.apply(), std::runtime_error,
+                      "Unable to set value '1234' for 'notExistInt': Unknown "
+                      "system variable 'not_exist_int'");
+
+    // changes are applied in order
+    EXPECT_EQ("pt_PT",
+              *instance.get_sysvar_string("lc_messages",
+                                          Var_qualifier::SESSION));
+    EXPECT_EQ(5678,
+              *instance.get_sysvar_int("wait_timeout", Var_qualifier::SESSION));
+  }
+
+  {
+    SCOPED_TRACE("Prefetched values are used.");
+    Config_server_handler cfg_h(&instance, Var_qualifier::SESSION);
+    cfg_h.prefetch({"lc_messages", "wait_timeout", "not_exist"});
+
+    EXPECT_EQ("pt_PT", *cfg_h.get_string("lc_messages"));
+    EXPECT_EQ(5678, *cfg_h.get_int("wait_timeout"));
+    EXPECT_THROW_LIKE(cfg_h.get_string("not_exist"), std::out_of_range,
+                      "Variable 'not_exist' does not exist.");
+
+    // changed values are fetched again
+    cfg_h.set("wait_timeout", std::optional<int64_t>(1234));
+    cfg_h.apply();
+    EXPECT_EQ(1234, *cfg_h.get_int("wait_timeout"));
+
+    cfg_h.clear_prefetched();
+  }
+
+  instance.set_sysvar("lc_messages", *lc_messages, Var_qualifier::SESSION);
+  instance.set_sysvar("wait_timeout", *wait_timeout, Var_qualifier::SESSION);
+  instance.set_sysvar("sql_warnings", *sql_warnings, Var_qualifier::SESSION);
+}
+
 TEST_F(Config_server_handler_test, get_persisted_value) {
   // Test getting persisted values.
   mysqlshdk::mysql::Instance instance(m_session);
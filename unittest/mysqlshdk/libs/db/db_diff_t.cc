@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/db/utils/diff.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+using Differences = std::vector<std::pair<std::string, Row_difference>>;
+
+Differences find_differences(IResult *left, IResult *right) {
+  Differences differences;
+
+  find_different_rows_with_key_indexes(
+      left, right, {0},
+      [&differences](const IRow *l, const IRow *r, Row_difference d) {
+        differences.emplace_back((l ? l : r)->get_as_string(0), d);
+        return true;
+      });
+
+  return differences;
+}
+
+}  // namespace
+
+TEST(Db_diff, different_types) {
+  Mutable_result left{{Mutable_result::make_column("id", Type::Integer),
+                       Mutable_result::make_column("value", Type::Integer)}};
+  left.append(1, 10);
+  left.append(2, 20);
+  left.append(3, 30);
+
+  // i.e. column was altered on one side, values are compared as text
+  Mutable_result right{{Mutable_result::make_column("id", Type::Integer),
+                        Mutable_result::make_column("value", Type::String)}};
+  right.append(1, "10");
+  right.append(2, "21");
+  right.append(3, nullptr);
+
+  EXPECT_EQ((Differences{{"2", Row_difference::Fields_differ},
+                         {"3", Row_difference::Fields_differ}}),
+            find_differences(&left, &right));
+
+  left.reset();
+  right.reset();
+
+  const auto l = left.fetch_one();
+  const auto r = right.fetch_one();
+  std::vector<int> fields;
+
+  EXPECT_EQ(0u, find_different_row_fields(*l, *r, [&fields](int f) {
+              fields.emplace_back(f);
+              return true;
+            }));
+  EXPECT_TRUE(fields.empty());
+}
+
+TEST(Db_diff, different_key_types) {
+  Mutable_result left{{Mutable_result::make_column("id", Type::Integer)}};
+  left.append(1);
+  left.append(2);
+
+  Mutable_result right{{Mutable_result::make_column("id", Type::String)}};
+  right.append("1");
+  right.append("3");
+
+  EXPECT_EQ((Differences{{"2", Row_difference::Row_missing},
+                         {"3", Row_difference::Row_added}}),
+            find_differences(&left, &right));
+}
+
+TEST(Db_diff, different_names) {
+  // fields are compared by their position
+  Mutable_result left{{Mutable_result::make_column("id", Type::Integer),
+                       Mutable_result::make_column("old", Type::String)}};
+  left.append(1, "one");
+  left.append(2, "two");
+
+  Mutable_result right{{Mutable_result::make_column("id", Type::Integer),
+                        Mutable_result::make_column("new", Type::String)}};
+  right.append(1, "one");
+  right.append(2, "TWO");
+
+  EXPECT_EQ((Differences{{"2", Row_difference::Fields_differ}}),
+            find_differences(&left, &right));
+}
+
+TEST(Db_diff, different_number_of_fields) {
+  Mutable_result left{{Mutable_result::make_column("id", Type::Integer)}};
+  left.append(1);
+
+  Mutable_result right{{Mutable_result::make_column("id", Type::Integer),
+                        Mutable_result::make_column("extra", Type::Integer)}};
+  right.append(1, 2);
+
+  EXPECT_THROW(find_differences(&left, &right), std::invalid_argument);
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <string>
+
+#include "unittest/gtest_clean.h"
+#include "unittest/mysqlshdk/libs/db/db_common.h"
+#include "unittest/test_utils.h"
+
+#include "mysqlshdk/libs/db/row_batch.h"
+
+namespace mysqlshdk {
+namespace db {
+
+TEST(Row_batch, add_and_copy) {
+  const std::string big(100 * 1024, 'x');
+  const char *data[] = {"one", nullptr, "", big.c_str()};
+  const unsigned long lengths[] = {3, 0, 0,
+                                   static_cast<unsigned long>(big.length())};
+
+  Row_batch batch;
+  EXPECT_TRUE(batch.empty());
+
+  for (int i = 0; i < 2; ++i) {
+    SCOPED_TRACE("iteration " + std::to_string(i));
+
+    batch.reset(4);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(4, batch.num_fields());
+
+    batch.add_row(data, lengths);
+    batch.copy_row(data, lengths);
+
+    ASSERT_EQ(2, batch.size());
+
+    // referenced data
+    EXPECT_EQ(data[0], batch.data(0, 0));
+    EXPECT_EQ(data[3], batch.data(0, 3));
+
+    // copied data
+    EXPECT_NE(data[0], batch.data(1, 0));
+    EXPECT_NE(data[3], batch.data(1, 3));
+
+    for (std::size_t row = 0; row < batch.size(); ++row) {
+      EXPECT_FALSE(batch.is_null(row, 0));
+      EXPECT_EQ("one", std::string(batch.data(row, 0), batch.length(row, 0)));
+
+      EXPECT_TRUE(batch.is_null(row, 1));
+      EXPECT_EQ(0, batch.length(row, 1));
+
+      EXPECT_FALSE(batch.is_null(row, 2));
+      EXPECT_EQ(0, batch.length(row, 2));
+
+      const char *ptr = nullptr;
+      std::size_t length = 0;
+      batch.get_raw_data(row, 3, &ptr, &length);
+      EXPECT_EQ(big, std::string(ptr, length));
+    }
+  }
+}
+
+class Db_row_batch : public Db_tests {};
+
+TEST_F(Db_row_batch, fetch_batch) {
+  do {
+    SCOPED_TRACE(is_classic ? "mysql" : "mysqlx");
+    ASSERT_NO_THROW(session->connect(Connection_options(uri())));
+
+    const std::string query =
+        "SELECT n, IF(n % 2, NULL, REPEAT('a', n)) FROM (WITH RECURSIVE seq "
+        "(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < 10) "
+        "SELECT n FROM seq) t ORDER BY n";
+
+    for (const auto buffered : {false, true}) {
+      SCOPED_TRACE(buffered ? "buffered" : "unbuffered");
+
+      const auto result = session->query(query, buffered);
+      std::size_t fetched = 0;
+
+      // first row is fetched using the old API
+      const auto row = result->fetch_one();
+      ASSERT_NE(nullptr, row);
+      EXPECT_EQ(1, row->get_int(0));
+      ++fetched;
+
+      while (true) {
+        const auto &batch = result->fetch_batch(3);
+
+        if (batch.empty()) {
+          break;
+        }
+
+        EXPECT_GE(3, batch.size());
+
+        if (is_classic && !buffered) {
+          // row buffer of an unbuffered result is not copied
+          EXPECT_EQ(1, batch.size());
+        }
+
+        EXPECT_EQ(2, batch.num_fields());
+
+        for (std::size_t i = 0; i < batch.size(); ++i) {
+          const auto n = ++fetched;
+
+          EXPECT_EQ(std::to_string(n),
+                    std::string(batch.data(i, 0), batch.length(i, 0)));
+
+          if (n % 2) {
+            EXPECT_TRUE(batch.is_null(i, 1));
+          } else {
+            EXPECT_FALSE(batch.is_null(i, 1));
+            EXPECT_EQ(std::string(n, 'a'),
+                      std::string(batch.data(i, 1), batch.length(i, 1)));
+          }
+        }
+      }
+
+      EXPECT_EQ(10, fetched);
+      EXPECT_EQ(nullptr, result->fetch_one());
+      EXPECT_TRUE(result->fetch_batch(3).empty());
+    }
+  } while (switch_proto());
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
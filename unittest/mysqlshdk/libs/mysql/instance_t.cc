@@ -815,6 +815,76 @@ TEST_F(Instance_test, set_sysvar_default) {
   _session->close();
 }
 
+TEST_F(Instance_test, prefetch_sysvars) {
+  EXPECT_CALL(session, do_connect(_connection_options));
+  EXPECT_CALL(session, is_open()).WillOnce(Return(false));
+  const mysqlshdk::db::Connection_options opts;
+  EXPECT_CALL(session, get_connection_options()).WillOnce(ReturnRef(opts));
+  _session->connect(_connection_options);
+  mysqlshdk::mysql::Instance instance(_session);
+
+  // all variables are fetched using a single query
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in ('gtid_mode', "
+          "'server_id', 'not_existing')")
+      .then_return({{"show GLOBAL variables where `variable_name` in "
+                     "('gtid_mode', 'server_id', 'not_existing')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"gtid_mode", "ON"}, {"server_id", "1234"}}}});
+  instance.prefetch_sysvars({"gtid_mode", "server_id", "not_existing"});
+
+  // values are cached, server is not queried
+  EXPECT_EQ("ON", instance.get_sysvar_string("gtid_mode").value_or(""));
+  EXPECT_EQ("ON", instance.get_sysvar_string("GTID_MODE").value_or(""));
+  EXPECT_TRUE(instance.get_sysvar_bool("gtid_mode").value_or(false));
+  EXPECT_EQ(1234, instance.get_sysvar_int("server_id").value_or(0));
+  EXPECT_FALSE(instance.get_sysvar_string("not_existing").has_value());
+
+  // SESSION variables were not fetched
+  session
+      .expect_query(
+          "show SESSION variables where `variable_name` in ('gtid_mode')")
+      .then_return({{"show SESSION variables "
+                     "where `variable_name` in ('gtid_mode')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"gtid_mode", "ON"}}}});
+  EXPECT_EQ("ON", instance
+                      .get_sysvar_string(
+                          "gtid_mode", mysqlshdk::mysql::Var_qualifier::SESSION)
+                      .value_or(""));
+
+  // multiple variables are set using a single statement, cached values are
+  // invalidated
+  session
+      .expect_query(
+          "SET GLOBAL `gtid_mode` = 'OFF', PERSIST_ONLY `server_id` = 5678, "
+          "SESSION `sql_log_bin` = 'OFF'")
+      .then({""});
+  instance.set_sysvars({{"gtid_mode", std::string{"OFF"},
+                         mysqlshdk::mysql::Var_qualifier::GLOBAL},
+                        {"server_id", int64_t{5678},
+                         mysqlshdk::mysql::Var_qualifier::PERSIST_ONLY},
+                        {"sql_log_bin", false,
+                         mysqlshdk::mysql::Var_qualifier::SESSION}});
+
+  session
+      .expect_query(
+          "show GLOBAL variables where `variable_name` in ('gtid_mode')")
+      .then_return({{"show GLOBAL variables "
+                     "where `variable_name` in ('gtid_mode')",
+                     {"Variable_name", "Value"},
+                     {Type::String, Type::String},
+                     {{"gtid_mode", "OFF"}}}});
+  EXPECT_EQ("OFF", instance.get_sysvar_string("gtid_mode").value_or(""));
+
+  EXPECT_CALL(session, do_close());
+  EXPECT_CALL(session, is_open()).WillOnce(Return(false));
+  _session->close();
+}
+
 TEST_F(Instance_test, install_plugin_win) {
   EXPECT_CALL(session, do_connect(_connection_options));
   EXPECT_CALL(session, is_open()).WillOnce(Return(false));
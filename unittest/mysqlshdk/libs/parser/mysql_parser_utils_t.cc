@@ -21,6 +21,10 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "unittest/gtest_clean.h"
 
 // hack to workaround antlr4 trying to include Token.h but getting token.h from
@@ -132,5 +136,65 @@ DELIMITER ;
                Sql_syntax_error);
 }
 
+TEST(MysqlParserUtils, check_syntax_reuse) {
+  // parser instances are reused, an error must not affect subsequent checks
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_THROW(check_sql_syntax("select rows from t"), Sql_syntax_error);
+    EXPECT_NO_THROW(check_sql_syntax("select `rows` from t"));
+  }
+
+  // valid statement followed by an invalid one
+  EXPECT_THROW(check_sql_syntax("select 1;\nselect * from t where rows = 1"),
+               Sql_syntax_error);
+}
+
+TEST(MysqlParserUtils, check_syntax_parallel) {
+  const std::string routine = R"*(
+DELIMITER $$
+CREATE PROCEDURE p(IN a INT)
+BEGIN
+  DECLARE b INT DEFAULT 0;
+  WHILE b < a DO
+    SET b = b + 1;
+    IF b % 2 = 0 THEN
+      SELECT b, CASE WHEN b > 10 THEN 'big' ELSE 'small' END FROM dual;
+    END IF;
+  END WHILE;
+END$$
+DELIMITER ;
+)*";
+
+  std::vector<std::thread> threads;
+  std::vector<int> errors(8, 0);
+
+  for (std::size_t t = 0; t < errors.size(); ++t) {
+    threads.emplace_back([&routine, &error = errors[t]]() {
+      for (int i = 0; i < 20; ++i) {
+        try {
+          check_sql_syntax(routine);
+        } catch (...) {
+          ++error;
+        }
+
+        try {
+          check_sql_syntax("select rows from t");
+        } catch (const Sql_syntax_error &) {
+          continue;
+        }
+
+        ++error;
+      }
+    });
+  }
+
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  for (const auto error : errors) {
+    EXPECT_EQ(0, error);
+  }
+}
+
 }  // namespace parser
 }  // namespace mysqlshdk
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/rest/rest_executor.h"
+#include "mysqlshdk/libs/rest/response.h"
+
+namespace mysqlshdk {
+namespace rest {
+namespace test {
+
+namespace {
+
+class Gate final {
+ public:
+  void open() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_open = true;
+    }
+
+    m_cv.notify_all();
+  }
+
+  void wait() {
+    std::unique_lock lock{m_mutex};
+    m_cv.wait(lock, [this]() { return m_open; });
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_open = false;
+};
+
+}  // namespace
+
+TEST(Rest_executor, results) {
+  Rest_executor executor{2};
+
+  auto value = executor.submit(Rest_executor::Priority::PAR,
+                               []() { return std::string{"value"}; });
+  auto nothing = executor.submit(Rest_executor::Priority::PAR, []() {});
+  auto error = executor.submit(Rest_executor::Priority::CLEANUP, []() -> int {
+    throw std::runtime_error("failed");
+  });
+
+  EXPECT_EQ("value", value.get());
+  EXPECT_NO_THROW(nothing.get());
+  EXPECT_THROW(error.get(), std::runtime_error);
+}
+
+TEST(Rest_executor, bounded_threads) {
+  constexpr std::size_t k_max_threads = 4;
+  Rest_executor executor{k_max_threads};
+  std::atomic<std::size_t> running{0};
+  std::atomic<std::size_t> max_running{0};
+  std::vector<std::future<void>> futures;
+
+  for (int i = 0; i < 32; ++i) {
+    futures.emplace_back(
+        executor.submit(Rest_executor::Priority::PAR, [&]() {
+          const auto current = ++running;
+          auto expected = max_running.load();
+
+          while (current > expected &&
+                 !max_running.compare_exchange_weak(expected, current)) {
+          }
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+          --running;
+        }));
+  }
+
+  for (auto &f : futures) {
+    f.get();
+  }
+
+  EXPECT_LE(max_running.load(), k_max_threads);
+  EXPECT_LE(executor.threads(), k_max_threads);
+  EXPECT_EQ(k_max_threads, executor.max_threads());
+}
+
+TEST(Rest_executor, priorities) {
+  Rest_executor executor{1};
+  Gate gate;
+  Gate started;
+  std::mutex order_mutex;
+  std::vector<std::string> order;
+
+  const auto record = [&](const char *name) {
+    return [&, name]() {
+      std::lock_guard lock{order_mutex};
+      order.emplace_back(name);
+    };
+  };
+
+  // block the only worker, so that the remaining tasks are queued
+  auto blocker = executor.submit(Rest_executor::Priority::PAR, [&]() {
+    started.open();
+    gate.wait();
+  });
+  started.wait();
+
+  auto cleanup =
+      executor.submit(Rest_executor::Priority::CLEANUP, record("cleanup"));
+  auto first = executor.submit(Rest_executor::Priority::PAR, record("first"));
+  auto second =
+      executor.submit(Rest_executor::Priority::PAR, record("second"));
+
+  gate.open();
+
+  blocker.get();
+  cleanup.get();
+  first.get();
+  second.get();
+
+  EXPECT_EQ((std::vector<std::string>{"first", "second", "cleanup"}), order);
+}
+
+TEST(Rest_executor, retry) {
+  Rest_executor executor{1};
+  int attempts = 0;
+
+  auto retry = std::make_unique<Retry_strategy>(0);
+  retry->set_max_attempts(5);
+  retry->set_retry_on_server_errors(true);
+
+  auto result = executor.submit(
+      Rest_executor::Priority::PAR,
+      [&attempts]() {
+        if (++attempts < 3) {
+          throw Response_error(Response::Status_code::SERVICE_UNAVAILABLE);
+        }
+
+        return attempts;
+      },
+      std::move(retry));
+
+  EXPECT_EQ(3, result.get());
+
+  // without a retry strategy, the error is reported right away
+  attempts = 0;
+  auto failure = executor.submit(Rest_executor::Priority::PAR, [&attempts]() {
+    ++attempts;
+    throw Response_error(Response::Status_code::SERVICE_UNAVAILABLE);
+  });
+
+  EXPECT_THROW(failure.get(), Response_error);
+  EXPECT_EQ(1, attempts);
+}
+
+TEST(Rest_executor, pending_tasks_are_executed) {
+  std::atomic<int> executed{0};
+
+  {
+    Rest_executor executor{1};
+
+    for (int i = 0; i < 10; ++i) {
+      executor.submit(Rest_executor::Priority::CLEANUP, [&]() { ++executed; });
+    }
+  }
+
+  EXPECT_EQ(10, executed.load());
+}
+
+TEST(Rest_executor, shared) {
+  const auto first = Rest_executor::shared();
+  const auto second = Rest_executor::shared();
+
+  EXPECT_EQ(first.get(), second.get());
+}
+
+}  // namespace test
+}  // namespace rest
+}  // namespace mysqlshdk
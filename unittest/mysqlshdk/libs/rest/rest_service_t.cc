@@ -973,6 +973,31 @@ TEST_F(Rest_service_test, bug34765385) {
   EXPECT_EQ(2, retry_strategy.get_retry_count());
 }
 
+TEST_F(Rest_service_test, connection_reuse) {
+  FAIL_IF_NO_SERVER
+
+  constexpr std::size_t services = 3;
+  constexpr std::size_t requests = 4;
+  const auto before = Rest_service::connection_stats();
+
+  for (std::size_t i = 0; i < services; ++i) {
+    Rest_service service{s_test_server->get_address(), false};
+
+    for (std::size_t j = 0; j < requests; ++j) {
+      auto request = Request("/get");
+      EXPECT_EQ(Response::Status_code::OK, service.get(&request).status);
+    }
+  }
+
+  const auto after = Rest_service::connection_stats();
+
+  EXPECT_EQ(services * requests, after.requests - before.requests);
+  // connections are not shared by the concurrent services, but handles of the
+  // destroyed services are pooled, each service reuses the connection
+  // established by the first one (or by one of the previous tests)
+  EXPECT_GE(1u, after.connections - before.connections);
+}
+
 }  // namespace test
 }  // namespace rest
 }  // namespace mysqlshdk
@@ -33,6 +33,7 @@
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
 
+#include "mysqlshdk/include/scripting/shexcept.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 
@@ -222,6 +223,224 @@ TEST(In_memory_allocator, threads) {
   }
 }
 
+TEST(In_memory_allocator, memory_limit) {
+  constexpr std::size_t number_of_blocks = 4;
+  constexpr std::size_t block_size = 512;
+  constexpr std::size_t page_size = number_of_blocks * block_size;
+
+  Allocator a{page_size, block_size};
+
+  EXPECT_EQ(0, a.memory_limit());
+  EXPECT_EQ(page_size, a.stats().resident);
+
+  // limit is rounded down, at least one page is available
+  a.set_memory_limit(page_size - 1);
+  EXPECT_EQ(page_size, a.memory_limit());
+
+  a.set_memory_limit(2 * page_size + 1);
+  EXPECT_EQ(2 * page_size, a.memory_limit());
+
+  {
+    // use all the available memory
+    const auto blocks = a.try_allocate(2 * page_size);
+    EXPECT_EQ(2 * number_of_blocks, blocks.size());
+    EXPECT_EQ(2 * page_size, a.stats().resident);
+
+    // limit is reached
+    EXPECT_TRUE(a.try_allocate(1).empty());
+
+    // 0 bytes can be always allocated
+    EXPECT_TRUE(a.try_allocate(0).empty());
+    EXPECT_TRUE(a.allocate(0).empty());
+
+    // once memory is released, it can be allocated again
+    a.free(blocks.front());
+    const auto block = a.try_allocate(1);
+    EXPECT_EQ(1, block.size());
+
+    a.free(block);
+    a.free(blocks.begin() + 1, blocks.end());
+  }
+
+  {
+    // request bigger than the limit is served if nothing else is allocated
+    EXPECT_TRUE(a.try_allocate(3 * page_size).empty());
+    const auto blocks = a.allocate(3 * page_size);
+    EXPECT_EQ(3 * number_of_blocks, blocks.size());
+    EXPECT_EQ(3 * page_size, a.stats().peak_resident);
+    a.free(blocks);
+  }
+
+  {
+    // allocate() waits until memory is released
+    const auto blocks = a.allocate(2 * page_size);
+    std::atomic<bool> released = false;
+
+    std::thread t{[&]() {
+      const auto block = a.allocate(1);
+      EXPECT_TRUE(released);
+      a.free(block);
+    }};
+
+    shcore::sleep_ms(100);
+    released = true;
+    a.free(blocks);
+    t.join();
+
+    EXPECT_LT(0, a.stats().blocked_time.count());
+  }
+
+  {
+    // removing the limit wakes up the waiting threads
+    const auto blocks = a.allocate(2 * page_size);
+
+    std::thread t{[&]() { a.free(a.allocate(1)); }};
+
+    shcore::sleep_ms(100);
+    a.set_memory_limit(0);
+    t.join();
+
+    a.free(blocks);
+    a.set_memory_limit(2 * page_size);
+  }
+
+  {
+    // interrupt wakes up the waiting threads
+    const auto blocks = a.allocate(2 * page_size);
+
+    std::thread t{[&]() { EXPECT_THROW(a.allocate(1), shcore::cancelled); }};
+
+    shcore::sleep_ms(100);
+    a.interrupt();
+    t.join();
+
+    a.free(blocks);
+  }
+}
+
+TEST(In_memory_allocator, page_options) {
+  constexpr std::size_t block_size = 4096;
+  constexpr std::size_t page_size = 4 * 1024 * 1024;
+
+  for (const auto huge_pages : {false, true}) {
+    for (const auto prefault : {false, true}) {
+      SCOPED_TRACE("huge_pages: " + std::to_string(huge_pages) +
+                   ", prefault: " + std::to_string(prefault));
+
+      Allocator::Page_options options;
+      options.huge_pages = huge_pages;
+      options.prefault = prefault;
+
+      Allocator a{page_size, block_size, options};
+      EXPECT_EQ(page_size, a.stats().resident);
+
+      // whole memory is usable
+      const auto blocks = a.allocate(2 * page_size);
+      EXPECT_EQ(2 * page_size / block_size, blocks.size());
+
+      for (const auto block : blocks) {
+        block[0] = 'a';
+        block[block_size - 1] = 'z';
+      }
+
+      a.free(blocks);
+    }
+  }
+}
+
+TEST(In_memory_allocator, thread_cache) {
+  constexpr std::size_t block_size = 8192;
+  constexpr std::size_t page_size = 64 * block_size;
+  constexpr std::size_t threads = 8;
+  constexpr std::size_t iterations = 10000;
+
+  Allocator a{page_size, block_size};
+
+  {
+    // blocks released by the current thread are reused
+    const auto block = a.allocate_block();
+    a.free(block);
+    EXPECT_EQ(block, a.allocate_block());
+    a.free(block);
+  }
+
+  {
+    // blocks are allocated and released by different threads
+    shcore::Synchronized_queue<char *> queue;
+    std::vector<std::thread> workers;
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([&, i]() {
+        for (std::size_t j = 0; j < iterations; ++j) {
+          if (i % 2) {
+            auto block = queue.pop();
+            EXPECT_NE(nullptr, block);
+            a.free(block);
+          } else {
+            auto block = a.allocate_block();
+            ASSERT_NE(nullptr, block);
+            block[0] = 'x';
+            queue.push(block);
+          }
+        }
+      });
+    }
+
+    for (auto &w : workers) {
+      w.join();
+    }
+  }
+
+  // setting a limit returns all the cached blocks, whole memory is available
+  const auto resident = a.stats().resident;
+  a.set_memory_limit(resident);
+
+  const auto blocks = a.try_allocate(resident);
+  EXPECT_EQ(resident / block_size, blocks.size());
+  EXPECT_EQ(resident, a.stats().resident);
+
+  a.free(blocks);
+}
+
+TEST(In_memory_allocator, thread_cache_lifetime) {
+  constexpr std::size_t block_size = 8192;
+  constexpr std::size_t page_size = 64 * block_size;
+
+  {
+    Allocator a{page_size, block_size};
+
+    std::thread worker{[&a]() {
+      std::vector<char *> blocks;
+
+      for (std::size_t i = 0; i < 10; ++i) {
+        blocks.emplace_back(a.allocate_block());
+      }
+
+      for (const auto block : blocks) {
+        a.free(block);
+      }
+    }};
+    worker.join();
+
+    // blocks cached by a thread are returned when it finishes, whole page is
+    // available
+    const auto blocks = a.allocate(page_size);
+    EXPECT_EQ(page_size / block_size, blocks.size());
+    EXPECT_EQ(page_size, a.stats().resident);
+
+    a.free(blocks);
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    // allocator is destroyed before the thread which has used it, next
+    // allocator may get the same address, but not the same cache
+    Allocator a{page_size, block_size};
+    const auto block = a.allocate_block();
+    block[0] = 'x';
+    a.free(block);
+  }
+}
+
 }  // namespace in_memory
 }  // namespace storage
 }  // namespace mysqlshdk
@@ -23,6 +23,7 @@
 
 #include "mysqlshdk/libs/storage/backend/in_memory/virtual_fs.h"
 
+#include <chrono>
 #include <random>
 #include <stdexcept>
 #include <string>
@@ -37,7 +38,9 @@
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "mysqlshdk/libs/storage/backend/in_memory/synchronized_file.h"
@@ -403,6 +406,116 @@ TEST(Virtual_fs, file_write) {
   EXPECT_EQ("affghijklmnomnfghijklmno", read_contents(file));
 }
 
+TEST(Virtual_fs, file_spill) {
+  const auto spill_dir =
+      shcore::path::join_path(getenv("TMPDIR"), "virtual_fs_spill");
+  shcore::create_directory(spill_dir);
+  shcore::on_leave_scope cleanup([&spill_dir]() {
+    shcore::remove_directory(spill_dir);
+  });
+
+  Virtual_fs fs{20, 10};
+  fs.set_memory_limit(20);
+  fs.set_spill_directory(spill_dir);
+
+  constexpr auto buffer = "abcdefghijklmnopqrstuvwxyz";
+  constexpr auto buffer_length = std::char_traits<char>::length(buffer);
+  const auto dir = fs.create_directory("dir");
+
+  const auto read_contents = [](Virtual_fs::IFile *f, std::size_t chunk) {
+    std::string result;
+    result.resize(f->size());
+    std::size_t offset = 0;
+
+    f->open(true);
+
+    while (const auto r = f->read(result.data() + offset,
+                                  std::min(chunk, result.length() - offset))) {
+      offset += r;
+    }
+
+    f->close();
+
+    return result;
+  };
+
+  for (std::size_t i = 1; i <= buffer_length; ++i) {
+    SCOPED_TRACE("chunk size: " + std::to_string(i));
+
+    const auto name = "file" + std::to_string(i);
+    auto file = dir->create_file(name);
+
+    // memory limit is 20 bytes, the rest of the data goes to the spill file
+    file->open(false);
+
+    for (std::size_t l = 0; l < buffer_length; l += i) {
+      file->write(buffer + l, std::min(i, buffer_length - l));
+    }
+
+    EXPECT_EQ(buffer_length, file->size());
+
+    // overwrite data held in memory and in the spill file
+    file->seek(18);
+    file->write("TUVW", 4);
+    file->seek(buffer_length);
+    file->close();
+
+    EXPECT_EQ(1, shcore::listdir(spill_dir).size());
+    EXPECT_EQ("abcdefghijklmnopqrTUVWwxyz", read_contents(file, i));
+
+    dir->remove_file(name);
+    EXPECT_EQ(0, shcore::listdir(spill_dir).size());
+  }
+
+  EXPECT_LT(0, fs.spilled_bytes());
+  EXPECT_EQ(20, fs.memory_stats().peak_resident);
+}
+
+TEST(Virtual_fs, file_memory_stall_timeout) {
+  Virtual_fs fs{20, 10};
+  fs.set_memory_limit(20);
+  fs.set_memory_stall_timeout(std::chrono::milliseconds{100});
+
+  constexpr auto buffer = "abcdefghijklmnopqrstuvwxyz";
+  constexpr auto buffer_length = std::char_traits<char>::length(buffer);
+  const auto dir = fs.create_directory("dir");
+
+  {
+    // memory limit is 20 bytes, there's no spill directory and memory is not
+    // released, write fails
+    auto file = dir->create_file("file1");
+    file->open(false);
+
+    EXPECT_THROW_MSG(file->write(buffer, buffer_length), std::runtime_error,
+                     "Unable to write to file: file1, Memory limit has been "
+                     "reached and no memory was released while waiting");
+
+    file->close();
+    dir->remove_file("file1");
+  }
+
+  {
+    // memory is released while the second file waits, write succeeds
+    auto first = dir->create_file("first");
+    first->open(false);
+    EXPECT_EQ(20, first->write(buffer, 20));
+    first->close();
+
+    auto second = dir->create_file("second");
+    second->open(false);
+
+    std::thread remover{[&dir]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{50});
+      dir->remove_file("first");
+    }};
+
+    EXPECT_EQ(20, second->write(buffer, 20));
+
+    remover.join();
+    second->close();
+  }
+}
+
 TEST(Virtual_fs, file_read) {
   Virtual_fs fs{1024, 10};
   constexpr auto data = "abcdefghijklmnopqrstuvwxyz";
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include "mysqlshdk/shellcore/credential_cache.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+using namespace std::chrono_literals;
+
+TEST(Credential_cache_test, put_and_get) {
+  Credential_cache cache{1h};
+  std::string credential;
+
+  EXPECT_TRUE(cache.enabled());
+  EXPECT_FALSE(cache.get("user@host", &credential));
+
+  cache.put("user@host", "pass");
+  cache.put("user@host:3306", "");
+  cache.put("root@localhost", std::string(1000, 'x'));
+
+  EXPECT_TRUE(cache.get("user@host", &credential));
+  EXPECT_EQ("pass", credential);
+
+  EXPECT_TRUE(cache.get("user@host:3306", &credential));
+  EXPECT_EQ("", credential);
+
+  EXPECT_TRUE(cache.get("root@localhost", &credential));
+  EXPECT_EQ(std::string(1000, 'x'), credential);
+
+  // replace
+  cache.put("user@host", "new pass");
+  EXPECT_TRUE(cache.get("user@host", &credential));
+  EXPECT_EQ("new pass", credential);
+
+  cache.remove("user@host");
+  EXPECT_FALSE(cache.get("user@host", &credential));
+  EXPECT_TRUE(cache.get("user@host:3306", &credential));
+
+  cache.clear();
+  EXPECT_FALSE(cache.get("user@host:3306", &credential));
+  EXPECT_FALSE(cache.get("root@localhost", &credential));
+}
+
+TEST(Credential_cache_test, ttl) {
+  Credential_cache cache{200ms};
+  std::string credential;
+
+  cache.put("user@host", "pass");
+  EXPECT_TRUE(cache.get("user@host", &credential));
+  EXPECT_EQ("pass", credential);
+
+  std::this_thread::sleep_for(300ms);
+
+  EXPECT_FALSE(cache.get("user@host", &credential));
+
+  // changing TTL removes all entries
+  cache.put("user@host", "pass");
+  cache.set_ttl(1h);
+  EXPECT_EQ(std::chrono::steady_clock::duration{1h}, cache.ttl());
+  EXPECT_FALSE(cache.get("user@host", &credential));
+}
+
+TEST(Credential_cache_test, disabled) {
+  Credential_cache cache{0s};
+  std::string credential;
+
+  EXPECT_FALSE(cache.enabled());
+
+  cache.put("user@host", "pass");
+  EXPECT_FALSE(cache.get("user@host", &credential));
+
+  cache.set_ttl(1h);
+  EXPECT_TRUE(cache.enabled());
+
+  cache.put("user@host", "pass");
+  EXPECT_TRUE(cache.get("user@host", &credential));
+
+  cache.set_ttl(0s);
+  EXPECT_FALSE(cache.enabled());
+  EXPECT_FALSE(cache.get("user@host", &credential));
+}
+
+}  // namespace shcore
@@ -22,7 +22,17 @@
  */
 
 #include <gtest_clean.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_options.h"
 #include "mysqlshdk/include/shellcore/shell_resultset_dumper.h"
+#include "mysqlshdk/libs/utils/array_result.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 using Print_flags = mysqlsh::Print_flags;
 using Print_flag = mysqlsh::Print_flag;
@@ -67,3 +77,158 @@ TEST(Resultset_dumper, get_data_sizes) {
   // Multibyte character 3 bytes represented in 2 spaces
   TEST_DATA_SIZES("I 爱 MySQL Shell\0", 17, Print_flags(), 16, 17);
 }
+
+namespace {
+
+class Null_printer : public mysqlsh::Resultset_printer {
+ public:
+  void print(const std::string &) override {}
+  void println(const std::string &) override {}
+  void raw_print(const std::string &) override {}
+};
+
+class Json_streaming_dumper : public mysqlsh::Resultset_dumper_base {
+ public:
+  explicit Json_streaming_dumper(mysqlshdk::db::IResult *target)
+      : Resultset_dumper_base(target, std::make_unique<Null_printer>(),
+                              "json/raw", "json/raw") {}
+
+  std::vector<std::string> json() {
+    std::vector<std::string> chunks;
+    EXPECT_EQ(m_rows, format_json("row", false, false,
+                                  [&chunks](const std::string &s) {
+                                    chunks.emplace_back(s);
+                                  }));
+    return chunks;
+  }
+
+  std::vector<std::string> ndjson() {
+    std::vector<std::string> chunks;
+    EXPECT_EQ(m_rows, format_ndjson("row", false,
+                                    [&chunks](const std::string &s) {
+                                      chunks.emplace_back(s);
+                                    }));
+    return chunks;
+  }
+
+  size_t m_rows = 0;
+};
+
+class Recording_printer : public mysqlsh::Resultset_printer {
+ public:
+  explicit Recording_printer(std::vector<std::string> *prints)
+      : m_prints(prints) {}
+
+  void print(const std::string &s) override { m_prints->emplace_back(s); }
+  void println(const std::string &s) override { print(s + "\n"); }
+  void raw_print(const std::string &s) override { print(s); }
+
+ private:
+  std::vector<std::string> *m_prints;
+};
+
+class Gui_json_dumper : public mysqlsh::Gui_resultset_dumper {
+ public:
+  Gui_json_dumper(mysqlshdk::db::IResult *target,
+                  std::vector<std::string> *prints)
+      : Gui_resultset_dumper(target, "json/raw") {
+    m_printer = std::make_unique<Recording_printer>(prints);
+  }
+
+  using Gui_resultset_dumper::dump_json;
+};
+
+shcore::Array_t make_result(size_t rows) {
+  auto table = shcore::make_array();
+  auto columns = shcore::make_array();
+  columns->emplace_back("id");
+  columns->emplace_back("data");
+  table->emplace_back(std::move(columns));
+
+  for (size_t i = 0; i < rows; ++i) {
+    auto row = shcore::make_array();
+    row->emplace_back(std::to_string(i));
+    row->emplace_back(std::string(100, 'x'));
+    table->emplace_back(std::move(row));
+  }
+
+  return table;
+}
+
+}  // namespace
+
+TEST(Resultset_dumper, format_json_streaming) {
+  mysqlsh::Scoped_shell_options options{
+      std::make_shared<mysqlsh::Shell_options>(0, nullptr)};
+  constexpr size_t k_rows = 5000;
+  shcore::Array_as_result result{make_result(k_rows)};
+  Json_streaming_dumper dumper{&result};
+  dumper.m_rows = k_rows;
+
+  const auto chunks = dumper.json();
+
+  // output is flushed multiple times, no chunk holds the whole result
+  ASSERT_LT(1, chunks.size());
+
+  std::string json;
+  for (const auto &chunk : chunks) {
+    EXPECT_GT(128 * 1024, chunk.size());
+    json += chunk;
+  }
+
+  const auto doc = shcore::Value::parse(json).as_map();
+  EXPECT_TRUE(doc->get_bool("hasData"));
+  EXPECT_EQ(k_rows, doc->get_array("rows")->size());
+  EXPECT_EQ("0", doc->get_array("rows")->at(0).as_map()->get_string("id"));
+  EXPECT_EQ(0u, doc->get_uint("warningsCount"));
+}
+
+TEST(Resultset_dumper, format_ndjson_streaming) {
+  mysqlsh::Scoped_shell_options options{
+      std::make_shared<mysqlsh::Shell_options>(0, nullptr)};
+  constexpr size_t k_rows = 5000;
+  shcore::Array_as_result result{make_result(k_rows)};
+  Json_streaming_dumper dumper{&result};
+  dumper.m_rows = k_rows;
+
+  const auto chunks = dumper.ndjson();
+
+  ASSERT_LT(1, chunks.size());
+
+  std::string ndjson;
+  for (const auto &chunk : chunks) {
+    ndjson += chunk;
+  }
+
+  const auto lines = shcore::str_split(ndjson, "\n");
+  // one line per row, followed by the summary
+  ASSERT_EQ(k_rows + 1, lines.size());
+
+  for (size_t i = 0; i < k_rows; ++i) {
+    EXPECT_EQ(std::to_string(i),
+              shcore::Value::parse(lines[i]).as_map()->get_string("id"));
+  }
+
+  const auto summary = shcore::Value::parse(lines.back()).as_map();
+  EXPECT_TRUE(summary->get_bool("hasData"));
+  EXPECT_EQ(k_rows, summary->get_uint("rowCount"));
+}
+
+TEST(Resultset_dumper, gui_json_is_printed_at_once) {
+  mysqlsh::Scoped_shell_options options{
+      std::make_shared<mysqlsh::Shell_options>(0, nullptr)};
+  constexpr size_t k_rows = 5000;
+  shcore::Array_as_result result{make_result(k_rows)};
+  std::vector<std::string> prints;
+  Gui_json_dumper dumper{&result, &prints};
+
+  EXPECT_EQ(k_rows, dumper.dump_json("row", false));
+
+  // each print is a separate message in the GUI, the document cannot be split
+  // even if it's bigger than the size of the flushed chunks
+  ASSERT_EQ(2u, prints.size());
+  EXPECT_EQ("\n", prints[1]);
+
+  const auto doc = shcore::Value::parse(prints[0]).as_map();
+  EXPECT_EQ(k_rows, doc->get_array("rows")->size());
+}
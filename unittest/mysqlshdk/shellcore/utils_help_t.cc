@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is also distributed with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms, as
+ * designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have included with MySQL.
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/include/shellcore/utils_help.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Help_registry_test, lazy_help_concurrent_first_lookup) {
+  constexpr std::size_t k_entries = 2000;
+  constexpr std::size_t k_threads = 8;
+
+  // lazy help needs to have static storage duration
+  static std::vector<std::string> s_tokens;
+  static std::vector<std::string> s_data;
+
+  const auto base = s_tokens.size();
+
+  for (std::size_t i = 0; i < k_entries; ++i) {
+    s_tokens.emplace_back("TEST_LAZY_HELP_CONCURRENT_" +
+                          std::to_string(base + i));
+    s_data.emplace_back("lazy help text " + std::to_string(base + i));
+  }
+
+  // vectors are not modified once pointers to their strings are stored
+  for (std::size_t i = base; i < s_tokens.size(); ++i) {
+    Help_registry::Lazy_help help;
+    help.type = Help_registry::Lazy_help::Type::TEXT;
+    help.token = s_tokens[i].c_str();
+    help.data = s_data[i].c_str();
+
+    Help_registry::add_lazy_help(help);
+  }
+
+  std::atomic<bool> start = false;
+  std::atomic<std::size_t> missing = 0;
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < k_threads; ++t) {
+    threads.emplace_back([&start, &missing]() {
+      while (!start) {
+        std::this_thread::yield();
+      }
+
+      // the last entry is registered last, all threads need to see it, even
+      // if another thread is still registering the pending entries
+      if (s_data.back() != Help_registry::get()->get_token(s_tokens.back())) {
+        ++missing;
+      }
+    });
+  }
+
+  start = true;
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(0, missing);
+
+  for (std::size_t i = base; i < s_tokens.size(); ++i) {
+    EXPECT_EQ(s_data[i], Help_registry::get()->get_token(s_tokens[i]));
+  }
+}
+
+TEST(Help_registry_test, registration_does_not_load_lazy_help) {
+  static const std::string s_token = "TEST_LAZY_HELP_NOT_LOADED";
+  static const std::string s_data = "lazy help text";
+
+  Help_registry::Lazy_help help;
+  help.type = Help_registry::Lazy_help::Type::TEXT;
+  help.token = s_token.c_str();
+  help.data = s_data.c_str();
+
+  Help_registry::add_lazy_help(help);
+  ASSERT_TRUE(Help_registry::has_lazy_help());
+
+  // help registered at startup by the topics and the dynamic text is queued
+  // after the lazy help
+  const auto registry = Help_registry::get();
+  registry->add_help_class("TestLazyHelpClass", "", "",
+                           IShell_core::all_scripting_modes(), {});
+  registry->add_help("TEST_LAZY_HELP_DYNAMIC", "dynamic " + s_data);
+  registry->add_help(s_token, "overridden " + s_data);
+
+  EXPECT_TRUE(Help_registry::has_lazy_help());
+
+  // everything is registered on the first lookup, in the original order
+  EXPECT_EQ("Provides help about this class and it's members",
+            registry->get_token("TESTLAZYHELPCLASS.HELP_BRIEF"));
+  EXPECT_FALSE(Help_registry::has_lazy_help());
+
+  EXPECT_EQ("dynamic " + s_data,
+            registry->get_token("TEST_LAZY_HELP_DYNAMIC"));
+  EXPECT_EQ("overridden " + s_data, registry->get_token(s_token));
+
+  // once lazy help is loaded, help is registered right away
+  registry->add_help("TEST_LAZY_HELP_DYNAMIC", s_data);
+  EXPECT_FALSE(Help_registry::has_lazy_help());
+  EXPECT_EQ(s_data, registry->get_token("TEST_LAZY_HELP_DYNAMIC"));
+}
+
+}  // namespace shcore
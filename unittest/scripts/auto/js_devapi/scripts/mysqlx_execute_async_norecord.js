@@ -0,0 +1,104 @@
+//@<> Setup
+shell.connect(__uripwd);
+var schema = session.createSchema('execute_async');
+var collection = schema.createCollection('coll');
+session.sql('CREATE TABLE execute_async.tbl (id INT PRIMARY KEY, name TEXT)').execute();
+var table = schema.getTable('tbl');
+
+//@<> results are received in order
+var pending = [];
+
+for (var i = 0; i < 10; ++i) {
+  pending.push(collection.add({_id: `${i}`, value: i}).executeAsync());
+}
+
+pending.push(collection.modify('value < 5').set('small', true).executeAsync());
+pending.push(collection.remove('value > 7').executeAsync());
+pending.push(table.insert('id', 'name').values(1, 'one').values(2, 'two').executeAsync());
+pending.push(table.update().set('name', 'three').where('id = :id').bind('id', 2).executeAsync());
+pending.push(table.delete().where('id = 1').executeAsync());
+pending.push(session.sql('SELECT COUNT(*) FROM execute_async.tbl WHERE id > ?').bind(0).executeAsync());
+
+EXPECT_FALSE(pending[pending.length - 1].isReady());
+
+var last = pending[pending.length - 1].getResult();
+EXPECT_EQ(1, last.fetchOne()[0]);
+
+for (var i = 0; i < 10; ++i) {
+  EXPECT_TRUE(pending[i].isReady());
+  EXPECT_EQ(1, pending[i].getResult().affectedItemsCount);
+}
+
+EXPECT_EQ(5, pending[10].getResult().affectedItemsCount);
+EXPECT_EQ(2, pending[11].getResult().affectedItemsCount);
+EXPECT_EQ(2, pending[12].getResult().affectedItemsCount);
+EXPECT_EQ(1, pending[13].getResult().affectedItemsCount);
+EXPECT_EQ(1, pending[14].getResult().affectedItemsCount);
+
+// result is retrieved only once
+EXPECT_TRUE(pending[0].getResult() === pending[0].getResult());
+
+EXPECT_EQ(8, collection.count());
+EXPECT_EQ(5, collection.find('small = true').execute().fetchAll().length);
+
+//@<> synchronous operation receives the pending results
+var p1 = collection.add({_id: '100'}).executeAsync();
+var p2 = collection.add({_id: '101'}).executeAsync();
+EXPECT_FALSE(p1.isReady());
+EXPECT_FALSE(p2.isReady());
+
+EXPECT_EQ(10, collection.count());
+EXPECT_TRUE(p1.isReady());
+EXPECT_TRUE(p2.isReady());
+EXPECT_EQ(1, p2.getResult().affectedItemsCount);
+
+//@<> pipeline stops at the first failure
+var ok = collection.add({_id: '200'}).executeAsync();
+var failed = collection.add({_id: '200'}).executeAsync();
+var skipped = collection.add({_id: '201'}).executeAsync();
+
+EXPECT_THROWS(function() { skipped.getResult(); }, "Expectation failed: no_error");
+EXPECT_THROWS(function() { failed.getResult(); }, "Document contains a field value that is not unique but required to be");
+EXPECT_EQ(1, ok.getResult().affectedItemsCount);
+
+EXPECT_EQ(1, collection.find("_id = '200'").execute().fetchAll().length);
+EXPECT_EQ(0, collection.find("_id = '201'").execute().fetchAll().length);
+
+// next pipeline is not affected
+EXPECT_EQ(1, collection.add({_id: '201'}).executeAsync().getResult().affectedItemsCount);
+
+//@<> maximum number of operations awaiting their results
+shell.options['devapi.pipelineDepth'] = 2;
+
+var p1 = collection.add({_id: '300'}).executeAsync();
+var p2 = collection.add({_id: '301'}).executeAsync();
+EXPECT_FALSE(p1.isReady());
+
+var p3 = collection.add({_id: '302'}).executeAsync();
+EXPECT_TRUE(p1.isReady());
+EXPECT_FALSE(p2.isReady());
+EXPECT_FALSE(p3.isReady());
+
+EXPECT_EQ(1, p3.getResult().affectedItemsCount);
+EXPECT_TRUE(p2.isReady());
+
+shell.options['devapi.pipelineDepth'] = 64;
+
+//@<> invalid pipeline depth
+EXPECT_THROWS(function() { shell.options['devapi.pipelineDepth'] = 0; }, "value out of range");
+
+//@<> empty operation is not sent to the server
+var empty = collection.add([]).executeAsync();
+EXPECT_TRUE(empty.isReady());
+EXPECT_EQ(-1, empty.getResult().affectedItemsCount);
+
+//@<> pending results are received when session is closed
+var p1 = collection.add({_id: '400'}).executeAsync();
+session.close();
+EXPECT_TRUE(p1.isReady());
+EXPECT_EQ(1, p1.getResult().affectedItemsCount);
+
+//@<> Cleanup
+shell.connect(__uripwd);
+session.dropSchema('execute_async');
+session.close();
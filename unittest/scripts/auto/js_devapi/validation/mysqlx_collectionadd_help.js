@@ -18,6 +18,9 @@ FUNCTIONS
             Executes the add operation, the documents are added to the target
             collection.
 
+      executeAsync()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
@@ -19,6 +19,9 @@ FUNCTIONS
             Executes the document deletion with the configured filter and
             limit.
 
+      executeAsync()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
@@ -51,6 +51,8 @@ CLASSES
  - DatabaseObject   Provides base functionality for database objects.
  - DocResult        Allows traversing the DbDoc objects returned by a
                     Collection.find operation.
+ - PendingResult    Handle to the result of an operation executed using
+                    executeAsync().
  - Result           Allows retrieving information about non query operations
                     performed on the database.
  - RowResult        Allows traversing the Row objects returned by a
@@ -18,6 +18,9 @@ FUNCTIONS
       execute()
             Executes the sql statement.
 
+      executeAsync()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
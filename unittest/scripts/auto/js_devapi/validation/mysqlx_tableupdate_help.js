@@ -16,6 +16,9 @@ FUNCTIONS
       execute()
             Executes the update operation with all the configured options.
 
+      executeAsync()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
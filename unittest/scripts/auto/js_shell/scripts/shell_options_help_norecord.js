@@ -13,6 +13,9 @@
 //@ devapi.dbObjectHandles option help text
 \option --help devapi.dbObjectHandles
 
+//@ devapi.pipelineDepth option help text
+\option -h devapi.pipelineDepth
+
 //@ history.autoSave option help text
 \option -h history.autoSave
 
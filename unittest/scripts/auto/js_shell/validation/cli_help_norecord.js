@@ -69,6 +69,12 @@ The following operations are available at 'util':
       Performs series of tests on specified MySQL server to check if the
       upgrade process will succeed.
 
+   compare-schemas
+      Compares data of schemas in the source and the target instance.
+
+   compare-tables
+      Compares data of tables in the source and the target instance.
+
    copy-instance
       Copies a source instance to the target instance. Requires an open global
       Shell session to the source instance, if there is none, an exception is
@@ -416,6 +422,26 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--maxMetadataMemory=<str>
+            Limit the memory used to hold the metadata and DDL files which were
+            written by the source side, but were not yet read by the target
+            side. Table data is streamed directly to the target server and is
+            not subject to this limit. Memory is reserved in 32M pages. When
+            the limit is reached, writing waits until memory is released,
+            unless metadataSpillDir is set. Use maxMetadataMemory="0" to set no
+            limit. Default: "0".
+
+--metadataSpillDir=<str>
+            Local directory used to temporarily hold the metadata and DDL files
+            which do not fit in maxMetadataMemory. Requires maxMetadataMemory
+            to be set. Default: not set.
+
+--metadataWaitTimeout=<float>
+            Time in seconds writing of a metadata or DDL file waits for memory
+            to be released when maxMetadataMemory is reached. If no memory is
+            released during that time, the copy fails. Use
+            metadataWaitTimeout=0 to wait indefinitely. Default: 300.
+
 //@<OUT> CLI util copy-schemas --help
 NAME
       copy-schemas - Copies schemas from the source instance to the target
@@ -596,6 +622,26 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--maxMetadataMemory=<str>
+            Limit the memory used to hold the metadata and DDL files which were
+            written by the source side, but were not yet read by the target
+            side. Table data is streamed directly to the target server and is
+            not subject to this limit. Memory is reserved in 32M pages. When
+            the limit is reached, writing waits until memory is released,
+            unless metadataSpillDir is set. Use maxMetadataMemory="0" to set no
+            limit. Default: "0".
+
+--metadataSpillDir=<str>
+            Local directory used to temporarily hold the metadata and DDL files
+            which do not fit in maxMetadataMemory. Requires maxMetadataMemory
+            to be set. Default: not set.
+
+--metadataWaitTimeout=<float>
+            Time in seconds writing of a metadata or DDL file waits for memory
+            to be released when maxMetadataMemory is reached. If no memory is
+            released during that time, the copy fails. Use
+            metadataWaitTimeout=0 to wait indefinitely. Default: 300.
+
 //@<OUT> CLI util copy-tables --help
 NAME
       copy-tables - Copies tables and views from schema in the source instance
@@ -751,6 +797,26 @@ OPTIONS
             continues, "ignore": ignores the error and continues copying the
             account.
 
+--maxMetadataMemory=<str>
+            Limit the memory used to hold the metadata and DDL files which were
+            written by the source side, but were not yet read by the target
+            side. Table data is streamed directly to the target server and is
+            not subject to this limit. Memory is reserved in 32M pages. When
+            the limit is reached, writing waits until memory is released,
+            unless metadataSpillDir is set. Use maxMetadataMemory="0" to set no
+            limit. Default: "0".
+
+--metadataSpillDir=<str>
+            Local directory used to temporarily hold the metadata and DDL files
+            which do not fit in maxMetadataMemory. Requires maxMetadataMemory
+            to be set. Default: not set.
+
+--metadataWaitTimeout=<float>
+            Time in seconds writing of a metadata or DDL file waits for memory
+            to be released when maxMetadataMemory is reached. If no memory is
+            released during that time, the copy fails. Use
+            metadataWaitTimeout=0 to wait indefinitely. Default: 300.
+
 //@<OUT> CLI util dump-instance --help
 NAME
       dump-instance - Dumps the whole database to files in the output
@@ -819,6 +885,13 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--metadataCache=<str>
+            Path to a local file used to cache metadata of the dumped tables
+            between runs. If the file exists, metadata of tables whose
+            CREATE_TIME and UPDATE_TIME did not change since the file was
+            written is read from it, instead of being fetched from the server.
+            Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -986,6 +1059,16 @@ OPTIONS
             accounts with the given user name are included. By default, all
             users are included. Default: not set.
 
+--incrementalBase=<str>
+            URL of a dump created by util.dumpInstance(), which is used as a
+            base of an incremental dump. Only the tables which were modified
+            since the base dump was created are dumped, objects which were
+            removed are recorded, so that they are dropped when the dump is
+            loaded. The base dump has to be loaded using the updateGtidSet
+            option, its GTID set is used to verify that it was loaded before
+            the incremental dump. Cannot be used with the ddlOnly or dataOnly
+            options. Default: not set.
+
 //@<OUT> CLI util dump-schemas --help
 NAME
       dump-schemas - Dumps the specified schemas to the files in the output
@@ -1057,6 +1140,13 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--metadataCache=<str>
+            Path to a local file used to cache metadata of the dumped tables
+            between runs. If the file exists, metadata of tables whose
+            CREATE_TIME and UPDATE_TIME did not change since the file was
+            written is read from it, instead of being fetched from the server.
+            Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -1276,6 +1366,13 @@ OPTIONS
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
+--metadataCache=<str>
+            Path to a local file used to cache metadata of the dumped tables
+            between runs. If the file exists, metadata of tables whose
+            CREATE_TIME and UPDATE_TIME did not change since the file was
+            written is read from it, instead of being fetched from the server.
+            Default: not set.
+
 --triggers=<bool>
             Include triggers for each dumped table. Default: true.
 
@@ -1763,6 +1860,16 @@ OPTIONS
 --threads=<uint>
             Number of threads to use to import table data. Default: 4.
 
+--adaptiveThreads=<bool>
+            If enabled, the number of threads which load the data concurrently
+            is adjusted while the load is running, based on the metrics
+            periodically sampled from the target server: number of running
+            threads, InnoDB history list length and checkpoint age, Group
+            Replication applier queue and replication lag. The number of active
+            threads is reduced when the target server is under pressure, and
+            increased again once it recovers, up to the value of the threads
+            option. All decisions are written to the log file. Default: false.
+
 --backgroundThreads=<uint>
             Number of additional threads to use to fetch contents of metadata
             and DDL files. If not set, loader will use the value of the threads
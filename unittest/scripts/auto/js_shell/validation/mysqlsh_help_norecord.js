@@ -127,8 +127,11 @@ Usage: mysqlsh [OPTIONS] [URI]
   --pym <module>                   Run Python library module as a script.
                                    Remaining args are forwarded to it.
   --json[=<format>]                Produce output in JSON format. Allowed
-                                   values: raw, pretty, and off. If no format
-                                   is specified pretty format is produced.
+                                   values: raw, pretty, ndjson and off. If no
+                                   format is specified pretty format is
+                                   produced. The ndjson format is the same as
+                                   raw, but rows of the results are printed as
+                                   separate documents, one per line.
   --table                          Produce output in table format (default for
                                    interactive mode). This option can be used
                                    to force that format when running in batch
@@ -218,6 +221,8 @@ Usage: mysqlsh [OPTIONS] [URI]
   --nw, --no-wizard                Disables wizard mode.
   --no-password                    Sets empty password and disables prompt for
                                    password.
+  --startup-profile                Prints the time spent in each of the startup
+                                   phases.
   -V, --version                    Prints the version of MySQL Shell.
   --ssl-key=<file_name>            The path to the SSL private key file in PEM
                                    format.
@@ -119,12 +119,18 @@ DESCRIPTION
         execution of an SQL script in batch mode shall continue if errors occur
       - connectTimeout: float, default connection timeout used by Shell
         sessions, in seconds
+      - credentialStore.cacheTtl: integer, number of seconds for which the
+        passwords fetched from or stored by the credential helper are cached in
+        memory, 0 disables the cache
       - credentialStore.excludeFilters: array of URLs for which automatic
         password storage is disabled, supports glob characters '*' and '?'
       - credentialStore.helper: name of the credential helper to use to
         fetch/store passwords; a special value "default" is supported to use
         platform default helper; a special value "<disabled>" is supported to
         disable the credential store
+      - credentialStore.persistentHelper: bool, starts the credential helper
+        once and uses it to execute all operations, instead of starting it for
+        each operation
       - credentialStore.savePasswords: controls automatic password storage,
         allowed values: "always", "prompt" or "never"
       - dba.connectTimeout: float, default connection timeout used for sessions
@@ -146,6 +152,8 @@ DESCRIPTION
         "js", "py", "sql" or "none"
       - devapi.dbObjectHandles: true to enable schema collection and table name
         aliases in the db object, for DevAPI operations.
+      - devapi.pipelineDepth: maximum number of DevAPI operations executed using
+        executeAsync() which can await their results.
       - history.autoSave: true to save command history when exiting the shell
       - history.maxSize: number of entries to keep in command history
       - history.sql.ignorePattern: colon separated list of glob patterns to
@@ -196,8 +204,13 @@ DESCRIPTION
       - ssh.configFile string path default empty, custom path for SSH
         configuration. If not defined the standard SSH paths will be used
         (~/.ssh/config).
-      - ssh.bufferSize integer default 10240 bytes, used for tunnel data
+      - ssh.bufferSize integer default 65536 bytes, used for tunnel data
         transfer
+      - ssh.tunnelThreads integer default 1, maximum number of threads, each
+        using a separate SSH connection, which transfer data of a single SSH
+        tunnel. Values greater than 1 open additional SSH connections to the
+        server. The number of threads is also limited by the number of CPU
+        cores.
 
       The resultFormat option supports the following values to modify the
       format of printed query results:
@@ -17,6 +17,10 @@
  devapi.dbObjectHandles  Enable table and collection name handles for the
                          DevAPI db object.
 
+//@<OUT> devapi.pipelineDepth option help text
+ devapi.pipelineDepth  Maximum number of DevAPI operations executed using
+                       executeAsync() which can await their results.
+
 //@<OUT> history.autoSave option help text
  history.autoSave  Shell's history autosave.
 
@@ -300,84 +300,92 @@
 |5|
 
 //@<OUT> List all the options using \option
- autocomplete.nameCache          true
- batchContinueOnError            false
- connectTimeout                  10
- credentialStore.excludeFilters  []
- credentialStore.helper          default
- credentialStore.savePasswords   prompt
- dba.connectTimeout              5
- dba.connectivityChecks          true
- dba.gtidWaitTimeout             60
- dba.logSql                      0
- dba.restartWaitTimeout          60
- defaultCompress                 false
- defaultMode                     none
- devapi.dbObjectHandles          true
- history.autoSave                false
- history.maxSize                 1000
- history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
- history.sql.syslog              false
- interactive                     true
- logFile                         <<<testutil.getShellLogPath()>>>
- logLevel                        5
- logSql                          error
- logSql.ignorePattern            *SELECT*:SHOW*
- logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD*
- mysqlPluginDir                  [[*]]plugins
- oci.configFile                  <<<_defaultOciConfigFile>>>
- oci.profile                     DEFAULT
- outputFormat                    table
- pager                           ""
- passwordsFromStdin              false
- resultFormat                    table
- sandboxDir                      <<<_defaultSandboxDir>>>
- showColumnTypeInfo              false
- showWarnings                    true
- ssh.bufferSize                  10240
- ssh.configFile                  ""
- useWizards                      true
- verbose                         0
+ autocomplete.nameCache            true
+ batchContinueOnError              false
+ connectTimeout                    10
+ credentialStore.cacheTtl          60
+ credentialStore.excludeFilters    []
+ credentialStore.helper            default
+ credentialStore.persistentHelper  false
+ credentialStore.savePasswords     prompt
+ dba.connectTimeout                5
+ dba.connectivityChecks            true
+ dba.gtidWaitTimeout               60
+ dba.logSql                        0
+ dba.restartWaitTimeout            60
+ defaultCompress                   false
+ defaultMode                       none
+ devapi.dbObjectHandles            true
+ devapi.pipelineDepth              64
+ history.autoSave                  false
+ history.maxSize                   1000
+ history.sql.ignorePattern         *IDENTIFIED*:*PASSWORD*
+ history.sql.syslog                false
+ interactive                       true
+ logFile                           <<<testutil.getShellLogPath()>>>
+ logLevel                          5
+ logSql                            error
+ logSql.ignorePattern              *SELECT*:SHOW*
+ logSql.ignorePatternUnsafe        *IDENTIFIED*:*PASSWORD*
+ mysqlPluginDir                    [[*]]plugins
+ oci.configFile                    <<<_defaultOciConfigFile>>>
+ oci.profile                       DEFAULT
+ outputFormat                      table
+ pager                             ""
+ passwordsFromStdin                false
+ resultFormat                      table
+ sandboxDir                        <<<_defaultSandboxDir>>>
+ showColumnTypeInfo                false
+ showWarnings                      true
+ ssh.bufferSize                    65536
+ ssh.configFile                    ""
+ ssh.tunnelThreads                 1
+ useWizards                        true
+ verbose                           0
 
 //@<OUT> List all the options using \option and show-origin
- autocomplete.nameCache          true (Compiled default)
- batchContinueOnError            false (Compiled default)
- connectTimeout                  10 (Compiled default)
- credentialStore.excludeFilters  [] (Compiled default)
- credentialStore.helper          default (Compiled default)
- credentialStore.savePasswords   prompt (Compiled default)
- dba.connectTimeout              5 (Compiled default)
- dba.connectivityChecks          true (Compiled default)
- dba.gtidWaitTimeout             60 (Compiled default)
- dba.logSql                      0 (Compiled default)
- dba.restartWaitTimeout          60 (Compiled default)
- defaultCompress                 false (Compiled default)
- defaultMode                     none (Compiled default)
- devapi.dbObjectHandles          true (Compiled default)
- history.autoSave                false (Compiled default)
- history.maxSize                 1000 (Compiled default)
- history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
- history.sql.syslog              false (Compiled default)
- interactive                     true (Compiled default)
- logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
- logLevel                        5 (Compiled default)
- logSql                          error (Compiled default)
- logSql.ignorePattern            *SELECT*:SHOW* (Compiled default)
- logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD* (Compiled default)
- mysqlPluginDir                  [[*]]plugins (Compiled default)
- oci.configFile                  <<<_defaultOciConfigFile>>> (Compiled default)
- oci.profile                     DEFAULT (Compiled default)
- outputFormat                    table (Compiled default)
- pager                           "" (Compiled default)
- passwordsFromStdin              false (Compiled default)
- resultFormat                    table (Compiled default)
- sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
- showColumnTypeInfo              false (Compiled default)
- showWarnings                    true (Compiled default)
- ssh.bufferSize                  10240 (Compiled default)
- ssh.configFile                  "" (Compiled default)
- useWizards                      true (Compiled default)
- verbose                         0 (Compiled default)
+ autocomplete.nameCache            true (Compiled default)
+ batchContinueOnError              false (Compiled default)
+ connectTimeout                    10 (Compiled default)
+ credentialStore.cacheTtl          60 (Compiled default)
+ credentialStore.excludeFilters    [] (Compiled default)
+ credentialStore.helper            default (Compiled default)
+ credentialStore.persistentHelper  false (Compiled default)
+ credentialStore.savePasswords     prompt (Compiled default)
+ dba.connectTimeout                5 (Compiled default)
+ dba.connectivityChecks            true (Compiled default)
+ dba.gtidWaitTimeout               60 (Compiled default)
+ dba.logSql                        0 (Compiled default)
+ dba.restartWaitTimeout            60 (Compiled default)
+ defaultCompress                   false (Compiled default)
+ defaultMode                       none (Compiled default)
+ devapi.dbObjectHandles            true (Compiled default)
+ devapi.pipelineDepth              64 (Compiled default)
+ history.autoSave                  false (Compiled default)
+ history.maxSize                   1000 (Compiled default)
+ history.sql.ignorePattern         *IDENTIFIED*:*PASSWORD* (Compiled default)
+ history.sql.syslog                false (Compiled default)
+ interactive                       true (Compiled default)
+ logFile                           <<<testutil.getShellLogPath()>>> (Compiled default)
+ logLevel                          5 (Compiled default)
+ logSql                            error (Compiled default)
+ logSql.ignorePattern              *SELECT*:SHOW* (Compiled default)
+ logSql.ignorePatternUnsafe        *IDENTIFIED*:*PASSWORD* (Compiled default)
+ mysqlPluginDir                    [[*]]plugins (Compiled default)
+ oci.configFile                    <<<_defaultOciConfigFile>>> (Compiled default)
+ oci.profile                       DEFAULT (Compiled default)
+ outputFormat                      table (Compiled default)
+ pager                             "" (Compiled default)
+ passwordsFromStdin                false (Compiled default)
+ resultFormat                      table (Compiled default)
+ sandboxDir                        <<<_defaultSandboxDir>>> (Compiled default)
+ showColumnTypeInfo                false (Compiled default)
+ showWarnings                      true (Compiled default)
+ ssh.bufferSize                    65536 (Compiled default)
+ ssh.configFile                    "" (Compiled default)
+ ssh.tunnelThreads                 1 (Compiled default)
+ useWizards                        true (Compiled default)
+ verbose                           0 (Compiled default)
 
 //@ List an option which origin is Compiled default
 |(Compiled default)|
@@ -461,85 +469,93 @@
 |5|
 
 //@<OUT> List all the options using \option for SQL mode
- autocomplete.nameCache          true
- batchContinueOnError            false
- connectTimeout                  10
- credentialStore.excludeFilters  []
- credentialStore.helper          default
- credentialStore.savePasswords   prompt
- dba.connectTimeout              5
- dba.connectivityChecks          true
- dba.gtidWaitTimeout             60
- dba.logSql                      0
- dba.restartWaitTimeout          60
- defaultCompress                 false
- defaultMode                     none
- devapi.dbObjectHandles          true
- history.autoSave                false
- history.maxSize                 1000
- history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
- history.sql.syslog              false
- interactive                     true
- logFile                         <<<testutil.getShellLogPath()>>>
- logLevel                        5
- logSql                          error
- logSql.ignorePattern            *SELECT*:SHOW*
- logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD*
- mysqlPluginDir                  [[*]]plugins
- oci.configFile                  <<<_defaultOciConfigFile>>>
- oci.profile                     DEFAULT
- outputFormat                    table
- pager                           ""
- passwordsFromStdin              false
- resultFormat                    table
- sandboxDir                      <<<_defaultSandboxDir>>>
- showColumnTypeInfo              false
- showWarnings                    true
- ssh.bufferSize                  10240
- ssh.configFile                  ""
- useWizards                      true
- verbose                         0
+ autocomplete.nameCache            true
+ batchContinueOnError              false
+ connectTimeout                    10
+ credentialStore.cacheTtl          60
+ credentialStore.excludeFilters    []
+ credentialStore.helper            default
+ credentialStore.persistentHelper  false
+ credentialStore.savePasswords     prompt
+ dba.connectTimeout                5
+ dba.connectivityChecks            true
+ dba.gtidWaitTimeout               60
+ dba.logSql                        0
+ dba.restartWaitTimeout            60
+ defaultCompress                   false
+ defaultMode                       none
+ devapi.dbObjectHandles            true
+ devapi.pipelineDepth              64
+ history.autoSave                  false
+ history.maxSize                   1000
+ history.sql.ignorePattern         *IDENTIFIED*:*PASSWORD*
+ history.sql.syslog                false
+ interactive                       true
+ logFile                           <<<testutil.getShellLogPath()>>>
+ logLevel                          5
+ logSql                            error
+ logSql.ignorePattern              *SELECT*:SHOW*
+ logSql.ignorePatternUnsafe        *IDENTIFIED*:*PASSWORD*
+ mysqlPluginDir                    [[*]]plugins
+ oci.configFile                    <<<_defaultOciConfigFile>>>
+ oci.profile                       DEFAULT
+ outputFormat                      table
+ pager                             ""
+ passwordsFromStdin                false
+ resultFormat                      table
+ sandboxDir                        <<<_defaultSandboxDir>>>
+ showColumnTypeInfo                false
+ showWarnings                      true
+ ssh.bufferSize                    65536
+ ssh.configFile                    ""
+ ssh.tunnelThreads                 1
+ useWizards                        true
+ verbose                           0
 
 //@<OUT> List all the options using \option and show-origin for SQL mode
 Switching to SQL mode... Commands end with ;
- autocomplete.nameCache          true (Compiled default)
- batchContinueOnError            false (Compiled default)
- connectTimeout                  10 (Compiled default)
- credentialStore.excludeFilters  [] (Compiled default)
- credentialStore.helper          default (Compiled default)
- credentialStore.savePasswords   prompt (Compiled default)
- dba.connectTimeout              5 (Compiled default)
- dba.connectivityChecks          true (Compiled default)
- dba.gtidWaitTimeout             60 (Compiled default)
- dba.logSql                      0 (Compiled default)
- dba.restartWaitTimeout          60 (Compiled default)
- defaultCompress                 false (Compiled default)
- defaultMode                     none (Compiled default)
- devapi.dbObjectHandles          true (Compiled default)
- history.autoSave                false (Compiled default)
- history.maxSize                 1000 (Compiled default)
- history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
- history.sql.syslog              false (Compiled default)
- interactive                     true (Compiled default)
- logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
- logLevel                        5 (Compiled default)
- logSql                          error (Compiled default)
- logSql.ignorePattern            *SELECT*:SHOW* (Compiled default)
- logSql.ignorePatternUnsafe      *IDENTIFIED*:*PASSWORD* (Compiled default)
- mysqlPluginDir                  [[*]]plugins (Compiled default)
- oci.configFile                  <<<_defaultOciConfigFile>>> (Compiled default)
- oci.profile                     DEFAULT (Compiled default)
- outputFormat                    table (Compiled default)
- pager                           "" (Compiled default)
- passwordsFromStdin              false (Compiled default)
- resultFormat                    table (Compiled default)
- sandboxDir                      <<<_defaultSandboxDir>>> (Compiled default)
- showColumnTypeInfo              false (Compiled default)
- showWarnings                    true (Compiled default)
- ssh.bufferSize                  10240 (Compiled default)
- ssh.configFile                  "" (Compiled default)
- useWizards                      true (Compiled default)
- verbose                         0 (Compiled default)
+ autocomplete.nameCache            true (Compiled default)
+ batchContinueOnError              false (Compiled default)
+ connectTimeout                    10 (Compiled default)
+ credentialStore.cacheTtl          60 (Compiled default)
+ credentialStore.excludeFilters    [] (Compiled default)
+ credentialStore.helper            default (Compiled default)
+ credentialStore.persistentHelper  false (Compiled default)
+ credentialStore.savePasswords     prompt (Compiled default)
+ dba.connectTimeout                5 (Compiled default)
+ dba.connectivityChecks            true (Compiled default)
+ dba.gtidWaitTimeout               60 (Compiled default)
+ dba.logSql                        0 (Compiled default)
+ dba.restartWaitTimeout            60 (Compiled default)
+ defaultCompress                   false (Compiled default)
+ defaultMode                       none (Compiled default)
+ devapi.dbObjectHandles            true (Compiled default)
+ devapi.pipelineDepth              64 (Compiled default)
+ history.autoSave                  false (Compiled default)
+ history.maxSize                   1000 (Compiled default)
+ history.sql.ignorePattern         *IDENTIFIED*:*PASSWORD* (Compiled default)
+ history.sql.syslog                false (Compiled default)
+ interactive                       true (Compiled default)
+ logFile                           <<<testutil.getShellLogPath()>>> (Compiled default)
+ logLevel                          5 (Compiled default)
+ logSql                            error (Compiled default)
+ logSql.ignorePattern              *SELECT*:SHOW* (Compiled default)
+ logSql.ignorePatternUnsafe        *IDENTIFIED*:*PASSWORD* (Compiled default)
+ mysqlPluginDir                    [[*]]plugins (Compiled default)
+ oci.configFile                    <<<_defaultOciConfigFile>>> (Compiled default)
+ oci.profile                       DEFAULT (Compiled default)
+ outputFormat                      table (Compiled default)
+ pager                             "" (Compiled default)
+ passwordsFromStdin                false (Compiled default)
+ resultFormat                      table (Compiled default)
+ sandboxDir                        <<<_defaultSandboxDir>>> (Compiled default)
+ showColumnTypeInfo                false (Compiled default)
+ showWarnings                      true (Compiled default)
+ ssh.bufferSize                    65536 (Compiled default)
+ ssh.configFile                    "" (Compiled default)
+ ssh.tunnelThreads                 1 (Compiled default)
+ useWizards                        true (Compiled default)
+ verbose                           0 (Compiled default)
 
 //@<OUT> Verify options persistence WL#14246 TSFR_10_5
 /path/config
@@ -16,6 +16,12 @@ FUNCTIONS
             Performs series of tests on specified MySQL server to check if the
             upgrade process will succeed.
 
+      compareSchemas(schemas, connectionData[, options])
+            Compares data of schemas in the source and the target instance.
+
+      compareTables(schema, tables, connectionData[, options])
+            Compares data of tables in the source and the target instance.
+
       copyInstance(connectionData[, options])
             Copies a source instance to the target instance. Requires an open
             global Shell session to the source instance, if there is none, an
@@ -274,6 +280,20 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMetadataMemory: string (default: "0") - Limit the memory used to
+        hold the metadata and DDL files which were written by the source side,
+        but were not yet read by the target side. Table data is streamed
+        directly to the target server and is not subject to this limit. Memory
+        is reserved in 32M pages. When the limit is reached, writing waits
+        until memory is released, unless metadataSpillDir is set. Use
+        maxMetadataMemory="0" to set no limit.
+      - metadataSpillDir: string (default: not set) - Local directory used to
+        temporarily hold the metadata and DDL files which do not fit in
+        maxMetadataMemory. Requires maxMetadataMemory to be set.
+      - metadataWaitTimeout: float (default: 300) - Time in seconds writing of
+        a metadata or DDL file waits for memory to be released when
+        maxMetadataMemory is reached. If no memory is released during that
+        time, the copy fails. Use metadataWaitTimeout=0 to wait indefinitely.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -397,6 +417,20 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMetadataMemory: string (default: "0") - Limit the memory used to
+        hold the metadata and DDL files which were written by the source side,
+        but were not yet read by the target side. Table data is streamed
+        directly to the target server and is not subject to this limit. Memory
+        is reserved in 32M pages. When the limit is reached, writing waits
+        until memory is released, unless metadataSpillDir is set. Use
+        maxMetadataMemory="0" to set no limit.
+      - metadataSpillDir: string (default: not set) - Local directory used to
+        temporarily hold the metadata and DDL files which do not fit in
+        maxMetadataMemory. Requires maxMetadataMemory to be set.
+      - metadataWaitTimeout: float (default: 300) - Time in seconds writing of
+        a metadata or DDL file waits for memory to be released when
+        maxMetadataMemory is reached. If no memory is released during that
+        time, the copy fails. Use metadataWaitTimeout=0 to wait indefinitely.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -509,6 +543,20 @@ DESCRIPTION
       - maxRate: string (default: "0") - Limit data read throughput to maximum
         rate, measured in bytes per second per thread. Use maxRate="0" to set
         no limit.
+      - maxMetadataMemory: string (default: "0") - Limit the memory used to
+        hold the metadata and DDL files which were written by the source side,
+        but were not yet read by the target side. Table data is streamed
+        directly to the target server and is not subject to this limit. Memory
+        is reserved in 32M pages. When the limit is reached, writing waits
+        until memory is released, unless metadataSpillDir is set. Use
+        maxMetadataMemory="0" to set no limit.
+      - metadataSpillDir: string (default: not set) - Local directory used to
+        temporarily hold the metadata and DDL files which do not fit in
+        maxMetadataMemory. Requires maxMetadataMemory to be set.
+      - metadataWaitTimeout: float (default: 300) - Time in seconds writing of
+        a metadata or DDL file waits for memory to be released when
+        maxMetadataMemory is reached. If no memory is released during that
+        time, the copy fails. Use metadataWaitTimeout=0 to wait indefinitely.
       - showProgress: bool (default: true if stdout is a TTY device, false
         otherwise) - Enable or disable copy progress information.
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
@@ -622,6 +670,14 @@ DESCRIPTION
         specified users. Each user is in the format of 'user_name'[@'host']. If
         the host is not specified, all the accounts with the given user name
         are included. By default, all users are included.
+      - incrementalBase: string (default: not set) - URL of a dump created by
+        util.dumpInstance(), which is used as a base of an incremental dump.
+        Only the tables which were modified since the base dump was created are
+        dumped, objects which were removed are recorded, so that they are
+        dropped when the dump is loaded. The base dump has to be loaded using
+        the updateGtidSet option, its GTID set is used to verify that it was
+        loaded before the incremental dump. Cannot be used with the ddlOnly or
+        dataOnly options.
       - triggers: bool (default: true) - Include triggers for each dumped
         table.
       - excludeTriggers: list of strings (default: empty) - List of triggers to
@@ -656,6 +712,11 @@ DESCRIPTION
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache metadata of the dumped tables between runs. If the file exists,
+        metadata of tables whose CREATE_TIME and UPDATE_TIME did not change
+        since the file was written is read from it, instead of being fetched
+        from the server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1293,6 +1354,11 @@ DESCRIPTION
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache metadata of the dumped tables between runs. If the file exists,
+        metadata of tables whose CREATE_TIME and UPDATE_TIME did not change
+        since the file was written is read from it, instead of being fetched
+        from the server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -1907,6 +1973,11 @@ DESCRIPTION
         of bytes to be written to each chunk file, enables chunking.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
+      - metadataCache: string (default: not set) - Path to a local file used to
+        cache metadata of the dumped tables between runs. If the file exists,
+        metadata of tables whose CREATE_TIME and UPDATE_TIME did not change
+        since the file was written is read from it, instead of being fetched
+        from the server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
         meaning as the corresponding clause for SELECT ... INTO OUTFILE.
       - fieldsEnclosedBy: char (default: '') - This option has the same meaning
@@ -3288,6 +3359,18 @@ DESCRIPTION
       LOAD DATA LOCAL INFILE is used to load table data and thus, the
       'local_infile' MySQL global setting must be enabled.
 
+      Incremental dumps
+
+      An incremental dump, created by util.dumpInstance() with the
+      'incrementalBase' option, has to be loaded into an instance which already
+      contains its base dump. If the base dump contains a GTID set,
+      gtid_executed of the destination instance has to include it, which means
+      that the base dump has to be loaded using the 'updateGtidSet' option.
+      Objects which were removed since the base dump was created are dropped,
+      tables which were modified are recreated and their data is loaded again,
+      remaining tables are left intact. Objects which already exist in the
+      destination database are not reported as duplicates.
+
       Resuming
 
       The load command will store progress information into a file for each
@@ -3321,6 +3404,14 @@ DESCRIPTION
 
       Options dictionary:
 
+      - adaptiveThreads: bool (default: false) - If enabled, the number of
+        threads which load the data concurrently is adjusted while the load is
+        running, based on the metrics periodically sampled from the target
+        server: number of running threads, InnoDB history list length and
+        checkpoint age, Group Replication applier queue and replication lag. The
+        number of active threads is reduced when the target server is under
+        pressure, and increased again once it recovers, up to the value of the
+        threads option. All decisions are written to the log file.
       - analyzeTables: "off", "on", "histogram" (default: off) - If 'on',
         executes ANALYZE TABLE for all tables, once loaded. If set to
         'histogram', only tables that have histogram information stored in the
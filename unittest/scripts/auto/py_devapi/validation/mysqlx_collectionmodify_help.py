@@ -34,6 +34,9 @@ FUNCTIONS
             Executes the update operations added to the handler with the
             configured filter and limit.
 
+      execute_async()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
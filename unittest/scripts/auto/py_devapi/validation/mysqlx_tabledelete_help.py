@@ -19,6 +19,9 @@ FUNCTIONS
       execute()
             Executes the delete operation with all the configured options.
 
+      execute_async()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
@@ -13,6 +13,9 @@ FUNCTIONS
       execute()
             Executes the insert operation.
 
+      execute_async()
+            Sends the operation to the server without waiting for its result.
+
       help([member])
             Provides help about this class and it's members
 
@@ -0,0 +1,105 @@
+#@<> INCLUDE dump_utils.inc
+#@<> INCLUDE copy_utils.inc
+
+#@<> entry point
+test_schema = "sakila"
+test_tables = [ "actor", "address", "film_text" ]
+
+def compare(options = {}, tables = test_tables):
+    WIPE_OUTPUT()
+    util.compare_tables(test_schema, tables, __sandbox_uri2, { "showProgress": False, **options })
+
+#@<> Setup
+setup_copy_tests(4)
+util.copy_tables(test_schema, test_tables, __sandbox_uri2, { "showProgress": False })
+
+#@<> invalid number of arguments
+EXPECT_THROWS(lambda: util.compare_tables(), "ValueError: Util.compare_tables: Invalid number of arguments, expected 3 to 4 but got 0")
+
+#@<> options which are not supported
+for option in [ "compression", "ddlOnly", "dataOnly", "dryRun", "ocimds", "triggers" ]:
+    EXPECT_THROWS(lambda: compare({ option: True }), f"Argument #4: Invalid options: {option}")
+
+#@<> the same instance
+EXPECT_THROWS(lambda: util.compare_tables(test_schema, test_tables, __sandbox_uri1), "The target instance is the same as the source instance")
+
+#@<> identical data
+EXPECT_NO_THROWS(lambda: compare(), "compare")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 0")
+EXPECT_STDOUT_NOT_CONTAINS("checksums differ")
+
+#@<> identical data, multiple chunks
+EXPECT_NO_THROWS(lambda: compare({ "bytesPerChunk": "128k", "threads": 2 }), "compare")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 0")
+
+#@<> different data
+tgt_session.run_sql("UPDATE sakila.actor SET first_name = 'CHANGED' WHERE actor_id = 10")
+tgt_session.run_sql("DELETE FROM sakila.address WHERE address_id = 20")
+tgt_session.run_sql("INSERT INTO sakila.film_text VALUES (5000, 'ADDED', NULL)")
+
+EXPECT_THROWS(lambda: compare(), "Data of the source and the target instance differs.")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 3")
+EXPECT_STDOUT_CONTAINS("checksums differ, rows on source: 200, rows on target: 200")
+EXPECT_STDOUT_CONTAINS("checksums differ, rows on source: 603, rows on target: 602")
+EXPECT_STDOUT_CONTAINS("checksums differ, rows on source: 1000, rows on target: 1001")
+EXPECT_STDOUT_CONTAINS(": row `actor_id`='10' differs, columns: `first_name`")
+EXPECT_STDOUT_CONTAINS(": row `address_id`='20' is missing on target")
+EXPECT_STDOUT_CONTAINS(": row `film_id`='5000' exists only on target")
+
+#@<> different data, only checksums
+EXPECT_THROWS(lambda: compare({ "maxRowDifferences": 0 }), "Data of the source and the target instance differs.")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 3")
+EXPECT_STDOUT_NOT_CONTAINS("differs, columns")
+
+#@<> where option
+EXPECT_NO_THROWS(lambda: compare({ "where": { "sakila.actor": "actor_id > 10" } }, [ "actor" ]), "compare")
+
+#@<> rows are sorted in the same way regardless of collation and NULL values - setup
+ordering_schema = "compare_ordering"
+ordering_tables = [ "ci_key", "nullable_key" ]
+
+src_session.run_sql("DROP SCHEMA IF EXISTS !", [ordering_schema])
+src_session.run_sql("CREATE SCHEMA !", [ordering_schema])
+# case-insensitive collation sorts 'a' before 'B', byte order is the opposite
+src_session.run_sql("CREATE TABLE !.ci_key (k VARCHAR(10) COLLATE utf8mb4_general_ci PRIMARY KEY, v VARCHAR(10))", [ordering_schema])
+src_session.run_sql("INSERT INTO !.ci_key VALUES ('a', 'one'), ('B', 'two'), ('c', 'three')", [ordering_schema])
+# table without a non-nullable unique key, whole row is the key
+src_session.run_sql("CREATE TABLE !.nullable_key (k INT NULL, v VARCHAR(10), UNIQUE KEY (k))", [ordering_schema])
+src_session.run_sql("INSERT INTO !.nullable_key VALUES (NULL, 'x'), (1, 'y'), (2, 'z')", [ordering_schema])
+
+util.copy_schemas([ ordering_schema ], __sandbox_uri2, { "showProgress": False })
+
+def compare_ordering(options = {}):
+    WIPE_OUTPUT()
+    util.compare_tables(ordering_schema, ordering_tables, __sandbox_uri2, { "showProgress": False, **options })
+
+#@<> rows are sorted in the same way regardless of collation and NULL values - identical data
+EXPECT_NO_THROWS(lambda: compare_ordering(), "compare")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 0")
+
+#@<> rows are sorted in the same way regardless of collation and NULL values - different data
+tgt_session.run_sql("DELETE FROM !.ci_key WHERE k = 'a'", [ordering_schema])
+tgt_session.run_sql("DELETE FROM !.nullable_key WHERE k IS NULL", [ordering_schema])
+
+EXPECT_THROWS(lambda: compare_ordering(), "Data of the source and the target instance differs.")
+EXPECT_STDOUT_CONTAINS("Chunks with differences: 2")
+EXPECT_STDOUT_CONTAINS(": row `k`='a' is missing on target")
+EXPECT_STDOUT_CONTAINS(": row `k`=NULL, `v`='x' is missing on target")
+EXPECT_STDOUT_NOT_CONTAINS("exists only on target")
+EXPECT_STDOUT_NOT_CONTAINS("differs, columns")
+
+#@<> different definitions of columns are reported, values are compared
+tgt_session.run_sql("ALTER TABLE !.ci_key MODIFY v VARCHAR(20) COLLATE utf8mb4_bin", [ordering_schema])
+tgt_session.run_sql("UPDATE !.ci_key SET v = 'changed' WHERE k = 'c'", [ordering_schema])
+
+EXPECT_THROWS(lambda: compare_ordering(), "Data of the source and the target instance differs.")
+EXPECT_STDOUT_CONTAINS("Table `compare_ordering`.`ci_key`: definitions of columns differ (i.e. type, length or collation): `v`, their values are compared byte by byte")
+EXPECT_STDOUT_CONTAINS(": row `k`='c' differs, columns: `v`")
+EXPECT_STDOUT_NOT_CONTAINS("Compared results have different fields")
+
+#@<> rows are sorted in the same way regardless of collation and NULL values - cleanup
+src_session.run_sql("DROP SCHEMA IF EXISTS !", [ordering_schema])
+tgt_session.run_sql("DROP SCHEMA IF EXISTS !", [ordering_schema])
+
+#@<> Cleanup
+cleanup_copy_tests()
@@ -259,6 +259,25 @@ EXPECT_SUCCESS(__sandbox_uri2, { "maxRate": "" })
 TEST_STRING_OPTION("maxRate")
 EXPECT_FAIL("ValueError", f'Argument #{options_arg_no}: Wrong input number "2Mhz"', __sandbox_uri2, { "maxRate": "2Mhz" })
 
+#@<> maxMetadataMemory option
+EXPECT_SUCCESS(__sandbox_uri2, { "maxMetadataMemory": "32M" })
+EXPECT_SUCCESS(__sandbox_uri2, { "maxMetadataMemory": "" })
+TEST_STRING_OPTION("maxMetadataMemory")
+EXPECT_FAIL("ValueError", f'Argument #{options_arg_no}: Wrong input number "2Mhz"', __sandbox_uri2, { "maxMetadataMemory": "2Mhz" })
+
+#@<> metadataSpillDir option
+EXPECT_SUCCESS(__sandbox_uri2, { "maxMetadataMemory": "32M", "metadataSpillDir": __tmp_dir })
+EXPECT_STDOUT_CONTAINS("Peak memory usage: ")
+TEST_STRING_OPTION("metadataSpillDir")
+EXPECT_FAIL("ValueError", f"Argument #{options_arg_no}: The option 'metadataSpillDir' cannot be used if the 'maxMetadataMemory' option is not set.", __sandbox_uri2, { "metadataSpillDir": __tmp_dir })
+EXPECT_FAIL("ValueError", f"Argument #{options_arg_no}: The option 'metadataSpillDir' must be set to an existing directory, got: {os.path.join(__tmp_dir, 'missing')}", __sandbox_uri2, { "maxMetadataMemory": "32M", "metadataSpillDir": os.path.join(__tmp_dir, "missing") })
+
+#@<> metadataWaitTimeout option
+EXPECT_SUCCESS(__sandbox_uri2, { "maxMetadataMemory": "32M", "metadataWaitTimeout": 0 })
+EXPECT_SUCCESS(__sandbox_uri2, { "maxMetadataMemory": "32M", "metadataWaitTimeout": 0.5 })
+EXPECT_FAIL("TypeError", f"Argument #{options_arg_no}: Option 'metadataWaitTimeout' Float expected, but value is String", "mysql://user@host:3306", { "metadataWaitTimeout": "dummy" })
+EXPECT_FAIL("ValueError", f"Argument #{options_arg_no}: The option 'metadataWaitTimeout' cannot be set to a negative value.", __sandbox_uri2, { "metadataWaitTimeout": -1 })
+
 #@<> WL15298_TSFR_4_4_54
 EXPECT_SUCCESS(__sandbox_uri2, { "showProgress": True })
 # if progress is shown, progress information (like the one below) is not captured from stdout
@@ -549,12 +568,15 @@ for param in [
         "compression",
         "ocimds",
         "targetVersion",
+        "adaptiveThreads",
         "backgroundThreads",
         "characterSet",
         "createInvisiblePKs",
+        "incrementalBase",
         "loadData",
         "loadDdl",
         "loadUsers",
+        "metadataCache",
         "progressFile",
         "resetProgress",
         "showMetadata",
@@ -685,5 +707,21 @@ src_session.run_sql(f"DROP USER {account_name}")
 src_session.run_sql(f"DROP ROLE {role_name}")
 testutil.dbug_set("")
 
+#@<> binary data is copied without encoding
+binary_schema = "copy_binary_data"
+all_bytes = "".join(f"{i:02x}" for i in range(256))
+
+src_session.run_sql("DROP SCHEMA IF EXISTS !", [binary_schema])
+src_session.run_sql("CREATE SCHEMA !", [binary_schema])
+src_session.run_sql("CREATE TABLE !.t (id INT PRIMARY KEY, b BLOB, vb VARBINARY(300), bt BIT(48), g GEOMETRY)", [binary_schema])
+src_session.run_sql("INSERT INTO !.t VALUES (1, UNHEX(?), UNHEX(?), 0x5c0a090d001a, ST_GeomFromText('POINT(1 1)')), (2, '', NULL, b'0', NULL)", [binary_schema, all_bytes, all_bytes[::-1]])
+
+EXPECT_SUCCESS(__sandbox_uri2, { "includeSchemas": [ binary_schema ], "users": False })
+
+checksum = "SELECT HEX(b), HEX(vb), HEX(bt), ST_AsText(g) FROM !.t ORDER BY id"
+EXPECT_EQ([list(r) for r in src_session.run_sql(checksum, [binary_schema]).fetch_all()], [list(r) for r in tgt_session.run_sql(checksum, [binary_schema]).fetch_all()])
+
+src_session.run_sql("DROP SCHEMA IF EXISTS !", [binary_schema])
+
 #@<> Cleanup
 cleanup_copy_tests()
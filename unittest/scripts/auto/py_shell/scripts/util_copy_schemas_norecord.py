@@ -520,12 +520,14 @@ for param in [
         "ocimds",
         "targetVersion",
         "users",
+        "adaptiveThreads",
         "backgroundThreads",
         "characterSet",
         "createInvisiblePKs",
         "loadData",
         "loadDdl",
         "loadUsers",
+        "metadataCache",
         "progressFile",
         "resetProgress",
         "showMetadata",
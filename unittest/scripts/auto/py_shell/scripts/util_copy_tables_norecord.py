@@ -455,12 +455,14 @@ for param in [
         "targetVersion",
         "routines",
         "users",
+        "adaptiveThreads",
         "backgroundThreads",
         "characterSet",
         "createInvisiblePKs",
         "loadData",
         "loadDdl",
         "loadUsers",
+        "metadataCache",
         "progressFile",
         "resetProgress",
         "showMetadata",
@@ -2791,6 +2791,61 @@ else:
 # cleanup
 testutil.dbug_set("")
 
+#@<> view DDL is executed concurrently, views with missing dependencies are retried {(not __dbug_off)}
+# setup
+tested_schema = "test_schema"
+dump_dir = os.path.join(outdir, "concurrent_views")
+
+shell.connect(__sandbox_uri1)
+session.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session.run_sql("CREATE SCHEMA !", [tested_schema])
+session.run_sql("CREATE TABLE !.t (id INT PRIMARY KEY, data VARCHAR(32))", [tested_schema])
+session.run_sql("INSERT INTO !.t VALUES (1, 'one'), (2, 'two'), (3, 'three')", [tested_schema])
+
+# views use a character set which is different from the one used by the loader
+session.run_sql("SET NAMES 'latin1'")
+
+for i in range(10):
+    session.run_sql(f"CREATE VIEW !.! AS SELECT * FROM !.t WHERE id > {i}", [tested_schema, f"independent_{i}", tested_schema])
+
+session.run_sql("CREATE VIEW !.chain_0 AS SELECT * FROM !.t", [tested_schema, tested_schema])
+
+for i in range(1, 5):
+    session.run_sql("CREATE VIEW !.! AS SELECT * FROM !.!", [tested_schema, f"chain_{i}", tested_schema, f"chain_{i - 1}"])
+
+session.run_sql("SET NAMES 'utf8mb4'")
+
+util.dump_schemas([ tested_schema ], dump_dir, { "showProgress": False })
+
+# connect to the destination server
+shell.connect(__sandbox_uri2)
+wipeout_server(session)
+
+# CREATE VIEW fails once as if its dependency did not exist
+testutil.set_trap("mysql", ["sql regex VIEW `chain_2` AS"], { "code": 1146, "msg": "Table 'test_schema.chain_1' doesn't exist", "state": "42S02", "onetime": True })
+
+WIPE_OUTPUT()
+EXPECT_NO_THROWS(lambda: util.load_dump(dump_dir, { "threads": 4, "loadUsers": False, "showProgress": False }), "load should succeed")
+EXPECT_STDOUT_NOT_CONTAINS("ERROR")
+# deferred view and views which depend on it are executed sequentially
+EXPECT_SHELL_LOG_CONTAINS("`chain_2` will be retried")
+EXPECT_SHELL_LOG_CONTAINS("Executing DDL of 3 views sequentially")
+
+testutil.clear_traps("mysql")
+
+# verify correctness
+compare_servers(session1, session2, check_users=False)
+
+views_charset_sql = "SELECT TABLE_NAME, CHARACTER_SET_CLIENT, COLLATION_CONNECTION FROM information_schema.views WHERE TABLE_SCHEMA = ? ORDER BY TABLE_NAME"
+EXPECT_EQ(str(session1.run_sql(views_charset_sql, [tested_schema]).fetch_all()), str(session2.run_sql(views_charset_sql, [tested_schema]).fetch_all()))
+
+for i in range(5):
+    EXPECT_EQ(3, session2.run_sql("SELECT COUNT(*) FROM !.!", [tested_schema, f"chain_{i}"]).fetch_one()[0])
+
+# cleanup
+session1.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+session2.run_sql("DROP SCHEMA IF EXISTS !", [tested_schema])
+
 #@<> Cleanup
 testutil.destroy_sandbox(__mysql_sandbox_port1)
 testutil.destroy_sandbox(__mysql_sandbox_port2)
@@ -680,6 +680,13 @@ EXPECT_TRUE(has_file_with_basename(test_output_absolute, encode_table_basename(t
 # this dump used smaller chunk size, number of files should be greater
 EXPECT_TRUE(count_files_with_basename(test_output_absolute, encode_table_basename(test_schema, test_table_primary) + "@") > number_of_dump_files)
 
+# distribution of the chunk sizes is stored in the metadata
+with open(os.path.join(test_output_absolute, "@.done.json"), encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+    chunks = metadata["tableChunkBytes"][test_schema][test_table_primary]
+    EXPECT_EQ(len([f for f in metadata["chunkFileBytes"] if f.startswith(encode_table_basename(test_schema, test_table_primary) + "@")]), chunks["count"])
+    EXPECT_TRUE(chunks["min"] <= chunks["median"] <= chunks["max"])
+
 #@<> WL13807-FR4.13.2 - The value of the `bytesPerChunk` option must use the same format as specified in WL#12193.
 EXPECT_FAIL("ValueError", 'Argument #2: Wrong input number "xyz"', test_output_absolute, { "bytesPerChunk": "xyz" })
 EXPECT_FAIL("ValueError", 'Argument #2: Wrong input number "1xyz"', test_output_absolute, { "bytesPerChunk": "1xyz" })
@@ -3787,6 +3794,96 @@ EXPECT_STDOUT_NOT_CONTAINS(account_for_grant())
 #@<> BUG#35680824 - cleanup
 session.run_sql(f"DROP USER IF EXISTS {test_account}")
 
+#@<> incremental dump - setup
+incremental_schema = "incremental_dump"
+incremental_base_output = os.path.join(__tmp_dir, "incremental_base")
+
+session.run_sql("DROP SCHEMA IF EXISTS !", [incremental_schema])
+session.run_sql("CREATE SCHEMA !", [incremental_schema])
+
+for table in [ "unchanged", "modified", "altered", "removed" ]:
+    session.run_sql("CREATE TABLE !.! (id INT PRIMARY KEY)", [incremental_schema, table])
+    session.run_sql("INSERT INTO !.! VALUES (1), (2), (3)", [incremental_schema, table])
+
+session.run_sql("CREATE VIEW !.removed_view AS SELECT * FROM !.removed", [incremental_schema, incremental_schema])
+
+# modification times have a resolution of one second
+time.sleep(1)
+
+shutil.rmtree(incremental_base_output, True)
+util.dump_instance(incremental_base_output, { "includeSchemas": [ incremental_schema ], "users": False, "showProgress": False })
+
+#@<> incremental dump - option type
+TEST_STRING_OPTION("incrementalBase")
+
+#@<> incremental dump - conflicting options
+EXPECT_FAIL("ValueError", "Argument #2: The 'incrementalBase' option cannot be used if the 'ddlOnly' or the 'dataOnly' option is set to true.", test_output_relative, { "incrementalBase": incremental_base_output, "ddlOnly": True })
+EXPECT_FAIL("ValueError", "Argument #2: The 'incrementalBase' option cannot be used if the 'ddlOnly' or the 'dataOnly' option is set to true.", test_output_relative, { "incrementalBase": incremental_base_output, "dataOnly": True })
+
+#@<> incremental dump - invalid base
+EXPECT_FAIL("Error: Shell Error (52040)", re.compile(r"While 'Initializing': Cannot use '.*' as a base of an incremental dump: directory does not exist."), test_output_relative, { "incrementalBase": os.path.join(__tmp_dir, "missing_incremental_base"), "showProgress": False })
+
+#@<> incremental dump - modify the instance
+session.run_sql("INSERT INTO !.modified VALUES (4)", [incremental_schema])
+# in-place ALTER TABLE does not modify UPDATE_TIME
+session.run_sql("ALTER TABLE !.altered ADD COLUMN c INT, ALGORITHM=INPLACE", [incremental_schema])
+session.run_sql("DROP VIEW !.removed_view", [incremental_schema])
+session.run_sql("DROP TABLE !.removed", [incremental_schema])
+session.run_sql("CREATE TABLE !.added (id INT PRIMARY KEY)", [incremental_schema])
+session.run_sql("INSERT INTO !.added VALUES (1)", [incremental_schema])
+
+#@<> incremental dump - dump
+EXPECT_SUCCESS([ incremental_schema ], test_output_absolute, { "incrementalBase": incremental_base_output, "users": False, "showProgress": False })
+EXPECT_STDOUT_CONTAINS("1 out of 4 tables were not modified since the base dump was created, their data is not going to be dumped.")
+
+with open(os.path.join(test_output_absolute, "@.json"), encoding="utf-8") as json_file:
+    dropped = json.load(json_file)["incremental"]["dropped"]
+
+EXPECT_EQ({ incremental_schema: [ "removed" ] }, dropped["tables"])
+EXPECT_EQ({ incremental_schema: [ "removed_view" ] }, dropped["views"])
+
+with open(os.path.join(test_output_absolute, encode_table_basename(incremental_schema, "unchanged") + ".json"), encoding="utf-8") as json_file:
+    EXPECT_FALSE(json.load(json_file)["includesData"])
+
+with open(os.path.join(test_output_absolute, encode_table_basename(incremental_schema, "altered") + ".json"), encoding="utf-8") as json_file:
+    EXPECT_TRUE(json.load(json_file)["includesData"])
+
+#@<> incremental dump - base was not loaded
+metadata_file = os.path.join(test_output_absolute, "@.json")
+
+with open(metadata_file, encoding="utf-8") as json_file:
+    metadata = json.load(json_file)
+
+base_gtid_executed = metadata["incremental"]["baseGtidExecuted"]
+
+if base_gtid_executed:
+    metadata["incremental"]["baseGtidExecuted"] = "00000000-0000-0000-0000-000000000001:1-10"
+    with open(metadata_file, "w", encoding="utf-8") as json_file:
+        json.dump(metadata, json_file)
+    EXPECT_THROWS(lambda: util.load_dump(test_output_absolute, { "dryRun": True, "showProgress": False, "resetProgress": True }), "Error: Shell Error (53029): Util.load_dump: The incremental dump can only be loaded into an instance which contains its base dump")
+    metadata["incremental"]["baseGtidExecuted"] = base_gtid_executed
+    with open(metadata_file, "w", encoding="utf-8") as json_file:
+        json.dump(metadata, json_file)
+
+#@<> incremental dump - load the base and the incremental dump
+expected_checksums = { table: md5_table(session, incremental_schema, table) for table in [ "unchanged", "modified", "altered", "added" ] }
+session.run_sql("DROP SCHEMA !", [incremental_schema])
+
+util.load_dump(incremental_base_output, { "showProgress": False, "resetProgress": True })
+
+WIPE_STDOUT()
+util.load_dump(test_output_absolute, { "showProgress": False, "resetProgress": True })
+EXPECT_STDOUT_CONTAINS("2 objects were dropped.")
+
+for table, checksum in expected_checksums.items():
+    EXPECT_EQ(checksum, md5_table(session, incremental_schema, table))
+
+EXPECT_EQ(0, session.run_sql("SELECT COUNT(*) FROM information_schema.tables WHERE table_schema = ? AND table_name LIKE 'removed%'", [incremental_schema]).fetch_one()[0])
+
+#@<> incremental dump - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !", [incremental_schema])
+shutil.rmtree(incremental_base_output, True)
+
 #@<> Cleanup
 drop_all_schemas()
 session.run_sql("SET GLOBAL local_infile = false;")
@@ -57,11 +57,11 @@ crud.execute()
 //@ third execution after lockExclusive(), uses prepared statement
 crud.execute()
 
-//@ creates statement to test lockShared()
+//@ new operation with the same statement uses the prepared one, to test lockShared()
 var crud = collection.find();
 crud.execute();
 
-//@ prepares statement to test lockShared()
+//@ second execution of the new operation uses the prepared one, to test lockShared()
 crud.execute();
 
 //@ lockShared() changes statement, back to normal execution
@@ -95,13 +95,9 @@
 3 documents in set ([[*]] sec)
 
 //@<PROTOCOL> fields() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+//@<PROTOCOL> fields() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -238,13 +234,6 @@
 3 documents in set ([[*]] sec)
 
 //@<PROTOCOL> sort() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -404,13 +393,6 @@
 3 documents in set ([[*]] sec)
 
 //@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -631,13 +613,6 @@
 2 documents in set ([[*]] sec)
 
 //@<PROTOCOL> lockExclusive() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -830,16 +805,12 @@
 }
 2 documents in set ([[*]] sec)
 
-//@<PROTOCOL> creates statement to test lockShared()
->>>> SEND Mysqlx.Crud.Find {
-  collection {
-    name: "test_collection"
-    schema: "prepared_stmt"
-  }
-  data_model: DOCUMENT
+//@<PROTOCOL> new operation with the same statement uses the prepared one, to test lockShared()
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
 }
 
-//@<OUT> creates statement to test lockShared()
+//@<OUT> new operation with the same statement uses the prepared one, to test lockShared()
 {
     "_id": "001",
     "age": 18,
@@ -857,29 +828,12 @@
 }
 3 documents in set ([[*]] sec)
 
-//@<PROTOCOL> prepares statement to test lockShared()
->>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 6
-  stmt {
-    type: FIND
-    find {
-      collection {
-        name: "test_collection"
-        schema: "prepared_stmt"
-      }
-      data_model: DOCUMENT
-    }
-  }
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
+//@<PROTOCOL> second execution of the new operation uses the prepared one, to test lockShared()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 1
 }
 
-//@<OUT> prepares statement to test lockShared()
+//@<OUT> second execution of the new operation uses the prepared one, to test lockShared()
 {
     "_id": "001",
     "age": 18,
@@ -898,13 +852,6 @@
 3 documents in set ([[*]] sec)
 
 //@<PROTOCOL> lockShared() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 6
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -937,7 +884,7 @@
 
 //@<PROTOCOL> second execution after lockShared(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 7
+  stmt_id: 6
   stmt {
     type: FIND
     find {
@@ -955,7 +902,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 //@<OUT> second execution after lockShared(), prepares statement and executes it
@@ -981,7 +928,7 @@
 
 //@<PROTOCOL> third execution after lockShared(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 //@<OUT> third execution after lockShared(), uses prepared statement
@@ -1065,7 +1012,7 @@
 
 //@<PROTOCOL> prepares statement with aggregate function to test having()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 8
+  stmt_id: 7
   stmt {
     type: FIND
     find {
@@ -1123,7 +1070,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 8
+  stmt_id: 7
 }
 
 //@<OUT> prepares statement with aggregate function to test having()
@@ -1138,13 +1085,6 @@
 2 documents in set ([[*]] sec)
 
 //@<PROTOCOL> having() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 8
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -1237,7 +1177,7 @@
 
 //@<PROTOCOL> second execution after having(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 9
+  stmt_id: 8
   stmt {
     type: FIND
     find {
@@ -1325,7 +1265,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 //@<OUT> second execution after having(), prepares statement and executes it
@@ -1340,7 +1280,7 @@
 
 //@<PROTOCOL> third execution after having(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 //@<OUT> third execution after having(), uses prepared statement
@@ -1409,7 +1349,7 @@
 
 //@<PROTOCOL> prepares statement to test no changes when reusing bind(), limit() and offset()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 10
+  stmt_id: 9
   stmt {
     type: FIND
     find {
@@ -1455,7 +1395,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1505,7 +1445,7 @@
 
 //@<PROTOCOL> Reusing statement with bind() using g%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1544,7 +1484,7 @@
 
 //@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1583,7 +1523,7 @@
 
 //@<PROTOCOL> Reusing statement with bind() using l%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1622,7 +1562,7 @@
 
 //@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1661,7 +1601,7 @@
 
 //@<PROTOCOL> Reusing statement with new offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1700,7 +1640,7 @@
 
 //@<PROTOCOL> Reusing statement with new limit() and offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -124,13 +124,9 @@ Rows matched: 3  Changed: 3  Warnings: 0
 3 rows in set ([[*]] sec)
 
 //@<PROTOCOL> set() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+//@<PROTOCOL> set() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_table"
@@ -384,13 +380,6 @@ Rows matched: 3  Changed: 3  Warnings: 0
 3 rows in set ([[*]] sec)
 
 //@<PROTOCOL> where() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_table"
@@ -686,13 +675,6 @@ Rows matched: 1  Changed: 1  Warnings: 0
 3 rows in set ([[*]] sec)
 
 //@<PROTOCOL> orderBy() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_table"
@@ -1006,13 +988,6 @@ Rows matched: 1  Changed: 1  Warnings: 0
 3 rows in set ([[*]] sec)
 
 //@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_table"
@@ -58,11 +58,11 @@ crud.execute()
 #@ third execution after lock_exclusive(), uses prepared statement
 crud.execute()
 
-#@ creates statement to test lock_shared()
+#@ new operation with the same statement uses the prepared one, to test lock_shared()
 crud = table.select();
 crud.execute();
 
-#@ prepares statement to test lock_shared()
+#@ second execution of the new operation uses the prepared one, to test lock_shared()
 crud.execute();
 
 #@ lock_shared() changes statement, back to normal execution
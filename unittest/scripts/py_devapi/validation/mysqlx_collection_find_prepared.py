@@ -95,13 +95,9 @@
 3 documents in set ([[*]] sec)
 
 #@<PROTOCOL> fields() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+#@<PROTOCOL> fields() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -238,13 +234,6 @@
 3 documents in set ([[*]] sec)
 
 #@<PROTOCOL> sort() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -404,13 +393,6 @@
 3 documents in set ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -630,13 +612,6 @@
 2 documents in set ([[*]] sec)
 
 #@<PROTOCOL> lock_exclusive() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -829,16 +804,12 @@
 }
 2 documents in set ([[*]] sec)
 
-#@<PROTOCOL> creates statement to test lock_shared()
->>>> SEND Mysqlx.Crud.Find {
-  collection {
-    name: "test_collection"
-    schema: "prepared_stmt"
-  }
-  data_model: DOCUMENT
+#@<PROTOCOL> new operation with the same statement uses the prepared one, to test lock_shared()
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
 }
 
-#@<OUT> creates statement to test lock_shared()
+#@<OUT> new operation with the same statement uses the prepared one, to test lock_shared()
 {
     "_id": "001",
     "age": 18,
@@ -856,29 +827,12 @@
 }
 3 documents in set ([[*]] sec)
 
-#@<PROTOCOL> prepares statement to test lock_shared()
->>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 6
-  stmt {
-    type: FIND
-    find {
-      collection {
-        name: "test_collection"
-        schema: "prepared_stmt"
-      }
-      data_model: DOCUMENT
-    }
-  }
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
+#@<PROTOCOL> second execution of the new operation uses the prepared one, to test lock_shared()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 1
 }
 
-#@<OUT> prepares statement to test lock_shared()
+#@<OUT> second execution of the new operation uses the prepared one, to test lock_shared()
 {
     "_id": "001",
     "age": 18,
@@ -897,13 +851,6 @@
 3 documents in set ([[*]] sec)
 
 #@<PROTOCOL> lock_shared() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 6
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -936,7 +883,7 @@
 
 #@<PROTOCOL> second execution after lock_shared(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 7
+  stmt_id: 6
   stmt {
     type: FIND
     find {
@@ -954,7 +901,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 #@<OUT> second execution after lock_shared(), prepares statement and executes it
@@ -980,7 +927,7 @@
 
 #@<PROTOCOL> third execution after lock_shared(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 #@<OUT> third execution after lock_shared(), uses prepared statement
@@ -1064,7 +1011,7 @@
 
 #@<PROTOCOL> prepares statement with aggregate function to test having()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 8
+  stmt_id: 7
   stmt {
     type: FIND
     find {
@@ -1122,7 +1069,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 8
+  stmt_id: 7
 }
 
 #@<OUT> prepares statement with aggregate function to test having()
@@ -1137,13 +1084,6 @@
 2 documents in set ([[*]] sec)
 
 #@<PROTOCOL> having() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 8
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_collection"
@@ -1236,7 +1176,7 @@
 
 #@<PROTOCOL> second execution after having(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 9
+  stmt_id: 8
   stmt {
     type: FIND
     find {
@@ -1324,7 +1264,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 #@<OUT> second execution after having(), prepares statement and executes it
@@ -1339,7 +1279,7 @@
 
 #@<PROTOCOL> third execution after having(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 #@<OUT> third execution after having(), uses prepared statement
@@ -1408,7 +1348,7 @@
 
 #@<PROTOCOL> prepares statement to test no changes when reusing bind(), limit() and offset()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 10
+  stmt_id: 9
   stmt {
     type: FIND
     find {
@@ -1454,7 +1394,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1504,7 +1444,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using g%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1543,7 +1483,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1582,7 +1522,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using l%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1621,7 +1561,7 @@
 
 #@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1660,7 +1600,7 @@
 
 #@<PROTOCOL> Reusing statement with new offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1699,7 +1639,7 @@
 
 #@<PROTOCOL> Reusing statement with new limit() and offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
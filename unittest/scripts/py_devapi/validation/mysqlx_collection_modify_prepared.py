@@ -162,13 +162,9 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> set() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+#@<PROTOCOL> set() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -377,13 +373,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> unset() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -601,13 +590,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> patch() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -1041,13 +1023,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> array_insert() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -1534,13 +1509,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> array_append() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 5
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -2072,13 +2040,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> sort() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 6
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -2634,13 +2595,6 @@ Query OK, 3 items affected ([[*]] sec)
 Rows matched: 3  Changed: 3  Warnings: 0
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 7
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Update {
   collection {
     name: "test_collection"
@@ -128,13 +128,9 @@ Query OK, 1 item affected ([[*]] sec)
 Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> sort() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+#@<PROTOCOL> sort() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Delete {
   collection {
     name: "test_collection"
@@ -288,13 +284,6 @@ Query OK, 1 item affected ([[*]] sec)
 Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Delete {
   collection {
     name: "test_collection"
@@ -56,13 +56,9 @@ Query OK, 1 item affected ([[*]] sec)
 Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> where() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+#@<PROTOCOL> where() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Delete {
   collection {
     name: "test_table"
@@ -174,13 +170,6 @@ Query OK, 1 item affected ([[*]] sec)
 Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> order_by() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Delete {
   collection {
     name: "test_table"
@@ -310,13 +299,6 @@ Query OK, 1 item affected ([[*]] sec)
 Query OK, 1 item affected ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Delete {
   collection {
     name: "test_table"
@@ -65,13 +65,9 @@
 3 rows in set ([[*]] sec)
 
 #@<PROTOCOL> where() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 1
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
+~>>>> SEND Mysqlx.Prepare.Deallocate {
 
+#@<PROTOCOL> where() changes statement, back to normal execution
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -173,13 +169,6 @@
 2 rows in set ([[*]] sec)
 
 #@<PROTOCOL> order_by() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 2
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -299,13 +288,6 @@
 2 rows in set ([[*]] sec)
 
 #@<PROTOCOL> limit() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 3
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -493,13 +475,6 @@
 1 row in set ([[*]] sec)
 
 #@<PROTOCOL> lock_exclusive() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 4
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -660,16 +635,12 @@
 +----+--------+-----+
 1 row in set ([[*]] sec)
 
-#@<PROTOCOL> creates statement to test lock_shared()
->>>> SEND Mysqlx.Crud.Find {
-  collection {
-    name: "test_table"
-    schema: "prepared_stmt"
-  }
-  data_model: TABLE
+#@<PROTOCOL> new operation with the same statement uses the prepared one, to test lock_shared()
+>>>> SEND Mysqlx.Prepare.Execute {
+  stmt_id: 1
 }
 
-#@<OUT> creates statement to test lock_shared()
+#@<OUT> new operation with the same statement uses the prepared one, to test lock_shared()
 +----+--------+-----+
 | id | name   | age |
 +----+--------+-----+
@@ -679,29 +650,12 @@
 +----+--------+-----+
 3 rows in set ([[*]] sec)
 
-#@<PROTOCOL> prepares statement to test lock_shared()
->>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 6
-  stmt {
-    type: FIND
-    find {
-      collection {
-        name: "test_table"
-        schema: "prepared_stmt"
-      }
-      data_model: TABLE
-    }
-  }
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
+#@<PROTOCOL> second execution of the new operation uses the prepared one, to test lock_shared()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 6
+  stmt_id: 1
 }
 
-#@<OUT> prepares statement to test lock_shared()
+#@<OUT> second execution of the new operation uses the prepared one, to test lock_shared()
 +----+--------+-----+
 | id | name   | age |
 +----+--------+-----+
@@ -712,13 +666,6 @@
 3 rows in set ([[*]] sec)
 
 #@<PROTOCOL> lock_shared() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 6
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -740,7 +687,7 @@
 
 #@<PROTOCOL> second execution after lock_shared(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 7
+  stmt_id: 6
   stmt {
     type: FIND
     find {
@@ -758,7 +705,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 #@<OUT> second execution after lock_shared(), prepares statement and executes it
@@ -773,7 +720,7 @@
 
 #@<PROTOCOL> third execution after lock_shared(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 7
+  stmt_id: 6
 }
 
 #@<OUT> third execution after lock_shared(), uses prepared statement
@@ -837,7 +784,7 @@
 
 #@<PROTOCOL> prepares statement with aggregate function to test having()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 8
+  stmt_id: 7
   stmt {
     type: FIND
     find {
@@ -885,7 +832,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 8
+  stmt_id: 7
 }
 
 #@<OUT> prepares statement with aggregate function to test having()
@@ -898,13 +845,6 @@
 2 rows in set ([[*]] sec)
 
 #@<PROTOCOL> having() changes statement, back to normal execution
->>>> SEND Mysqlx.Prepare.Deallocate {
-  stmt_id: 8
-}
-
-<<<< RECEIVE Mysqlx.Ok {
-}
-
 >>>> SEND Mysqlx.Crud.Find {
   collection {
     name: "test_table"
@@ -973,7 +913,7 @@
 
 #@<PROTOCOL> second execution after having(), prepares statement and executes it
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 9
+  stmt_id: 8
   stmt {
     type: FIND
     find {
@@ -1040,7 +980,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 #@<OUT> second execution after having(), prepares statement and executes it
@@ -1053,7 +993,7 @@
 
 #@<PROTOCOL> third execution after having(), uses prepared statement
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 9
+  stmt_id: 8
 }
 
 #@<OUT> third execution after having(), uses prepared statement
@@ -1111,7 +1051,7 @@
 
 #@<PROTOCOL> prepares statement to test no changes when reusing bind(), limit() and offset()
 >>>> SEND Mysqlx.Prepare.Prepare {
-  stmt_id: 10
+  stmt_id: 9
   stmt {
     type: FIND
     find {
@@ -1154,7 +1094,7 @@
 }
 
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1192,7 +1132,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using g%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1228,7 +1168,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using j%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1264,7 +1204,7 @@
 
 #@<PROTOCOL> Reusing statement with bind() using l%
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1300,7 +1240,7 @@
 
 #@<PROTOCOL> Reusing statement with new limit()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1336,7 +1276,7 @@
 
 #@<PROTOCOL> Reusing statement with new offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
@@ -1372,7 +1312,7 @@
 
 #@<PROTOCOL> Reusing statement with new limit() and offset()
 >>>> SEND Mysqlx.Prepare.Execute {
-  stmt_id: 10
+  stmt_id: 9
   args {
     type: SCALAR
     scalar {
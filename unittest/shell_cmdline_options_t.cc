@@ -147,6 +147,8 @@ class Shell_cmdline_options : public tests::Shell_base_test {
       return options->result_format;
     else if (option == "wrap_json")
       return options->wrap_json;
+    else if (option == "wrap_json_rows")
+      return AS__STRING(options->wrap_json_rows);
     else if (option == "session_type" || option == "session-type")
       return options->connection_options().has_scheme()
                  ? options->connection_options().get_scheme()
@@ -182,6 +184,8 @@ class Shell_cmdline_options : public tests::Shell_base_test {
       return AS__STRING(static_cast<int>(options->quiet_start));
     else if (option == "showColumnTypeInfo")
       return AS__STRING(options->show_column_type_info);
+    else if (option == "startup-profile")
+      return AS__STRING(options->startup_profile);
     else if (option == "compress")
       return options->connection_options().get_compression();
     else if (option == "mysqlPluginDir")
@@ -801,6 +805,7 @@ TEST_F(Shell_cmdline_options, default_values) {
       options.connection_options().has(mysqlshdk::db::kConnectTimeout));
   EXPECT_EQ(Shell_options::Quiet_start::NOT_SET, options.quiet_start);
   EXPECT_FALSE(options.show_column_type_info);
+  EXPECT_FALSE(options.startup_profile);
   EXPECT_TRUE(!options.connection_options().has_compression());
   EXPECT_FALSE(options.default_compress);
   EXPECT_TRUE(!options.connection_options().has_compression_algorithms());
@@ -931,6 +936,11 @@ TEST_F(Shell_cmdline_options, app) {
   test_option_equal_value("json", "pretty", false, "wrap_json", "json");
   test_option_equal_value("json", "raw", false, "wrap_json", "json/raw");
   test_option_equal_value("json", "off", false, "wrap_json", "off");
+  test_option_equal_value("json", "ndjson", false, "wrap_json", "json/raw");
+  test_option_equal_value("json", "ndjson", false, "wrap_json_rows", "1");
+  test_option_equal_value("json", "raw", false, "wrap_json_rows", "0");
+  // ndjson does not override the result format
+  test_option_equal_value("json", "ndjson", false, "result_format", "table");
 
   test_option_with_no_value("--trace-proto", "trace_protocol", "1");
   test_option_with_no_value("--force", "force", "1");
@@ -942,6 +952,7 @@ TEST_F(Shell_cmdline_options, app) {
   test_option_with_value("quiet-start", "", "2", "1", !IS_CONNECTION_DATA,
                          IS_NULLABLE, "quiet-start", "2");
   test_option_with_no_value("--column-type-info", "showColumnTypeInfo", "1");
+  test_option_with_no_value("--startup-profile", "startup-profile", "1");
   test_option_with_value("interactive", "", "full", "1", !IS_CONNECTION_DATA,
                          IS_NULLABLE, "interactive", "1");
   // test_option_with_value("interactive", "", "full", "1", !IS_CONNECTION_DATA,
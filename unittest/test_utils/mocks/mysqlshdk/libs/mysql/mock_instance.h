@@ -77,6 +77,11 @@ class Mock_instance : public mysqlshdk::mysql::IInstance {
                                       const Var_qualifier));
   MOCK_CONST_METHOD2(set_sysvar_default,
                      void(const std::string &, const Var_qualifier));
+  MOCK_CONST_METHOD1(set_sysvars,
+                     void(const std::vector<Sysvar_assignment> &));
+  MOCK_CONST_METHOD2(prefetch_sysvars, void(const std::vector<std::string> &,
+                                            const Var_qualifier));
+  MOCK_CONST_METHOD0(clear_sysvars_cache, void());
   MOCK_CONST_METHOD1(has_variable_compiled_value, bool(const std::string &));
   MOCK_CONST_METHOD0(is_performance_schema_enabled, bool());
   MOCK_CONST_METHOD0(is_ssl_enabled, bool());
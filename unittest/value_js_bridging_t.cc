@@ -37,6 +37,9 @@
 #include "scripting/types.h"
 #include "scripting/types_cpp.h"
 #include "test_utils.h"
+#include "utils/utils_file.h"
+#include "utils/utils_general.h"
+#include "utils/utils_path.h"
 #include "utils/utils_string.h"
 
 using namespace std::placeholders;
@@ -542,5 +545,58 @@ TEST_F(JavaScript, js_date_object) {
   ASSERT_TRUE(object.as_object()->class_name() == "Date");
   ASSERT_EQ("\"2014-01-01 00:00:00\"", object.repr());
 }
+
+class JavaScript_snapshot : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    shcore::JScript_context_init();
+    m_path = shcore::path::join_path(getenv("TMPDIR"), "js_snapshot.bin");
+  }
+
+  void TearDown() override {
+    // subsequent contexts are initialized from scratch
+    JScript_context::load_snapshot("");
+    shcore::delete_file(m_path);
+  }
+
+  std::string m_path;
+};
+
+TEST_F(JavaScript_snapshot, create_and_load) {
+  JScript_context::create_snapshot(m_path);
+  ASSERT_TRUE(JScript_context::load_snapshot(m_path));
+
+  Environment env;
+
+  EXPECT_EQ("function", env.js->execute("typeof require").first.descr(false));
+  EXPECT_EQ("function", env.js->execute("typeof dir").first.descr(false));
+  EXPECT_EQ("\"hello world\"",
+            env.js->execute("repr(unrepr(repr(\"hello world\")))")
+                .first.descr(false));
+  // list of native modules is not stored in the snapshot
+  EXPECT_EQ("null",
+            env.js->execute("String(require.__mh.constructor.__native_modules)")
+                .first.descr(false));
+}
+
+TEST_F(JavaScript_snapshot, invalid_snapshot) {
+  ASSERT_TRUE(shcore::create_file(m_path, "invalid", true));
+  EXPECT_FALSE(JScript_context::load_snapshot(m_path));
+
+  // context is initialized from scratch
+  Environment env;
+
+  EXPECT_EQ("function", env.js->execute("typeof require").first.descr(false));
+}
+
+TEST_F(JavaScript_snapshot, missing_snapshot) {
+  EXPECT_FALSE(JScript_context::load_snapshot(m_path));
+  EXPECT_FALSE(JScript_context::load_snapshot(""));
+
+  Environment env;
+
+  EXPECT_EQ("function", env.js->execute("typeof require").first.descr(false));
+}
+
 }  // namespace tests
 }  // namespace shcore